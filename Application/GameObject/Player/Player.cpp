@@ -15,6 +15,7 @@
 #include "application/GameObject/Enemy/Enemy.h"
 #include "numbers"
 #include <Application/Utility/MotionEditor/MotionEditor.h>
+#include <Data/JsonHotReloader.h>
 #include <Input.h>
 #include <cmath>
 
@@ -22,6 +23,9 @@ Player::Player() {
 }
 
 Player::~Player() {
+    if (JsonHotReloader *hotReloader = JsonHotReloader::TryGetInstance()) {
+        hotReloader->Unwatch(this);
+    }
 }
 
 void Player::Init(const std::string objectName) {
@@ -40,6 +44,7 @@ void Player::Init(const std::string objectName) {
     isGrounded_ = true; // 初期状態は地面にいる
 
     data_ = std::make_unique<DataHandler>("EntityData", "Player");
+    JsonHotReloader::GetInstance()->Watch(data_->GetFilePath(), this, [this]() { Load(); });
     shadow_ = std::make_unique<BaseObject>();
     shadow_->Init("shadow");
     shadow_->CreatePrimitiveModel(PrimitiveType::Plane);
@@ -61,6 +66,11 @@ void Player::Init(const std::string objectName) {
     this->AddChild(leftHand_.get());
     this->AddChild(rightHand_.get());
 
+    // 移動・弾・衝突をフレームレートに依存させないため固定ステップで更新する
+    SetUseFixedTimeStep(true);
+    leftHand_->SetUseFixedTimeStep(true);
+    rightHand_->SetUseFixedTimeStep(true);
+
     MotionEditor::GetInstance()->Register(leftHand_.get());
     MotionEditor::GetInstance()->Register(rightHand_.get());
 
@@ -2,7 +2,6 @@
 #include "Engine/Utility/Scene/SceneManager.h"
 void ClearScene::Initialize() {
     audio_ = Audio::GetInstance();
-    spCommon_ = SpriteCommon::GetInstance();
     ptCommon_ = ParticleCommon::GetInstance();
     input_ = Input::GetInstance();
     vp_.Initialize();
@@ -37,11 +36,11 @@ void ClearScene::Update() {
 void ClearScene::Draw() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
+    SpriteBatch::GetInstance()->Begin();
     clearLogo_->Draw();
     titleButton_->Draw();
+    SpriteBatch::GetInstance()->End();
     //------------------------
 
     /// -------描画処理終了-------
@@ -50,8 +49,6 @@ void ClearScene::Draw() {
 void ClearScene::DrawForOffScreen() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------
@@ -1,8 +1,8 @@
 #include "DemoScene.h"
+#include "Particle/ParticleSystem.h"
 
 void DemoScene::Initialize() {
     audio_ = Audio::GetInstance();
-    spCommon_ = SpriteCommon::GetInstance();
     ptCommon_ = ParticleCommon::GetInstance();
     input_ = Input::GetInstance();
     vp_.Initialize();
@@ -29,13 +29,12 @@ void DemoScene::Update() {
 void DemoScene::Draw() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------------
 
     ptEditor_->DrawAll(vp_);
+    ParticleSystem::GetInstance()->Draw();
 
     /// ----------------------------------
 
@@ -45,8 +44,6 @@ void DemoScene::Draw() {
 void DemoScene::DrawForOffScreen() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------
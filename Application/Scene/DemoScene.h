@@ -41,7 +41,6 @@ class DemoScene : public BaseScene {
 
     Audio *audio_;
     Input *input_;
-    SpriteCommon *spCommon_;
     ParticleCommon *ptCommon_;
     ParticleEditor *ptEditor_;
 
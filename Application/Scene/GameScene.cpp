@@ -1,10 +1,11 @@
 #include "GameScene.h"
 
 #include "Engine/Utility/Scene/SceneManager.h"
+#include "Particle/ParticleSystem.h"
+#include "SpriteBatch.h"
 #include <Application/Utility/MotionEditor/MotionEditor.h>
 void GameScene::Initialize() {
     audio_ = Audio::GetInstance();
-    spCommon_ = SpriteCommon::GetInstance();
     ptCommon_ = ParticleCommon::GetInstance();
     input_ = Input::GetInstance();
     vp_.Initialize();
@@ -83,8 +84,10 @@ void GameScene::Update() {
 
 void GameScene::Draw() {
     /// -------描画処理開始-------
+    SpriteBatch::GetInstance()->Begin();
     playerUI_->Draw();
     enemyUI_->Draw();
+    SpriteBatch::GetInstance()->End();
 
     skyBox_->Draw(vp_);
 
@@ -99,10 +102,9 @@ void GameScene::Draw() {
     //------Particleの描画開始-------
     enemy_ptr->DrawParticle(vp_);
     player_ptr->DrawParticle(vp_);
+    ParticleSystem::GetInstance()->Draw();
     //-----------------------------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     /// -------描画処理終了-------
@@ -111,8 +113,6 @@ void GameScene::Draw() {
 void GameScene::DrawForOffScreen() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------
@@ -50,7 +50,6 @@ class GameScene : public BaseScene {
 
     Audio *audio_;
     Input *input_;
-    SpriteCommon *spCommon_;
     ParticleCommon *ptCommon_;
 
     ViewProjection vp_;
@@ -2,7 +2,6 @@
 
 void SelectScene::Initialize() {
     audio_ = Audio::GetInstance();
-    spCommon_ = SpriteCommon::GetInstance();
     ptCommon_ = ParticleCommon::GetInstance();
     input_ = Input::GetInstance();
     vp_.Initialize();
@@ -27,8 +26,6 @@ void SelectScene::Update() {
 void SelectScene::Draw() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------
@@ -39,8 +36,6 @@ void SelectScene::Draw() {
 void SelectScene::DrawForOffScreen() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------
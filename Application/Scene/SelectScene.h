@@ -41,7 +41,6 @@ class SelectScene : public BaseScene {
 
     Audio *audio_;
     Input *input_;
-    SpriteCommon *spCommon_;
     ParticleCommon *ptCommon_;
 
     ViewProjection vp_;
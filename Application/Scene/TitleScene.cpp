@@ -3,7 +3,6 @@
 #include <Frame.h>
 void TitleScene::Initialize() {
     audio_ = Audio::GetInstance();
-    spCommon_ = SpriteCommon::GetInstance();
     ptCommon_ = ParticleCommon::GetInstance();
     input_ = Input::GetInstance();
     vp_.Initialize();
@@ -39,8 +38,11 @@ void TitleScene::Update() {
 
 void TitleScene::Draw() {
     /// -------描画処理開始-------
+    SpriteBatch::GetInstance()->Begin();
     titleLogo_->Draw();
     startButton_->Draw();
+    SpriteBatch::GetInstance()->End();
+
     skyBox_->Draw(vp_);
 
     BaseObjectManager::GetInstance()->Draw(vp_);
@@ -51,8 +53,6 @@ void TitleScene::Draw() {
 void TitleScene::DrawForOffScreen() {
     /// -------描画処理開始-------
 
-    /// Spriteの描画準備
-    spCommon_->DrawCommonSetting();
     //-----Spriteの描画開始-----
 
     //------------------------
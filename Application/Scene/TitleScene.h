@@ -46,7 +46,6 @@ class TitleScene : public BaseScene {
 
     Audio *audio_;
     Input *input_;
-    SpriteCommon *spCommon_;
     ParticleCommon *ptCommon_;
 
     ViewProjection vp_;
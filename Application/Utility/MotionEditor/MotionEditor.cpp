@@ -3,6 +3,7 @@
 #include "imgui.h"
 #endif // _DEBUG
 #include "myMath.h"
+#include <Data/JsonHotReloader.h>
 #include <Line/DrawLine3D.h>
 
 MotionEditor *MotionEditor::instance = nullptr;
@@ -82,6 +83,9 @@ MotionEditor *MotionEditor::GetInstance() {
 }
 
 void MotionEditor::Finalize() {
+    if (JsonHotReloader *hotReloader = JsonHotReloader::TryGetInstance()) {
+        hotReloader->Unwatch(this);
+    }
     delete instance;
     instance = nullptr;
 }
@@ -416,6 +420,7 @@ bool MotionEditor::PlayFromFile(BaseObject *target, const std::string &fileName,
     motion.objectName = tempName;
     motion.isTemporary = true;
     motion.returnToOriginal = returnToOriginal;
+    motion.sourceFileName = fileName;
     motion.totalTime = data.Load<float>("totalTime", 1.0f);
     motion.colliderOnTime = data.Load("colliderOnTime", 0.3f);
     motion.colliderOffTime = data.Load("colliderOffTime", 0.6f);
@@ -454,9 +459,38 @@ bool MotionEditor::PlayFromFile(BaseObject *target, const std::string &fileName,
     motion.currentTime = 0.0f;
     motion.status = MotionStatus::Playing;
 
+    JsonHotReloader::GetInstance()->Watch(data.GetFilePath(), this, [this, fileName]() { ReloadMotionFile(fileName); });
+
     return true;
 }
 
+void MotionEditor::ReloadMotionFile(const std::string &fileName) {
+    Motion loaded = Load(fileName);
+    for (auto &[name, motion] : motions_) {
+        if (motion.sourceFileName != fileName) {
+            continue;
+        }
+        // 再生状態と基準トランスフォームは保ったままパラメータだけ差し替える
+        motion.totalTime = loaded.totalTime;
+        motion.colliderOnTime = loaded.colliderOnTime;
+        motion.colliderOffTime = loaded.colliderOffTime;
+        motion.startPosOffset = loaded.startPosOffset;
+        motion.endPosOffset = loaded.endPosOffset;
+        motion.startRotOffset = loaded.startRotOffset;
+        motion.endRotOffset = loaded.endRotOffset;
+        motion.startScaleOffset = loaded.startScaleOffset;
+        motion.endScaleOffset = loaded.endScaleOffset;
+        motion.easingType = loaded.easingType;
+        motion.useCatmullRom = loaded.useCatmullRom;
+        motion.controlPoints = loaded.controlPoints;
+
+        motion.actualStartRot = Quaternion::FromEulerAngles(motion.baseRot + motion.startRotOffset);
+        motion.actualEndRot = Quaternion::FromEulerAngles(motion.baseRot + motion.endRotOffset);
+        motion.actualStartScale = motion.baseScale + motion.startScaleOffset;
+        motion.actualEndScale = motion.baseScale + motion.endScaleOffset;
+    }
+}
+
 
 void MotionEditor::SetComboStartPosition(BaseObject *target) {
     if (!target)
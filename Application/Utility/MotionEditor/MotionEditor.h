@@ -72,6 +72,7 @@ struct Motion {
     float colliderOffTime = 0.6f;
 
     bool isTemporary = false;
+    std::string sourceFileName; // PlayFromFileで読み込んだファイル名
 
     bool returnToOriginal = false;
 
@@ -166,6 +167,9 @@ class MotionEditor {
     // 一時モーションのクリーンアップ
     void CleanupFinishedTemporaryMotions();
 
+    // JSONが外部で書き換えられたとき、そのファイルから作ったモーションに反映
+    void ReloadMotionFile(const std::string &fileName);
+
     // 親子関係対応のヘルパー関数
     Matrix4x4 GetParentInverseWorldMatrix(BaseObject *object);
     Vector3 GetLocalControlPointPosition(BaseObject *object, const Vector3 &worldPos);
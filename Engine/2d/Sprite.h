@@ -7,7 +7,8 @@
 #include"wrl.h"
 #include"string"
 #include <Graphics/Srv/SrvManager.h>
-class SpriteCommon;
+#include "SpriteAtlas.h"
+#include "SpriteBatch.h"
 class Sprite
 {
 public: // メンバ関数
@@ -35,7 +36,7 @@ public: // メンバ関数
 	const Vector2& GetPosition()const { return position_; }
 	float GetRotation() const { return rotation; }
 	const Vector2& GetSize() const { return size; }
-	const Vector4& GetColor()const { return materialData->color; }
+	const Vector4& GetColor()const { return color_; }
 	const Vector2& GetAnchorPoint()const { return anchorPoint_; }
 	const bool GetFlipX()const { return isFlipX_; }
 	const bool GetFilpY()const { return isFlipY_; }
@@ -49,37 +50,30 @@ public: // メンバ関数
 	void SetPosition(const Vector2& position) { this->position_ = position; }
 	void SetRotation(float rotation) { this->rotation = rotation; }
 	void SetSize(const Vector2& size) { this->size = size; }
-	void SetColor(const Vector3& color) { materialData->color.x = color.x, materialData->color.y = color.y, materialData->color.z = color.z; }
-	void SetAlpha(const float& alpha) { materialData->color.w = alpha; }
+	void SetColor(const Vector3& color) { color_.x = color.x, color_.y = color.y, color_.z = color.z; }
+	void SetAlpha(const float& alpha) { color_.w = alpha; }
 	void SetTexturePath(std::string textureFilePath);
 	void SetAnchorPoint(const Vector2& anchorPoint) { this->anchorPoint_ = anchorPoint; }
 	void SetFlipX(bool isFlipX) { isFlipX_ = isFlipX; }
 	void SetFlipY(bool isFlipY) { isFlipY_ = isFlipY; }
 	void SetTexLeftTop(const Vector2& textureLeftTop) { this->textureLeftTop = textureLeftTop; }
 	void SetTexSize(const Vector2& textureSize) { this->textureSize = textureSize; }
-	void SetUVTransform(const Matrix4x4& uvTransform) { materialData->uvTransform = uvTransform; }
-
-private: // メンバ関数
-
-	/// <summary>
-	/// 更新
-	/// </summary>
-	void Update(bool isbackmost_);
+	void SetUVTransform(const Matrix4x4& uvTransform) { uvTransform_ = uvTransform; }
+	void SetBlendMode(BlendMode blendMode) { blendMode_ = blendMode; }
+	void SetLayer(int32_t layer) { layer_ = layer; }
 
 	/// <summary>
-	/// 頂点データ作成
+	/// アトラスの切り出し範囲を使う（テクスチャもアトラスのものにする）
 	/// </summary>
-	void CreateVartexData();
+	/// <param name="isAdjustSize">表示サイズを切り出し範囲の大きさに合わせるか</param>
+	void SetAtlasRegion(const SpriteAtlas& atlas, const std::string& regionName, bool isAdjustSize = true);
 
-	/// <summary>
-	/// マテリアルデータ作成
-	/// </summary>
-	void CreateMaterial();
+private: // メンバ関数
 
 	/// <summary>
-	/// 座標変換行列データ作成
+	/// 描画する四角形の作成
 	/// </summary>
-	void CreateTransformationMatrix();
+	SpriteQuad MakeQuad(bool isBackMost) const;
 
 	/// <summary>
 	/// テクスチャサイズをイメージに合わせる
@@ -87,53 +81,11 @@ private: // メンバ関数
 	void AdjustTextureSize();
 private:
 
-	struct Transform {
-		Vector3 scale;
-		Vector3 rotate;
-		Vector3 translate;
-	};
-
-	// 頂点データ
-	struct VertexData {
-		Vector4 position;
-		Vector2 texcoord;
-	};
-
-	// マテリアルデータ
-	struct Material {
-		Vector4 color;
-		Matrix4x4 uvTransform;
-		float padding[3];
-	};
-
-	// 座標変換行列データ
-	struct TransformationMatrix {
-		Matrix4x4 WVP;
-		Matrix4x4 World;
-	};
-
-	SpriteCommon* spriteCommon_ = nullptr;
-	SrvManager* srvManager_ = nullptr;
-
-	// バッファリソース
-	Microsoft::WRL::ComPtr<ID3D12Resource> vertexResource = nullptr;
-	Microsoft::WRL::ComPtr<ID3D12Resource> indexResource = nullptr;
-	// バッファリソース内のデータを指すポインタ
-	VertexData* vertexData = nullptr;
-	uint32_t* indexData = nullptr;
-	// バッファリソースの使い道を補足するバッファビュー
-	D3D12_VERTEX_BUFFER_VIEW vertexBufferView{};
-	D3D12_INDEX_BUFFER_VIEW indexBufferView{};
-
-	// バッファリソース
-	Microsoft::WRL::ComPtr<ID3D12Resource> materialResource = nullptr;
-	// バッファリソース内のデータを指すポインタ
-	Material* materialData = nullptr;
-
-	// バッファリソース
-	Microsoft::WRL::ComPtr<ID3D12Resource> transformationMatrixResource;
-	// バッファリソース内のデータを指すポインタ
-	TransformationMatrix* transformationMatrixData = nullptr;
+	// 頂点・定数バッファはSpriteBatchでまとめて持つので、ここでは描画に使う値だけを持つ
+	Vector4 color_ = { 1.0f,1.0f,1.0f,1.0f };
+	Matrix4x4 uvTransform_ = { 1.0f,0.0f,0.0f,0.0f, 0.0f,1.0f,0.0f,0.0f, 0.0f,0.0f,1.0f,0.0f, 0.0f,0.0f,0.0f,1.0f };
+	BlendMode blendMode_ = BlendMode::kNormal;
+	int32_t layer_ = 0;
 
 	// 移動させる用各SRT
 	Vector2 position_ = { 0.0f,0.0f };
@@ -150,8 +102,6 @@ private:
 	// 上下フリップ
 	bool isFlipY_ = false;
 
-	bool isbackmost_ = false;
-
 	// テクスチャ左上座標
 	Vector2 textureLeftTop = { 0.0f,0.0f };
 	// テクスチャ切り出しサイズ
@@ -0,0 +1,24 @@
+#include "SpriteAtlas.h"
+
+void SpriteAtlas::Initialize(const std::string &textureFilePath) {
+    textureFilePath_ = textureFilePath;
+    regions_.clear();
+}
+
+void SpriteAtlas::AddRegion(const std::string &name, const Vector2 &leftTop, const Vector2 &size) {
+    regions_[name] = {leftTop, size};
+}
+
+void SpriteAtlas::AddGrid(const std::string &prefix, const Vector2 &leftTop, const Vector2 &cellSize, uint32_t columns, uint32_t rows) {
+    for (uint32_t row = 0; row < rows; ++row) {
+        for (uint32_t column = 0; column < columns; ++column) {
+            Vector2 cellLeftTop = {leftTop.x + cellSize.x * column, leftTop.y + cellSize.y * row};
+            AddRegion(prefix + "_" + std::to_string(row * columns + column), cellLeftTop, cellSize);
+        }
+    }
+}
+
+const SpriteAtlas::Region *SpriteAtlas::FindRegion(const std::string &name) const {
+    auto it = regions_.find(name);
+    return it != regions_.end() ? &it->second : nullptr;
+}
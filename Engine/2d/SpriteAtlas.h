@@ -0,0 +1,49 @@
+#pragma once
+#include "type/Vector2.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/// <summary>
+/// 1枚のテクスチャに並べた複数の画像の切り出し範囲
+/// 同じアトラスのスプライトはテクスチャが同じになるので、SpriteBatchで1回の描画にまとまる
+/// </summary>
+class SpriteAtlas {
+public:
+	// 切り出し範囲（ピクセル）
+	struct Region {
+		Vector2 leftTop;
+		Vector2 size;
+	};
+
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	/// <param name="textureFilePath">アトラスのテクスチャ</param>
+	void Initialize(const std::string& textureFilePath);
+
+	/// <summary>
+	/// 名前を付けて切り出し範囲を登録する
+	/// </summary>
+	void AddRegion(const std::string& name, const Vector2& leftTop, const Vector2& size);
+
+	/// <summary>
+	/// 同じ大きさのマスを左上から横に並べて登録する（名前は prefix_0, prefix_1 ...）
+	/// </summary>
+	void AddGrid(const std::string& prefix, const Vector2& leftTop, const Vector2& cellSize, uint32_t columns, uint32_t rows);
+
+	/// <summary>
+	/// 切り出し範囲の取得（見つからなければnullptr）
+	/// </summary>
+	const Region* FindRegion(const std::string& name) const;
+
+	/// <summary>
+	/// getter
+	/// </summary>
+	const std::string& GetTextureFilePath() const { return textureFilePath_; }
+	size_t GetRegionCount() const { return regions_.size(); }
+
+private:
+	std::string textureFilePath_;
+	std::unordered_map<std::string, Region> regions_;
+};
@@ -0,0 +1,254 @@
+#include "SpriteBatch.h"
+#include "Engine/Frame/FrameStats.h"
+#include <Debug/Profiler/Profiler.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <myMath.h>
+
+void SpriteBatcher::GenerateQuad(const SpriteQuad &quad, const Matrix4x4 &projection, SpriteVertex *vertices) {
+    float left = 0.0f - quad.anchorPoint.x;
+    float right = 1.0f - quad.anchorPoint.x;
+    float top = 0.0f - quad.anchorPoint.y;
+    float bottom = 1.0f - quad.anchorPoint.y;
+
+    // 左右反転
+    if (quad.isFlipX) {
+        left = -left;
+        right = -right;
+    }
+    // 上下反転
+    if (quad.isFlipY) {
+        top = -top;
+        bottom = -bottom;
+    }
+
+    // 左下・左上・右下・右上
+    const Vector2 corners[kVerticesPerQuad] = {{left, bottom}, {left, top}, {right, bottom}, {right, top}};
+    const Vector2 texcoords[kVerticesPerQuad] = {
+        {quad.uvLeftTop.x, quad.uvRightBottom.y},
+        {quad.uvLeftTop.x, quad.uvLeftTop.y},
+        {quad.uvRightBottom.x, quad.uvRightBottom.y},
+        {quad.uvRightBottom.x, quad.uvLeftTop.y},
+    };
+
+    // 拡縮→Z軸回転→移動を頂点ごとに展開して、射影行列だけを掛ける
+    const float sinZ = std::sin(quad.rotation);
+    const float cosZ = std::cos(quad.rotation);
+    const Matrix4x4 &p = projection;
+    const Matrix4x4 &uv = quad.uvTransform;
+    for (uint32_t i = 0; i < kVerticesPerQuad; ++i) {
+        float x = corners[i].x * quad.size.x;
+        float y = corners[i].y * quad.size.y;
+        float worldX = x * cosZ - y * sinZ + quad.position.x;
+        float worldY = x * sinZ + y * cosZ + quad.position.y;
+        float worldZ = quad.depth;
+
+        SpriteVertex &vertex = vertices[i];
+        vertex.position.x = worldX * p.m[0][0] + worldY * p.m[1][0] + worldZ * p.m[2][0] + p.m[3][0];
+        vertex.position.y = worldX * p.m[0][1] + worldY * p.m[1][1] + worldZ * p.m[2][1] + p.m[3][1];
+        vertex.position.z = worldX * p.m[0][2] + worldY * p.m[1][2] + worldZ * p.m[2][2] + p.m[3][2];
+        vertex.position.w = worldX * p.m[0][3] + worldY * p.m[1][3] + worldZ * p.m[2][3] + p.m[3][3];
+
+        // ピクセルシェーダーで掛けていたuvTransformはここで済ませておく
+        float u = texcoords[i].x;
+        float v = texcoords[i].y;
+        vertex.texcoord.x = u * uv.m[0][0] + v * uv.m[1][0] + uv.m[3][0];
+        vertex.texcoord.y = u * uv.m[0][1] + v * uv.m[1][1] + uv.m[3][1];
+        vertex.color = quad.color;
+    }
+}
+
+void SpriteBatcher::Clear() {
+    quads_.clear();
+}
+
+void SpriteBatcher::Add(const SpriteQuad &quad) {
+    quads_.push_back(quad);
+}
+
+void SpriteBatcher::Build(const Matrix4x4 &projection) {
+    const uint32_t quadCount = static_cast<uint32_t>(quads_.size());
+    batchBuilds_.clear();
+    batches_.clear();
+
+    // 追加した順に頂点を作る（重なりの判定にも使う）
+    quadVertices_.resize(static_cast<size_t>(quadCount) * kVerticesPerQuad);
+    for (uint32_t i = 0; i < quadCount; ++i) {
+        GenerateQuad(quads_[i], projection, &quadVertices_[static_cast<size_t>(i) * kVerticesPerQuad]);
+    }
+
+    // レイヤーの順に並べる（同じレイヤーは追加した順）
+    layerOrder_.resize(quadCount);
+    for (uint32_t i = 0; i < quadCount; ++i) {
+        layerOrder_[i] = i;
+    }
+    std::stable_sort(layerOrder_.begin(), layerOrder_.end(), [this](uint32_t a, uint32_t b) { return quads_[a].layer < quads_[b].layer; });
+
+    // 同じテクスチャ・ブレンドモードの描画をさかのぼって探し、間の描画と重ならなければそこへまとめる
+    quadBatch_.resize(quadCount);
+    size_t layerFirstBatch = 0;
+    for (uint32_t quadIndex : layerOrder_) {
+        const SpriteQuad &quad = quads_[quadIndex];
+        const SpriteVertex *vertices = &quadVertices_[static_cast<size_t>(quadIndex) * kVerticesPerQuad];
+        Vector2 min = {vertices[0].position.x / vertices[0].position.w, vertices[0].position.y / vertices[0].position.w};
+        Vector2 max = min;
+        for (uint32_t i = 1; i < kVerticesPerQuad; ++i) {
+            float x = vertices[i].position.x / vertices[i].position.w;
+            float y = vertices[i].position.y / vertices[i].position.w;
+            min = {(std::min)(min.x, x), (std::min)(min.y, y)};
+            max = {(std::max)(max.x, x), (std::max)(max.y, y)};
+        }
+
+        if (!batchBuilds_.empty() && batchBuilds_.back().layer != quad.layer) {
+            layerFirstBatch = batchBuilds_.size();
+        }
+        size_t target = batchBuilds_.size();
+        for (size_t i = batchBuilds_.size(), step = 0; i > layerFirstBatch && step < kMaxLookbackBatches; --i, ++step) {
+            const BatchBuild &build = batchBuilds_[i - 1];
+            if (build.batch.textureIndex == quad.textureIndex && build.batch.blendMode == quad.blendMode) {
+                target = i - 1;
+                break;
+            }
+            // 後から描く描画と重なるなら、それより前には詰められない
+            if (min.x <= build.max.x && build.min.x <= max.x && min.y <= build.max.y && build.min.y <= max.y) {
+                break;
+            }
+        }
+
+        if (target == batchBuilds_.size()) {
+            batchBuilds_.push_back({{quad.textureIndex, quad.blendMode, 0, 0}, quad.layer, min, max});
+        } else {
+            BatchBuild &build = batchBuilds_[target];
+            build.min = {(std::min)(build.min.x, min.x), (std::min)(build.min.y, min.y)};
+            build.max = {(std::max)(build.max.x, max.x), (std::max)(build.max.y, max.y)};
+        }
+        ++batchBuilds_[target].batch.quadCount;
+        quadBatch_[quadIndex] = static_cast<uint32_t>(target);
+    }
+
+    // 描画ごとに四角形を詰めて、頂点を描く順に並べる
+    uint32_t firstQuad = 0;
+    for (BatchBuild &build : batchBuilds_) {
+        build.batch.firstQuad = firstQuad;
+        firstQuad += build.batch.quadCount;
+        batches_.push_back(build.batch);
+        build.batch.quadCount = 0;
+    }
+    quadOrder_.resize(quadCount);
+    vertices_.resize(quadVertices_.size());
+    for (uint32_t quadIndex : layerOrder_) {
+        Batch &batch = batchBuilds_[quadBatch_[quadIndex]].batch;
+        uint32_t order = batch.firstQuad + batch.quadCount++;
+        quadOrder_[order] = quadIndex;
+        std::memcpy(&vertices_[static_cast<size_t>(order) * kVerticesPerQuad], &quadVertices_[static_cast<size_t>(quadIndex) * kVerticesPerQuad],
+                    sizeof(SpriteVertex) * kVerticesPerQuad);
+    }
+}
+
+SpriteBatch *SpriteBatch::instance = nullptr;
+
+SpriteBatch *SpriteBatch::GetInstance() {
+    if (instance == nullptr) {
+        instance = new SpriteBatch();
+    }
+    return instance;
+}
+
+void SpriteBatch::Finalize() {
+    delete instance;
+    instance = nullptr;
+}
+
+void SpriteBatch::Initialize(DirectXCommon *dxCommon, SrvManager *srvManager) {
+    dxCommon_ = dxCommon;
+    srvManager_ = srvManager;
+
+    // Spriteと同じ画面サイズの正射影
+    projection_ = MakeOrthographicMatrix(0.0f, 0.0f, float(WinApp::kClientWidth), float(WinApp::kClientHeight), 0.0f, 100.0f);
+
+    // 頂点リソース（毎フレームCPUで書き込むので、アップロードヒープに置いたまま書き換える）
+    vertexResource_ = dxCommon_->CreateBufferResource(sizeof(SpriteVertex) * SpriteBatcher::kVerticesPerQuad * kMaxQuads);
+    vertexBufferView_.BufferLocation = vertexResource_->GetGPUVirtualAddress();
+    vertexBufferView_.SizeInBytes = sizeof(SpriteVertex) * SpriteBatcher::kVerticesPerQuad * kMaxQuads;
+    vertexBufferView_.StrideInBytes = sizeof(SpriteVertex);
+    vertexResource_->Map(0, nullptr, reinterpret_cast<void **>(&vertexData_));
+
+    // インデックスは四角形の並びが変わらないので最初に書いておく
+    indexResource_ = dxCommon_->CreateBufferResource(sizeof(uint32_t) * SpriteBatcher::kIndicesPerQuad * kMaxQuads);
+    indexBufferView_.BufferLocation = indexResource_->GetGPUVirtualAddress();
+    indexBufferView_.SizeInBytes = sizeof(uint32_t) * SpriteBatcher::kIndicesPerQuad * kMaxQuads;
+    indexBufferView_.Format = DXGI_FORMAT_R32_UINT;
+    uint32_t *indexData = nullptr;
+    indexResource_->Map(0, nullptr, reinterpret_cast<void **>(&indexData));
+    for (uint32_t quad = 0; quad < kMaxQuads; ++quad) {
+        for (uint32_t i = 0; i < SpriteBatcher::kIndicesPerQuad; ++i) {
+            indexData[quad * SpriteBatcher::kIndicesPerQuad + i] = quad * SpriteBatcher::kVerticesPerQuad + SpriteBatcher::kQuadIndices[i];
+        }
+    }
+    indexResource_->Unmap(0, nullptr);
+}
+
+void SpriteBatch::Begin() {
+    batcher_.Clear();
+    isRecording_ = true;
+}
+
+void SpriteBatch::Add(const SpriteQuad &quad) {
+    batcher_.Add(quad);
+    if (!isRecording_) {
+        Flush();
+    }
+}
+
+void SpriteBatch::End() {
+    isRecording_ = false;
+    Flush();
+}
+
+void SpriteBatch::Flush() {
+    PROFILE_FUNCTION();
+    batcher_.Build(projection_);
+
+    // 頂点バッファに入りきらない分は描かない
+    const uint32_t quadCount = static_cast<uint32_t>(batcher_.GetQuadCount());
+    const uint32_t drawQuadCount = (std::min)(quadCount, kMaxQuads - usedQuadCount_);
+    assert(drawQuadCount == quadCount && "SpriteBatch::kMaxQuadsを超えました");
+    STAT_COUNTER_ADD("SpritesDropped", quadCount - drawQuadCount);
+    if (drawQuadCount == 0) {
+        batcher_.Clear();
+        return;
+    }
+    const uint32_t baseQuad = usedQuadCount_;
+    std::memcpy(vertexData_ + static_cast<size_t>(baseQuad) * SpriteBatcher::kVerticesPerQuad, batcher_.GetVertices().data(),
+                sizeof(SpriteVertex) * SpriteBatcher::kVerticesPerQuad * drawQuadCount);
+    usedQuadCount_ += drawQuadCount;
+
+    ID3D12GraphicsCommandList *commandList = dxCommon_->GetCommandList().Get();
+    const SpriteBatcher::Batch *previous = nullptr;
+    for (const SpriteBatcher::Batch &batch : batcher_.GetBatches()) {
+        if (batch.firstQuad >= drawQuadCount) {
+            break;
+        }
+        // ブレンドモードが変わったときだけパイプラインを設定し直す（ルートシグネチャも張り直すのでテクスチャも設定する）
+        bool isPipelineChanged = previous == nullptr || previous->blendMode != batch.blendMode;
+        if (isPipelineChanged) {
+            PipeLineManager::GetInstance()->DrawCommonSetting(PipelineType::kSpriteBatch, batch.blendMode);
+            commandList->IASetVertexBuffers(0, 1, &vertexBufferView_);
+            commandList->IASetIndexBuffer(&indexBufferView_);
+        }
+        if (isPipelineChanged || previous->textureIndex != batch.textureIndex) {
+            srvManager_->SetGraphicsRootDescriptorTable(0, batch.textureIndex);
+        }
+
+        uint32_t batchQuadCount = (std::min)(batch.quadCount, drawQuadCount - batch.firstQuad);
+        commandList->DrawIndexedInstanced(batchQuadCount * SpriteBatcher::kIndicesPerQuad, 1, 0,
+                                          static_cast<INT>((baseQuad + batch.firstQuad) * SpriteBatcher::kVerticesPerQuad), 0);
+        STAT_COUNTER_ADD("DrawCalls", 1);
+        STAT_COUNTER_ADD("SpriteBatches", 1);
+        previous = &batch;
+    }
+    STAT_COUNTER_ADD("Sprites", drawQuadCount);
+    batcher_.Clear();
+}
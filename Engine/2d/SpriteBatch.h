@@ -0,0 +1,180 @@
+#pragma once
+#include "DirectXCommon.h"
+#include "type/Matrix4x4.h"
+#include "type/Vector2.h"
+#include "type/Vector4.h"
+#include <Graphics/PipeLine/PipeLineManager.h>
+#include <Graphics/Srv/SrvManager.h>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// スプライト1枚分の描画情報
+/// </summary>
+struct SpriteQuad {
+	Vector2 position = {0.0f, 0.0f};      // 画面上の位置（ピクセル）
+	Vector2 size = {0.0f, 0.0f};          // 大きさ（ピクセル）
+	Vector2 anchorPoint = {0.0f, 0.0f};
+	float rotation = 0.0f;
+	float depth = 0.0f;                   // 射影前のZ（最背面に描くものは奥に置く）
+	Vector2 uvLeftTop = {0.0f, 0.0f};     // テクスチャ座標（0～1）
+	Vector2 uvRightBottom = {1.0f, 1.0f};
+	Matrix4x4 uvTransform = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}; // テクスチャ座標にかける行列
+	Vector4 color = {1.0f, 1.0f, 1.0f, 1.0f};
+	bool isFlipX = false;
+	bool isFlipY = false;
+	uint32_t textureIndex = 0;            // テクスチャのSRV番号（アトラスなら同じ番号になるのでまとめて描ける）
+	BlendMode blendMode = BlendMode::kNormal;
+	int32_t layer = 0;                    // 小さいほど先に描く。同じレイヤーの中だけで並べ替える
+};
+
+// まとめて描くスプライトの頂点（SpriteBatch.VS.hlsl の VertexShaderInput と同じ並び）
+struct SpriteVertex {
+	Vector4 position; // 射影後の座標
+	Vector2 texcoord;
+	Vector4 color;
+};
+
+/// <summary>
+/// スプライトの四角形を頂点にして、テクスチャとブレンドモードが同じものを1回の描画にまとめる
+/// レイヤーの順は守り、同じレイヤーの中では重なっていないものだけを前に詰めるので、見た目は描いた順のときと変わらない
+/// GPUを使わないのでそのまま確認できる
+/// </summary>
+class SpriteBatcher {
+public:
+	// 描画1回分（firstQuadは並べ替えた後の四角形の番号）
+	struct Batch {
+		uint32_t textureIndex;
+		BlendMode blendMode;
+		uint32_t firstQuad;
+		uint32_t quadCount;
+	};
+
+	static constexpr uint32_t kVerticesPerQuad = 4;
+	static constexpr uint32_t kIndicesPerQuad = 6;
+	// 四角形の頂点の並び（左下・左上・右下・右上）に対する2枚の三角形
+	static constexpr uint32_t kQuadIndices[kIndicesPerQuad] = {0, 1, 2, 1, 3, 2};
+	// まとめ先を探すときにさかのぼる描画の数（重なりの確認が増えすぎないようにする）
+	static constexpr uint32_t kMaxLookbackBatches = 16;
+
+	/// <summary>
+	/// 四角形の頂点を作る（Spriteが1枚ずつ行列を使って変換していたのと同じ結果になる）
+	/// </summary>
+	static void GenerateQuad(const SpriteQuad& quad, const Matrix4x4& projection, SpriteVertex* vertices);
+
+	/// <summary>
+	/// 空にする（確保したメモリは残す）
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// 四角形を追加する
+	/// </summary>
+	void Add(const SpriteQuad& quad);
+
+	/// <summary>
+	/// 頂点を作って描画の単位にまとめる
+	/// </summary>
+	void Build(const Matrix4x4& projection);
+
+	/// <summary>
+	/// getter
+	/// </summary>
+	size_t GetQuadCount() const { return quads_.size(); }
+	const std::vector<Batch>& GetBatches() const { return batches_; }
+	// 描く順に並べた頂点（四角形ごとにkVerticesPerQuad個）
+	const std::vector<SpriteVertex>& GetVertices() const { return vertices_; }
+	// 描く順に並べた四角形の、追加した順での番号
+	const std::vector<uint32_t>& GetQuadOrder() const { return quadOrder_; }
+
+private:
+	// 描画1回分のまとめ途中の情報
+	struct BatchBuild {
+		Batch batch;
+		int32_t layer;
+		// まとめた四角形を囲む範囲（射影後の座標）
+		Vector2 min;
+		Vector2 max;
+	};
+
+	std::vector<SpriteQuad> quads_;
+	std::vector<SpriteVertex> quadVertices_; // 追加した順の頂点
+	std::vector<uint32_t> layerOrder_;
+	std::vector<uint32_t> quadBatch_;
+	std::vector<BatchBuild> batchBuilds_;
+	std::vector<Batch> batches_;
+	std::vector<SpriteVertex> vertices_;
+	std::vector<uint32_t> quadOrder_;
+};
+
+/// <summary>
+/// スプライトの一括描画
+/// Begin～Endの間のSprite::Drawは積むだけにして、Endで1つの頂点バッファにまとめて描く
+/// 記録中でなければ1枚ずつすぐに描く
+/// </summary>
+class SpriteBatch {
+private:
+	static SpriteBatch* instance;
+
+	SpriteBatch() = default;
+	~SpriteBatch() = default;
+	SpriteBatch(SpriteBatch&) = delete;
+	SpriteBatch& operator=(SpriteBatch&) = delete;
+
+public:
+	// 1フレームに描けるスプライトの数
+	static constexpr uint32_t kMaxQuads = 16384;
+
+	static SpriteBatch* GetInstance();
+
+	void Finalize();
+
+	/// <summary>
+	/// 初期化
+	/// </summary>
+	void Initialize(DirectXCommon* dxCommon, SrvManager* srvManager);
+
+	/// <summary>
+	/// フレームの始めに呼ぶ（使った頂点を空にする）
+	/// </summary>
+	void BeginFrame() { usedQuadCount_ = 0; }
+
+	/// <summary>
+	/// 記録開始
+	/// </summary>
+	void Begin();
+
+	/// <summary>
+	/// スプライトを積む（記録中でなければすぐに描く）
+	/// </summary>
+	void Add(const SpriteQuad& quad);
+
+	/// <summary>
+	/// 積んだスプライトをまとめて描く
+	/// </summary>
+	void End();
+
+	bool IsRecording() const { return isRecording_; }
+
+private:
+	// 積んだ分を描いて空にする
+	void Flush();
+
+private:
+	DirectXCommon* dxCommon_ = nullptr;
+	SrvManager* srvManager_ = nullptr;
+
+	SpriteBatcher batcher_;
+	Matrix4x4 projection_;
+
+	// 毎フレーム書き換える頂点バッファと、四角形の並びを書いておくインデックスバッファ
+	Microsoft::WRL::ComPtr<ID3D12Resource> vertexResource_;
+	Microsoft::WRL::ComPtr<ID3D12Resource> indexResource_;
+	SpriteVertex* vertexData_ = nullptr;
+	D3D12_VERTEX_BUFFER_VIEW vertexBufferView_{};
+	D3D12_INDEX_BUFFER_VIEW indexBufferView_{};
+
+	// このフレームで使った四角形の数
+	uint32_t usedQuadCount_ = 0;
+	bool isRecording_ = false;
+};
@@ -0,0 +1,148 @@
+#include "SpriteBatch.h"
+#include "Test/Test.h"
+#include "myMath.h"
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace {
+
+constexpr float kScreenWidth = 1280.0f;
+constexpr float kScreenHeight = 720.0f;
+
+// UIや文字のようにほとんどが1枚のアトラスから切り出したもので、
+// 一部だけ別のテクスチャや加算のものが混ざり、レイヤーに分かれている並び
+std::vector<SpriteQuad> MakeQuads(uint32_t count) {
+    constexpr uint32_t kAtlasTextureIndex = 1;
+    constexpr int32_t kLayerCount = 4;
+    std::mt19937 random(20240601u);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> x(0.0f, kScreenWidth);
+    std::uniform_real_distribution<float> y(0.0f, kScreenHeight);
+    std::uniform_real_distribution<float> size(8.0f, 32.0f);
+    std::uniform_real_distribution<float> rotation(-3.14f, 3.14f);
+    std::uniform_int_distribution<uint32_t> atlasCell(0, 15);
+    std::vector<SpriteQuad> quads(count);
+    for (SpriteQuad &quad : quads) {
+        quad.position = {x(random), y(random)};
+        quad.size = {size(random), size(random)};
+        quad.anchorPoint = {0.5f, 0.5f};
+        quad.rotation = percent(random) < 20 ? rotation(random) : 0.0f;
+        quad.depth = percent(random) < 5 ? 10000.0f : 0.0f;
+        float cell = static_cast<float>(atlasCell(random));
+        quad.uvLeftTop = {cell / 16.0f, 0.0f};
+        quad.uvRightBottom = {(cell + 1.0f) / 16.0f, 1.0f};
+        quad.color = {unit(random), unit(random), unit(random), 1.0f};
+        quad.isFlipX = percent(random) < 10;
+        quad.isFlipY = percent(random) < 10;
+        uint32_t kind = percent(random);
+        quad.textureIndex = kind < 90 ? kAtlasTextureIndex : kAtlasTextureIndex + 1 + kind % 2;
+        quad.blendMode = percent(random) < 10 ? BlendMode::kAdd : BlendMode::kNormal;
+        quad.layer = static_cast<int32_t>(percent(random)) % kLayerCount;
+    }
+    return quads;
+}
+
+Matrix4x4 MakeProjection() { return MakeOrthographicMatrix(0.0f, 0.0f, kScreenWidth, kScreenHeight, 0.0f, 100.0f); }
+
+// 四角形ごとの描かれた順番（quadOrderの逆引き）
+std::vector<uint32_t> MakeDrawOrder(const SpriteBatcher &batcher, uint32_t count) {
+    std::vector<uint32_t> drawOrder(count, count);
+    const std::vector<uint32_t> &quadOrder = batcher.GetQuadOrder();
+    for (uint32_t i = 0; i < quadOrder.size(); ++i) {
+        CHECK(quadOrder[i] < count && drawOrder[quadOrder[i]] == count);
+        if (quadOrder[i] < count) {
+            drawOrder[quadOrder[i]] = i;
+        }
+    }
+    return drawOrder;
+}
+
+} // namespace
+
+// どの四角形もちょうど1回ずつ、レイヤーの順に描かれ、描画は同じテクスチャ・ブレンドモードごとに隙間なく並ぶ
+TEST(BatchesCoverAllQuadsInLayerOrder) {
+    constexpr uint32_t kCount = 4000;
+    std::vector<SpriteQuad> quads = MakeQuads(kCount);
+    SpriteBatcher batcher;
+    for (const SpriteQuad &quad : quads) {
+        batcher.Add(quad);
+    }
+    batcher.Build(MakeProjection());
+
+    const std::vector<uint32_t> &quadOrder = batcher.GetQuadOrder();
+    CHECK(quadOrder.size() == kCount);
+    CHECK(batcher.GetVertices().size() == kCount * SpriteBatcher::kVerticesPerQuad);
+    MakeDrawOrder(batcher, kCount);
+    for (uint32_t i = 1; i < quadOrder.size(); ++i) {
+        CHECK(quads[quadOrder[i - 1]].layer <= quads[quadOrder[i]].layer);
+    }
+
+    const std::vector<SpriteBatcher::Batch> &batches = batcher.GetBatches();
+    uint32_t nextQuad = 0;
+    for (const SpriteBatcher::Batch &batch : batches) {
+        CHECK(batch.firstQuad == nextQuad && batch.quadCount > 0);
+        for (uint32_t i = batch.firstQuad; i < batch.firstQuad + batch.quadCount; ++i) {
+            const SpriteQuad &quad = quads[quadOrder[i]];
+            CHECK(quad.textureIndex == batch.textureIndex && quad.blendMode == batch.blendMode);
+        }
+        nextQuad += batch.quadCount;
+    }
+    CHECK(nextQuad == kCount);
+    // 描画の回数が減っている
+    CHECK(!batches.empty() && batches.size() < kCount / 4);
+}
+
+// 頂点は四角形ごとの頂点と同じで、Spriteが使っていた行列での変換とも一致する
+// 同じレイヤーで重なる四角形同士は、追加した順のまま描かれる
+TEST(VerticesMatchSpriteTransformAndOverlapOrder) {
+    constexpr uint32_t kCount = 4000;
+    std::vector<SpriteQuad> quads = MakeQuads(kCount);
+    const Matrix4x4 projection = MakeProjection();
+    SpriteBatcher batcher;
+    for (const SpriteQuad &quad : quads) {
+        batcher.Add(quad);
+    }
+    batcher.Build(projection);
+    std::vector<uint32_t> drawOrder = MakeDrawOrder(batcher, kCount);
+    const std::vector<SpriteVertex> &batchVertices = batcher.GetVertices();
+
+    std::vector<Vector2> quadMin(kCount);
+    std::vector<Vector2> quadMax(kCount);
+    for (uint32_t i = 0; i < kCount; ++i) {
+        SpriteVertex vertices[SpriteBatcher::kVerticesPerQuad];
+        SpriteBatcher::GenerateQuad(quads[i], projection, vertices);
+        if (drawOrder[i] < kCount) {
+            CHECK(std::memcmp(vertices, &batchVertices[static_cast<size_t>(drawOrder[i]) * SpriteBatcher::kVerticesPerQuad], sizeof(vertices)) == 0);
+        }
+
+        const SpriteQuad &quad = quads[i];
+        float left = quad.isFlipX ? quad.anchorPoint.x : -quad.anchorPoint.x;
+        float right = quad.isFlipX ? quad.anchorPoint.x - 1.0f : 1.0f - quad.anchorPoint.x;
+        float top = quad.isFlipY ? quad.anchorPoint.y : -quad.anchorPoint.y;
+        float bottom = quad.isFlipY ? quad.anchorPoint.y - 1.0f : 1.0f - quad.anchorPoint.y;
+        const Vector2 corners[SpriteBatcher::kVerticesPerQuad] = {{left, bottom}, {left, top}, {right, bottom}, {right, top}};
+        Matrix4x4 wvp = MakeAffineMatrix(Vector3{quad.size.x, quad.size.y, 1.0f}, Vector3{0.0f, 0.0f, quad.rotation},
+                                         Vector3{quad.position.x, quad.position.y, quad.depth}) * projection;
+        quadMin[i] = {vertices[0].position.x, vertices[0].position.y};
+        quadMax[i] = quadMin[i];
+        for (uint32_t v = 0; v < SpriteBatcher::kVerticesPerQuad; ++v) {
+            Vector3 expected = Transformation(Vector3{corners[v].x, corners[v].y, 0.0f}, wvp);
+            CHECK(std::abs(vertices[v].position.x - expected.x) < 1e-4f && std::abs(vertices[v].position.y - expected.y) < 1e-4f &&
+                  std::abs(vertices[v].position.z - expected.z) < 1e-4f && vertices[v].position.w == 1.0f);
+            quadMin[i] = {(std::min)(quadMin[i].x, vertices[v].position.x), (std::min)(quadMin[i].y, vertices[v].position.y)};
+            quadMax[i] = {(std::max)(quadMax[i].x, vertices[v].position.x), (std::max)(quadMax[i].y, vertices[v].position.y)};
+        }
+    }
+
+    for (uint32_t i = 0; i < kCount; ++i) {
+        for (uint32_t j = i + 1; j < kCount; ++j) {
+            bool isOverlapped = quads[i].layer == quads[j].layer && quadMin[i].x <= quadMax[j].x && quadMin[j].x <= quadMax[i].x &&
+                                quadMin[i].y <= quadMax[j].y && quadMin[j].y <= quadMax[i].y;
+            if (isOverlapped) {
+                CHECK(drawOrder[i] < drawOrder[j]);
+            }
+        }
+    }
+}
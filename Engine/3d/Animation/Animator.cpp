@@ -3,10 +3,10 @@
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <cassert>
+#include <Memory/AllocationTracker.h>
 #include <myMath.h>
-#include <set>
 
-std::unordered_map<std::string, Animation> Animator::animationCache;
+std::unordered_map<AssetID, Animation> Animator::animationCache;
 
 void Animator::Initialize(const std::string &directorypath, const std::string &filename) {
     haveAnimation = false;
@@ -24,6 +24,8 @@ void Animator::Update(bool loop) {
     if (!isAnimation_)
         return;
 
+    ALLOCATION_SCOPE("Animation");
+
     if (blendState_.isBlending) {
         UpdateBlend(loop);
     } else {
@@ -88,6 +90,7 @@ void Animator::UpdateBlend(bool loop) {
     }
 
     animationTime = blendState_.toAnimationTime;
+    UpdateBlendedAnimation();
 }
 void Animator::UpdateSingle(bool loop) {
     if (loop) {
@@ -124,6 +127,10 @@ void Animator::BlendToAnimation(const Animation &newAnimation, float blendDurati
     blendState_.blendFactor = 0.0f;
     blendState_.isBlending = true;
 
+    // 補間するノードの組み合わせが変わるので作り直す
+    blendedAnimation_.nodeAnimations.clear();
+    UpdateBlendedAnimation();
+
     isAnimation_ = true;
     isFinish_ = false;
 }
@@ -157,20 +164,17 @@ void Animator::BlendToAnimation(const std::string &directoryPath, const std::str
     blendState_.blendFactor = 0.0f;
     blendState_.isBlending = true;
 
+    // 補間するノードの組み合わせが変わるので作り直す
+    blendedAnimation_.nodeAnimations.clear();
+    UpdateBlendedAnimation();
+
     isAnimation_ = true;
     isFinish_ = false;
 }
 
-Animation Animator::GetCurrentAnimation() const {
-    if (!blendState_.isBlending) {
-        return currentAnimation_;
-    }
-
-    // 補間中の場合は動的に生成されたアニメーションを返す
-    Animation blendedAnimation;
-    blendedAnimation.duration = blendState_.toAnimation.duration;
-    blendedAnimation.nodeAnimations = GetBlendedNodeAnimations();
-    return blendedAnimation;
+const Animation &Animator::GetCurrentAnimation() const {
+    // 補間中の場合はUpdateで作った補間結果を返す
+    return blendState_.isBlending ? blendedAnimation_ : currentAnimation_;
 }
 
 void Animator::UpdateCurrentFileInfo(const std::string &directoryPath, const std::string &filename) {
@@ -178,34 +182,44 @@ void Animator::UpdateCurrentFileInfo(const std::string &directoryPath, const std
     filename_ = filename;
 }
 
-std::map<std::string, NodeAnimation> Animator::GetBlendedNodeAnimations() const {
-    std::map<std::string, NodeAnimation> blendedAnimations;
-
-    if (!blendState_.isBlending) {
-        return currentAnimation_.nodeAnimations;
-    }
-
-    // 全てのノード名を収集
-    std::set<std::string> allNodeNames;
-    for (const auto &pair : blendState_.fromAnimation.nodeAnimations) {
-        allNodeNames.insert(pair.first);
-    }
-    for (const auto &pair : blendState_.toAnimation.nodeAnimations) {
-        allNodeNames.insert(pair.first);
-    }
-
-    for (const std::string &nodeName : allNodeNames) {
-        NodeAnimation blendedNode;
+const std::map<std::string, NodeAnimation> &Animator::GetBlendedNodeAnimations() const {
+    return GetCurrentAnimation().nodeAnimations;
+}
 
-        auto fromIt = blendState_.fromAnimation.nodeAnimations.find(nodeName);
-        auto toIt = blendState_.toAnimation.nodeAnimations.find(nodeName);
+void Animator::UpdateBlendedAnimation() {
+    blendedAnimation_.duration = blendState_.toAnimation.duration;
+
+    // どちらのmapも名前順なので、マージすれば全てのノードを重複なく名前順にたどれる
+    const auto &fromNodes = blendState_.fromAnimation.nodeAnimations;
+    const auto &toNodes = blendState_.toAnimation.nodeAnimations;
+    auto fromIt = fromNodes.begin();
+    auto toIt = toNodes.begin();
+    while (fromIt != fromNodes.end() || toIt != toNodes.end()) {
+        const std::string *nodeName;
+        const NodeAnimation *fromNodePointer = nullptr;
+        const NodeAnimation *toNodePointer = nullptr;
+        if (toIt == toNodes.end() || (fromIt != fromNodes.end() && fromIt->first < toIt->first)) {
+            nodeName = &fromIt->first;
+            fromNodePointer = &(fromIt++)->second;
+        } else if (fromIt == fromNodes.end() || toIt->first < fromIt->first) {
+            nodeName = &toIt->first;
+            toNodePointer = &(toIt++)->second;
+        } else {
+            nodeName = &fromIt->first;
+            fromNodePointer = &(fromIt++)->second;
+            toNodePointer = &(toIt++)->second;
+        }
 
-        if (fromIt != blendState_.fromAnimation.nodeAnimations.end() &&
-            toIt != blendState_.toAnimation.nodeAnimations.end()) {
+        // 2フレーム目以降はノードもキーフレームの配列も確保済みのものを使い回す
+        NodeAnimation &blendedNode = blendedAnimation_.nodeAnimations[*nodeName];
+        blendedNode.translate.clear();
+        blendedNode.rotate.clear();
+        blendedNode.scale.clear();
 
+        if (fromNodePointer && toNodePointer) {
             // 両方のアニメーションにノードが存在する場合
-            const NodeAnimation &fromNode = fromIt->second;
-            const NodeAnimation &toNode = toIt->second;
+            const NodeAnimation &fromNode = *fromNodePointer;
+            const NodeAnimation &toNode = *toNodePointer;
 
             // Translation
             if (!fromNode.translate.empty() && !toNode.translate.empty()) {
@@ -240,9 +254,9 @@ std::map<std::string, NodeAnimation> Animator::GetBlendedNodeAnimations() const
                 blendedNode.scale.push_back(keyframe);
             }
 
-        } else if (fromIt != blendState_.fromAnimation.nodeAnimations.end()) {
+        } else if (fromNodePointer) {
             // 補間元のアニメーションにのみ存在する場合
-            const NodeAnimation &fromNode = fromIt->second;
+            const NodeAnimation &fromNode = *fromNodePointer;
 
             Vector3 defaultTranslate = {0.0f, 0.0f, 0.0f};
             Quaternion defaultRotate = {0.0f, 0.0f, 0.0f, 1.0f};
@@ -272,9 +286,9 @@ std::map<std::string, NodeAnimation> Animator::GetBlendedNodeAnimations() const
                 blendedNode.scale.push_back(keyframe);
             }
 
-        } else if (toIt != blendState_.toAnimation.nodeAnimations.end()) {
+        } else {
             // 補間先のアニメーションにのみ存在する場合
-            const NodeAnimation &toNode = toIt->second;
+            const NodeAnimation &toNode = *toNodePointer;
 
             Vector3 defaultTranslate = {0.0f, 0.0f, 0.0f};
             Quaternion defaultRotate = {0.0f, 0.0f, 0.0f, 1.0f};
@@ -304,19 +318,16 @@ std::map<std::string, NodeAnimation> Animator::GetBlendedNodeAnimations() const
                 blendedNode.scale.push_back(keyframe);
             }
         }
-
-        blendedAnimations[nodeName] = blendedNode;
     }
-
-    return blendedAnimations;
 }
 
 Animation Animator::LoadAnimationFile(const std::string &directoryPath, const std::string &filename) {
-    std::string filePath = directoryPath + "/" + filename;
+    AssetID assetID = AssetDatabase::MakeAssetID(directoryPath + "/" + filename);
+    std::string filePath = AssetDatabase::GetInstance()->ResolvePath(directoryPath + "/" + filename);
     Animation animation;
 
     // キャッシュチェック
-    auto it = animationCache.find(filePath);
+    auto it = animationCache.find(assetID);
     if (it != animationCache.end()) {
         haveAnimation = true;
         return it->second;
@@ -366,7 +377,7 @@ Animation Animator::LoadAnimationFile(const std::string &directoryPath, const st
         }
     }
 
-    animationCache[filePath] = animation;
+    animationCache[assetID] = animation;
     return animation;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "Model/ModelStructs.h"
+#include <Asset/AssetDatabase.h>
 #include <map>
 #include <string>
 #include <type/Quaternion.h>
@@ -29,9 +30,12 @@ class Animator {
     float animationTime = 0.0f;
     Animation currentAnimation_;
     AnimationBlendState blendState_;
+    // 補間中の結果（毎フレーム中身だけ書き換えて使い回す）
+    Animation blendedAnimation_;
     bool isAnimation_ = true;
     bool isFinish_ = false;
-    static std::unordered_map<std::string, Animation> animationCache;
+    // アセットIDごとの読み込み済みアニメーション
+    static std::unordered_map<AssetID, Animation> animationCache;
 
   public:
     void Initialize(const std::string &directorypath, const std::string &filename);
@@ -62,16 +66,16 @@ class Animator {
     bool IsBlending() const { return blendState_.isBlending; }
 
     /// <summary>
-    /// 現在のアニメーションデータを取得（補間済み）
+    /// 現在のアニメーションデータを取得（補間済み。次のUpdateまで有効）
     /// </summary>
-    Animation GetCurrentAnimation() const;
+    const Animation &GetCurrentAnimation() const;
 
     void UpdateCurrentFileInfo(const std::string &directoryPath, const std::string &filename);
 
     /// <summary>
-    /// 補間されたノードアニメーションを取得
+    /// 補間されたノードアニメーションを取得（次のUpdateまで有効）
     /// </summary>
-    std::map<std::string, NodeAnimation> GetBlendedNodeAnimations() const;
+    const std::map<std::string, NodeAnimation> &GetBlendedNodeAnimations() const;
 
     // Getter/Setter
     Animation GetAnimation() const { return currentAnimation_; }
@@ -119,6 +123,11 @@ class Animator {
     /// </summary>
     void UpdateSingle(bool loop);
 
+    /// <summary>
+    /// 補間中の結果を現在の時間で作り直す
+    /// </summary>
+    void UpdateBlendedAnimation();
+
     /// <summary>
     /// 補間された値を計算（Vector3用）
     /// </summary>
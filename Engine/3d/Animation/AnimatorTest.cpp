@@ -0,0 +1,143 @@
+#include "Animation/Animator.h"
+#include "Animation/Bone.h"
+#include "Frame.h"
+#include "Test/Test.h"
+#include <cmath>
+
+namespace {
+
+bool IsNear(float a, float b) { return std::abs(a - b) < 1e-4f; }
+bool IsNear(const Vector3 &a, const Vector3 &b) { return IsNear(a.x, b.x) && IsNear(a.y, b.y) && IsNear(a.z, b.z); }
+
+// 平行移動だけのキーフレーム
+NodeAnimation MakeTranslateAnimation(const Vector3 &start, const Vector3 &end, float duration) {
+    NodeAnimation nodeAnimation;
+    nodeAnimation.translate = {{start, 0.0f}, {end, duration}};
+    nodeAnimation.rotate = {{Quaternion{0.0f, 0.0f, 0.0f, 1.0f}, 0.0f}};
+    nodeAnimation.scale = {{Vector3{1.0f, 1.0f, 1.0f}, 0.0f}};
+    return nodeAnimation;
+}
+
+Node MakeNode(const std::string &name) {
+    Node node;
+    node.name = name;
+    node.transform.scale = {1.0f, 1.0f, 1.0f};
+    node.transform.rotate = {0.0f, 0.0f, 0.0f, 1.0f};
+    node.transform.translate = {0.0f, 0.0f, 0.0f};
+    node.localMatrix = MakeIdentity4x4();
+    return node;
+}
+
+} // namespace
+
+// キーの上ではその値、キーの間は線形補間、範囲外は端の値になる
+TEST(CalculateValueSamplesKeyframes) {
+    std::vector<KeyframeVector3> keyframes = {
+        {{0.0f, 0.0f, 0.0f}, 0.0f},
+        {{2.0f, 4.0f, -2.0f}, 1.0f},
+        {{2.0f, 0.0f, 6.0f}, 3.0f},
+    };
+    CHECK(IsNear(Animator::CalculateValue(keyframes, -1.0f), {0.0f, 0.0f, 0.0f}));
+    CHECK(IsNear(Animator::CalculateValue(keyframes, 0.0f), {0.0f, 0.0f, 0.0f}));
+    CHECK(IsNear(Animator::CalculateValue(keyframes, 0.5f), {1.0f, 2.0f, -1.0f}));
+    CHECK(IsNear(Animator::CalculateValue(keyframes, 1.0f), {2.0f, 4.0f, -2.0f}));
+    CHECK(IsNear(Animator::CalculateValue(keyframes, 2.0f), {2.0f, 2.0f, 2.0f}));
+    CHECK(IsNear(Animator::CalculateValue(keyframes, 5.0f), {2.0f, 0.0f, 6.0f}));
+
+    // 回転は球面線形補間（Y軸まわりに0度と90度の間は45度）
+    const float halfAngle = 3.14159265f / 4.0f;
+    std::vector<KeyframeQuaternion> rotations = {
+        {{0.0f, 0.0f, 0.0f, 1.0f}, 0.0f},
+        {{0.0f, std::sin(halfAngle), 0.0f, std::cos(halfAngle)}, 1.0f},
+    };
+    Quaternion middle = Animator::CalculateValue(rotations, 0.5f);
+    CHECK(IsNear(middle.y, std::sin(halfAngle / 2.0f)) && IsNear(middle.w, std::cos(halfAngle / 2.0f)));
+    CHECK(IsNear(middle.x, 0.0f) && IsNear(middle.z, 0.0f));
+}
+
+// スケルトンの行列は親から順に積み上がり、アニメーションの時間に合わせて動く
+TEST(BoneAppliesAnimationDownTheHierarchy) {
+    Node root = MakeNode("root");
+    Node child = MakeNode("child");
+    child.children.push_back(MakeNode("tip"));
+    root.children.push_back(child);
+    ModelData modelData;
+    modelData.rootNode = root;
+
+    Animation animation;
+    animation.duration = 2.0f;
+    animation.nodeAnimations["root"] = MakeTranslateAnimation({0.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}, animation.duration);
+    animation.nodeAnimations["child"] = MakeTranslateAnimation({0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, animation.duration);
+    animation.nodeAnimations["tip"] = MakeTranslateAnimation({0.0f, 0.0f, 2.0f}, {0.0f, 0.0f, 0.0f}, animation.duration);
+
+    Bone bone;
+    bone.Initialize(modelData);
+    CHECK(bone.GetJointSkeletonSpaceMatrix("tip").has_value());
+    CHECK(!bone.GetJointSkeletonSpaceMatrix("missing").has_value());
+
+    auto tipPosition = [&]() {
+        Matrix4x4 matrix = bone.GetJointSkeletonSpaceMatrix("tip").value_or(MakeIdentity4x4());
+        return Vector3{matrix.m[3][0], matrix.m[3][1], matrix.m[3][2]};
+    };
+    bone.Update(animation, 0.0f);
+    CHECK(IsNear(tipPosition(), {0.0f, 1.0f, 2.0f}));
+    bone.Update(animation, 1.0f);
+    CHECK(IsNear(tipPosition(), {2.0f, 1.0f, 1.0f}));
+    bone.Update(animation, 2.0f);
+    CHECK(IsNear(tipPosition(), {4.0f, 1.0f, 0.0f}));
+
+    // ワールド行列をかけた位置
+    std::optional<Vector3> worldPosition = bone.GetJointWorldPosition("tip", MakeTranslateMatrix({0.0f, 0.0f, 10.0f}));
+    CHECK(worldPosition.has_value() && IsNear(*worldPosition, {4.0f, 1.0f, 10.0f}));
+}
+
+// 補間中は両方のアニメーションを混ぜた値になり、結果の入れ物は毎フレーム使い回す
+TEST(BlendReusesBlendedAnimation) {
+    Animation walk;
+    walk.duration = 2.0f;
+    walk.nodeAnimations["root"] = MakeTranslateAnimation({0.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}, walk.duration);
+    walk.nodeAnimations["walkOnly"] = MakeTranslateAnimation({2.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}, walk.duration);
+    Animation run;
+    run.duration = 1.0f;
+    run.nodeAnimations["root"] = MakeTranslateAnimation({0.0f, 0.0f, 0.0f}, {0.0f, 8.0f, 0.0f}, run.duration);
+    run.nodeAnimations["runOnly"] = MakeTranslateAnimation({0.0f, 0.0f, 4.0f}, {0.0f, 0.0f, 4.0f}, run.duration);
+
+    // 0.25秒ずつ進める
+    Frame::SetFixedTimeStep(true, 0.25f);
+    Frame::BeginFixedStep();
+
+    Animator animator;
+    animator.BlendToAnimation(walk, 0.25f);
+    animator.Update(true);
+    CHECK(!animator.IsBlending());
+    CHECK(IsNear(animator.GetAnimationTime(), 0.25f));
+
+    animator.BlendToAnimation(run, 1.0f);
+    CHECK(animator.IsBlending());
+    animator.Update(true);
+    // 補間率0.25、walkは0.5秒、runは0.25秒の位置
+    const Animation &blended = animator.GetCurrentAnimation();
+    CHECK(blended.nodeAnimations.size() == 3);
+    auto position = [&](const std::string &nodeName) {
+        return Animator::CalculateValue(blended.nodeAnimations.at(nodeName).translate, animator.GetAnimationTime());
+    };
+    CHECK(IsNear(position("root"), Lerp(Vector3{1.0f, 0.0f, 0.0f}, Vector3{0.0f, 2.0f, 0.0f}, 0.25f)));
+    CHECK(IsNear(position("walkOnly"), {1.5f, 0.0f, 0.0f}));
+    CHECK(IsNear(position("runOnly"), {0.0f, 0.0f, 1.0f}));
+
+    const KeyframeVector3 *rootKeyframes = blended.nodeAnimations.at("root").translate.data();
+    animator.Update(true);
+    CHECK(&animator.GetCurrentAnimation() == &blended);
+    CHECK(&animator.GetBlendedNodeAnimations() == &blended.nodeAnimations);
+    CHECK(blended.nodeAnimations.at("root").translate.data() == rootKeyframes);
+    CHECK(IsNear(position("runOnly"), {0.0f, 0.0f, 2.0f}));
+
+    // 補間が終われば補間先そのもの
+    animator.Update(true);
+    animator.Update(true);
+    CHECK(!animator.IsBlending());
+    CHECK(animator.GetCurrentAnimation().nodeAnimations.count("walkOnly") == 0);
+
+    Frame::EndFixedStep();
+    Frame::SetFixedTimeStep(false);
+}
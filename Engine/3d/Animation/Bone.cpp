@@ -14,7 +14,7 @@ void Bone::Update(const Animation& animation, float animationTime)
 	for (Joint& joint : skeleton_.joints) {
             joint.localMatrix = MakeBoneMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
 		if (joint.parent) { // 親がいれば親の行列を掛ける
-			joint.skeletonSpaceMatrix = joint.localMatrix * skeleton_.joints[*joint.parent].skeletonSpaceMatrix;
+			joint.skeletonSpaceMatrix = MultiplyAffine(joint.localMatrix, skeleton_.joints[*joint.parent].skeletonSpaceMatrix);
 		}
 		else { // 親がいないのでlocalMatrixとskeletonSpaceMatrixは一致する
 			joint.skeletonSpaceMatrix = joint.localMatrix;
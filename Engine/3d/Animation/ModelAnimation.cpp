@@ -1,4 +1,5 @@
 #include "ModelAnimation.h"
+#include "Debug/Profiler/Profiler.h"
 
 void ModelAnimation::Initialize(const std::string &directorypath, const std::string &filename) {
     directorypath_ = directorypath;
@@ -15,6 +16,7 @@ void ModelAnimation::Initialize(const std::string &directorypath, const std::str
 }
 
 void ModelAnimation::Update(bool roop) {
+    PROFILE_FUNCTION();
     if (animator_->HaveAnimation()) {
         animator_->Update(roop);
         bone_->Update(animator_->GetCurrentAnimation(), animator_->GetAnimationTime());
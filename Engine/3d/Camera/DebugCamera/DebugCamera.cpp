@@ -1,7 +1,7 @@
 #include "DebugCamera.h"
 #include "DirectXCommon.h"
 #include "Input.h"
-#include "Mymath.h"
+#include "myMath.h"
 #ifdef _DEBUG
 #include "imgui.h"
 #endif // _DEBUG
@@ -1,5 +1,6 @@
 #include "LightGroup.h"
 #include "DirectXCommon.h"
+#include "Data/JsonHotReloader.h"
 #include <filesystem>
 #include <fstream>
 
@@ -13,6 +14,9 @@ LightGroup *LightGroup::GetInstance() {
 }
 
 void LightGroup::Finalize() {
+    if (JsonHotReloader *hotReloader = JsonHotReloader::TryGetInstance()) {
+        hotReloader->Unwatch(this);
+    }
     delete instance;
     instance = nullptr;
 }
@@ -27,6 +31,12 @@ void LightGroup::Initialize() {
     LoadDirectionalLight();
     LoadPointLight();
     LoadSpotLight();
+
+    // ライト設定のJSONが書き換えられたらその場で反映
+    JsonHotReloader *hotReloader = JsonHotReloader::GetInstance();
+    hotReloader->Watch(DLightData_->GetFilePath(), this, [this]() { LoadDirectionalLight(); });
+    hotReloader->Watch(PLightData_->GetFilePath(), this, [this]() { LoadPointLight(); });
+    hotReloader->Watch(SLightData_->GetFilePath(), this, [this]() { LoadSpotLight(); });
 }
 
 void LightGroup::Update(const ViewProjection &viewProjection) {
@@ -1,8 +1,35 @@
 #include "DrawLine3D.h"
 #include "DirectXCommon.h"
+#include "Engine/Frame/FrameStats.h"
+#include <Debug/Profiler/Profiler.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <myMath.h>
+#include <numbers>
+#include <thread>
 
 DrawLine3D *DrawLine3D::instance = nullptr;
+std::atomic<uint64_t> DrawLine3D::nextGeneration_ = 1;
+
+namespace {
+
+// 拡縮と移動だけの行列（球や箱の配置は回転がいらないので三角関数を使わずに作る）
+Matrix4x4 MakeScaleTranslate(const Vector3 &scale, const Vector3 &translate) {
+    return {scale.x, 0.0f, 0.0f, 0.0f,
+            0.0f, scale.y, 0.0f, 0.0f,
+            0.0f, 0.0f, scale.z, 0.0f,
+            translate.x, translate.y, translate.z, 1.0f};
+}
+
+// アフィン変換（wで割らない）
+Vector3 TransformPoint(const Vector3 &point, const Matrix4x4 &m) {
+    return {point.x * m.m[0][0] + point.y * m.m[1][0] + point.z * m.m[2][0] + m.m[3][0],
+            point.x * m.m[0][1] + point.y * m.m[1][1] + point.z * m.m[2][1] + m.m[3][1],
+            point.x * m.m[0][2] + point.y * m.m[1][2] + point.z * m.m[2][2] + m.m[3][2]};
+}
+
+} // namespace
 
 DrawLine3D *DrawLine3D::GetInstance() {
     if (instance == nullptr) {
@@ -41,7 +68,8 @@ std::unique_ptr<DrawLine3D::LineData> DrawLine3D::CreateMesh(UINT vertexCount, U
 
 void DrawLine3D::Initialize() {
     dxCommon = DirectXCommon::GetInstance();
-    CreateMeshes();
+    // 最初の1ページだけ作っておき、足りなくなったらDrawで増やす
+    pages_.push_back(CreateMesh(kLinesPerPage * kVertexCountLine, kIndexCountLine));
     CreateResource();
     psoManager_ = PipeLineManager::GetInstance();
 }
@@ -52,31 +80,49 @@ void DrawLine3D::Finalize() {
 }
 
 void DrawLine3D::SetPoints(const Vector3 &p1, const Vector3 &p2, const Vector4 &color) {
-
-    if (indexLine_ < kMaxLineCount) {
-        line_->vertMap[indexLine_ * 2] = {p1, color};
-        line_->vertMap[indexLine_ * 2 + 1] = {p2, color};
-
-        indexLine_++;
-    }
+    LineRecorder *recorder = GetRecorder();
+    recorder->vertices.push_back({p1, color});
+    recorder->vertices.push_back({p2, color});
 }
 
 void DrawLine3D::Reset() {
-    indexLine_ = 0;
+    std::lock_guard<std::mutex> lock(recorderMutex_);
+    for (const std::unique_ptr<LineRecorder> &recorder : recorders_) {
+        recorder->vertices.clear();
+    }
 }
 
 void DrawLine3D::Draw(const ViewProjection &viewProjection) {
-
-    if (indexLine_ == 0) {
+    PROFILE_FUNCTION();
+    const uint32_t lineCount = GetLineCount();
+    if (lineCount == 0) {
         return;
     }
+
+    // ページの上限を超えた分は描かない
+    const uint32_t drawLineCount = (std::min)(lineCount, kLinesPerPage * kMaxPageCount);
+    STAT_COUNTER_ADD("LinesDropped", lineCount - drawLineCount);
+    const uint32_t pageCount = (drawLineCount + kLinesPerPage - 1) / kLinesPerPage;
+    while (pages_.size() < pageCount) {
+        pages_.push_back(CreateMesh(kLinesPerPage * kVertexCountLine, kIndexCountLine));
+    }
+
     cBufferData_->viewProject = viewProjection.matView_ * viewProjection.matProjection_;
 
     psoManager_->DrawCommonSetting(PipelineType::kLine3d);
-    D3D12_VERTEX_BUFFER_VIEW vbView = line_->vbView;
-    dxCommon->GetCommandList()->IASetVertexBuffers(0, 1, &vbView);
     dxCommon->GetCommandList()->SetGraphicsRootConstantBufferView(0, cBufferResource_->GetGPUVirtualAddress());
-    dxCommon->GetCommandList()->DrawInstanced(indexLine_ * 2, 1, 0, 0);
+    for (uint32_t page = 0; page < pageCount; ++page) {
+        const uint32_t firstLine = page * kLinesPerPage;
+        const uint32_t pageLineCount = (std::min)(kLinesPerPage, drawLineCount - firstLine);
+        CopyLines(firstLine, pageLineCount, pages_[page]->vertMap);
+
+        D3D12_VERTEX_BUFFER_VIEW vbView = pages_[page]->vbView;
+        dxCommon->GetCommandList()->IASetVertexBuffers(0, 1, &vbView);
+        dxCommon->GetCommandList()->DrawInstanced(pageLineCount * kVertexCountLine, 1, 0, 0);
+        STAT_COUNTER_ADD("DrawCalls", 1);
+    }
+    STAT_COUNTER_ADD("UploadBytes", drawLineCount * kVertexCountLine * sizeof(VertexPosColor));
+    STAT_GAUGE_SET("LinePages", pages_.size());
 
     Reset();
 }
@@ -86,127 +132,184 @@ void DrawLine3D::DrawGrid(float y, int division, float size, Vector4 color) {
     if (division <= 0 || size <= 0.0f) {
         return;
     }
+    DrawShape(GetGridShape(division), MakeScaleTranslate({size, 1.0f, size}, {0.0f, y, 0.0f}), color);
+}
 
-    // 一区画の幅
-    float interval = (size * 2.0f) / division;
-
-    // グリッド線の色（薄いグレー）
-    const Vector4 gridColor = color;
-
-    for (int i = 0; i <= division; ++i) {
-        // 現在の位置
-        float offset = -size + i * interval;
+void DrawLine3D::DrawSphere(const Vector3 &position, const Vector4 &color, float radius, int divisions) {
+    DrawSphere(MakeScaleTranslate({radius, radius, radius}, position), color, divisions);
+}
 
-        // X方向の線（Zを移動）
-        Vector3 startX = {-size, y, offset};
-        Vector3 endX = {size, y, offset};
-        SetPoints(startX, endX, gridColor);
+void DrawLine3D::DrawCube(const Vector3 &position, const Vector4 &color, float size) {
+    DrawBox(MakeScaleTranslate({size, size, size}, position), color);
+}
 
-        // Z方向の線（Xを移動）
-        Vector3 startZ = {offset, y, -size};
-        Vector3 endZ = {offset, y, size};
-        SetPoints(startZ, endZ, gridColor);
+void DrawLine3D::DrawSphere(const Matrix4x4 &worldMatrix, const Vector4 &color, int divisions) {
+    // 分割数が最低限必要
+    if (divisions < 3) {
+        return;
     }
+    DrawShape(GetSphereShape(divisions), worldMatrix, color);
 }
 
-void DrawLine3D::CreateMeshes() {
-
-    const UINT maxVertex = kMaxLineCount * kVertexCountLine;
-    const UINT maxIndices = 20;
-
-    line_ = CreateMesh(maxVertex, maxIndices);
+void DrawLine3D::DrawBox(const Matrix4x4 &worldMatrix, const Vector4 &color) {
+    DrawShape(GetBoxShape(), worldMatrix, color);
 }
 
-void DrawLine3D::CreateResource() {
-    cBufferResource_ = dxCommon->CreateBufferResource(sizeof(CBuffer));
-    cBufferData_ = nullptr;
-    cBufferResource_->Map(0, nullptr, reinterpret_cast<void **>(&cBufferData_));
-    cBufferData_->viewProject = MakeIdentity4x4();
+void DrawLine3D::DrawAABB(const Vector3 &min, const Vector3 &max, const Vector4 &color) {
+    DrawBox(MakeScaleTranslate(max - min, (min + max) * 0.5f), color);
 }
 
-void DrawLine3D::DrawCube(const Vector3 &position, const Vector4 &color, float size) {
-    // 半サイズ（中心から各辺までの距離）
-    float hs = size * 0.5f;
-
-    // 立方体の8頂点（左手座標系）
-    Vector3 corners[8] = {
-        {position.x - hs, position.y - hs, position.z - hs}, // 0: 左下前
-        {position.x + hs, position.y - hs, position.z - hs}, // 1: 右下前
-        {position.x + hs, position.y + hs, position.z - hs}, // 2: 右上前
-        {position.x - hs, position.y + hs, position.z - hs}, // 3: 左上前
-        {position.x - hs, position.y - hs, position.z + hs}, // 4: 左下後
-        {position.x + hs, position.y - hs, position.z + hs}, // 5: 右下後
-        {position.x + hs, position.y + hs, position.z + hs}, // 6: 右上後
-        {position.x - hs, position.y + hs, position.z + hs}, // 7: 左上後
-    };
-
-    // 各辺を線で結ぶ（合計12本）
-    int edges[12][2] = {
-        {0, 1}, {1, 2}, {2, 3}, {3, 0}, // 前面
-        {4, 5},
-        {5, 6},
-        {6, 7},
-        {7, 4}, // 背面
-        {0, 4},
-        {1, 5},
-        {2, 6},
-        {3, 7} // 側面
-    };
+void DrawLine3D::DrawShape(const LineShape &shape, const Matrix4x4 &worldMatrix, const Vector4 &color) {
+    LineRecorder *recorder = GetRecorder();
 
-    for (int i = 0; i < 12; ++i) {
-        SetPoints(corners[edges[i][0]], corners[edges[i][1]], color);
+    // 点を一度ずつ変換してから、線の両端に配る
+    recorder->points.resize(shape.points.size());
+    for (size_t i = 0; i < shape.points.size(); ++i) {
+        recorder->points[i] = TransformPoint(shape.points[i], worldMatrix);
+    }
+    const size_t first = recorder->vertices.size();
+    recorder->vertices.resize(first + shape.indices.size());
+    VertexPosColor *vertices = recorder->vertices.data() + first;
+    for (size_t i = 0; i < shape.indices.size(); ++i) {
+        vertices[i] = {recorder->points[shape.indices[i]], color};
     }
 }
 
-void DrawLine3D::DrawSphere(const Vector3 &position, const Vector4 &color, float radius, int divisions) {
-    // 分割数が最低限必要
-    if (divisions < 3)
-        return;
-
-    const float PI = 3.1415926535f;
+const DrawLine3D::LineShape &DrawLine3D::GetSphereShape(int divisions) {
+    std::lock_guard<std::mutex> lock(shapeMutex_);
+    std::unique_ptr<LineShape> &shape = sphereShapes_[divisions];
+    if (shape) {
+        return *shape;
+    }
+    shape = std::make_unique<LineShape>();
 
-    // 緯度方向（Y軸周り）の分割
+    // 緯度 -π/2～π/2 をdivisions個、経度 0～2π をdivisions個に分けた点（極の点は重なるがそのまま持つ）
+    const float pi = std::numbers::pi_v<float>;
     for (int i = 0; i <= divisions; ++i) {
-        float theta1 = PI * (float)(i) / divisions - PI / 2.0f;
-        float theta2 = PI * (float)(i + 1) / divisions - PI / 2.0f;
-
-        for (int j = 0; j <= divisions; ++j) {
-            float phi = 2.0f * PI * (float)(j) / divisions;
-
-            // 緯線用の点1・点2
-            Vector3 p1 = {
-                position.x + radius * cosf(theta1) * cosf(phi),
-                position.y + radius * sinf(theta1),
-                position.z + radius * cosf(theta1) * sinf(phi)};
+        float theta = pi * static_cast<float>(i) / divisions - pi / 2.0f;
+        for (int j = 0; j < divisions; ++j) {
+            float phi = 2.0f * pi * static_cast<float>(j) / divisions;
+            shape->points.push_back({std::cos(theta) * std::cos(phi), std::sin(theta), std::cos(theta) * std::sin(phi)});
+        }
+    }
+    auto pointIndex = [divisions](int i, int j) { return static_cast<uint32_t>(i * divisions + j % divisions); };
+    // 経線
+    for (int j = 0; j < divisions; ++j) {
+        for (int i = 0; i < divisions; ++i) {
+            shape->indices.push_back(pointIndex(i, j));
+            shape->indices.push_back(pointIndex(i + 1, j));
+        }
+    }
+    // 緯線（極では長さ0になるので除く）
+    for (int i = 1; i < divisions; ++i) {
+        for (int j = 0; j < divisions; ++j) {
+            shape->indices.push_back(pointIndex(i, j));
+            shape->indices.push_back(pointIndex(i, j + 1));
+        }
+    }
+    return *shape;
+}
 
-            Vector3 p2 = {
-                position.x + radius * cosf(theta2) * cosf(phi),
-                position.y + radius * sinf(theta2),
-                position.z + radius * cosf(theta2) * sinf(phi)};
+const DrawLine3D::LineShape &DrawLine3D::GetGridShape(int division) {
+    std::lock_guard<std::mutex> lock(shapeMutex_);
+    std::unique_ptr<LineShape> &shape = gridShapes_[division];
+    if (shape) {
+        return *shape;
+    }
+    shape = std::make_unique<LineShape>();
 
-            SetPoints(p1, p2, color);
+    // -1～1 の範囲をdivision個に分ける
+    for (int i = 0; i <= division; ++i) {
+        float offset = -1.0f + 2.0f * static_cast<float>(i) / division;
+        uint32_t first = static_cast<uint32_t>(shape->points.size());
+        // X方向の線（Zを移動）
+        shape->points.push_back({-1.0f, 0.0f, offset});
+        shape->points.push_back({1.0f, 0.0f, offset});
+        // Z方向の線（Xを移動）
+        shape->points.push_back({offset, 0.0f, -1.0f});
+        shape->points.push_back({offset, 0.0f, 1.0f});
+        for (uint32_t index = first; index < first + 4; ++index) {
+            shape->indices.push_back(index);
         }
     }
+    return *shape;
+}
 
-    // 経度方向（Z軸周り）の分割
-    for (int j = 0; j <= divisions; ++j) {
-        float phi1 = 2.0f * PI * (float)(j) / divisions;
-        float phi2 = 2.0f * PI * (float)(j + 1) / divisions;
-
-        for (int i = 0; i <= divisions; ++i) {
-            float theta = PI * (float)(i) / divisions - PI / 2.0f;
+const DrawLine3D::LineShape &DrawLine3D::GetBoxShape() {
+    static const LineShape shape = {
+        // 立方体の8頂点（左手座標系）
+        {
+            {-0.5f, -0.5f, -0.5f}, // 0: 左下前
+            {0.5f, -0.5f, -0.5f},  // 1: 右下前
+            {0.5f, 0.5f, -0.5f},   // 2: 右上前
+            {-0.5f, 0.5f, -0.5f},  // 3: 左上前
+            {-0.5f, -0.5f, 0.5f},  // 4: 左下後
+            {0.5f, -0.5f, 0.5f},   // 5: 右下後
+            {0.5f, 0.5f, 0.5f},    // 6: 右上後
+            {-0.5f, 0.5f, 0.5f},   // 7: 左上後
+        },
+        // 各辺を線で結ぶ（合計12本）
+        {
+            0, 1, 1, 2, 2, 3, 3, 0, // 前面
+            4, 5, 5, 6, 6, 7, 7, 4, // 背面
+            0, 4, 1, 5, 2, 6, 3, 7, // 側面
+        },
+    };
+    return shape;
+}
 
-            Vector3 p1 = {
-                position.x + radius * cosf(theta) * cosf(phi1),
-                position.y + radius * sinf(theta),
-                position.z + radius * cosf(theta) * sinf(phi1)};
+uint32_t DrawLine3D::GetLineCount() {
+    std::lock_guard<std::mutex> lock(recorderMutex_);
+    size_t vertexCount = 0;
+    for (const std::unique_ptr<LineRecorder> &recorder : recorders_) {
+        vertexCount += recorder->vertices.size();
+    }
+    return static_cast<uint32_t>(vertexCount / kVertexCountLine);
+}
 
-            Vector3 p2 = {
-                position.x + radius * cosf(theta) * cosf(phi2),
-                position.y + radius * sinf(theta),
-                position.z + radius * cosf(theta) * sinf(phi2)};
+void DrawLine3D::CopyLines(uint32_t firstLine, uint32_t lineCount, VertexPosColor *destination) {
+    std::lock_guard<std::mutex> lock(recorderMutex_);
+    size_t skip = static_cast<size_t>(firstLine) * kVertexCountLine;
+    size_t remaining = static_cast<size_t>(lineCount) * kVertexCountLine;
+    for (const std::unique_ptr<LineRecorder> &recorder : recorders_) {
+        const std::vector<VertexPosColor> &vertices = recorder->vertices;
+        if (skip >= vertices.size()) {
+            skip -= vertices.size();
+            continue;
+        }
+        size_t count = (std::min)(vertices.size() - skip, remaining);
+        std::memcpy(destination, vertices.data() + skip, sizeof(VertexPosColor) * count);
+        destination += count;
+        remaining -= count;
+        skip = 0;
+        if (remaining == 0) {
+            break;
+        }
+    }
+}
 
-            SetPoints(p1, p2, color);
+DrawLine3D::LineRecorder *DrawLine3D::GetRecorder() {
+    thread_local LineRecorder *recorder = nullptr;
+    thread_local uint64_t recorderGeneration = 0;
+    if (recorderGeneration != generation_) {
+        // 別のインスタンスを使っていたスレッドなら、以前に登録したものを探す
+        const std::thread::id threadId = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(recorderMutex_);
+        auto it = std::find_if(recorders_.begin(), recorders_.end(), [&](const std::unique_ptr<LineRecorder> &r) { return r->threadId == threadId; });
+        if (it == recorders_.end()) {
+            recorders_.push_back(std::make_unique<LineRecorder>());
+            recorders_.back()->threadId = threadId;
+            it = recorders_.end() - 1;
         }
+        recorder = it->get();
+        recorderGeneration = generation_;
     }
-}
\ No newline at end of file
+    return recorder;
+}
+
+void DrawLine3D::CreateResource() {
+    cBufferResource_ = dxCommon->CreateBufferResource(sizeof(CBuffer));
+    cBufferData_ = nullptr;
+    cBufferResource_->Map(0, nullptr, reinterpret_cast<void **>(&cBufferData_));
+    cBufferData_->viewProject = MakeIdentity4x4();
+}
@@ -1,17 +1,27 @@
 #pragma once
 #include "Camera/ViewProjection/ViewProjection.h"
 #include "Graphics/PipeLine/PipeLineManager.h"
+#include <atomic>
 #include <cstdint>
 #include <d3d12.h>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <type/Matrix4x4.h>
 #include <type/Vector3.h>
 #include <type/Vector4.h>
+#include <unordered_map>
+#include <vector>
 #include <wrl/client.h>
 
 using namespace Microsoft::WRL;
 
+/// <summary>
+/// 3Dの線の描画
+/// SetPointsや各図形の描画はどのスレッドからでも呼べる（スレッドごとに記録し、Drawでまとめる）
+/// Drawはメインスレッドで、記録しているジョブがすべて終わってから呼ぶ
+/// </summary>
 class DrawLine3D {
   public:
     static DrawLine3D *instance;
@@ -22,7 +32,10 @@ class DrawLine3D {
     DrawLine3D &operator=(DrawLine3D &) = delete;
 
   public:
-    static const UINT kMaxLineCount = 65536;
+    // 頂点バッファ1ページに入る線の数（足りなくなったらページを増やす）
+    static const UINT kLinesPerPage = 65536;
+    // ページの上限（これを超えた線は描かずにLinesDroppedに数える）
+    static const UINT kMaxPageCount = 32;
     static const UINT kVertexCountLine = 2;
     static const UINT kIndexCountLine = 0;
 
@@ -40,6 +53,12 @@ class DrawLine3D {
         uint16_t *indexMap = nullptr;
     };
 
+    // 大きさ1の図形の線（pointsを一度ずつ変換して、indicesの2つずつを線にする）
+    struct LineShape {
+        std::vector<Vector3> points;
+        std::vector<uint32_t> indices;
+    };
+
     std::unique_ptr<LineData> CreateMesh(UINT vertexCount, UINT indexCount);
 
     static DrawLine3D *GetInstance();
@@ -59,15 +78,66 @@ class DrawLine3D {
     void DrawSphere(const Vector3 &position, const Vector4 &color, float radius, int divisions);
     void DrawCube(const Vector3 &position, const Vector4 &color, float size);
 
+    /// <summary>
+    /// 半径1の球・大きさ1の立方体を行列で変換して描く（楕円体やOBBにも使える）
+    /// </summary>
+    void DrawSphere(const Matrix4x4 &worldMatrix, const Vector4 &color, int divisions);
+    void DrawBox(const Matrix4x4 &worldMatrix, const Vector4 &color);
+    void DrawAABB(const Vector3 &min, const Vector3 &max, const Vector4 &color);
+
+    /// <summary>
+    /// 図形の線を行列で変換して積む
+    /// </summary>
+    void DrawShape(const LineShape &shape, const Matrix4x4 &worldMatrix, const Vector4 &color);
+
+    /// <summary>
+    /// 図形の取得（初めて使う分割数のときだけ作って、以降は同じものを返す）
+    /// </summary>
+    const LineShape &GetSphereShape(int divisions);
+    const LineShape &GetGridShape(int division);
+    static const LineShape &GetBoxShape();
+
+    /// <summary>
+    /// 全スレッドで記録した線の数
+    /// </summary>
+    uint32_t GetLineCount();
+
+    /// <summary>
+    /// 記録した線のfirstLine本目からlineCount本を、スレッドごとにまとめた順でdestinationに詰める
+    /// </summary>
+    void CopyLines(uint32_t firstLine, uint32_t lineCount, VertexPosColor *destination);
+
   private:
-    void CreateMeshes();
+    // スレッド1つ分の記録（書き込むのは持ち主のスレッドだけなのでロックはいらない）
+    struct LineRecorder {
+        std::thread::id threadId;
+        std::vector<VertexPosColor> vertices;
+        // 図形の点を変換する作業用
+        std::vector<Vector3> points;
+    };
+
+    /// <summary>
+    /// 呼び出したスレッドの記録先（初めて呼んだときだけ登録する）
+    /// </summary>
+    LineRecorder *GetRecorder();
 
     void CreateResource();
 
   private:
-    std::unique_ptr<LineData> line_;
-
-    uint32_t indexLine_ = 0;
+    // 頂点バッファのページ（前のフレームで増やした分はそのまま使い回す）
+    std::vector<std::unique_ptr<LineData>> pages_;
+
+    // スレッドごとの記録（登録とDrawでの読み出しのときだけロックする）
+    std::mutex recorderMutex_;
+    std::vector<std::unique_ptr<LineRecorder>> recorders_;
+    // スレッドが持っている記録先がこのインスタンスのものかを見分ける番号
+    static std::atomic<uint64_t> nextGeneration_;
+    const uint64_t generation_ = nextGeneration_.fetch_add(1);
+
+    // 分割数ごとの図形
+    std::mutex shapeMutex_;
+    std::unordered_map<int, std::unique_ptr<LineShape>> sphereShapes_;
+    std::unordered_map<int, std::unique_ptr<LineShape>> gridShapes_;
 
     DirectXCommon *dxCommon = nullptr;
 
@@ -0,0 +1,176 @@
+#include "Line/DrawLine3D.h"
+#include "Test/Test.h"
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <random>
+#include <thread>
+
+namespace {
+
+constexpr int kSphereDivisions = 10;
+constexpr uint32_t kSphereLineCount = kSphereDivisions * kSphereDivisions + (kSphereDivisions - 1) * kSphereDivisions;
+constexpr uint32_t kBoxLineCount = 12;
+
+// 当たり判定のデバッグ表示のように、球と箱を並べたもの
+struct Shapes {
+    std::vector<Vector3> centers;
+    std::vector<Vector3> sizes;
+    std::vector<bool> isSphere;
+};
+
+Shapes MakeShapes(uint32_t count) {
+    std::mt19937 random(20240601u);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.1f, 3.0f);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    Shapes shapes;
+    for (uint32_t i = 0; i < count; ++i) {
+        shapes.centers.push_back({position(random), position(random), position(random)});
+        shapes.sizes.push_back({size(random), size(random), size(random)});
+        shapes.isSphere.push_back(percent(random) < 40);
+    }
+    return shapes;
+}
+
+void RecordShapes(DrawLine3D &drawLine, const Shapes &shapes, uint32_t begin, uint32_t end, const Vector4 &color) {
+    for (uint32_t i = begin; i < end; ++i) {
+        if (shapes.isSphere[i]) {
+            drawLine.DrawSphere(shapes.centers[i], color, shapes.sizes[i].x, kSphereDivisions);
+        } else {
+            drawLine.DrawAABB(shapes.centers[i] - shapes.sizes[i] * 0.5f, shapes.centers[i] + shapes.sizes[i] * 0.5f, color);
+        }
+    }
+}
+
+std::vector<DrawLine3D::VertexPosColor> CopyAllLines(DrawLine3D &drawLine) {
+    uint32_t lineCount = drawLine.GetLineCount();
+    std::vector<DrawLine3D::VertexPosColor> vertices(static_cast<size_t>(lineCount) * DrawLine3D::kVertexCountLine);
+    // Drawと同じくページごとに詰める
+    for (uint32_t firstLine = 0; firstLine < lineCount; firstLine += DrawLine3D::kLinesPerPage) {
+        uint32_t pageLineCount = (std::min)(DrawLine3D::kLinesPerPage, lineCount - firstLine);
+        drawLine.CopyLines(firstLine, pageLineCount, &vertices[static_cast<size_t>(firstLine) * DrawLine3D::kVertexCountLine]);
+    }
+    return vertices;
+}
+
+bool IsNear(const Vector3 &a, const Vector3 &b) { return std::abs(a.x - b.x) < 1e-3f && std::abs(a.y - b.y) < 1e-3f && std::abs(a.z - b.z) < 1e-3f; }
+
+} // namespace
+
+// 線の数は図形ごとの本数の合計で、両端は毎回三角関数で求めていたときの点と一致する
+TEST(ShapesMatchDirectComputation) {
+    constexpr uint32_t kCount = 2000;
+    const Vector4 color = {1.0f, 1.0f, 0.0f, 1.0f};
+    Shapes shapes = MakeShapes(kCount);
+    DrawLine3D drawLine;
+    RecordShapes(drawLine, shapes, 0, kCount, color);
+    std::vector<DrawLine3D::VertexPosColor> vertices = CopyAllLines(drawLine);
+
+    uint32_t expectedLineCount = 0;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        expectedLineCount += shapes.isSphere[i] ? kSphereLineCount : kBoxLineCount;
+    }
+    CHECK(drawLine.GetLineCount() == expectedLineCount);
+    CHECK(vertices.size() == expectedLineCount * 2);
+    // 1ページに収まらない量になっている
+    CHECK(expectedLineCount > DrawLine3D::kLinesPerPage);
+
+    const float pi = std::numbers::pi_v<float>;
+    auto spherePoint = [&](uint32_t shape, int i, int j) {
+        float theta = pi * static_cast<float>(i) / kSphereDivisions - pi / 2.0f;
+        float phi = 2.0f * pi * static_cast<float>(j % kSphereDivisions) / kSphereDivisions;
+        float radius = shapes.sizes[shape].x;
+        const Vector3 &center = shapes.centers[shape];
+        return Vector3{center.x + radius * std::cos(theta) * std::cos(phi), center.y + radius * std::sin(theta),
+                       center.z + radius * std::cos(theta) * std::sin(phi)};
+    };
+    size_t vertexIndex = 0;
+    for (uint32_t shape = 0; shape < kCount && vertexIndex < vertices.size(); ++shape) {
+        std::vector<std::pair<Vector3, Vector3>> expected;
+        if (shapes.isSphere[shape]) {
+            for (int j = 0; j < kSphereDivisions; ++j) {
+                for (int i = 0; i < kSphereDivisions; ++i) {
+                    expected.push_back({spherePoint(shape, i, j), spherePoint(shape, i + 1, j)});
+                }
+            }
+            for (int i = 1; i < kSphereDivisions; ++i) {
+                for (int j = 0; j < kSphereDivisions; ++j) {
+                    expected.push_back({spherePoint(shape, i, j), spherePoint(shape, i, j + 1)});
+                }
+            }
+        } else {
+            const Vector3 min = shapes.centers[shape] - shapes.sizes[shape] * 0.5f;
+            const Vector3 max = shapes.centers[shape] + shapes.sizes[shape] * 0.5f;
+            const Vector3 corners[8] = {{min.x, min.y, min.z}, {max.x, min.y, min.z}, {max.x, max.y, min.z}, {min.x, max.y, min.z},
+                                        {min.x, min.y, max.z}, {max.x, min.y, max.z}, {max.x, max.y, max.z}, {min.x, max.y, max.z}};
+            const int edges[12][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6}, {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+            for (const auto &edge : edges) {
+                expected.push_back({corners[edge[0]], corners[edge[1]]});
+            }
+        }
+        for (size_t i = 0; i < expected.size() && vertexIndex + 1 < vertices.size(); ++i, vertexIndex += 2) {
+            CHECK(IsNear(vertices[vertexIndex].pos, expected[i].first));
+            CHECK(IsNear(vertices[vertexIndex + 1].pos, expected[i].second));
+            CHECK(vertices[vertexIndex].color.x == color.x && vertices[vertexIndex].color.z == color.z);
+        }
+    }
+
+    // 図形は分割数ごとに一度だけ作られる
+    CHECK(&drawLine.GetSphereShape(kSphereDivisions) == &drawLine.GetSphereShape(kSphereDivisions));
+
+    // Resetで空になる
+    drawLine.Reset();
+    CHECK(drawLine.GetLineCount() == 0);
+}
+
+// 複数のスレッドから同時に積んでも欠けずに、スレッドごとには積んだ順のまま集まる
+TEST(ThreadRecordsMergeInOrder) {
+    constexpr uint32_t kCount = 2000;
+    constexpr uint32_t kThreadCount = 4;
+    Shapes shapes = MakeShapes(kCount);
+
+    DrawLine3D singleDrawLine;
+    RecordShapes(singleDrawLine, shapes, 0, kCount, {1.0f, 1.0f, 0.0f, 1.0f});
+    std::vector<DrawLine3D::VertexPosColor> expected = CopyAllLines(singleDrawLine);
+
+    // 色のZにスレッドの番号を入れておく
+    DrawLine3D drawLine;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&, t] {
+            RecordShapes(drawLine, shapes, kCount * t / kThreadCount, kCount * (t + 1) / kThreadCount, {1.0f, 1.0f, static_cast<float>(t), 1.0f});
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    std::vector<DrawLine3D::VertexPosColor> vertices = CopyAllLines(drawLine);
+    CHECK(vertices.size() == expected.size());
+
+    // スレッドごとの、1スレッドで積んだときの先頭の頂点
+    std::vector<size_t> firstVertex(kThreadCount + 1, 0);
+    for (uint32_t t = 0; t < kThreadCount; ++t) {
+        firstVertex[t + 1] = firstVertex[t];
+        for (uint32_t i = kCount * t / kThreadCount; i < kCount * (t + 1) / kThreadCount; ++i) {
+            firstVertex[t + 1] += (shapes.isSphere[i] ? kSphereLineCount : kBoxLineCount) * DrawLine3D::kVertexCountLine;
+        }
+    }
+    // スレッドの記録の切れ目ごとに、1スレッドで積んだときの同じ範囲と比べる
+    std::vector<bool> isMerged(kThreadCount, false);
+    for (size_t i = 0; i < vertices.size() && vertices.size() == expected.size();) {
+        uint32_t thread = static_cast<uint32_t>(vertices[i].color.z);
+        CHECK(thread < kThreadCount && !isMerged[thread]);
+        if (thread >= kThreadCount || isMerged[thread]) {
+            break;
+        }
+        isMerged[thread] = true;
+        size_t count = firstVertex[thread + 1] - firstVertex[thread];
+        for (size_t v = 0; v < count; ++v) {
+            const DrawLine3D::VertexPosColor &vertex = vertices[i + v];
+            CHECK(std::memcmp(&vertex.pos, &expected[firstVertex[thread] + v].pos, sizeof(Vector3)) == 0);
+            CHECK(vertex.color.z == static_cast<float>(thread));
+        }
+        i += count;
+    }
+}
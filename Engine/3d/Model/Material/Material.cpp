@@ -23,9 +23,7 @@ void Material::PrimitiveInitialize(const PrimitiveType &type) {
 
 // デバッグ用: Material::Draw()でテクスチャインデックスを確認
 void Material::Draw(const Vector4 &color, bool lighting) {
-    // 描画時の一時的な値設定
-    materialDataGPU_->color = color;
-    materialDataGPU_->enableLighting = lighting ? 1 : 0;
+    UpdateDrawData(color, lighting);
 
     ID3D12GraphicsCommandList *commandList = dxCommon_->GetCommandList().Get();
     commandList->SetGraphicsRootConstantBufferView(0, materialResource_->GetGPUVirtualAddress());
@@ -33,6 +31,12 @@ void Material::Draw(const Vector4 &color, bool lighting) {
     SrvManager::GetInstance()->SetGraphicsRootDescriptorTable(2, materialData_.textureIndex);
 }
 
+void Material::UpdateDrawData(const Vector4 &color, bool lighting) {
+    // 描画時の一時的な値設定
+    materialDataGPU_->color = color;
+    materialDataGPU_->enableLighting = lighting ? 1 : 0;
+}
+
 
 void Material::SetTexture(const std::string &texturePath) {
     if (materialData_.textureFilePath == texturePath)
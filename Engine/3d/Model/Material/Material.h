@@ -16,6 +16,8 @@ class Material {
     void PrimitiveInitialize(const PrimitiveType &type);
 
     void Draw(const Vector4 &color, bool lighting);
+    // 描画ごとの値だけ書き込む（定数バッファとテクスチャは設定済みのとき）
+    void UpdateDrawData(const Vector4 &color, bool lighting);
 
     MaterialData &GetMaterialData() { return materialData_; }
     const MaterialData &GetMaterialData() const { return materialData_; }
@@ -1,5 +1,6 @@
 #include "Mesh.h"
 #include "DirectXCommon.h"
+#include <Model/MeshOptimizer/MeshOptimizer.h>
 void Mesh::Initialize() {
     dxCommon_ = DirectXCommon::GetInstance();
 
@@ -28,6 +29,21 @@ void Mesh::CreateVartexData() {
 }
 
 void Mesh::CreateIndexResource() {
+    // 頂点数が65536未満なら16bitインデックスで帯域を節約する
+    if (MeshOptimizer::CanUse16BitIndex(meshData_.vertices.size())) {
+        indexResource = dxCommon_->CreateBufferResource(sizeof(uint16_t) * meshData_.indices.size());
+        indexBufferView.BufferLocation = indexResource->GetGPUVirtualAddress();
+        indexBufferView.SizeInBytes = UINT(sizeof(uint16_t) * meshData_.indices.size());
+        indexBufferView.Format = DXGI_FORMAT_R16_UINT;
+        uint16_t *indexData16 = nullptr;
+        indexResource->Map(0, nullptr, reinterpret_cast<void **>(&indexData16));
+        for (size_t i = 0; i < meshData_.indices.size(); ++i) {
+            indexData16[i] = static_cast<uint16_t>(meshData_.indices[i]);
+        }
+        indexData = nullptr;
+        return;
+    }
+
     indexResource = dxCommon_->CreateBufferResource(sizeof(uint32_t) * meshData_.indices.size());
     indexBufferView.BufferLocation = indexResource->GetGPUVirtualAddress();
     indexBufferView.SizeInBytes = UINT(sizeof(uint32_t) * meshData_.indices.size());
@@ -0,0 +1,373 @@
+#include "MeshOptimizer.h"
+#include "Debug/Log/Logger.h"
+#include "assimp/Importer.hpp"
+#include "assimp/postprocess.h"
+#include "assimp/scene.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+namespace {
+
+// Forsythスコア計算用のパラメータ
+const uint32_t kForsythCacheSize = 32;
+const float kCacheDecayPower = 1.5f;
+const float kLastTriScore = 0.75f;
+const float kValenceBoostScale = 2.0f;
+const float kValenceBoostPower = 0.5f;
+
+/// <summary>
+/// 頂点のスコアを計算
+/// </summary>
+/// <param name="cachePosition">キャッシュ内の位置（キャッシュ外なら-1）</param>
+/// <param name="remainingValence">未出力の三角形のうちこの頂点を使う数</param>
+float CalcVertexScore(int32_t cachePosition, uint32_t remainingValence) {
+    if (remainingValence == 0) {
+        // もう使われない頂点
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // 直前の三角形で使われた頂点は固定スコア
+            score = kLastTriScore;
+        } else {
+            const float scaler = 1.0f / static_cast<float>(kForsythCacheSize - 3);
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, kCacheDecayPower);
+        }
+    }
+
+    // 残りの使用数が少ない頂点ほど優先して使い切る
+    score += kValenceBoostScale * std::pow(static_cast<float>(remainingValence), -kValenceBoostPower);
+    return score;
+}
+
+// 頂点データのハッシュ（ビット単位で比較する）
+struct VertexDataHash {
+    size_t operator()(const VertexData &vertex) const {
+        const unsigned char *bytes = reinterpret_cast<const unsigned char *>(&vertex);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < sizeof(VertexData); ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+struct VertexDataEqual {
+    bool operator()(const VertexData &a, const VertexData &b) const {
+        return std::memcmp(&a, &b, sizeof(VertexData)) == 0;
+    }
+};
+
+} // namespace
+
+MeshOptimizeReport MeshOptimizer::Optimize(std::vector<VertexData> &vertices, std::vector<uint32_t> &indices,
+                                           std::vector<uint32_t> *remap, bool weld, const std::string &name) {
+    MeshOptimizeReport report;
+    report.name = name;
+    report.vertexCountBefore = static_cast<uint32_t>(vertices.size());
+    report.triangleCount = static_cast<uint32_t>(indices.size() / 3);
+    report.acmrBefore = CalculateACMR(indices, vertices.size());
+
+    // 元の頂点番号→現在の頂点番号
+    std::vector<uint32_t> totalRemap(vertices.size());
+    for (uint32_t i = 0; i < totalRemap.size(); ++i) {
+        totalRemap[i] = i;
+    }
+
+    if (!indices.empty()) {
+        std::vector<uint32_t> stepRemap;
+
+        // 重複頂点の結合
+        if (weld) {
+            WeldVertices(vertices, indices, stepRemap);
+            for (uint32_t &index : totalRemap) {
+                index = stepRemap[index];
+            }
+        }
+
+        // 頂点キャッシュ最適化
+        OptimizeVertexCache(indices, vertices.size());
+
+        // 頂点フェッチ最適化
+        OptimizeVertexFetch(vertices, indices, stepRemap);
+        for (uint32_t &index : totalRemap) {
+            if (index != kInvalidIndex) {
+                index = stepRemap[index];
+            }
+        }
+    }
+
+    report.vertexCountAfter = static_cast<uint32_t>(vertices.size());
+    report.acmrAfter = CalculateACMR(indices, vertices.size());
+    report.use16BitIndex = CanUse16BitIndex(vertices.size());
+
+    if (remap) {
+        *remap = std::move(totalRemap);
+    }
+    return report;
+}
+
+void MeshOptimizer::WeldVertices(std::vector<VertexData> &vertices, std::vector<uint32_t> &indices, std::vector<uint32_t> &remap) {
+    remap.assign(vertices.size(), kInvalidIndex);
+
+    std::unordered_map<VertexData, uint32_t, VertexDataHash, VertexDataEqual> uniqueMap;
+    uniqueMap.reserve(vertices.size());
+
+    std::vector<VertexData> uniqueVertices;
+    uniqueVertices.reserve(vertices.size());
+
+    // 最初に出現した頂点を代表として残す
+    for (uint32_t i = 0; i < vertices.size(); ++i) {
+        auto [it, inserted] = uniqueMap.try_emplace(vertices[i], static_cast<uint32_t>(uniqueVertices.size()));
+        if (inserted) {
+            uniqueVertices.push_back(vertices[i]);
+        }
+        remap[i] = it->second;
+    }
+
+    for (uint32_t &index : indices) {
+        index = remap[index];
+    }
+    vertices.swap(uniqueVertices);
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t> &indices, size_t vertexCount) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || vertexCount == 0) {
+        return;
+    }
+
+    // 各頂点を使用する三角形の数
+    std::vector<uint32_t> valence(vertexCount, 0);
+    for (uint32_t index : indices) {
+        ++valence[index];
+    }
+
+    // 頂点→三角形の隣接リスト
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (uint32_t t = 0; t < triangleCount; ++t) {
+            for (uint32_t k = 0; k < 3; ++k) {
+                adjacency[fill[indices[t * 3 + k]]++] = t;
+            }
+        }
+    }
+
+    // スコアの初期化
+    std::vector<int32_t> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        vertexScore[v] = CalcVertexScore(-1, valence[v]);
+    }
+    std::vector<bool> emitted(triangleCount, false);
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    // LRUキャッシュ（追い出し判定用に三角形1つ分余分に持つ）
+    std::array<uint32_t, kForsythCacheSize + 3> cache{};
+    std::array<uint32_t, kForsythCacheSize + 3> newCache{};
+    uint32_t cacheCount = 0;
+
+    size_t scanCursor = 0;
+    int64_t bestTriangle = -1;
+
+    while (result.size() < indices.size()) {
+        if (bestTriangle < 0) {
+            // キャッシュ内に候補がない場合は未出力の三角形から順に選ぶ
+            while (scanCursor < triangleCount && emitted[scanCursor]) {
+                ++scanCursor;
+            }
+            bestTriangle = static_cast<int64_t>(scanCursor);
+        }
+
+        const uint32_t triangle = static_cast<uint32_t>(bestTriangle);
+        emitted[triangle] = true;
+
+        // 三角形を出力し、隣接リストから取り除く
+        uint32_t newCacheCount = 0;
+        for (uint32_t k = 0; k < 3; ++k) {
+            uint32_t v = indices[triangle * 3 + k];
+            result.push_back(v);
+            newCache[newCacheCount++] = v;
+
+            uint32_t begin = adjacencyOffset[v];
+            uint32_t end = begin + valence[v];
+            for (uint32_t i = begin; i < end; ++i) {
+                if (adjacency[i] == triangle) {
+                    adjacency[i] = adjacency[end - 1];
+                    break;
+                }
+            }
+            --valence[v];
+        }
+
+        // 出力した頂点を先頭にしてキャッシュを更新
+        for (uint32_t i = 0; i < cacheCount; ++i) {
+            uint32_t v = cache[i];
+            if (v != newCache[0] && v != newCache[1] && v != newCache[2]) {
+                newCache[newCacheCount++] = v;
+            }
+        }
+
+        // キャッシュ内(追い出された頂点含む)のスコアを更新
+        for (uint32_t i = 0; i < newCacheCount; ++i) {
+            uint32_t v = newCache[i];
+            int32_t position = (i < kForsythCacheSize) ? static_cast<int32_t>(i) : -1;
+            cachePosition[v] = position;
+            vertexScore[v] = CalcVertexScore(position, valence[v]);
+        }
+
+        // 影響を受けた三角形のスコアを更新し、次の候補を探す
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (uint32_t i = 0; i < newCacheCount; ++i) {
+            uint32_t v = newCache[i];
+            uint32_t begin = adjacencyOffset[v];
+            uint32_t end = begin + valence[v];
+            for (uint32_t a = begin; a < end; ++a) {
+                uint32_t t = adjacency[a];
+                float score = vertexScore[indices[t * 3 + 0]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+                if (cachePosition[v] >= 0 && score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = t;
+                }
+            }
+        }
+
+        cacheCount = (std::min)(newCacheCount, kForsythCacheSize);
+        std::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+    }
+
+    indices.swap(result);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(std::vector<VertexData> &vertices, std::vector<uint32_t> &indices, std::vector<uint32_t> &remap) {
+    remap.assign(vertices.size(), kInvalidIndex);
+
+    std::vector<VertexData> orderedVertices;
+    orderedVertices.reserve(vertices.size());
+
+    // 初めて参照された順に頂点を詰める
+    for (uint32_t &index : indices) {
+        if (remap[index] == kInvalidIndex) {
+            remap[index] = static_cast<uint32_t>(orderedVertices.size());
+            orderedVertices.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices.swap(orderedVertices);
+}
+
+float MeshOptimizer::CalculateACMR(const std::vector<uint32_t> &indices, size_t vertexCount, uint32_t cacheSize) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return 0.0f;
+    }
+
+    // FIFOキャッシュをタイムスタンプで模擬する
+    std::vector<uint32_t> timestamp(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+    uint32_t misses = 0;
+    for (uint32_t index : indices) {
+        if (time - timestamp[index] > cacheSize) {
+            timestamp[index] = time++;
+            ++misses;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+std::vector<MeshOptimizeReport> MeshOptimizer::ReportDirectory(const std::string &directoryPath) {
+    std::vector<MeshOptimizeReport> reports;
+    if (!std::filesystem::exists(directoryPath)) {
+        return reports;
+    }
+
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(directoryPath)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        std::string extension = entry.path().extension().string();
+        if (extension != ".obj" && extension != ".gltf") {
+            continue;
+        }
+
+        Assimp::Importer importer;
+        const aiScene *scene = importer.ReadFile(entry.path().string().c_str(), aiProcess_FlipWindingOrder | aiProcess_FlipUVs);
+        if (!scene || !scene->HasMeshes()) {
+            continue;
+        }
+
+        for (uint32_t meshIndex = 0; meshIndex < scene->mNumMeshes; ++meshIndex) {
+            aiMesh *mesh = scene->mMeshes[meshIndex];
+
+            // 頂点とインデックスだけ読み込む（座標系変換はACMRに影響しない）
+            std::vector<VertexData> vertices(mesh->mNumVertices);
+            for (uint32_t vertexIndex = 0; vertexIndex < mesh->mNumVertices; ++vertexIndex) {
+                const aiVector3D &position = mesh->mVertices[vertexIndex];
+                vertices[vertexIndex].position = {position.x, position.y, position.z, 1.0f};
+                if (mesh->HasNormals()) {
+                    const aiVector3D &normal = mesh->mNormals[vertexIndex];
+                    vertices[vertexIndex].normal = {normal.x, normal.y, normal.z};
+                }
+                if (mesh->HasTextureCoords(0)) {
+                    const aiVector3D &texcoord = mesh->mTextureCoords[0][vertexIndex];
+                    vertices[vertexIndex].texcoord = {texcoord.x, texcoord.y};
+                }
+            }
+
+            std::vector<uint32_t> indices;
+            indices.reserve(mesh->mNumFaces * 3);
+            for (uint32_t faceIndex = 0; faceIndex < mesh->mNumFaces; ++faceIndex) {
+                const aiFace &face = mesh->mFaces[faceIndex];
+                if (face.mNumIndices != 3) {
+                    continue;
+                }
+                indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+            }
+
+            std::string name = entry.path().generic_string() + "#" + std::to_string(meshIndex);
+            MeshOptimizeReport report = Optimize(vertices, indices, nullptr, mesh->mNumBones == 0, name);
+
+            char line[512];
+            std::snprintf(line, sizeof(line), "[MeshOptimizer] %s : vertices %u -> %u, triangles %u, ACMR %.3f -> %.3f%s\n",
+                          report.name.c_str(), report.vertexCountBefore, report.vertexCountAfter, report.triangleCount,
+                          report.acmrBefore, report.acmrAfter, report.use16BitIndex ? ", 16bit index" : "");
+            Logger::Log(line);
+
+            reports.push_back(report);
+        }
+    }
+
+    return reports;
+}
+
+void MeshOptimizer::WriteReportCSV(const std::vector<MeshOptimizeReport> &reports, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "name,vertices_before,vertices_after,triangles,acmr_before,acmr_after,index16\n";
+    for (const auto &report : reports) {
+        file << report.name << "," << report.vertexCountBefore << "," << report.vertexCountAfter << ","
+             << report.triangleCount << "," << report.acmrBefore << "," << report.acmrAfter << ","
+             << (report.use16BitIndex ? 1 : 0) << "\n";
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <Model/ModelStructs.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// メッシュ最適化の結果レポート
+/// </summary>
+struct MeshOptimizeReport {
+    std::string name;               // メッシュ名
+    uint32_t vertexCountBefore = 0; // 最適化前の頂点数
+    uint32_t vertexCountAfter = 0;  // 最適化後の頂点数
+    uint32_t triangleCount = 0;     // 三角形数
+    float acmrBefore = 0.0f;        // 最適化前のACMR
+    float acmrAfter = 0.0f;         // 最適化後のACMR
+    bool use16BitIndex = false;     // 16bitインデックスを使用できるか
+};
+
+/// <summary>
+/// インポート時のメッシュ最適化
+/// 重複頂点の結合、頂点キャッシュ最適化(Forsyth)、頂点フェッチ最適化を行う
+/// </summary>
+class MeshOptimizer {
+  public:
+    /// ==========================================
+    /// public methods
+    /// ==========================================
+
+    // 無効なインデックス（未使用頂点のリマップ先）
+    static constexpr uint32_t kInvalidIndex = 0xffffffff;
+    // ACMR計算で想定するFIFOキャッシュサイズ
+    static constexpr uint32_t kFifoCacheSize = 16;
+
+    /// <summary>
+    /// 全最適化を順に適用する
+    /// </summary>
+    /// <param name="vertices">頂点配列</param>
+    /// <param name="indices">インデックス配列</param>
+    /// <param name="remap">元の頂点番号→最適化後の頂点番号（不要ならnullptr）</param>
+    /// <param name="weld">重複頂点を結合するか（スキニングメッシュではfalse）</param>
+    /// <param name="name">レポート用のメッシュ名</param>
+    static MeshOptimizeReport Optimize(std::vector<VertexData> &vertices, std::vector<uint32_t> &indices,
+                                       std::vector<uint32_t> *remap = nullptr, bool weld = true, const std::string &name = "");
+
+    /// <summary>
+    /// 完全に同一の頂点を結合する
+    /// </summary>
+    static void WeldVertices(std::vector<VertexData> &vertices, std::vector<uint32_t> &indices, std::vector<uint32_t> &remap);
+
+    /// <summary>
+    /// 頂点キャッシュのヒット率が上がるように三角形を並び替える(Forsyth)
+    /// </summary>
+    static void OptimizeVertexCache(std::vector<uint32_t> &indices, size_t vertexCount);
+
+    /// <summary>
+    /// インデックスの参照順に頂点を並び替える（未使用頂点は削除）
+    /// </summary>
+    static void OptimizeVertexFetch(std::vector<VertexData> &vertices, std::vector<uint32_t> &indices, std::vector<uint32_t> &remap);
+
+    /// <summary>
+    /// 三角形あたりの平均キャッシュミス数(ACMR)を計算
+    /// </summary>
+    static float CalculateACMR(const std::vector<uint32_t> &indices, size_t vertexCount, uint32_t cacheSize = kFifoCacheSize);
+
+    /// <summary>
+    /// 16bitインデックスで表現できるか
+    /// </summary>
+    static bool CanUse16BitIndex(size_t vertexCount) { return vertexCount < 65536; }
+
+    /// <summary>
+    /// ディレクトリ内のモデルを読み込み、最適化結果をレポートする（GPU不要）
+    /// </summary>
+    /// <param name="directoryPath">モデルディレクトリ</param>
+    static std::vector<MeshOptimizeReport> ReportDirectory(const std::string &directoryPath);
+
+    /// <summary>
+    /// レポートをCSVに書き出す
+    /// </summary>
+    static void WriteReportCSV(const std::vector<MeshOptimizeReport> &reports, const std::string &filePath);
+};
@@ -0,0 +1,182 @@
+#include "Model/MeshOptimizer/MeshOptimizer.h"
+#include "Test/Test.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+
+namespace {
+
+using Triangle = std::array<uint32_t, 3>;
+
+// 頂点番号ごとに違う位置の頂点
+VertexData MakeVertex(uint32_t id) {
+    VertexData vertex{};
+    vertex.position = {static_cast<float>(id), 0.0f, 0.0f, 1.0f};
+    vertex.normal = {0.0f, 1.0f, 0.0f};
+    return vertex;
+}
+
+// 頂点番号を位置から取り出す
+uint32_t VertexId(const VertexData &vertex) {
+    return static_cast<uint32_t>(vertex.position.x);
+}
+
+// 向きを変えずに一番小さい番号を先頭にする
+Triangle Canonical(uint32_t a, uint32_t b, uint32_t c) {
+    if (b < a && b < c) {
+        return {b, c, a};
+    }
+    if (c < a && c < b) {
+        return {c, a, b};
+    }
+    return {a, b, c};
+}
+
+// 頂点番号で表した三角形の一覧（順番は問わない）
+std::vector<Triangle> CollectTriangles(const std::vector<VertexData> &vertices, const std::vector<uint32_t> &indices) {
+    std::vector<Triangle> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        triangles.push_back(Canonical(VertexId(vertices[indices[i]]), VertexId(vertices[indices[i + 1]]), VertexId(vertices[indices[i + 2]])));
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// size x size マスの格子。shuffleなら三角形の順番を固定シードで混ぜる
+void MakeGrid(uint32_t size, bool shuffle, std::vector<VertexData> &vertices, std::vector<uint32_t> &indices) {
+    const uint32_t columns = size + 1;
+    vertices.clear();
+    for (uint32_t i = 0; i < columns * columns; ++i) {
+        vertices.push_back(MakeVertex(i));
+    }
+
+    std::vector<Triangle> triangles;
+    for (uint32_t z = 0; z < size; ++z) {
+        for (uint32_t x = 0; x < size; ++x) {
+            uint32_t v = z * columns + x;
+            triangles.push_back({v, v + columns, v + 1});
+            triangles.push_back({v + 1, v + columns, v + columns + 1});
+        }
+    }
+    if (shuffle) {
+        std::mt19937 random(20240601u);
+        std::shuffle(triangles.begin(), triangles.end(), random);
+    }
+
+    indices.clear();
+    for (const Triangle &triangle : triangles) {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+}
+
+// vertexCount個の頂点をすべて使う帯状のメッシュ
+void MakeStrip(uint32_t vertexCount, std::vector<VertexData> &vertices, std::vector<uint32_t> &indices) {
+    vertices.clear();
+    indices.clear();
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        vertices.push_back(MakeVertex(i));
+    }
+    for (uint32_t i = 0; i + 2 < vertexCount; ++i) {
+        indices.insert(indices.end(), {i, i + 1, i + 2});
+    }
+}
+
+} // namespace
+
+// 完全に同じ頂点は1つにまとまり、三角形の形は変わらない
+TEST(WeldsDuplicateVertices) {
+    // 四角形を2つの三角形に分けて、共有する頂点を重複して持たせる
+    std::vector<VertexData> vertices = {MakeVertex(0), MakeVertex(1), MakeVertex(2), MakeVertex(2), MakeVertex(1), MakeVertex(3)};
+    std::vector<uint32_t> indices = {0, 1, 2, 3, 4, 5};
+    std::vector<Triangle> expected = CollectTriangles(vertices, indices);
+
+    std::vector<uint32_t> remap;
+    MeshOptimizeReport report = MeshOptimizer::Optimize(vertices, indices, &remap);
+    CHECK(report.vertexCountBefore == 6);
+    CHECK(report.vertexCountAfter == 4);
+    CHECK(vertices.size() == 4);
+    CHECK(remap[1] == remap[4]);
+    CHECK(remap[2] == remap[3]);
+    CHECK(CollectTriangles(vertices, indices) == expected);
+}
+
+// スキニングメッシュ（結合しない）でも、元の頂点番号からリマップした先が同じ頂点を指す
+TEST(RemapKeepsSkinWeightIndicesValid) {
+    // 頂点5は使われず、頂点1と頂点4はデータが同じでもウェイトが違う想定
+    std::vector<VertexData> original = {MakeVertex(0), MakeVertex(1), MakeVertex(2), MakeVertex(3), MakeVertex(1), MakeVertex(5)};
+    std::vector<uint32_t> originalIndices = {0, 1, 2, 2, 4, 3, 3, 4, 0};
+
+    std::vector<VertexData> vertices = original;
+    std::vector<uint32_t> indices = originalIndices;
+    std::vector<uint32_t> remap;
+    MeshOptimizeReport report = MeshOptimizer::Optimize(vertices, indices, &remap, false);
+    CHECK(report.vertexCountAfter == 5);
+    CHECK(remap.size() == original.size());
+    CHECK(remap[5] == MeshOptimizer::kInvalidIndex);
+    CHECK(remap[1] != remap[4]);
+
+    // ウェイトは元の頂点番号で付いているので、リマップ先の頂点が元の頂点と同じでなければならない
+    std::vector<uint32_t> originalOf(vertices.size(), MeshOptimizer::kInvalidIndex);
+    for (uint32_t v = 0; v < remap.size(); ++v) {
+        if (remap[v] == MeshOptimizer::kInvalidIndex) {
+            continue;
+        }
+        CHECK(remap[v] < vertices.size());
+        CHECK(std::memcmp(&vertices[remap[v]], &original[v], sizeof(VertexData)) == 0);
+        originalOf[remap[v]] = v;
+    }
+
+    // 最適化後の三角形を元の頂点番号に戻すと、元の三角形と一致する
+    std::vector<Triangle> expected;
+    for (size_t i = 0; i < originalIndices.size(); i += 3) {
+        expected.push_back(Canonical(originalIndices[i], originalIndices[i + 1], originalIndices[i + 2]));
+    }
+    std::vector<Triangle> actual;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        actual.push_back(Canonical(originalOf[indices[i]], originalOf[indices[i + 1]], originalOf[indices[i + 2]]));
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    CHECK(actual == expected);
+}
+
+// 格子メッシュの頂点キャッシュ最適化でACMRが悪くならず、三角形はそのまま残る
+TEST(GridAcmrDoesNotGetWorse) {
+    for (bool shuffle : {false, true}) {
+        std::vector<VertexData> vertices;
+        std::vector<uint32_t> indices;
+        MakeGrid(32, shuffle, vertices, indices);
+        std::vector<Triangle> expected = CollectTriangles(vertices, indices);
+
+        MeshOptimizeReport report = MeshOptimizer::Optimize(vertices, indices);
+        CHECK(report.triangleCount == 32 * 32 * 2);
+        CHECK(report.vertexCountAfter == 33 * 33);
+        CHECK(report.acmrAfter <= report.acmrBefore);
+        CHECK(report.acmrAfter < 1.0f);
+        CHECK(CollectTriangles(vertices, indices) == expected);
+    }
+}
+
+// 頂点数が65535までなら16bitインデックスに収まり、65536からは32bitのまま
+TEST(Uses16BitIndexUpTo65535Vertices) {
+    CHECK(MeshOptimizer::CanUse16BitIndex(65535));
+    CHECK(!MeshOptimizer::CanUse16BitIndex(65536));
+
+    for (uint32_t vertexCount : {65535u, 65536u}) {
+        std::vector<VertexData> vertices;
+        std::vector<uint32_t> indices;
+        MakeStrip(vertexCount, vertices, indices);
+
+        MeshOptimizeReport report = MeshOptimizer::Optimize(vertices, indices);
+        CHECK(report.vertexCountAfter == vertexCount);
+        CHECK(report.use16BitIndex == (vertexCount == 65535));
+
+        // Mesh::CreateIndexResourceと同じく16bitに切り詰めても値が変わらない
+        if (report.use16BitIndex) {
+            bool fits = std::all_of(indices.begin(), indices.end(), [](uint32_t index) { return static_cast<uint16_t>(index) == index; });
+            CHECK(fits);
+        }
+        CHECK(*std::max_element(indices.begin(), indices.end()) == vertexCount - 1);
+    }
+}
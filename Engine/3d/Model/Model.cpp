@@ -1,17 +1,23 @@
 #include "Model.h"
 #include "Engine/Frame/Frame.h"
+#include "Engine/Frame/FrameStats.h"
 #include "Graphics/Texture/TextureManager.h"
+#include "Asset/AssetDatabase.h"
+#include "MeshOptimizer/MeshOptimizer.h"
 #include "Object/Object3dCommon.h"
 #include "fstream"
+#include <algorithm>
 #include "myMath.h"
 #include "sstream"
 #include <SkyBox/SkyBox.h>
 
 std::unordered_set<std::string> Model::jointNames = {};
+uint32_t Model::nextId_ = 0;
 
 void Model::Initialize(ModelCommon *modelCommon) {
     modelCommon_ = modelCommon;
     srvManager_ = SrvManager::GetInstance();
+    id_ = nextId_++;
 }
 
 void Model::CreateModel(const std::string &directorypath, const std::string &filename) {
@@ -21,6 +27,7 @@ void Model::CreateModel(const std::string &directorypath, const std::string &fil
 
     // モデル読み込み
     modelData = LoadModelFile(directorypath_, filename_);
+    modelData.localBounds = ComputeLocalBounds(modelData.meshes);
 
     // メッシュ配列のサイズを調整
     meshes_.resize(modelData.meshes.size());
@@ -73,12 +80,15 @@ void Model::CreatePrimitiveModel(const PrimitiveType &type, std::string texPath)
 
     // メッシュのマテリアルインデックスを設定
     modelData.meshes[0].materialIndex = 0;
+    modelData.localBounds = ComputeLocalBounds(modelData.meshes);
 }
 
 void Model::Update() {
     if (isGltf && animator_ && animator_->HaveAnimation()) {
         // 1. 入力頂点データ更新
         skin_->UpdateInputVertices(modelData);
+        STAT_COUNTER_ADD("SkinnedVertices", skin_->GetTotalVertex());
+        STAT_COUNTER_ADD("UploadBytes", skin_->GetTotalVertex() * sizeof(VertexData));
 
         // 2. コンピュートシェーダ実行のためのバリア
         ID3D12GraphicsCommandList *commandList = modelCommon_->GetDxCommon()->GetCommandList().Get();
@@ -101,10 +111,12 @@ void Model::Update() {
     }
 }
 
-void Model::Draw(const Vector4 &color, bool lighting, bool reflect) {
+void Model::Draw(const Vector4 &color, bool lighting, bool reflect, uint32_t instanceCount, bool isMaterialBound) {
     ID3D12GraphicsCommandList *commandList = modelCommon_->GetDxCommon()->GetCommandList().Get();
 
     INT vertexOffset = 0;
+    // 設定済みのマテリアル（続けて描くときは前の描画の最後のメッシュのもの）
+    uint32_t boundMaterialIndex = isMaterialBound ? lastMaterialIndex_ : UINT32_MAX;
 
     for (size_t meshIndex = 0; meshIndex < meshes_.size(); ++meshIndex) {
         Mesh *currentMesh = meshes_[meshIndex].get();
@@ -141,13 +153,20 @@ void Model::Draw(const Vector4 &color, bool lighting, bool reflect) {
             SetEnvironmentCoefficients(0.0f); // 環境係数を無効化
         }
 
-        // マテリアル描画
-        currentMaterial->Draw(color, lighting);
+        // マテリアル描画（同じマテリアルが続くときは定数バッファとテクスチャを設定し直さない）
+        if (materialIndex == boundMaterialIndex) {
+            currentMaterial->UpdateDrawData(color, lighting);
+        } else {
+            currentMaterial->Draw(color, lighting);
+            boundMaterialIndex = materialIndex;
+        }
 
         // 描画コール
         commandList->DrawIndexedInstanced(
-            UINT(modelData.meshes[meshIndex].indices.size()), 1, 0, vertexOffset, 0);
+            UINT(modelData.meshes[meshIndex].indices.size()), instanceCount, 0, vertexOffset, 0);
+        STAT_COUNTER_ADD("DrawCalls", 1);
     }
+    lastMaterialIndex_ = boundMaterialIndex;
 }
 
 ModelData Model::LoadModelFile(const std::string &directoryPath, const std::string &filename) {
@@ -164,7 +183,8 @@ ModelData Model::LoadModelFile(const std::string &directoryPath, const std::stri
     }
 
     Assimp::Importer importer;
-    std::string filePath = directoryPath + "/" + filename;
+    // アセットデータベースに登録済みなら実ファイルのパスを使う
+    std::string filePath = AssetDatabase::GetInstance()->ResolvePath(directoryPath + "/" + filename);
     const aiScene *scene = importer.ReadFile(filePath.c_str(), aiProcess_FlipWindingOrder | aiProcess_FlipUVs);
 
     // メッシュが存在しない場合
@@ -220,6 +240,10 @@ ModelData Model::LoadModelFile(const std::string &directoryPath, const std::stri
             }
         }
 
+        // 頂点キャッシュ・フェッチ最適化（スキニングメッシュはウェイトが頂点単位なので結合しない）
+        std::vector<uint32_t> vertexRemap;
+        MeshOptimizer::Optimize(currentMesh.vertices, currentMesh.indices, &vertexRemap, mesh->mNumBones == 0, filename);
+
         // スキニング情報の処理（各メッシュごとに）
         for (uint32_t boneIndex = 0; boneIndex < mesh->mNumBones; ++boneIndex) {
             aiBone *bone = mesh->mBones[boneIndex];
@@ -248,7 +272,11 @@ ModelData Model::LoadModelFile(const std::string &directoryPath, const std::stri
             // ウェイト情報の格納
             JointWeightData &jointWeightData = modelData.skinClusterData[jointName];
             for (uint32_t weightIndex = 0; weightIndex < bone->mNumWeights; ++weightIndex) {
-                uint32_t globalVertexIndex = bone->mWeights[weightIndex].mVertexId;
+                uint32_t globalVertexIndex = vertexRemap[bone->mWeights[weightIndex].mVertexId];
+                if (globalVertexIndex == MeshOptimizer::kInvalidIndex) {
+                    // 最適化で削除された頂点
+                    continue;
+                }
 
                 jointWeightData.vertexWeights.push_back({bone->mWeights[weightIndex].mWeight,
                                                          globalVertexIndex,
@@ -322,4 +350,23 @@ Node Model::ReadNode(aiNode *node) {
         result.children[childIndex] = ReadNode(node->mChildren[childIndex]);
     }
     return result;
-}
\ No newline at end of file
+}
+
+AABB Model::ComputeLocalBounds(const std::vector<MeshData> &meshes) {
+    AABB bounds{};
+    bool isFirst = true;
+    for (const MeshData &mesh : meshes) {
+        for (const VertexData &vertex : mesh.vertices) {
+            Vector3 position = {vertex.position.x, vertex.position.y, vertex.position.z};
+            if (isFirst) {
+                bounds.min = position;
+                bounds.max = position;
+                isFirst = false;
+                continue;
+            }
+            bounds.min = {(std::min)(bounds.min.x, position.x), (std::min)(bounds.min.y, position.y), (std::min)(bounds.min.z, position.z)};
+            bounds.max = {(std::max)(bounds.max.x, position.x), (std::max)(bounds.max.y, position.y), (std::max)(bounds.max.z, position.z)};
+        }
+    }
+    return bounds;
+}
@@ -3,9 +3,9 @@
 #include "Mesh/Mesh.h"
 #include "ModelCommon.h"
 #include "Object/Object3dCommon.h"
-#include "animation/Animator.h"
-#include "animation/Bone.h"
-#include "animation/Skin.h"
+#include "Animation/Animator.h"
+#include "Animation/Bone.h"
+#include "Animation/Skin.h"
 #include "array"
 #include "assimp/Importer.hpp"
 #include "assimp/postprocess.h"
@@ -46,6 +46,13 @@ class Model {
     Bone *bone_;
     static std::unordered_set<std::string> jointNames;
 
+    // 同じモデルの描画をまとめるための番号（Initializeで振る）
+    uint32_t id_ = 0;
+    static uint32_t nextId_;
+
+    // 直前のDrawで最後に設定したマテリアルの番号
+    uint32_t lastMaterialIndex_ = UINT32_MAX;
+
   public:
     /// <summary>
     /// 初期化
@@ -62,7 +69,9 @@ class Model {
     /// <summary>
     /// 描画
     /// </summary>
-    void Draw(const Vector4 &color, bool lighting, bool reflect);
+    /// <param name="instanceCount">インスタンス描画の数（行列はパイプライン側で設定しておく）</param>
+    /// <param name="isMaterialBound">直前の描画もこのモデルで、マテリアルの設定が残っている</param>
+    void Draw(const Vector4 &color, bool lighting, bool reflect, uint32_t instanceCount = 1, bool isMaterialBound = false);
 
     // Setter methods
     void SetSrv(SrvManager *srvManager) { srvManager_ = srvManager; }
@@ -85,7 +94,9 @@ class Model {
 
     // Getter methods
     ModelData GetModelData() { return modelData; }
+    const AABB &GetLocalBounds() const { return modelData.localBounds; }
     bool IsGltf() { return isGltf; }
+    uint32_t GetId() const { return id_; }
 
     // マルチメッシュ・マルチマテリアル情報取得
     size_t GetMeshCount() const { return meshes_.size(); }
@@ -114,4 +125,9 @@ class Model {
     /// <param name="node"></param>
     /// <returns></returns>
     static Node ReadNode(aiNode *node);
+
+    /// <summary>
+    /// 全メッシュの頂点を囲むAABBの計算
+    /// </summary>
+    static AABB ComputeLocalBounds(const std::vector<MeshData> &meshes);
 };
\ No newline at end of file
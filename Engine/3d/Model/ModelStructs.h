@@ -94,6 +94,8 @@ struct ModelData {
     std::vector<MaterialData> materials;
     std::map<std::string, JointWeightData> skinClusterData;
     Node rootNode;
+    // 全メッシュの頂点を囲むローカル空間のAABB（読み込み時に計算する）
+    AABB localBounds{};
 };
 
 static const uint32_t kNumMaxInfluence = 4;
@@ -161,8 +163,17 @@ struct ParticleForGPU {
     Vector4 color;
 };
 
+// まとめて描画するモデル1個分（Object3dInstanced.VS.hlsl の InstanceForGPU と同じ並び）
+struct InstanceForGPU {
+    Matrix4x4 WVP;
+    Matrix4x4 World;
+    Matrix4x4 WorldInverseTranspose;
+    Vector4 color;
+};
+
 struct Particle {
     WorldTransform transform; // 位置
+    Vector3 previousTranslation; // 直前の固定ステップ開始時の位置（描画時の補間用）
     Vector3 emitterPosition;
     Vector3 velocity; // 速度
     Vector3 Acce;
@@ -190,6 +201,8 @@ struct Particle {
     float childLifeScale;     // 子の寿命スケール（親より短く）
 
     BlendMode blendMode = BlendMode::kAdd;
+    uint32_t spawnerId = 0; // 発生元（ParticleSystemに登録したエミッターの番号）
+    uint32_t trailSlot = UINT32_MAX; // 軌跡の点を記録する枠（ParticleTrailPool。軌跡なしはUINT32_MAX）
 
     Particle() : isChild(false), createTrail(false), trailSpawnTimer(0.0f),
                  trailSpawnInterval(0.1f), maxChildren(10), childLifeScale(0.8f) {}
@@ -200,6 +213,8 @@ struct ParticleGroupData {
     std::vector<MaterialData> materials;
     // パーティクルのリスト (std::list<Particle> 型)
     std::list<Particle> particles;
+    // 使い終わったノード（発生のたびに確保しないように取っておく）
+    std::list<Particle> freeParticles;
     // インスタンシングデータ用SRVインデックス
     uint32_t instancingSRVIndex = 0;
     // インスタンシングリソース
@@ -1,6 +1,7 @@
 #define NOMINMAX
 #include "BaseObject.h"
 #include "Scene/SceneManager.h"
+#include "ShowFolder/DirectoryIndex.h"
 #include "ShowFolder/ShowFolder.h"
 
 void BaseObject::Init(const std::string objectName) {
@@ -39,6 +40,12 @@ void BaseObject::Draw(const ViewProjection &viewProjection, Vector3 offSet) {
     // 新しい位置を設定
     transform_->translation_ = newPosition;
 
+    // 視錐台の外ならモデルの描画（定数バッファの更新・コマンドの積み込み）を丸ごと省く
+    if (isCulled_) {
+        transform_->translation_ = currentPosition;
+        return;
+    }
+
     // スケルトンの描画が必要な場合
     if (skeletonDraw_) {
         obj3d_->DrawSkeleton(*transform_, viewProjection);
@@ -58,6 +65,7 @@ void BaseObject::UpdateWorldTransformHierarchy() {
     // まず自分のトランスフォームを更新
     if (transform_) {
         transform_->UpdateMatrix();
+        UpdateWorldBounds();
     }
     // 子を再帰的に更新
     for (auto it = children_.begin(); it != children_.end();) {
@@ -71,6 +79,21 @@ void BaseObject::UpdateWorldTransformHierarchy() {
     }
 }
 
+void BaseObject::UpdateWorldBounds() {
+    AABB localBounds;
+    hasWorldBounds_ = transform_ && obj3d_ && obj3d_->GetLocalBounds(localBounds);
+    if (hasWorldBounds_) {
+        worldBounds_ = TransformAABB(localBounds, transform_->matWorld_);
+    }
+}
+
+void BaseObject::SaveFixedStepTransform() {
+    previousScale_ = transform_->scale_;
+    previousRotation_ = transform_->quateRotation_;
+    previousEulerRotation_ = transform_->eulerRotation_;
+    previousTranslation_ = transform_->translation_;
+}
+
 void BaseObject::UpdateHierarchy() {
     // 自分自身の処理
     Update();
@@ -162,11 +185,13 @@ void BaseObject::CreateModel(const std::string modelname) {
     texturePath_ = obj3d_->GetTextureFilePath(0);
     LoadFromJson();
     AnimaLoadFromJson();
+    UpdateWorldBounds();
 }
 
 void BaseObject::CreatePrimitiveModel(const PrimitiveType &type) {
     obj3d_->CreatePrimitiveModel(type, texturePath_);
     type_ = type;
+    UpdateWorldBounds();
 }
 
 void BaseObject::AddCollider() {
@@ -808,8 +833,19 @@ void BaseObject::DebugObject() {
 void BaseObject::ShowFileSelector() {
 #ifdef _DEBUG
 
-    static int selectedIndex = -1;                              // 選択中のインデックス（-1は未選択）
-    static std::vector<std::string> gltfFiles = GetGltfFiles(); // GLTFファイルのリスト
+    static int selectedIndex = -1;            // 選択中のインデックス（-1は未選択）
+    static std::vector<std::string> gltfFiles; // GLTFファイルのリスト
+    static uint64_t gltfGeneration = 0;
+
+    // ディレクトリに変更があったときだけリストを作り直す
+    uint64_t generation = DirectoryIndex::GetInstance()->GetGeneration();
+    if (gltfFiles.empty() || generation != gltfGeneration) {
+        gltfFiles = GetGltfFiles();
+        gltfGeneration = DirectoryIndex::GetInstance()->GetGeneration();
+        if (selectedIndex >= static_cast<int>(gltfFiles.size())) {
+            selectedIndex = -1;
+        }
+    }
 
     // ファイルリストをCスタイル文字列の配列に変換
     std::vector<const char *> fileNames;
@@ -831,7 +867,7 @@ void BaseObject::ShowFileSelector() {
 
     // ボタンでアニメーションをセット
     if (selectedIndex >= 0 && ImGui::Button("Set Animation")) {
-        obj3d_->SetAnimation(gltfFiles[selectedIndex]); // 選択されたファイルをSetAnimationに渡す
+        SetAnima(gltfFiles[selectedIndex]); // 選択されたファイルをSetAnimationに渡す
     }
 #endif // _DEBUG
 }
@@ -862,13 +898,11 @@ void BaseObject::ShowBlendModeCombo(BlendMode &currentMode) {
 
 std::vector<std::string> BaseObject::GetGltfFiles() {
     std::vector<std::string> gltfFiles;
-    std::filesystem::path baseDir = "resources/models/animation"; // ベースディレクトリ
-    for (const auto &entry : std::filesystem::directory_iterator(baseDir)) {
-        if (entry.path().extension() == ".gltf") {
-            // フルパスではなく相対パスを取得し、区切り文字をスラッシュに変更
-            std::string relativePath = std::filesystem::relative(entry.path(), baseDir.parent_path()).string();
-            std::replace(relativePath.begin(), relativePath.end(), '\\', '/'); // バックスラッシュをスラッシュに置換
-            gltfFiles.push_back(relativePath);
+    // ディレクトリ一覧はキャッシュから取得（ファイル名は名前順、区切り文字はスラッシュ）
+    std::shared_ptr<const DirectoryListing> listing = DirectoryIndex::GetInstance()->GetListingSync("resources/models/animation");
+    for (const DirectoryEntry &entry : listing->files) {
+        if (entry.extension == ".gltf") {
+            gltfFiles.push_back("animation/" + entry.name);
         }
     }
     return gltfFiles;
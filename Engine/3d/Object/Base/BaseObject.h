@@ -4,7 +4,7 @@
 #include "Object/Object3d.h"
 #include "Transform/ObjColor.h"
 #include "Transform/WorldTransform.h"
-#include "collider/Collider.h"
+#include "Collider/Collider.h"
 #include "externals/nlohmann/json.hpp"
 #include <string>
 
@@ -53,6 +53,20 @@ class BaseObject : public Collider {
 
     PrimitiveType type_ = PrimitiveType::kCount;
 
+    // 固定ステップで更新するか（Frameの固定ステップが有効なときだけ効く）
+    bool isUseFixedTimeStep_ = false;
+    // 直前の固定ステップ開始時のSRT（描画時の補間に使う）
+    Vector3 previousScale_ = {1.0f, 1.0f, 1.0f};
+    Quaternion previousRotation_ = Quaternion::IdentityQuaternion();
+    Vector3 previousEulerRotation_ = {};
+    Vector3 previousTranslation_ = {};
+
+    // モデルを囲むワールド空間のAABB（ワールド行列の更新に合わせて計算する）
+    AABB worldBounds_{};
+    bool hasWorldBounds_ = false;
+    // 視錐台の外にあるため、このフレームのモデル描画を省くか
+    bool isCulled_ = false;
+
   private:
     using json = nlohmann::json;
 
@@ -67,6 +81,10 @@ class BaseObject : public Collider {
     virtual void Draw(const ViewProjection &viewProjection, Vector3 offSet = {0.0f, 0.0f, 0.0f});
     void UpdateWorldTransformHierarchy();
     void UpdateHierarchy();
+    // 固定ステップを進める前に現在のSRTを保存する
+    void SaveFixedStepTransform();
+    // モデルのローカルのAABBと現在のワールド行列からワールドのAABBを計算する
+    void UpdateWorldBounds();
 
     virtual void CreateModel(const std::string modelname);
     virtual void CreatePrimitiveModel(const PrimitiveType &type);
@@ -133,6 +151,14 @@ class BaseObject : public Collider {
     bool AnimaIsFinish() { return obj3d_->IsFinish(); }
     bool &GetLighting() { return isLighting_; }
     bool &GetLoop() { return isLoop_; }
+    bool IsUseFixedTimeStep() const { return isUseFixedTimeStep_; }
+    const Vector3 &GetPreviousScale() const { return previousScale_; }
+    const Quaternion &GetPreviousRotation() const { return previousRotation_; }
+    const Vector3 &GetPreviousEulerRotation() const { return previousEulerRotation_; }
+    const Vector3 &GetPreviousTranslation() const { return previousTranslation_; }
+    const AABB &GetWorldBounds() const { return worldBounds_; }
+    bool HasWorldBounds() const { return hasWorldBounds_; }
+    bool IsCulled() const { return isCulled_; }
 
     /// ===================================================
     /// setter
@@ -145,13 +171,23 @@ class BaseObject : public Collider {
     }
     void SetModel(std::unique_ptr<Object3d> obj) {
         obj3d_ = std::move(obj);
+        UpdateWorldBounds();
+    }
+    void SetModel(const std::string &filePath) {
+        obj3d_->SetModel(filePath);
+        UpdateWorldBounds();
+    }
+    void SetAnima(const std::string &filePath) {
+        obj3d_->SetAnimation(filePath);
+        UpdateWorldBounds();
     }
-    void SetModel(const std::string &filePath) { obj3d_->SetModel(filePath); }
-    void SetAnima(const std::string &filePath) { obj3d_->SetAnimation(filePath); }
     // void AddAnimation(std::string filePath) { obj3d_->AddAnimation(filePath); }
     void SetBlendMode(BlendMode blendMode) { obj3d_->SetBlendMode(blendMode); }
     void SetReflect(bool reflect) { reflect_ = reflect; }
     void SetColor(const Vector4 &color) { objColor_.GetColor() = color; }
+    void SetUseFixedTimeStep(bool isUseFixedTimeStep) { isUseFixedTimeStep_ = isUseFixedTimeStep; }
+    // BaseObjectManagerが視錐台の判定結果を設定する
+    void SetCulled(bool isCulled) { isCulled_ = isCulled; }
 
   private:
     void DebugObject();
@@ -2,8 +2,11 @@
 #ifdef _DEBUG
 #include "Debug/ImGui/ImGuizmoManager.h"
 #endif // _DEBUG
-#include <ShowFolder/ShowFolder.h>
 #include <Debug/Log/Logger.h>
+#include <Debug/Profiler/Profiler.h>
+#include <Frame.h>
+#include <FrameStats.h>
+#include <ShowFolder/ShowFolder.h>
 
 BaseObjectManager *BaseObjectManager::instance = nullptr;
 
@@ -30,6 +33,10 @@ void BaseObjectManager::RemoveAllObjects() {
 
     // すべてのオブジェクトを削除
     baseObjects_.clear();
+    transformHierarchy_.Clear();
+    transformHandles_.clear();
+    transformOwners_.clear();
+    isWorldBoundsReady_ = false;
 
 // ImGuizmoManagerもクリア
 #ifdef _DEBUG
@@ -42,20 +49,145 @@ void BaseObjectManager::AddObject(std::unique_ptr<BaseObject> baseObject) {
 #ifdef _DEBUG
     ImGuizmoManager::GetInstance()->AddTarget(baseObject->GetName(), baseObject.get());
 #endif // _DEBUG
-    baseObjects_.emplace(name, std::move(baseObject));
+    BaseObject *object = baseObject.get();
+    if (baseObjects_.emplace(name, std::move(baseObject)).second) {
+        // ワールド変換の一括計算に登録
+        uint32_t handle = transformHierarchy_.Create();
+        transformHandles_[object] = handle;
+        if (transformOwners_.size() <= handle) {
+            transformOwners_.resize(handle + 1);
+        }
+        transformOwners_[handle] = object;
+        object->SaveFixedStepTransform();
+        isWorldBoundsReady_ = false;
+    }
 }
 
 void BaseObjectManager::Update() {
+    PROFILE_FUNCTION();
+    bool isFixedTimeStep = Frame::IsFixedTimeStep();
     for (auto &[name, obj] : baseObjects_) {
+        // 固定ステップで更新するものはFixedUpdateで進める
+        if (isFixedTimeStep && obj->IsUseFixedTimeStep()) {
+            continue;
+        }
         obj->UpdateHierarchy();
-        obj->UpdateWorldTransformHierarchy();
     }
+    UpdateTransforms(isFixedTimeStep);
+}
+
+void BaseObjectManager::FixedUpdate() {
+    PROFILE_FUNCTION();
+    for (auto &[name, obj] : baseObjects_) {
+        if (obj->IsUseFixedTimeStep()) {
+            obj->SaveFixedStepTransform();
+            obj->UpdateHierarchy();
+        }
+    }
+    // 同じステップの衝突判定が補間前の位置を使えるようにしておく
+    UpdateTransforms(false);
+}
+
+void BaseObjectManager::UpdateTransforms(bool isInterpolate) {
+    PROFILE_FUNCTION();
+    float alpha = Frame::GetInterpolationAlpha();
+
+    legacyTransformObjects_.clear();
+
+    // ローカルのSRTと親子関係を反映（値が変わったものだけが再計算の対象になる）
+    for (auto &[object, handle] : transformHandles_) {
+        WorldTransform *transform = object->GetWorldTransform();
+
+        uint32_t parentHandle = TransformHierarchy::kInvalidHandle;
+        if (BaseObject *parent = object->GetParent()) {
+            auto found = transformHandles_.find(parent);
+            if (found == transformHandles_.end()) {
+                // 管理外の親を持つものは従来どおり親を辿って計算する
+                legacyTransformObjects_.push_back(object);
+                continue;
+            }
+            parentHandle = found->second;
+        }
+        transformHierarchy_.SetParent(handle, parentHandle);
+
+        if (transform->isUseQuaternion_) {
+            transform->ApplyEulerRotation();
+        }
+        if (isInterpolate && object->IsUseFixedTimeStep()) {
+            // 描画は直前のステップと現在のステップの間を補間する
+            Vector3 scale = Lerp(object->GetPreviousScale(), transform->scale_, alpha);
+            Vector3 translation = Lerp(object->GetPreviousTranslation(), transform->translation_, alpha);
+            if (transform->isUseQuaternion_) {
+                Quaternion rotation = Quaternion::Slerp(object->GetPreviousRotation(), transform->quateRotation_, alpha);
+                transformHierarchy_.SetLocal(handle, scale, rotation, translation);
+            } else {
+                Vector3 rotation = Lerp(object->GetPreviousEulerRotation(), transform->eulerRotation_, alpha);
+                transformHierarchy_.SetLocal(handle, scale, rotation, translation);
+            }
+        } else if (transform->isUseQuaternion_) {
+            transformHierarchy_.SetLocal(handle, transform->scale_, transform->quateRotation_, transform->translation_);
+        } else {
+            transformHierarchy_.SetLocal(handle, transform->scale_, transform->eulerRotation_, transform->translation_);
+        }
+
+        // 管理外の子は親の計算後に個別に計算する
+        for (BaseObject *child : *object->GetChildren()) {
+            if (child->GetParent() == object && !transformHandles_.contains(child)) {
+                legacyTransformObjects_.push_back(child);
+            }
+        }
+    }
+
+    // 変更があったノードとその子孫だけを計算して転送する
+    transformHierarchy_.Update();
+    transformHierarchy_.ForEachUpdated([this](uint32_t handle, const Matrix4x4 &world) {
+        WorldTransform *transform = transformOwners_[handle]->GetWorldTransform();
+        transform->matWorld_ = world;
+        transform->TransferMatrix();
+        transformOwners_[handle]->UpdateWorldBounds();
+    });
+
+    for (BaseObject *object : legacyTransformObjects_) {
+        object->UpdateWorldTransformHierarchy();
+    }
+    isWorldBoundsReady_ = true;
 }
 
 void BaseObjectManager::Draw(const ViewProjection &viewProjection, Vector3 offSet) {
+    PROFILE_FUNCTION();
+
+    // 描画の前に、モデルを持つものをまとめて視錐台と判定する
+    cullObjects_.clear();
+    cullBounds_.clear();
+    for (auto &[name, obj] : baseObjects_) {
+        obj->SetCulled(false);
+        if (isCullingEnabled_ && isWorldBoundsReady_ && obj->HasWorldBounds()) {
+            const AABB &bounds = obj->GetWorldBounds();
+            cullObjects_.push_back(obj.get());
+            cullBounds_.push_back({bounds.min + offSet, bounds.max + offSet});
+        }
+    }
+    cullResults_.resize(cullBounds_.size());
+    size_t visibleCount = 0;
+    if (!cullBounds_.empty()) {
+        Frustum frustum = MakeFrustum(viewProjection.matView_ * viewProjection.matProjection_);
+        visibleCount = CullAABBs(frustum, cullBounds_.data(), cullBounds_.size(), cullResults_.data());
+    }
+    for (size_t i = 0; i < cullObjects_.size(); ++i) {
+        cullObjects_[i]->SetCulled(cullResults_[i] == 0);
+    }
+    culledObjectCount_ = static_cast<uint32_t>(cullBounds_.size() - visibleCount);
+    visibleObjectCount_ = static_cast<uint32_t>(baseObjects_.size()) - culledObjectCount_;
+    STAT_GAUGE_SET("VisibleObjects", visibleObjectCount_);
+    STAT_GAUGE_SET("CulledObjects", culledObjectCount_);
+
+    // 省いたものもDrawは呼ぶ（派生クラスが持つ弾や影などはそれぞれで描画される）
+    // モデルの描画はいったん積み、状態ごとに並べ替えてからまとめて描画する
+    Object3d::BeginQueue();
     for (auto &[name, obj] : baseObjects_) {
         obj->Draw(viewProjection, offSet);
     }
+    Object3d::FlushQueue();
 }
 
 void BaseObjectManager::UpdateImGui() {
@@ -350,6 +482,14 @@ void BaseObjectManager::RemoveObject(const std::string &name) {
                 targetObject->SetParent(nullptr);
             }
         }
+        // ワールド変換の一括計算から外す
+        auto found = transformHandles_.find(targetObject);
+        if (found != transformHandles_.end()) {
+            transformHierarchy_.Destroy(found->second);
+            transformOwners_[found->second] = nullptr;
+            transformHandles_.erase(found);
+        }
+
         // オブジェクトを削除
         baseObjects_.erase(it);
     }
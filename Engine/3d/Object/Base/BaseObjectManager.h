@@ -1,5 +1,6 @@
 #pragma once
 #include "Object/Base/BaseObject.h"
+#include "Transform/TransformHierarchy.h"
 #include "unordered_map"
 class BaseObjectManager {
   private:
@@ -25,7 +26,10 @@ class BaseObjectManager {
     void AddObject(std::unique_ptr<BaseObject> baseObject);
 
     void Update();
+    // 固定ステップで更新するオブジェクトを1ステップ進める
+    void FixedUpdate();
     void DrawImGui();
+    // 視錐台の外にあるオブジェクトはモデルの描画を省き、残りは状態ごとに並べ替えて描画する
     void Draw(const ViewProjection &viewProjection, Vector3 offSet = {0.0f, 0.0f, 0.0f});
 
     void UpdateImGui();
@@ -56,6 +60,17 @@ class BaseObjectManager {
     void SaveAllParentChildRelationships();
     void LoadAllParentChildRelationships();
     void RemoveObject(const std::string &name);
+
+    /// ===================================================
+    /// 視錐台カリング
+    /// ===================================================
+
+    void SetCullingEnabled(bool isEnabled) { isCullingEnabled_ = isEnabled; }
+    bool IsCullingEnabled() const { return isCullingEnabled_; }
+    // 直前のDrawで描画した・省いたオブジェクトの数
+    uint32_t GetVisibleObjectCount() const { return visibleObjectCount_; }
+    uint32_t GetCulledObjectCount() const { return culledObjectCount_; }
+
   private:
     // 各機能を個別に描画するメソッド
     void DrawSceneSaveModel();
@@ -68,8 +83,26 @@ class BaseObjectManager {
 
     void CreateObject(std::string objectName, std::string modelPath, std::string texturePath = "");
 
+    // ワールド変換を変更があったものだけまとめて計算する
+    // isInterpolate: 固定ステップで更新するものを前のステップとの間で補間するか
+    void UpdateTransforms(bool isInterpolate);
+
   private:
     std::unordered_map<std::string, std::unique_ptr<BaseObject>> baseObjects_;
+    // ワールド変換の一括計算
+    TransformHierarchy transformHierarchy_;
+    std::unordered_map<BaseObject *, uint32_t> transformHandles_;
+    std::vector<BaseObject *> transformOwners_; // ハンドルからオブジェクトを引く
+    std::vector<BaseObject *> legacyTransformObjects_; // 管理外の親子を持つため個別に計算するもの
+    // 視錐台カリング（判定用の配列は使い回す）
+    bool isCullingEnabled_ = true;
+    // 追加・削除のあとワールド行列（とAABB）を計算し直したか。まだならAABBが古いので判定しない
+    bool isWorldBoundsReady_ = false;
+    std::vector<BaseObject *> cullObjects_;
+    std::vector<AABB> cullBounds_;
+    std::vector<uint8_t> cullResults_;
+    uint32_t visibleObjectCount_ = 0;
+    uint32_t culledObjectCount_ = 0;
     std::string sceneName_ = "TitleScene";
     std::string objectName_;
     std::string modelPath_;
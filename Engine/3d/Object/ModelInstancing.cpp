@@ -0,0 +1,82 @@
+#include "ModelInstancing.h"
+#include <algorithm>
+#include <cassert>
+
+void ModelInstanceBatcher::Clear() {
+    entries_.clear();
+}
+
+void ModelInstanceBatcher::Add(uint64_t key, uint32_t drawIndex) {
+    entries_.push_back({key, drawIndex});
+}
+
+void ModelInstanceBatcher::Build(uint32_t minInstanceCount, uint32_t capacity) {
+    groups_.clear();
+    instanceDrawIndices_.clear();
+    singleDrawIndices_.clear();
+
+    // キーごとに並べる（同じキーの中は追加した順）
+    sortedEntries_ = entries_;
+    std::stable_sort(sortedEntries_.begin(), sortedEntries_.end(), [](const Entry &a, const Entry &b) { return a.key < b.key; });
+
+    // 同じキーの並びをまとめる。グループの順は、キーごとの最初の描画の順にする
+    struct Run {
+        uint32_t begin;
+        uint32_t count;
+    };
+    std::vector<Run> runs;
+    for (uint32_t begin = 0; begin < sortedEntries_.size();) {
+        uint32_t end = begin + 1;
+        while (end < sortedEntries_.size() && sortedEntries_[end].key == sortedEntries_[begin].key) {
+            ++end;
+        }
+        runs.push_back({begin, end - begin});
+        begin = end;
+    }
+    std::sort(runs.begin(), runs.end(), [this](const Run &a, const Run &b) {
+        return sortedEntries_[a.begin].drawIndex < sortedEntries_[b.begin].drawIndex;
+    });
+
+    for (const Run &run : runs) {
+        const uint32_t instanceCount = static_cast<uint32_t>(instanceDrawIndices_.size());
+        if (run.count < minInstanceCount || instanceCount + run.count > capacity) {
+            for (uint32_t i = 0; i < run.count; ++i) {
+                singleDrawIndices_.push_back(sortedEntries_[run.begin + i].drawIndex);
+            }
+            continue;
+        }
+        groups_.push_back({sortedEntries_[run.begin].key, instanceCount, run.count});
+        for (uint32_t i = 0; i < run.count; ++i) {
+            instanceDrawIndices_.push_back(sortedEntries_[run.begin + i].drawIndex);
+        }
+    }
+    std::sort(singleDrawIndices_.begin(), singleDrawIndices_.end());
+}
+
+ModelInstancing *ModelInstancing::instance = nullptr;
+
+ModelInstancing *ModelInstancing::GetInstance() {
+    if (instance == nullptr) {
+        instance = new ModelInstancing();
+    }
+    return instance;
+}
+
+void ModelInstancing::Finalize() {
+    delete instance;
+    instance = nullptr;
+}
+
+void ModelInstancing::Initialize(DirectXCommon *dxCommon, SrvManager *srvManager) {
+    instanceResource_ = dxCommon->CreateBufferResource(sizeof(InstanceForGPU) * kMaxInstances);
+    instanceResource_->Map(0, nullptr, reinterpret_cast<void **>(&instanceData_));
+    srvIndex_ = srvManager->Allocate() + 1;
+    srvManager->CreateSRVforStructuredBuffer(srvIndex_, instanceResource_.Get(), kMaxInstances, sizeof(InstanceForGPU));
+}
+
+uint32_t ModelInstancing::Allocate(uint32_t count) {
+    assert(count <= GetRemainingCount());
+    uint32_t firstInstance = usedInstanceCount_;
+    usedInstanceCount_ += count;
+    return firstInstance;
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include "Graphics/Srv/SrvManager.h"
+#include "Model/ModelStructs.h"
+#include <cstdint>
+#include <vector>
+#include <wrl.h>
+
+/// <summary>
+/// 同じ描画状態（モデル・ブレンド・ライティングなど）の描画をまとめてインスタンス描画の単位にする
+/// 状態の組み合わせは呼び出し側が64bitのキーにして渡す。GPUを使わないのでそのまま確認できる
+/// </summary>
+class ModelInstanceBatcher {
+  public:
+    // まとめた描画1回分
+    struct Group {
+        uint64_t key;
+        uint32_t firstInstance; // インスタンスの配列での先頭
+        uint32_t instanceCount;
+    };
+
+    /// <summary>
+    /// 空にする（確保したメモリは残す）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 描画を追加する（drawIndexは呼び出し側の描画データの番号）
+    /// </summary>
+    void Add(uint64_t key, uint32_t drawIndex);
+
+    /// <summary>
+    /// キーごとにまとめる
+    /// minInstanceCountに満たないキーと、capacityに入りきらないキーはまとめずに個別の描画として残す
+    /// グループは最初に追加された順、グループ内は追加した順に並ぶ
+    /// </summary>
+    void Build(uint32_t minInstanceCount, uint32_t capacity);
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    const std::vector<Group> &GetGroups() const { return groups_; }
+    // グループのインスタンスの並び（Group::firstInstanceからinstanceCount個）
+    const std::vector<uint32_t> &GetInstanceDrawIndices() const { return instanceDrawIndices_; }
+    // まとめなかった描画（追加した順）
+    const std::vector<uint32_t> &GetSingleDrawIndices() const { return singleDrawIndices_; }
+
+  private:
+    struct Entry {
+        uint64_t key;
+        uint32_t drawIndex;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<Entry> sortedEntries_;
+    std::vector<Group> groups_;
+    std::vector<uint32_t> instanceDrawIndices_;
+    std::vector<uint32_t> singleDrawIndices_;
+};
+
+/// <summary>
+/// インスタンス描画用の行列と色の置き場（毎フレームCPUで書き込むので、アップロードヒープに置いたまま書き換える）
+/// </summary>
+class ModelInstancing {
+  private:
+    static ModelInstancing *instance;
+
+    ModelInstancing() = default;
+    ~ModelInstancing() = default;
+    ModelInstancing(ModelInstancing &) = delete;
+    ModelInstancing &operator=(ModelInstancing &) = delete;
+
+  public:
+    // 1フレームにまとめて描画できるインスタンスの数
+    static constexpr uint32_t kMaxInstances = 8192;
+
+    static ModelInstancing *GetInstance();
+
+    void Finalize();
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    void Initialize(DirectXCommon *dxCommon, SrvManager *srvManager);
+
+    /// <summary>
+    /// フレームの始めに呼ぶ（使った分を空にする）
+    /// </summary>
+    void BeginFrame() { usedInstanceCount_ = 0; }
+
+    /// <summary>
+    /// count個分の場所を確保して先頭の番号を返す（GetRemainingCount以下で呼ぶ）
+    /// </summary>
+    uint32_t Allocate(uint32_t count);
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    InstanceForGPU *GetInstanceData() const { return instanceData_; }
+    uint32_t GetSrvIndex() const { return srvIndex_; }
+    uint32_t GetRemainingCount() const { return kMaxInstances - usedInstanceCount_; }
+    bool IsInitialized() const { return instanceData_ != nullptr; }
+
+  private:
+    Microsoft::WRL::ComPtr<ID3D12Resource> instanceResource_;
+    InstanceForGPU *instanceData_ = nullptr;
+    uint32_t srvIndex_ = 0;
+    // このフレームで使ったインスタンスの数
+    uint32_t usedInstanceCount_ = 0;
+};
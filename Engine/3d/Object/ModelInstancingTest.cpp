@@ -0,0 +1,111 @@
+#include "Object/ModelInstancing.h"
+#include "Test/Test.h"
+#include <random>
+
+namespace {
+
+constexpr uint32_t kMinInstanceCount = 2;
+
+// 少数のモデルに偏った並び（木や岩を大量に置いたシーン）のキー。1割はブレンドなどの状態が違う
+std::vector<uint64_t> MakeKeys(uint32_t drawCount, uint32_t modelCount) {
+    std::mt19937 random(20240601u);
+    std::uniform_real_distribution<float> skew(0.0f, 1.0f);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    std::vector<uint64_t> keys(drawCount);
+    for (uint64_t &key : keys) {
+        float t = skew(random);
+        uint64_t modelId = static_cast<uint64_t>(t * t * t * modelCount);
+        key = (modelId << 2) | (percent(random) < 10 ? 1u : 0u);
+    }
+    return keys;
+}
+
+// どの描画もちょうど1回ずつ、まとめた描画か個別の描画に入っている
+void CheckCovered(const ModelInstanceBatcher &batcher, uint32_t drawCount) {
+    std::vector<uint32_t> drawCounts(drawCount, 0);
+    for (uint32_t drawIndex : batcher.GetInstanceDrawIndices()) {
+        CHECK(drawIndex < drawCount);
+        if (drawIndex < drawCount) {
+            ++drawCounts[drawIndex];
+        }
+    }
+    for (uint32_t drawIndex : batcher.GetSingleDrawIndices()) {
+        CHECK(drawIndex < drawCount);
+        if (drawIndex < drawCount) {
+            ++drawCounts[drawIndex];
+        }
+    }
+    for (uint32_t count : drawCounts) {
+        CHECK(count == 1);
+    }
+}
+
+// まとめた描画は同じキーだけを追加した順に持ち、最初に追加された順に隙間なく並ぶ
+void CheckGrouped(const ModelInstanceBatcher &batcher, const std::vector<uint64_t> &keys, uint32_t capacity) {
+    const std::vector<ModelInstanceBatcher::Group> &groups = batcher.GetGroups();
+    const std::vector<uint32_t> &drawIndices = batcher.GetInstanceDrawIndices();
+    CHECK(drawIndices.size() <= capacity);
+    uint32_t nextInstance = 0;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        const ModelInstanceBatcher::Group &group = groups[g];
+        CHECK(group.firstInstance == nextInstance);
+        CHECK(group.instanceCount >= kMinInstanceCount);
+        if (g > 0) {
+            CHECK(drawIndices[groups[g - 1].firstInstance] < drawIndices[group.firstInstance]);
+        }
+        for (uint32_t i = group.firstInstance; i < group.firstInstance + group.instanceCount; ++i) {
+            CHECK(keys[drawIndices[i]] == group.key);
+            CHECK(i == group.firstInstance || drawIndices[i - 1] < drawIndices[i]);
+        }
+        nextInstance += group.instanceCount;
+    }
+    CHECK(nextInstance == drawIndices.size());
+}
+
+} // namespace
+
+// 偏った並びは少ない描画回数にまとまる
+TEST(BatchesSkewedScene) {
+    constexpr uint32_t kDrawCount = 10000;
+    std::vector<uint64_t> keys = MakeKeys(kDrawCount, 200);
+    ModelInstanceBatcher batcher;
+    for (uint32_t i = 0; i < kDrawCount; ++i) {
+        batcher.Add(keys[i], i);
+    }
+    batcher.Build(kMinInstanceCount, ModelInstancing::kMaxInstances);
+
+    CheckCovered(batcher, kDrawCount);
+    CheckGrouped(batcher, keys, ModelInstancing::kMaxInstances);
+    CHECK(!batcher.GetGroups().empty());
+    CHECK(batcher.GetGroups().size() + batcher.GetSingleDrawIndices().size() < kDrawCount / 4);
+}
+
+// 置き場に入りきらない分と、数が足りないキーは個別の描画に回る
+TEST(OverflowAndSmallGroupsDrawSingly) {
+    constexpr uint32_t kDrawCount = 2000;
+    constexpr uint32_t kCapacity = 256;
+    std::vector<uint64_t> keys = MakeKeys(kDrawCount, 200);
+    ModelInstanceBatcher batcher;
+    for (uint32_t i = 0; i < kDrawCount; ++i) {
+        batcher.Add(keys[i], i);
+    }
+    batcher.Build(kMinInstanceCount, kCapacity);
+
+    CheckCovered(batcher, kDrawCount);
+    CheckGrouped(batcher, keys, kCapacity);
+    CHECK(!batcher.GetSingleDrawIndices().empty());
+
+    // 個別の描画は追加した順
+    const std::vector<uint32_t> &singles = batcher.GetSingleDrawIndices();
+    for (size_t i = 1; i < singles.size(); ++i) {
+        CHECK(singles[i - 1] < singles[i]);
+    }
+
+    // 作り直しても前の結果は残らない
+    batcher.Clear();
+    batcher.Add(7, 0);
+    batcher.Build(kMinInstanceCount, kCapacity);
+    CHECK(batcher.GetGroups().empty());
+    CHECK(batcher.GetInstanceDrawIndices().empty());
+    CHECK(batcher.GetSingleDrawIndices().size() == 1);
+}
@@ -6,11 +6,20 @@
 #include "Object3dCommon.h"
 #include "Transform/WorldTransform.h"
 #include "cassert"
+#include <algorithm>
+#include <Debug/Profiler/Profiler.h>
 #include <Frame.h>
-#include <line/DrawLine3D.h>
+#include <FrameStats.h>
+#include <Line/DrawLine3D.h>
 #include <myMath.h>
 #include <type/Matrix4x4.h>
 
+RenderQueue Object3d::renderQueue_;
+std::vector<Object3d::QueuedDraw> Object3d::queuedDraws_;
+std::vector<Object3d::InstancedDraw> Object3d::instancedDraws_;
+ModelInstanceBatcher Object3d::instanceBatcher_;
+bool Object3d::isQueueRecording_ = false;
+
 void Object3d::Initialize() {
     objectCommon_ = std::make_unique<Object3dCommon>();
     objectCommon_->Initialize();
@@ -47,6 +56,20 @@ void Object3d::CreatePrimitiveModel(const PrimitiveType &type,std::string texPat
     isPrimitive_ = true;
 }
 
+bool Object3d::GetLocalBounds(AABB &bounds) const {
+    if (!model) {
+        return false;
+    }
+    bounds = model->GetLocalBounds();
+    if (currentModelAnimation_) {
+        // 各軸の大きさの半分ずつ広げる
+        Vector3 margin = (bounds.max - bounds.min) * 0.5f;
+        bounds.min = bounds.min - margin;
+        bounds.max = bounds.max + margin;
+    }
+    return true;
+}
+
 void Object3d::Update(const WorldTransform &worldTransform, const ViewProjection &viewProjection) {
     if (lightGroup) {
         lightGroup->Update(viewProjection);
@@ -60,10 +83,12 @@ void Object3d::Update(const WorldTransform &worldTransform, const ViewProjection
     const Matrix4x4 &viewProjectionMatrix = viewProjection.matView_ * viewProjection.matProjection_;
     worldViewProjectionMatrix = worldMatrix * viewProjectionMatrix;
 
-    transformationMatrixData->WVP = worldViewProjectionMatrix;
-    transformationMatrixData->World = worldMatrix;
+    transformationMatrix_.WVP = worldViewProjectionMatrix;
+    transformationMatrix_.World = worldMatrix;
+    worldPosition_ = {worldMatrix.m[3][0], worldMatrix.m[3][1], worldMatrix.m[3][2]};
     Matrix4x4 worldInverseMatrix = Inverse(worldMatrix);
-    transformationMatrixData->WorldInverseTranspose = Transpose(worldInverseMatrix);
+    transformationMatrix_.WorldInverseTranspose = Transpose(worldInverseMatrix);
+    *transformationMatrixData = transformationMatrix_;
 
     if (model && model->IsGltf()) {
         if (currentModelAnimation_->GetAnimator()->HaveAnimation()) {
@@ -74,6 +99,13 @@ void Object3d::Update(const WorldTransform &worldTransform, const ViewProjection
 }
 
 void Object3d::Draw(const WorldTransform &worldTransform, const ViewProjection &viewProjection, bool reflect, ObjColor *color, bool lighting, bool modelDraw) {
+    if (isQueueRecording_) {
+        // 行列の書き込みとスキニングのディスパッチは積む時点で済ませ、描画コマンドはFlushQueueで積む
+        Update(worldTransform, viewProjection);
+        EnqueueDraw(viewProjection, reflect, color, lighting, modelDraw);
+        return;
+    }
+
     objectCommon_->SetBlendMode(blendMode_);
     Update(worldTransform, viewProjection);
 
@@ -104,6 +136,161 @@ void Object3d::Draw(const WorldTransform &worldTransform, const ViewProjection &
     }
 }
 
+void Object3d::BeginQueue() {
+    renderQueue_.Clear();
+    queuedDraws_.clear();
+    isQueueRecording_ = true;
+}
+
+void Object3d::FlushQueue() {
+    PROFILE_FUNCTION();
+    isQueueRecording_ = false;
+
+    renderQueue_.Clear();
+    BuildInstancedDraws();
+    for (uint32_t i = 0; i < queuedDraws_.size(); ++i) {
+        const QueuedDraw &draw = queuedDraws_[i];
+        if (!draw.isInstanced) {
+            renderQueue_.Add(RenderQueue::MakeKey(draw.pass, draw.pipeline, draw.blendMode, draw.materialId, draw.viewDepth), i);
+        }
+    }
+
+    renderQueue_.Sort();
+    renderQueue_.Execute([](const RenderQueue::Packet &packet, uint32_t stateChanges) {
+        if (packet.payload & kInstancedPayloadBit) {
+            const InstancedDraw &instancedDraw = instancedDraws_[packet.payload & ~kInstancedPayloadBit];
+            const QueuedDraw &draw = queuedDraws_[instancedDraw.drawIndex];
+            draw.object->DrawInstanced(draw, instancedDraw, packet.key, stateChanges);
+            return;
+        }
+        const QueuedDraw &draw = queuedDraws_[packet.payload];
+        draw.object->DrawQueued(draw, packet.key, stateChanges);
+    });
+
+    const RenderQueue::Stats &stats = renderQueue_.GetStats();
+    STAT_GAUGE_SET("PipelineChanges", stats.pipelineChanges);
+    STAT_GAUGE_SET("StateChangesSaved", stats.savedStateChanges);
+    STAT_GAUGE_SET("InstancedDraws", instancedDraws_.size());
+    STAT_GAUGE_SET("InstancedObjects", instanceBatcher_.GetInstanceDrawIndices().size());
+}
+
+uint64_t Object3d::MakeInstanceKey(const QueuedDraw &draw) {
+    // モデルが同じならメッシュ・マテリアル・テクスチャも同じ。色と行列はインスタンスごとに持つ
+    return (static_cast<uint64_t>(draw.object->model->GetId()) << 8) | (static_cast<uint64_t>(draw.blendMode) << 2) |
+           (static_cast<uint64_t>(draw.lighting) << 1) | static_cast<uint64_t>(draw.reflect);
+}
+
+void Object3d::BuildInstancedDraws() {
+    instancedDraws_.clear();
+    instanceBatcher_.Clear();
+
+    ModelInstancing *instancing = ModelInstancing::GetInstance();
+    if (!instancing->IsInitialized()) {
+        return;
+    }
+    for (uint32_t i = 0; i < queuedDraws_.size(); ++i) {
+        if (queuedDraws_[i].isInstanceable) {
+            instanceBatcher_.Add(MakeInstanceKey(queuedDraws_[i]), i);
+        }
+    }
+    instanceBatcher_.Build(kMinInstanceCount, instancing->GetRemainingCount());
+
+    const std::vector<uint32_t> &drawIndices = instanceBatcher_.GetInstanceDrawIndices();
+    if (drawIndices.empty()) {
+        return;
+    }
+    const uint32_t baseInstance = instancing->Allocate(static_cast<uint32_t>(drawIndices.size()));
+    InstanceForGPU *instanceData = instancing->GetInstanceData() + baseInstance;
+
+    for (const ModelInstanceBatcher::Group &group : instanceBatcher_.GetGroups()) {
+        // まとめた中で一番手前の深度で並べる
+        float viewDepth = queuedDraws_[drawIndices[group.firstInstance]].viewDepth;
+        for (uint32_t i = group.firstInstance; i < group.firstInstance + group.instanceCount; ++i) {
+            QueuedDraw &draw = queuedDraws_[drawIndices[i]];
+            draw.isInstanced = true;
+            instanceData[i].WVP = draw.transformationMatrix.WVP;
+            instanceData[i].World = draw.transformationMatrix.World;
+            instanceData[i].WorldInverseTranspose = draw.transformationMatrix.WorldInverseTranspose;
+            instanceData[i].color = draw.color;
+            viewDepth = (std::min)(viewDepth, draw.viewDepth);
+        }
+
+        const QueuedDraw &first = queuedDraws_[drawIndices[group.firstInstance]];
+        uint64_t key = RenderQueue::MakeKey(first.pass, PipelineType::kStandardInstanced, first.blendMode, first.materialId, viewDepth);
+        renderQueue_.Add(key, kInstancedPayloadBit | static_cast<uint32_t>(instancedDraws_.size()));
+        instancedDraws_.push_back({drawIndices[group.firstInstance], baseInstance + group.firstInstance, group.instanceCount});
+    }
+}
+
+void Object3d::EnqueueDraw(const ViewProjection &viewProjection, bool reflect, ObjColor *color, bool lighting, bool modelDraw) {
+    // スキニングのパイプラインはブレンドなしの1種類だけ
+    PipelineType pipeline = PipelineType::kStandard;
+    BlendMode blendMode = blendMode_;
+    HaveAnimation = false;
+    if (model && model->IsGltf() && currentModelAnimation_->GetAnimator()->HaveAnimation()) {
+        HaveAnimation = true;
+        pipeline = PipelineType::kSkinning;
+        blendMode = BlendMode::kNormal;
+    }
+
+    QueuedDraw draw;
+    draw.object = this;
+    draw.transformationMatrix = transformationMatrix_;
+    draw.color = color ? color->GetColor() : Vector4{1.0f, 1.0f, 1.0f, 1.0f};
+    draw.pass = blendMode_ == BlendMode::kNone ? RenderQueue::Pass::kOpaque : RenderQueue::Pass::kTransparent;
+    draw.pipeline = pipeline;
+    draw.blendMode = blendMode;
+    // マテリアルの定数バッファとテクスチャはモデルごとに持つので、モデルが同じなら設定を省ける
+    // （モデルを描かないものは何も設定しないので、描くものとは別の番号にする）
+    draw.materialId = (model && modelDraw) ? model->GetId() : RenderQueue::kMaxMaterialId;
+    const Matrix4x4 &view = viewProjection.matView_;
+    draw.viewDepth = worldPosition_.x * view.m[0][2] + worldPosition_.y * view.m[1][2] + worldPosition_.z * view.m[2][2] + view.m[3][2];
+    draw.lighting = lighting;
+    draw.reflect = reflect;
+    draw.modelDraw = modelDraw;
+    // 半透明は奥から順に描く必要があるのでまとめない
+    draw.isInstanceable = model && modelDraw && pipeline == PipelineType::kStandard && draw.pass == RenderQueue::Pass::kOpaque;
+    draw.isInstanced = false;
+    queuedDraws_.push_back(draw);
+}
+
+void Object3d::DrawQueued(const QueuedDraw &draw, uint64_t key, uint32_t stateChanges) {
+    if (stateChanges & RenderQueue::kPipelineChanged) {
+        PipeLineManager::GetInstance()->DrawCommonSetting(RenderQueue::GetPipeline(key), RenderQueue::GetBlendMode(key));
+        // ルートシグネチャを設定し直すとルート引数が無効になるので、ライトも設定し直す
+        if (lightGroup) {
+            lightGroup->Draw();
+        }
+    }
+
+    // 変換行列設定
+    dxCommon_->GetCommandList()->SetGraphicsRootConstantBufferView(1, transformationMatrixResource->GetGPUVirtualAddress());
+
+    // モデル描画
+    if (draw.modelDraw && model) {
+        bool isMaterialBound = (stateChanges & RenderQueue::kMaterialChanged) == 0;
+        model->Draw(draw.color, draw.lighting, draw.reflect, 1, isMaterialBound);
+    }
+}
+
+void Object3d::DrawInstanced(const QueuedDraw &draw, const InstancedDraw &instancedDraw, uint64_t key, uint32_t stateChanges) {
+    if (stateChanges & RenderQueue::kPipelineChanged) {
+        PipeLineManager::GetInstance()->DrawCommonSetting(PipelineType::kStandardInstanced, RenderQueue::GetBlendMode(key));
+        if (lightGroup) {
+            lightGroup->Draw();
+        }
+        // インスタンスの行列と色
+        SrvManager::GetInstance()->SetGraphicsRootDescriptorTable(1, ModelInstancing::GetInstance()->GetSrvIndex());
+    }
+
+    // このまとまりの先頭のインスタンス番号
+    dxCommon_->GetCommandList()->SetGraphicsRoot32BitConstant(8, instancedDraw.firstInstance, 0);
+
+    // 色はインスタンスごとに頂点シェーダーから渡すので、マテリアルは白にしておく
+    model->Draw(Vector4{1.0f, 1.0f, 1.0f, 1.0f}, draw.lighting, draw.reflect, instancedDraw.instanceCount);
+    STAT_COUNTER_ADD("InstancedDrawCalls", 1);
+}
+
 void Object3d::AnimationUpdate(bool roop) {
     if (currentModelAnimation_) {
         currentModelAnimation_->Update(roop);
@@ -1,8 +1,8 @@
 #pragma once
 #include "Camera/ViewProjection/ViewProjection.h"
 #include "Object/Object3dCommon.h"
-#include "animation/ModelAnimation.h"
-#include "light/LightGroup.h"
+#include "Animation/ModelAnimation.h"
+#include "Light/LightGroup.h"
 #include "string"
 #include "type/Matrix4x4.h"
 #include "type/Vector2.h"
@@ -10,7 +10,9 @@
 #include "type/Vector4.h"
 #include "vector"
 #include <Graphics/PipeLine/PipeLineManager.h>
+#include <Graphics/RenderQueue/RenderQueue.h>
 #include <Model/Model.h>
+#include <Object/ModelInstancing.h>
 #include <Transform/ObjColor.h>
 
 class ModelCommon;
@@ -35,6 +37,8 @@ class Object3d {
     Microsoft::WRL::ComPtr<ID3D12Resource> transformationMatrixResource;
     // バッファリソース内のデータを指すポインタ
     TransformationMatrix *transformationMatrixData = nullptr;
+    // 直前のUpdateで書き込んだ行列（書き込み専用のバッファから読み戻さないように手元にも持つ）
+    TransformationMatrix transformationMatrix_;
 
     Transform transform;
 
@@ -56,6 +60,42 @@ class Object3d {
     std::string modelFilePath_;
     std::unique_ptr<Object3dCommon> objectCommon_;
     BlendMode blendMode_ = BlendMode::kNone;
+    // 直前のUpdateで計算したワールド座標（描画順のキーに使う）
+    Vector3 worldPosition_ = {0.0f, 0.0f, 0.0f};
+
+    // 積んだ描画1回分
+    struct QueuedDraw {
+        Object3d *object;
+        TransformationMatrix transformationMatrix;
+        Vector4 color;
+        RenderQueue::Pass pass;
+        PipelineType pipeline;
+        BlendMode blendMode;
+        uint32_t materialId;
+        float viewDepth;
+        bool lighting;
+        bool reflect;
+        bool modelDraw;
+        bool isInstanceable; // 他の描画とまとめられる（不透明・スキニングなし・モデルあり）
+        bool isInstanced;    // まとめた描画に入った
+    };
+    // まとめた描画1回分（drawIndexはまとめた中の先頭の描画）
+    struct InstancedDraw {
+        uint32_t drawIndex;
+        uint32_t firstInstance;
+        uint32_t instanceCount;
+    };
+    // 描画パケットのpayloadがInstancedDrawの番号であることを示すビット
+    static constexpr uint32_t kInstancedPayloadBit = 1u << 31;
+    // これより少ない描画はまとめずにそのまま描く
+    static constexpr uint32_t kMinInstanceCount = 2;
+
+    // BeginQueue～FlushQueueの間のDrawは積むだけにして、まとめて並べ替えてから描画する
+    static RenderQueue renderQueue_;
+    static std::vector<QueuedDraw> queuedDraws_;
+    static std::vector<InstancedDraw> instancedDraws_;
+    static ModelInstanceBatcher instanceBatcher_;
+    static bool isQueueRecording_;
 
   public: // メンバ関数
     void Initialize();
@@ -102,6 +142,20 @@ class Object3d {
     /// </summary>
     void Draw(const WorldTransform &worldTransform, const ViewProjection &viewProjection, bool reflect, ObjColor *color = nullptr, bool Lighting = true, bool modelDraw = true);
 
+    /// <summary>
+    /// 描画の記録開始（以降のDrawは定数バッファの更新とスキニングだけ行って積む）
+    /// </summary>
+    static void BeginQueue();
+
+    /// <summary>
+    /// 積んだ描画を並べ替えて、同じ状態の設定を省きながら描画する
+    /// 同じモデル・同じ設定の不透明な描画は1回のインスタンス描画にまとめる
+    /// </summary>
+    static void FlushQueue();
+
+    static bool IsQueueRecording() { return isQueueRecording_; }
+    static const RenderQueue::Stats &GetQueueStats() { return renderQueue_.GetStats(); }
+
     /// <summary>
     /// スケルトン描画
     /// </summary>
@@ -126,6 +180,13 @@ class Object3d {
     }
 
     const bool &GetHaveAnimation() const { return HaveAnimation; }
+
+    /// <summary>
+    /// 描画するモデルを囲むローカル空間のAABB
+    /// アニメーションで頂点が動くモデルは読み込み時の姿勢から外れるので広めに取る
+    /// </summary>
+    /// <returns>モデルがなければfalse</returns>
+    bool GetLocalBounds(AABB &bounds) const;
     bool IsFinish() { return currentModelAnimation_->IsFinish(); }
 
     /// <summary>
@@ -160,6 +221,17 @@ class Object3d {
     /// </summary>
     void CreateTransformationMatrix();
 
+    // 描画を積む（Updateの後に呼ぶ）
+    void EnqueueDraw(const ViewProjection &viewProjection, bool reflect, ObjColor *color, bool lighting, bool modelDraw);
+    // 積んだ描画1回分の描画
+    void DrawQueued(const QueuedDraw &draw, uint64_t key, uint32_t stateChanges);
+    // まとめた描画の描画
+    void DrawInstanced(const QueuedDraw &draw, const InstancedDraw &instancedDraw, uint64_t key, uint32_t stateChanges);
+    // 同じインスタンス描画にまとめてよい描画で同じになる値
+    static uint64_t MakeInstanceKey(const QueuedDraw &draw);
+    // まとめられる描画をまとめて、インスタンスの行列と色を書き込む
+    static void BuildInstancedDraws();
+
     void DrawBoneArmature(const Vector3 &parentPos, const Vector3 &childPos, float scale);
 
     void DrawArmatureShape(const Vector3 &startPos, const Vector3 &endPos, float baseWidth, float tipWidth, const Vector4 &color);
@@ -22,4 +22,8 @@ void ParticleCommon::Initialize(DirectXCommon *dxCommon) {
 
 void ParticleCommon::DrawCommonSetting(BlendMode blendMode) {
     psoManager_->DrawCommonSetting(PipelineType::kParticle, blendMode);
+}
+
+void ParticleCommon::DrawTrailCommonSetting(BlendMode blendMode) {
+    psoManager_->DrawCommonSetting(PipelineType::kParticleTrail, blendMode);
 }
\ No newline at end of file
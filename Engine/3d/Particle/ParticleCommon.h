@@ -32,6 +32,11 @@ class ParticleCommon {
     /// </summary>
     void DrawCommonSetting(BlendMode blendMode);
 
+    /// <summary>
+    /// 軌跡の帯の共通描画処理
+    /// </summary>
+    void DrawTrailCommonSetting(BlendMode blendMode);
+
     DirectXCommon *GetDxCommon() const { return dxCommon_; }
 
   private:
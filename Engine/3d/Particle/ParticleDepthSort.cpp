@@ -0,0 +1,86 @@
+#include "ParticleDepthSort.h"
+#include "Job/JobSystem.h"
+#include <algorithm>
+
+const std::vector<uint32_t> &ParticleDepthSorter::Sort(const float *depths, uint32_t count, float minDepth, float maxDepth) {
+    if (keys_.size() < count) {
+        keys_.resize(count);
+        scratchKeys_.resize(count);
+        order_.resize(count);
+        scratchOrder_.resize(count);
+    }
+
+    // 奥ほど小さいキーにする（昇順に並べると奥から手前になる）
+    const float range = maxDepth - minDepth;
+    const float scale = range > 0.0f ? 65535.0f / range : 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+        float quantized = std::clamp((maxDepth - depths[i]) * scale, 0.0f, 65535.0f);
+        keys_[i] = static_cast<uint16_t>(quantized);
+        order_[i] = i;
+    }
+
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    uint32_t chunkCount = 1;
+    if (count >= kParallelThreshold && jobSystem->IsInitialized()) {
+        chunkCount = std::clamp(jobSystem->GetWorkerCount() + 1, 1u, kMaxChunkCount);
+    }
+    histograms_.resize(chunkCount * kBucketCount);
+
+    SortPass(count, chunkCount, 0);
+    SortPass(count, chunkCount, kRadixBits);
+
+    // 呼び出し側が範囲外を読まないように、返す配列は数ちょうどにしておく
+    keys_.resize(count);
+    order_.resize(count);
+    return order_;
+}
+
+void ParticleDepthSorter::SortPass(uint32_t count, uint32_t chunkCount, uint32_t shift) {
+    const uint32_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    auto forEachChunk = [&](auto function) {
+        if (chunkCount == 1) {
+            function(0u);
+            return;
+        }
+        JobSystem::GetInstance()->ParallelFor(chunkCount, 1, [&function](uint32_t begin, uint32_t end) {
+            for (uint32_t chunk = begin; chunk < end; ++chunk) {
+                function(chunk);
+            }
+        });
+    };
+
+    // 分割ごとに桁の数を数える
+    forEachChunk([&](uint32_t chunk) {
+        uint32_t *histogram = histograms_.data() + chunk * kBucketCount;
+        std::fill(histogram, histogram + kBucketCount, 0u);
+        const uint32_t end = (std::min)((chunk + 1) * chunkSize, count);
+        for (uint32_t i = chunk * chunkSize; i < end; ++i) {
+            ++histogram[(keys_[i] >> shift) & (kBucketCount - 1)];
+        }
+    });
+
+    // 桁の小さい順、同じ桁の中は分割の順に書き込み位置を決める（安定になる）
+    uint32_t offset = 0;
+    for (uint32_t bucket = 0; bucket < kBucketCount; ++bucket) {
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            uint32_t &slot = histograms_[chunk * kBucketCount + bucket];
+            uint32_t bucketCount = slot;
+            slot = offset;
+            offset += bucketCount;
+        }
+    }
+
+    // 振り分け（分割ごとに書き込み先が重ならない）
+    forEachChunk([&](uint32_t chunk) {
+        uint32_t *histogram = histograms_.data() + chunk * kBucketCount;
+        const uint32_t end = (std::min)((chunk + 1) * chunkSize, count);
+        for (uint32_t i = chunk * chunkSize; i < end; ++i) {
+            uint32_t destination = histogram[(keys_[i] >> shift) & (kBucketCount - 1)]++;
+            scratchKeys_[destination] = keys_[i];
+            scratchOrder_[destination] = order_[i];
+        }
+    });
+
+    keys_.swap(scratchKeys_);
+    order_.swap(scratchOrder_);
+}
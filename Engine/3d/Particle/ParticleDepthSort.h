@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// パーティクルを奥から手前の順に並べる（アルファブレンドのグループ用）
+/// ビューのZをグループ内の範囲で16bitに量子化し、8bitずつ2回の基数ソートで並べる
+/// 数が多いときはJobSystemで範囲ごとに数え上げ・振り分けを並列に行う（結果は並列でも同じ）
+/// 作業用の配列は使い回すので、数が増えたときしか確保は起きない
+/// </summary>
+class ParticleDepthSorter {
+  public:
+    // これより少ないときは並列にしない
+    static constexpr uint32_t kParallelThreshold = 8192;
+
+    /// <summary>
+    /// 並べ替え
+    /// </summary>
+    /// <param name="depths">ビューのZ（大きいほど奥）</param>
+    /// <param name="count">数</param>
+    /// <param name="minDepth">depthsの最小値</param>
+    /// <param name="maxDepth">depthsの最大値</param>
+    /// <returns>奥から順のインデックス（次に呼ぶまで有効）</returns>
+    const std::vector<uint32_t> &Sort(const float *depths, uint32_t count, float minDepth, float maxDepth);
+
+    /// <summary>
+    /// getter（直前の並べ替えのキー。orderと同じ順）
+    /// </summary>
+    const std::vector<uint16_t> &GetSortedKeys() const { return keys_; }
+
+  private:
+    static constexpr uint32_t kRadixBits = 8;
+    static constexpr uint32_t kBucketCount = 1u << kRadixBits;
+    // 並列にするときの分割数の上限
+    static constexpr uint32_t kMaxChunkCount = 16;
+
+    // shiftの桁で安定に振り分ける（keys_/order_ → 作業用 → 入れ替え）
+    void SortPass(uint32_t count, uint32_t chunkCount, uint32_t shift);
+
+    std::vector<uint16_t> keys_;
+    std::vector<uint16_t> scratchKeys_;
+    std::vector<uint32_t> order_;
+    std::vector<uint32_t> scratchOrder_;
+    // 分割ごとの桁の数（[分割][桁]）。振り分け時には書き込み位置になる
+    std::vector<uint32_t> histograms_;
+};
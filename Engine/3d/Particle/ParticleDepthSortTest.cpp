@@ -0,0 +1,67 @@
+#include "FastRandom.h"
+#include "Job/JobSystem.h"
+#include "Particle/ParticleDepthSort.h"
+#include "Test/Test.h"
+#include <algorithm>
+
+// 奥から順で、同じキーの中は元の順（安定）になっている
+TEST(SortsBackToFrontStably) {
+    ParticleDepthSorter depthSorter;
+    FastRandom random(20240601u);
+    for (uint32_t count : {1u, 100u, 10000u, 50000u}) {
+        std::vector<float> depths(count);
+        for (float &depth : depths) {
+            depth = random.Range(0.1f, 200.0f);
+        }
+        const float minDepth = *std::min_element(depths.begin(), depths.end());
+        const float maxDepth = *std::max_element(depths.begin(), depths.end());
+        const float quantizeStep = (maxDepth - minDepth) / 65535.0f;
+
+        const std::vector<uint32_t> &order = depthSorter.Sort(depths.data(), count, minDepth, maxDepth);
+        const std::vector<uint16_t> &keys = depthSorter.GetSortedKeys();
+        CHECK(order.size() == count);
+        std::vector<bool> isSeen(count, false);
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            CHECK(order[i] < count && !isSeen[order[i]]);
+            if (order[i] < count) {
+                isSeen[order[i]] = true;
+            }
+            if (i > 0) {
+                CHECK(keys[i - 1] < keys[i] || (keys[i - 1] == keys[i] && order[i - 1] < order[i]));
+                CHECK(depths[order[i - 1]] + quantizeStep >= depths[order[i]]);
+            }
+        }
+    }
+}
+
+// 深度がすべて同じなら元の順のまま
+TEST(EqualDepthsKeepOrder) {
+    ParticleDepthSorter depthSorter;
+    std::vector<float> depths(1000, 5.0f);
+    const std::vector<uint32_t> &order = depthSorter.Sort(depths.data(), 1000, 5.0f, 5.0f);
+    CHECK(order.size() == 1000);
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        CHECK(order[i] == i);
+    }
+}
+
+// ジョブで分割して並べても、1スレッドで並べたときと同じ順になる
+TEST(ParallelSortMatchesSingleThread) {
+    constexpr uint32_t kCount = 50000;
+    FastRandom random(7);
+    std::vector<float> depths(kCount);
+    for (float &depth : depths) {
+        // 同じキーが多く出るように粗くする
+        depth = static_cast<float>(random.Range(0, 999));
+    }
+
+    ParticleDepthSorter depthSorter;
+    std::vector<uint32_t> expected = depthSorter.Sort(depths.data(), kCount, 0.0f, 999.0f);
+
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(3);
+    ParticleDepthSorter parallelSorter;
+    const std::vector<uint32_t> &actual = parallelSorter.Sort(depths.data(), kCount, 0.0f, 999.0f);
+    CHECK(actual == expected);
+    jobSystem->Finalize();
+}
@@ -430,6 +430,11 @@ void ParticleEditor::ShowImGuiEditor() {
                 ShowFileSelector();
             }
 
+            // パーティクルグループの設定セクション (紫色)
+            if (ColoredCollapsingHeader("パーティクルグループ設定", 3)) {
+                ShowGroupSettings();
+            }
+
               ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.8f, 0.2f, 0.2f, 1.0f));        // 赤系
             ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.9f, 0.3f, 0.3f, 1.0f)); // ホバー時
             ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.7f, 0.1f, 0.1f, 1.0f));  // 押下時
@@ -490,6 +495,70 @@ void ParticleEditor::ShowFileSelector() {
     }
 }
 
+void ParticleEditor::ShowGroupSettings() {
+    std::vector<ParticleGroup *> groups = particleGroupManager_->GetParticleGroups();
+    if (groups.empty()) {
+        ImGui::Text("パーティクルグループがありません");
+        return;
+    }
+
+    // インデックスの範囲チェック
+    if (selectedGroupIndex_ >= static_cast<int>(groups.size())) {
+        selectedGroupIndex_ = static_cast<int>(groups.size()) - 1;
+    }
+
+    std::vector<std::string> groupNames;
+    for (ParticleGroup *group : groups) {
+        groupNames.push_back(group->GetGroupName());
+    }
+    std::vector<const char *> groupNameCStrs;
+    for (const auto &name : groupNames) {
+        groupNameCStrs.push_back(name.c_str());
+    }
+    ImGui::Combo("グループ選択", &selectedGroupIndex_, groupNameCStrs.data(), static_cast<int>(groupNameCStrs.size()));
+
+    ParticleGroup *group = groups[selectedGroupIndex_];
+    const std::string &groupName = groupNames[selectedGroupIndex_];
+
+    // 距離による間引き（編集した値はすぐ反映する）
+    ImGui::Text("距離による間引き");
+    ImGui::Separator();
+    ParticleLodSetting lodSetting = ParticleSystem::GetInstance()->GetLodSetting(group);
+    bool isChanged = false;
+    isChanged |= ImGui::DragFloat("間引き開始距離", &lodSetting.nearDistance, 0.5f, 0.0f, lodSetting.farDistance);
+    isChanged |= ImGui::DragFloat("最大間引き距離", &lodSetting.farDistance, 0.5f, lodSetting.nearDistance, lodSetting.cullDistance);
+    isChanged |= ImGui::DragFloat("非表示距離", &lodSetting.cullDistance, 0.5f, lodSetting.farDistance, 10000.0f);
+    isChanged |= ImGui::SliderFloat("遠いときの発生数の倍率", &lodSetting.farSpawnRate, 0.0f, 1.0f);
+    int farUpdateInterval = static_cast<int>(lodSetting.farUpdateInterval);
+    if (ImGui::SliderInt("遠いときの更新間隔", &farUpdateInterval, 1, 16)) {
+        lodSetting.farUpdateInterval = static_cast<uint32_t>(farUpdateInterval);
+        isChanged = true;
+    }
+    if (isChanged) {
+        particleGroupManager_->SetLodSetting(groupName, lodSetting);
+    }
+
+    // 描画順
+    ImGui::Spacing();
+    ImGui::Text("描画順");
+    ImGui::Separator();
+    bool isDepthSorted = ParticleSystem::GetInstance()->IsDepthSorted(group);
+    if (ImGui::Checkbox("奥から順に描画する", &isDepthSorted)) {
+        particleGroupManager_->SetDepthSort(groupName, isDepthSorted);
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("通常ブレンドなど半透明を重ねるグループで有効にします（加算なら不要）");
+    }
+
+    ImGui::Spacing();
+    if (ImGui::Button("グループ設定を保存")) {
+        particleGroupManager_->SaveParticleGroup(groupName);
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("resources/jsons/ParticleGroup/ に保存します");
+    }
+}
+
 std::vector<std::string> ParticleEditor::GetJsonFiles() {
     static std::vector<std::string> jsonFiles; // キャッシュされたJSONファイルリスト
     static size_t lastFileCount = 0;           // 最後に取得したJSONファイル数
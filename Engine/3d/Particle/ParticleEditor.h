@@ -44,6 +44,7 @@ class ParticleEditor {
     std::string localTexturePath_;                  // テクスチャパス
     std::string localEmitterName_;                  // エミッター名
     PrimitiveType localType_ = PrimitiveType::None; // プリミティブタイプ
+    int selectedGroupIndex_ = 0;                    // 設定を編集するパーティクルグループ
 
     // CollapsingHeaderの色を定義
     ImVec4 headerColors_[6];
@@ -65,6 +66,9 @@ class ParticleEditor {
     // ファイルセレクタ表示関数
     void ShowFileSelector();
 
+    // パーティクルグループの設定（距離による間引き・描画順）の編集
+    void ShowGroupSettings();
+
     // JSONファイル一覧取得関数
     std::vector<std::string> GetJsonFiles();
 
@@ -1,15 +1,23 @@
 #define NOMINMAX
 #include "ParticleEmitter.h"
 #include "Frame.h"
-#include "line/DrawLine3D.h"
+#include "Line/DrawLine3D.h"
 
 #include "ParticleGroupManager.h"
+#include <Data/JsonHotReloader.h>
 #include <Particle/ParticleEditor.h>
+#include <algorithm>
 #include <set>
 #include <type/Quaternion.h>
 // コンストラクタ
 ParticleEmitter::ParticleEmitter() {}
 
+ParticleEmitter::~ParticleEmitter() {
+    if (JsonHotReloader *hotReloader = JsonHotReloader::TryGetInstance()) {
+        hotReloader->Unwatch(this);
+    }
+}
+
 void ParticleEmitter::Initialize(std::string name) {
     transform_.Initialize();
     if (!name.empty()) {
@@ -17,9 +25,11 @@ void ParticleEmitter::Initialize(std::string name) {
         datas_ = std::make_unique<DataHandler>("Particle", name);
         LoadFromJson();
         Manager_ = std::make_unique<ParticleManager>();
-        Manager_->Initialize(SrvManager::GetInstance());
+        Manager_->SetUseFixedTimeStep(true);
+        Manager_->SetPriority(priority_);
         LoadParticleGroup();
         datas_ = std::make_unique<DataHandler>("Particle", name);
+        JsonHotReloader::GetInstance()->Watch(datas_->GetFilePath(), this, [this]() { OnJsonReloaded(); });
     }
 }
 
@@ -44,13 +54,10 @@ void ParticleEmitter::UpdateOnce() {
 }
 
 void ParticleEmitter::Draw(const ViewProjection &vp_) {
+    // パーティクルの更新と描画はParticleSystemがグループごとにまとめて行う
     Manager_->SetEmitterCenter(transform_.translation_);
 
     transform_.UpdateMatrix();
-    if (Manager_) {
-        Manager_->Update(vp_);
-        Manager_->Draw();
-    }
     DrawEmitter();
 
     size_t activeCount = Manager_->GetActiveParticleCount();
@@ -107,6 +114,7 @@ void ParticleEmitter::SaveToJson() {
     datas_->Save("isVisible", isVisible_);
     datas_->Save("isActive", isActive_);
     datas_->Save("isAuto", isAuto_);
+    datas_->Save("priority", priority_);
     for (const auto &[groupName, setting] : particleSettings_) {
         datas_->Save(groupName + "_translate", setting.translate);
         datas_->Save(groupName + "_rotation", setting.rotation);
@@ -174,6 +182,7 @@ void ParticleEmitter::LoadFromJson() {
     isVisible_ = datas_->Load<bool>("isVisible", true);
     isActive_ = datas_->Load<bool>("isActive", false);
     isAuto_ = datas_->Load<bool>("isAuto", false);
+    priority_ = datas_->Load<ParticlePriority>("priority", ParticlePriority::kNormal);
 
     for (const auto &groupName : particleGroupNames_) {
         ParticleSetting setting;
@@ -240,6 +249,40 @@ void ParticleEmitter::LoadParticleGroup() {
     }
 }
 
+void ParticleEmitter::OnJsonReloaded() {
+    std::vector<std::string> oldGroupNames = particleGroupNames_;
+
+    if (datas_) {
+        LoadFromJson();
+    } else {
+        // クローンは配置中のトランスフォームと再生状態を保ったまま発生設定だけ反映する
+        WorldTransform transform = transform_;
+        bool isActive = isActive_;
+        datas_ = std::make_unique<DataHandler>("Particle", name_);
+        LoadFromJson();
+        datas_.reset();
+        transform_ = transform;
+        isActive_ = isActive;
+    }
+
+    if (!Manager_) {
+        return;
+    }
+    Manager_->SetPriority(priority_);
+    // 外されたグループを取り除き、追加されたグループを付け直す
+    for (const auto &groupName : oldGroupNames) {
+        if (std::find(particleGroupNames_.begin(), particleGroupNames_.end(), groupName) == particleGroupNames_.end()) {
+            Manager_->RemoveParticleGroup(groupName);
+            particleSettings_.erase(groupName);
+        }
+    }
+    for (const auto &groupName : particleGroupNames_) {
+        if (std::find(oldGroupNames.begin(), oldGroupNames.end(), groupName) == oldGroupNames.end()) {
+            AddParticleGroup(ParticleGroupManager::GetInstance()->GetParticleGroup(groupName));
+        }
+    }
+}
+
 ParticleSetting ParticleEmitter::DefaultSetting() {
     ParticleSetting setting;
     setting.translate = {0, 0, 0};
@@ -634,13 +677,16 @@ void ParticleEmitter::DebugParticleData() {
                     ImGui::Indent();
                     ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0.4f, 0.2f, 0.4f, 0.4f));
 
-                    if (ImGui::DragFloat("トレイル生成間隔", &setting.trailSpawnInterval, 0.001f, 0.001f, 10.0f)) {
+                    if (ImGui::DragFloat("トレイル記録間隔", &setting.trailSpawnInterval, 0.001f, 0.001f, 10.0f)) {
                         SetTrailInterval(selectedGroup, setting.trailSpawnInterval);
                     }
+                    if (ImGui::SliderInt("トレイルの点の数", &setting.maxTrailParticles, 1, static_cast<int>(ParticleTrailPool::kMaxPoints))) {
+                        SetMaxTrailParticles(selectedGroup, setting.maxTrailParticles);
+                    }
                     if (ImGui::DragFloat("トレイル生存時間スケール", &setting.trailLifeScale, 0.01f)) {
                         SetTrailLifeScale(selectedGroup, setting.trailLifeScale);
                     }
-                    if (ImGui::DragFloat3("トレイルスケール倍率", &setting.trailScaleMultiplier.x, 0.01f)) {
+                    if (ImGui::DragFloat("トレイル幅倍率", &setting.trailScaleMultiplier.x, 0.01f)) {
                         SetTrailScaleMultiplier(selectedGroup, setting.trailScaleMultiplier);
                     }
                     if (ImGui::DragFloat4("トレイル色彩倍率", &setting.trailColorMultiplier.x, 0.01f)) {
@@ -648,20 +694,6 @@ void ParticleEmitter::DebugParticleData() {
                     }
 
                     ImGui::PopStyleColor();
-
-                    ImGui::PushStyleColor(ImGuiCol_CheckMark, ImVec4(0.8f, 0.2f, 0.8f, 1.0f));
-                    if (ImGui::Checkbox("トレイル速度継承", &setting.trailInheritVelocity)) {
-                        SetTrailVelocityInheritance(selectedGroup, setting.trailInheritVelocity, setting.trailVelocityScale);
-                    }
-                    ImGui::PopStyleColor();
-
-                    if (setting.trailInheritVelocity) {
-                        ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0.4f, 0.2f, 0.4f, 0.4f));
-                        if (ImGui::DragFloat("トレイル速度スケール", &setting.trailVelocityScale, 0.01f)) {
-                            SetTrailVelocityInheritance(selectedGroup, setting.trailInheritVelocity, setting.trailVelocityScale);
-                        }
-                        ImGui::PopStyleColor();
-                    }
                     ImGui::Unindent();
                 }
                 ImGui::TreePop();
@@ -1110,6 +1142,11 @@ void ParticleEmitter::DebugParticleData() {
 
         ImGui::Spacing();
 
+        // 優先度（「設定を保存」でJSONに書き込む）
+        ShowPriorityCombo();
+
+        ImGui::Spacing();
+
     } else {
         ImGui::PopStyleColor(3);
     }
@@ -1138,19 +1175,14 @@ void ParticleEmitter::AddParticleGroup(ParticleGroup *particleGroup) {
     // パーティクルグループ名を取得
     const std::string &groupName = particleGroup->GetGroupName();
 
-    // 独立したコピーを作成
-    ParticleGroup *independentGroup = ParticleGroupManager::GetInstance()->GetIndependentParticleGroup(groupName);
-    if (!independentGroup) {
-        return;
-    }
-
     // 設定が存在しない場合はデフォルト値で初期化
     auto it = particleSettings_.find(groupName);
     if (it == particleSettings_.end()) {
         particleSettings_[groupName] = DefaultSetting();
     }
 
-    Manager_->AddParticleGroup(independentGroup);
+    // クローンも含めて同じグループを共有し、ParticleSystemが1回だけ更新・描画する
+    Manager_->AddParticleGroup(particleGroup);
 }
 
 std::unique_ptr<ParticleEmitter> ParticleEmitter::Clone() const {
@@ -1162,13 +1194,17 @@ std::unique_ptr<ParticleEmitter> ParticleEmitter::Clone() const {
     newEmitter->SetActive(this->isActive_);
     newEmitter->isAuto_ = this->isAuto_;
     newEmitter->isVisible_ = this->isVisible_;
+    newEmitter->priority_ = this->priority_;
     newEmitter->transform_ = this->transform_;
     newEmitter->particleSettings_ = this->particleSettings_;
     newEmitter->particleGroupNames_ = this->particleGroupNames_;
 
-    // ParticleManager は個別に生成して初期化
+    // 発生元はエミッターごとに登録する
     newEmitter->Manager_ = std::make_unique<ParticleManager>();
-    newEmitter->Manager_->Initialize(SrvManager::GetInstance());
+    newEmitter->Manager_->SetPriority(priority_);
+    if (Manager_) {
+        newEmitter->Manager_->SetUseFixedTimeStep(Manager_->IsUseFixedTimeStep());
+    }
 
     // 同じグループを再アタッチ（共有参照でOK）
     for (const auto &groupName : particleGroupNames_) {
@@ -1177,6 +1213,12 @@ std::unique_ptr<ParticleEmitter> ParticleEmitter::Clone() const {
             newEmitter->AddParticleGroup(group);
         }
     }
+
+    // クローンも元のJSONの変更を受け取る
+    if (!name_.empty()) {
+        ParticleEmitter *emitter = newEmitter.get();
+        JsonHotReloader::GetInstance()->Watch(DataHandler("Particle", name_).GetFilePath(), emitter, [emitter]() { emitter->OnJsonReloaded(); });
+    }
     return newEmitter;
 }
 
@@ -1249,4 +1291,21 @@ void ParticleEmitter::ShowBlendModeCombo(BlendMode &currentMode) {
         // ユーザーが選択を変更したときに反映
         currentMode = static_cast<BlendMode>(currentIndex);
     }
+}
+
+void ParticleEmitter::ShowPriorityCombo() {
+    static const char *priorityItems[] = {
+        "低",   // kLow
+        "通常", // kNormal
+        "高"    // kHigh
+    };
+
+    int currentIndex = static_cast<int>(priority_);
+    if (ImGui::Combo("優先度", &currentIndex, priorityItems, IM_ARRAYSIZE(priorityItems))) {
+        SetPriority(static_cast<ParticlePriority>(currentIndex));
+    }
+
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("パーティクルの総数が上限に近づいたとき、低いものから発生を絞ります");
+    }
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ class ParticleEmitter {
   public:
     // コンストラクタでメンバ変数を初期化
     ParticleEmitter();
+    ~ParticleEmitter();
 
     void Initialize(std::string name = {});
 
@@ -25,6 +26,7 @@ class ParticleEmitter {
 
     void UpdateOnce();
 
+    // 枠の表示と、集まるときの目標の更新（パーティクル本体はParticleSystem::Drawでまとめて描く）
     void Draw(const ViewProjection &vp_);
 
     void DrawEmitter();
@@ -68,6 +70,12 @@ class ParticleEmitter {
     void SetActive(bool isActive) { isActive_ = isActive; }
     void SetFrequency(float frequency) { emitFrequency_ = frequency; }
     void SetName(const std::string &name) { name_ = name; }
+    void SetPriority(ParticlePriority priority) {
+        priority_ = priority;
+        if (Manager_) {
+            Manager_->SetPriority(priority);
+        }
+    }
     void SetTrailEnabled(const std::string &groupName, bool enabled);
     void SetTrailInterval(const std::string &groupName, float interval);
     void SetMaxTrailParticles(const std::string &groupName, int maxTrails);
@@ -126,8 +134,11 @@ class ParticleEmitter {
     void SaveToJson();
     void LoadFromJson();
     void LoadParticleGroup();
+    // JSONが外部で書き換えられたときの再適用
+    void OnJsonReloaded();
     ParticleSetting DefaultSetting();
     void ShowBlendModeCombo(BlendMode &currentMode);
+    void ShowPriorityCombo();
     void DebugParticleData();
 
   private:
@@ -138,6 +149,7 @@ class ParticleEmitter {
     bool isVisible_ = false;
     bool isActive_ = false;
     bool isAuto_ = false;
+    ParticlePriority priority_ = ParticlePriority::kNormal; // 予算に近づいたときの絞り方
 
     std::string name_;         // パーティクルの名前
     WorldTransform transform_; // 位置や回転などのトランスフォーム
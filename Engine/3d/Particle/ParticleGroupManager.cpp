@@ -1,4 +1,22 @@
 #include "ParticleGroupManager.h"
+#include "ParticleSystem.h"
+#include <Asset/AssetDatabase.h>
+#include <algorithm>
+
+namespace {
+
+// グループのJSONから距離による間引きの設定を読む（ないキーは既定値）
+ParticleLodSetting LoadLodSetting(const json &jsonData) {
+    ParticleLodSetting lodSetting;
+    lodSetting.nearDistance = jsonData.value("lodNearDistance", lodSetting.nearDistance);
+    lodSetting.farDistance = jsonData.value("lodFarDistance", lodSetting.farDistance);
+    lodSetting.cullDistance = jsonData.value("lodCullDistance", lodSetting.cullDistance);
+    lodSetting.farSpawnRate = jsonData.value("lodFarSpawnRate", lodSetting.farSpawnRate);
+    lodSetting.farUpdateInterval = jsonData.value("lodFarUpdateInterval", lodSetting.farUpdateInterval);
+    return lodSetting;
+}
+
+} // namespace
 
 ParticleGroupManager *ParticleGroupManager::instance = nullptr;
 
@@ -10,47 +28,66 @@ ParticleGroupManager *ParticleGroupManager::GetInstance() {
 }
 
 void ParticleGroupManager::Initialize() {
-    const std::string directoryPath = "resources/jsons/ParticleGroup/";
+    // アセットデータベースに登録されている resources/jsons/ParticleGroup/ 以下のJSONを読む
+    const std::string directoryPath = "jsons/particlegroup/";
 
-    // ディレクトリが存在しない場合は何もしない
-    if (!fs::exists(directoryPath) || !fs::is_directory(directoryPath)) {
-        return;
+    std::vector<std::string> filePaths;
+    for (const auto &[id, entry] : AssetDatabase::GetInstance()->GetEntries()) {
+        if (entry.type != AssetType::kJson) {
+            continue;
+        }
+        std::string normalized = AssetDatabase::NormalizePath(entry.path);
+        // サブフォルダは対象外
+        if (normalized.rfind(directoryPath, 0) == 0 && normalized.find('/', directoryPath.size()) == std::string::npos) {
+            filePaths.push_back(AssetDatabase::GetInstance()->GetFullPath(id));
+        }
     }
+    // 読み込み順を毎回同じにする
+    std::sort(filePaths.begin(), filePaths.end());
+
+    for (const std::string &filePath : filePaths) {
+        std::ifstream file(filePath);
+        if (file.is_open()) {
+            json jsonData = json::parse(file, nullptr, false);
+            if (jsonData.is_discarded()) {
+                continue;
+            }
 
-    for (const auto &entry : fs::directory_iterator(directoryPath)) {
-        if (entry.is_regular_file() && entry.path().extension() == ".json") {
-            std::ifstream file(entry.path());
-            if (file.is_open()) {
-                json jsonData;
-                file >> jsonData;
-
-                // グループ名がなければスキップ
-                if (!jsonData.contains("groupName") || !jsonData["groupName"].is_string()) {
-                    continue;
-                }
+            // グループ名がなければスキップ
+            if (!jsonData.contains("groupName") || !jsonData["groupName"].is_string()) {
+                continue;
+            }
 
-                std::string groupName = jsonData["groupName"];
+            std::string groupName = jsonData["groupName"];
 
-                // テクスチャは存在チェックだけする
-                std::string texturePath = jsonData.value("textrueName", "");
+            // テクスチャは存在チェックだけする
+            std::string texturePath = jsonData.value("textrueName", "");
 
-                // モデルパスが空でないなら CreateParticleGroup を使う
-                std::string modelPath = jsonData.value("modelfilePath", "");
+            // モデルパスが空でないならモデルのグループにする
+            std::string modelPath = jsonData.value("modelfilePath", "");
 
-                if (!modelPath.empty()) {
-                    CreateParticleGroup(groupName, modelPath, texturePath);
-                } else if (jsonData.contains("primitiveType")) {
-                    int primitiveValue = jsonData["primitiveType"].get<int>();
+            auto particleGroup = std::make_unique<ParticleGroup>();
+            if (!modelPath.empty()) {
+                particleGroup->CreateParticleGroup(groupName, modelPath, texturePath);
+            } else if (jsonData.contains("primitiveType")) {
+                int primitiveValue = jsonData["primitiveType"].get<int>();
 
-                    // enum が有効範囲（0以上）であることをチェック
-                    if (primitiveValue >= 0) {
-                        PrimitiveType type = static_cast<PrimitiveType>(primitiveValue);
-                        CreatePrimitiveParticleGroup(groupName, type, texturePath);
-                    }
+                // enum が有効範囲（0以上）でなければスキップ
+                if (primitiveValue < 0) {
+                    continue;
                 }
-
-                file.close();
+                PrimitiveType type = static_cast<PrimitiveType>(primitiveValue);
+                particleGroup->CreatePrimitiveParticleGroup(groupName, type, texturePath);
+            } else {
+                continue;
             }
+
+            // 保存し直す前にグループの設定をParticleSystemへ反映する
+            ParticleSystem::GetInstance()->SetLodSetting(particleGroup.get(), LoadLodSetting(jsonData));
+            ParticleSystem::GetInstance()->SetDepthSort(particleGroup.get(), jsonData.value("isDepthSorted", false));
+            AddParticleGroup(std::move(particleGroup));
+
+            file.close();
         }
     }
 }
@@ -61,6 +98,32 @@ void ParticleGroupManager::Finalize() {
     instance = nullptr;
 }
 void ParticleGroupManager::AddParticleGroup(std::unique_ptr<ParticleGroup> particleGroup) {
+    WriteParticleGroup(particleGroup.get());
+    particleGroups_.emplace_back(std::move(particleGroup));
+}
+
+void ParticleGroupManager::SetLodSetting(const std::string &name, const ParticleLodSetting &lodSetting) {
+    ParticleGroup *particleGroup = GetParticleGroup(name);
+    if (particleGroup) {
+        ParticleSystem::GetInstance()->SetLodSetting(particleGroup, lodSetting);
+    }
+}
+
+void ParticleGroupManager::SetDepthSort(const std::string &name, bool isDepthSorted) {
+    ParticleGroup *particleGroup = GetParticleGroup(name);
+    if (particleGroup) {
+        ParticleSystem::GetInstance()->SetDepthSort(particleGroup, isDepthSorted);
+    }
+}
+
+void ParticleGroupManager::SaveParticleGroup(const std::string &name) {
+    ParticleGroup *particleGroup = GetParticleGroup(name);
+    if (particleGroup) {
+        WriteParticleGroup(particleGroup);
+    }
+}
+
+void ParticleGroupManager::WriteParticleGroup(ParticleGroup *particleGroup) {
     std::unique_ptr<DataHandler> data = std::make_unique<DataHandler>("ParticleGroup", particleGroup->GetGroupName());
     data->Save("groupName", particleGroup->GetGroupName());
     // materialがvectorになったため、最初のmaterialのtextureFilePathを保存
@@ -69,7 +132,15 @@ void ParticleGroupManager::AddParticleGroup(std::unique_ptr<ParticleGroup> parti
     data->Save("textrueName", textureFilePath);
     data->Save("modelfilePath", particleGroup->GetModelPath());
     data->Save("primitiveType", particleGroup->GetPrimitiveType());
-    particleGroups_.emplace_back(std::move(particleGroup));
+    // 距離による間引き
+    const ParticleLodSetting &lodSetting = ParticleSystem::GetInstance()->GetLodSetting(particleGroup);
+    data->Save("lodNearDistance", lodSetting.nearDistance);
+    data->Save("lodFarDistance", lodSetting.farDistance);
+    data->Save("lodCullDistance", lodSetting.cullDistance);
+    data->Save("lodFarSpawnRate", lodSetting.farSpawnRate);
+    data->Save("lodFarUpdateInterval", lodSetting.farUpdateInterval);
+    // 奥から手前の順に並べて描画するか
+    data->Save("isDepthSorted", ParticleSystem::GetInstance()->IsDepthSorted(particleGroup));
 }
 
 void ParticleGroupManager::CreateParticleGroup(const std::string &groupName, const std::string &filename, const std::string &texturePath) {
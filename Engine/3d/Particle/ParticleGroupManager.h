@@ -2,6 +2,7 @@
 
 #include "Data/DataHandler.h"
 #include "ParticleGroup.h"
+#include "ParticleSystem.h"
 #include "memory"
 
 class ParticleGroupManager {
@@ -30,6 +31,15 @@ class ParticleGroupManager {
     void CreateParticleGroup(const std::string &groupName, const std::string &filename, const std::string &texturePath = {});
     void CreatePrimitiveParticleGroup(const std::string &groupName, PrimitiveType type, const std::string &texturePath);
 
+    // グループの距離による間引きをParticleSystemに反映する（JSONへの書き込みはSaveParticleGroup）
+    void SetLodSetting(const std::string &name, const ParticleLodSetting &lodSetting);
+
+    // グループを奥から手前の順に並べて描画するか（kNormalなどのアルファブレンドのグループ用）
+    void SetDepthSort(const std::string &name, bool isDepthSorted);
+
+    // グループの設定をJSONに保存する
+    void SaveParticleGroup(const std::string &name);
+
     // 既存の取得メソッド（参照用）
     ParticleGroup *GetParticleGroup(const std::string &name) {
         for (const auto &group : particleGroups_) {
@@ -63,18 +73,6 @@ class ParticleGroupManager {
         return copiedGroup;
     }
 
-    // エミッター用の独立したパーティクルグループを取得
-    ParticleGroup *GetIndependentParticleGroup(const std::string &name) {
-        auto copiedGroup = CreateParticleGroupCopy(name);
-        if (!copiedGroup) {
-            return nullptr;
-        }
-
-        ParticleGroup *groupPtr = copiedGroup.get();
-        independentGroups_.emplace_back(std::move(copiedGroup));
-        return groupPtr;
-    }
-
     std::vector<ParticleGroup *> GetParticleGroups() {
         std::vector<ParticleGroup *> result;
         for (const auto &group : particleGroups_) {
@@ -83,12 +81,14 @@ class ParticleGroupManager {
         return result;
     }
 
+  private:
+    // resources/jsons/ParticleGroup/ にグループの設定を書き込む
+    void WriteParticleGroup(ParticleGroup *particleGroup);
+
   private:
     /// ============================================
     /// private variaus
     /// ============================================
 
     std::vector<std::unique_ptr<ParticleGroup>> particleGroups_;
-    // エミッター用の独立したパーティクルグループを管理
-    std::vector<std::unique_ptr<ParticleGroup>> independentGroups_;
 };
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include <Model/ModelStructs.h>
+#include "type/Vector3.h"
+#include "type/Vector4.h"
+#include <cstdint>
+
+struct ParticleSetting {
+    int maxTrailParticles = 1; // 軌跡の点の数（ParticleTrailPool::kMaxPointsまで）
+    float gatherStartRatio = 0.5f;
+    float gatherStrength = 2.0f;
+    float trailSpawnInterval = 0.05f; // 軌跡の点を記録する間隔
+    float trailLifeScale = 0.5f;      // 軌跡の点が残る時間（パーティクルの寿命に対する倍率）
+    float lifeTimeMin;
+    float lifeTimeMax;
+    float gravity;
+    float alphaMin;
+    float alphaMax;
+    float scaleMin;
+    float scaleMax;
+    float trailVelocityScale = 0.3f; // 軌跡の速度スケール（帯の軌跡では使わない。古いJSONとの互換用）
+    Vector3 translate;
+    Vector3 rotation;
+    Vector3 scale;
+    Vector3 velocityMin;
+    Vector3 velocityMax;
+    Vector3 particleStartScale;
+    Vector3 particleEndScale;
+    Vector3 startAcce;
+    Vector3 endAcce;
+    Vector3 startRote;
+    Vector3 endRote;
+    Vector3 rotateVelocityMin;
+    Vector3 rotateVelocityMax;
+    Vector3 allScaleMax;
+    Vector3 allScaleMin;
+    Vector3 rotateStartMax;
+    Vector3 rotateStartMin;
+    Vector3 trailScaleMultiplier = {0.8f, 0.8f, 0.8f}; // 軌跡の帯の幅の倍率（xをパーティクルの大きさにかける）
+    Vector4 startColor = {1.0f, 1.0f, 1.0f, 1.0f};
+    Vector4 endColor = {1.0f, 1.0f, 1.0f, 1.0f};
+    Vector4 trailColorMultiplier = {1.0f, 1.0f, 1.0f, 0.7f}; // 軌跡の帯の色の倍率（パーティクルの色にかける）
+    uint32_t count;
+    bool enableTrail = false;         // 軌跡機能を有効にするか
+    bool trailInheritVelocity = true; // 軌跡が親の速度を継承するか（帯の軌跡では使わない。古いJSONとの互換用）
+    bool isRandomColor = false;
+    bool isBillboard = false;
+    bool isBillboardX = false;
+    bool isBillboardY = false;
+    bool isBillboardZ = false;
+    bool isRandomRotate = false;
+    bool isRotateVelocity = false;
+    bool isAcceMultiply = false;
+    bool isRandomSize = false;
+    bool isRandomAllSize = false;
+    bool isSinMove = false;
+    bool isFaceDirection = false;
+    bool isEndScale = false;
+    bool isEmitOnEdge = false;
+    bool isGatherMode = false;
+
+    BlendMode blendMode = BlendMode::kAdd;
+};
@@ -0,0 +1,865 @@
+#define NOMINMAX
+#include "ParticleSystem.h"
+#include "Engine/Frame/Frame.h"
+#include "Engine/Frame/FrameStats.h"
+#include "Debug/Profiler/Profiler.h"
+#include "Memory/AllocationTracker.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+ParticleSystem *ParticleSystem::instance = nullptr;
+
+namespace {
+// 優先度ごとに使える予算の割合（低いものから先に絞られる）
+constexpr float kPriorityBudgetRate[] = {0.6f, 0.85f, 1.0f};
+} // namespace
+
+ParticleSystem *ParticleSystem::GetInstance() {
+    if (instance == nullptr) {
+        instance = new ParticleSystem();
+    }
+    return instance;
+}
+
+void ParticleSystem::Initialize(SrvManager *srvManager) {
+    particleCommon = ParticleCommon::GetInstance();
+    srvManager_ = srvManager;
+    // 実行ごとに変える（再現したいときは発生元ごとにSetSpawnerSeedで上書きする）
+    std::random_device seedGenerator;
+    baseSeed_ = (static_cast<uint64_t>(seedGenerator()) << 32) | seedGenerator();
+
+    // 軌跡の帯（毎フレームCPUで書き込むので、アップロードヒープに置いたまま書き換える）
+    DirectXCommon *dxCommon = particleCommon->GetDxCommon();
+    trailVertexResource_ = dxCommon->CreateBufferResource(sizeof(ParticleTrailVertex) * kMaxTrailVertices);
+    trailVertexBufferView_.BufferLocation = trailVertexResource_->GetGPUVirtualAddress();
+    trailVertexBufferView_.SizeInBytes = UINT(sizeof(ParticleTrailVertex) * kMaxTrailVertices);
+    trailVertexBufferView_.StrideInBytes = sizeof(ParticleTrailVertex);
+    trailVertexResource_->Map(0, nullptr, reinterpret_cast<void **>(&trailVertexData_));
+
+    trailIndexResource_ = dxCommon->CreateBufferResource(sizeof(uint32_t) * kMaxTrailIndices);
+    trailIndexBufferView_.BufferLocation = trailIndexResource_->GetGPUVirtualAddress();
+    trailIndexBufferView_.SizeInBytes = UINT(sizeof(uint32_t) * kMaxTrailIndices);
+    trailIndexBufferView_.Format = DXGI_FORMAT_R32_UINT;
+    trailIndexResource_->Map(0, nullptr, reinterpret_cast<void **>(&trailIndexData_));
+
+    trailCameraResource_ = dxCommon->CreateBufferResource(sizeof(Matrix4x4));
+    trailCameraResource_->Map(0, nullptr, reinterpret_cast<void **>(&trailCameraData_));
+    *trailCameraData_ = MakeIdentity4x4();
+}
+
+void ParticleSystem::Finalize() {
+    delete instance;
+    instance = nullptr;
+}
+
+void ParticleSystem::Update(const ViewProjection &viewProjection) {
+    ALLOCATION_SCOPE("Particle");
+    PROFILE_FUNCTION();
+
+    // 前のフレームで絞った数を確定する
+    throttledParticleCount_ = throttledInFrame_;
+    throttledInFrame_ = 0;
+    STAT_COUNTER_ADD("ThrottledParticles", throttledParticleCount_);
+
+    // 間引きは前のステップで求めた範囲で決める（更新の間隔は次のフレームから効く）
+    Matrix4x4 cameraMatrix = InverseAffine(viewProjection.matView_);
+    Vector3 cameraPosition = {cameraMatrix.m[3][0], cameraMatrix.m[3][1], cameraMatrix.m[3][2]};
+    UpdateLod(MakeFrustum(viewProjection.matView_ * viewProjection.matProjection_), cameraPosition);
+
+    if (Frame::IsFixedTimeStep()) {
+        // 固定ステップを使うグループは貯まった時間の分だけ固定の刻みで進め、描画は前のステップとの間を補間する
+        Simulate(Frame::DeltaTime(), Frame::GetFixedStepCount(), Frame::FixedDeltaTime());
+        UpdateInstancingData(viewProjection, Frame::GetInterpolationAlpha());
+        BuildTrailVertices(cameraPosition, Frame::GetInterpolationAlpha());
+    } else {
+        Simulate(Frame::DeltaTime());
+        UpdateInstancingData(viewProjection, 1.0f);
+        BuildTrailVertices(cameraPosition, 1.0f);
+    }
+    if (trailCameraData_) {
+        *trailCameraData_ = viewProjection.matView_ * viewProjection.matProjection_;
+    }
+}
+
+void ParticleSystem::Clear() {
+    for (Batch &batch : batches_) {
+        // ノードは解放せずにプールへ戻す
+        ParticleGroupData &groupData = batch.particleGroup->GetParticleGroupData();
+        groupData.freeParticles.splice(groupData.freeParticles.end(), groupData.particles);
+        groupData.instanceCount = 0;
+        batch.trailPool.Clear();
+        batch.trailIndexCount = 0;
+        for (uint32_t id = 0; id < batch.spawners.size(); ++id) {
+            batch.spawners[id].liveCount = 0;
+            batch.spawners[id].hasBounds = false;
+            if (batch.spawners[id].isReleased) {
+                OnParticleRemoved(batch, id);
+            }
+        }
+    }
+}
+
+ParticleSystem::Batch &ParticleSystem::FindOrAddBatch(ParticleGroup *particleGroup) {
+    // 同じグループはまとめる
+    auto it = std::find_if(batches_.begin(), batches_.end(), [particleGroup](const Batch &batch) {
+        return batch.particleGroup == particleGroup;
+    });
+    if (it != batches_.end()) {
+        return *it;
+    }
+    Batch &batch = batches_.emplace_back();
+    batch.particleGroup = particleGroup;
+    return batch;
+}
+
+ParticleSpawnerHandle ParticleSystem::RegisterSpawner(ParticleGroup *particleGroup) {
+    assert(particleGroup);
+    ParticleSpawnerHandle handle;
+
+    Batch &batch = FindOrAddBatch(particleGroup);
+    handle.batchIndex = static_cast<uint32_t>(&batch - batches_.data());
+    if (!batch.freeSpawnerIds.empty()) {
+        handle.spawnerId = batch.freeSpawnerIds.back();
+        batch.freeSpawnerIds.pop_back();
+        batch.spawners[handle.spawnerId] = Spawner{};
+    } else {
+        handle.spawnerId = static_cast<uint32_t>(batch.spawners.size());
+        batch.spawners.emplace_back();
+    }
+    batch.spawners[handle.spawnerId].random.Seed(baseSeed_ + spawnerSerial_++);
+    return handle;
+}
+
+void ParticleSystem::ReleaseSpawner(ParticleSpawnerHandle &handle) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    Batch &batch = batches_[handle.batchIndex];
+    Spawner &spawner = batch.spawners[handle.spawnerId];
+    spawner.isReleased = true;
+    // 生きているパーティクルがなければすぐ使い回せる
+    if (spawner.liveCount == 0) {
+        batch.freeSpawnerIds.push_back(handle.spawnerId);
+    }
+    handle = ParticleSpawnerHandle{};
+}
+
+void ParticleSystem::SetSpawnerSetting(const ParticleSpawnerHandle &handle, const ParticleSetting &setting) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    batches_[handle.batchIndex].spawners[handle.spawnerId].setting = setting;
+}
+
+void ParticleSystem::SetSpawnerCenter(const ParticleSpawnerHandle &handle, const Vector3 &center) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    batches_[handle.batchIndex].spawners[handle.spawnerId].center = center;
+}
+
+void ParticleSystem::SetSpawnerPriority(const ParticleSpawnerHandle &handle, ParticlePriority priority) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    batches_[handle.batchIndex].spawners[handle.spawnerId].priority = priority;
+}
+
+void ParticleSystem::SetLodSetting(ParticleGroup *particleGroup, const ParticleLodSetting &lodSetting) {
+    assert(particleGroup);
+    FindOrAddBatch(particleGroup).lodSetting = lodSetting;
+}
+
+const ParticleLodSetting &ParticleSystem::GetLodSetting(ParticleGroup *particleGroup) {
+    assert(particleGroup);
+    return FindOrAddBatch(particleGroup).lodSetting;
+}
+
+void ParticleSystem::SetDepthSort(ParticleGroup *particleGroup, bool isDepthSorted) {
+    assert(particleGroup);
+    FindOrAddBatch(particleGroup).isDepthSorted = isDepthSorted;
+}
+
+bool ParticleSystem::IsDepthSorted(ParticleGroup *particleGroup) {
+    assert(particleGroup);
+    return FindOrAddBatch(particleGroup).isDepthSorted;
+}
+
+void ParticleSystem::SetUseFixedTimeStep(ParticleGroup *particleGroup, bool isUseFixedTimeStep) {
+    assert(particleGroup);
+    FindOrAddBatch(particleGroup).isUseFixedTimeStep = isUseFixedTimeStep;
+}
+
+void ParticleSystem::SetSpawnerSeed(const ParticleSpawnerHandle &handle, uint64_t seed) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    batches_[handle.batchIndex].spawners[handle.spawnerId].random.Seed(seed);
+}
+
+void ParticleSystem::Spawn(const ParticleSpawnerHandle &handle) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    Batch &batch = batches_[handle.batchIndex];
+    Spawner &spawner = batch.spawners[handle.spawnerId];
+    if (spawner.setting.count == 0) {
+        return;
+    }
+
+    // 距離による間引き（端数は持ち越して、少ない発生数でも平均が倍率どおりになるようにする）
+    float scaledCount = static_cast<float>(spawner.setting.count) * spawner.spawnRate + spawner.spawnRemainder;
+    uint32_t lodCount = static_cast<uint32_t>(scaledCount);
+    spawner.spawnRemainder = scaledCount - static_cast<float>(lodCount);
+    if (lodCount < spawner.setting.count) {
+        throttledInFrame_ += spawner.setting.count - lodCount;
+    }
+
+    const uint32_t count = ClampToBudget(batch, spawner, lodCount);
+    if (count == 0) {
+        return;
+    }
+    ParticleGroupData &groupData = batch.particleGroup->GetParticleGroupData();
+
+    // 足りない分だけプールに足す（足りていれば確保は起きない）
+    if (groupData.freeParticles.size() < count) {
+        groupData.freeParticles.resize(count);
+    }
+
+    // 軌跡は点の数だけの枠を割り当て、発生位置を最初の点にする
+    const uint32_t trailPointCount = static_cast<uint32_t>(std::clamp(spawner.setting.maxTrailParticles, 1, static_cast<int>(ParticleTrailPool::kMaxPoints)));
+
+    // プールの先頭count個をその場で初期化して、まとめてリストの末尾に付け替える
+    auto last = groupData.freeParticles.begin();
+    for (uint32_t nowCount = 0; nowCount < count; ++nowCount, ++last) {
+        MakeNewParticle(*last, spawner.random, spawner.setting);
+        last->spawnerId = handle.spawnerId;
+        if (spawner.setting.enableTrail) {
+            last->trailSlot = batch.trailPool.Acquire(trailPointCount);
+            batch.trailPool.Push(last->trailSlot, last->transform.translation_, 0.0f);
+        }
+    }
+    groupData.particles.splice(groupData.particles.end(), groupData.freeParticles, groupData.freeParticles.begin(), last);
+    spawner.liveCount += count;
+    STAT_COUNTER_ADD("SpawnedParticles", count);
+}
+
+void ParticleSystem::ReserveParticles(const ParticleSpawnerHandle &handle, size_t count) {
+    if (!handle.IsValid()) {
+        return;
+    }
+    auto &freeParticles = batches_[handle.batchIndex].particleGroup->GetParticleGroupData().freeParticles;
+    if (freeParticles.size() < count) {
+        freeParticles.resize(count);
+    }
+}
+
+size_t ParticleSystem::GetActiveParticleCount(const ParticleSpawnerHandle &handle) const {
+    if (!handle.IsValid()) {
+        return 0;
+    }
+    return batches_[handle.batchIndex].spawners[handle.spawnerId].liveCount;
+}
+
+bool ParticleSystem::IsSpawnerCulled(const ParticleSpawnerHandle &handle) const {
+    if (!handle.IsValid()) {
+        return false;
+    }
+    return batches_[handle.batchIndex].spawners[handle.spawnerId].isCulled;
+}
+
+size_t ParticleSystem::GetActiveParticleCount() const {
+    size_t totalCount = 0;
+    for (const Batch &batch : batches_) {
+        totalCount += batch.particleGroup->GetParticleGroupData().particles.size();
+    }
+    return totalCount;
+}
+
+void ParticleSystem::OnParticleRemoved(Batch &batch, uint32_t spawnerId) {
+    Spawner &spawner = batch.spawners[spawnerId];
+    if (spawner.liveCount > 0) {
+        --spawner.liveCount;
+    }
+    if (spawner.isReleased && spawner.liveCount == 0 &&
+        std::find(batch.freeSpawnerIds.begin(), batch.freeSpawnerIds.end(), spawnerId) == batch.freeSpawnerIds.end()) {
+        batch.freeSpawnerIds.push_back(spawnerId);
+    }
+}
+
+uint32_t ParticleSystem::ClampToBudget(const Batch &batch, const Spawner &spawner, uint32_t count) {
+    // 優先度の低いものほど早く絞る
+    size_t limit = static_cast<size_t>(static_cast<float>(particleBudget_) * kPriorityBudgetRate[static_cast<int>(spawner.priority)]);
+    size_t total = GetActiveParticleCount();
+    size_t room = total < limit ? limit - total : 0;
+
+    // グループの上限を超えた分は描画できないので、発生させない
+    size_t groupCount = batch.particleGroup->GetParticleGroupData().particles.size();
+    size_t maxInstance = batch.particleGroup->GetMaxInstance();
+    room = (std::min)(room, groupCount < maxInstance ? maxInstance - groupCount : 0);
+
+    uint32_t allowed = static_cast<uint32_t>((std::min)(static_cast<size_t>(count), room));
+    throttledInFrame_ += count - allowed;
+    return allowed;
+}
+
+std::list<Particle>::iterator ParticleSystem::RemoveParticle(Batch &batch, std::list<Particle>::iterator it) {
+    OnParticleRemoved(batch, it->spawnerId);
+    batch.trailPool.Release(it->trailSlot);
+    it->trailSlot = ParticleTrailPool::kInvalidSlot;
+    ParticleGroupData &groupData = batch.particleGroup->GetParticleGroupData();
+    auto next = std::next(it);
+    groupData.freeParticles.splice(groupData.freeParticles.end(), groupData.particles, it);
+    return next;
+}
+
+void ParticleSystem::Simulate(float deltaTime) {
+    for (Batch &batch : batches_) {
+        SimulateBatch(batch, deltaTime);
+    }
+}
+
+void ParticleSystem::Simulate(float deltaTime, int fixedStepCount, float fixedDeltaTime) {
+    for (Batch &batch : batches_) {
+        if (!batch.isUseFixedTimeStep) {
+            SimulateBatch(batch, deltaTime);
+            continue;
+        }
+        for (int i = 0; i < fixedStepCount; ++i) {
+            SimulateBatch(batch, fixedDeltaTime);
+        }
+    }
+}
+
+void ParticleSystem::SimulateBatch(Batch &batch, float deltaTime) {
+    ++batch.stepCount;
+    for (Spawner &spawner : batch.spawners) {
+        spawner.hasBounds = false;
+    }
+
+    // 寿命が尽きたものはその場で取り除き、ノードはプールに戻す（次の発生で使い回す）
+    auto &particles = batch.particleGroup->GetParticleGroupData().particles;
+    for (auto it = particles.begin(); it != particles.end();) {
+        Particle &particle = *it;
+        if (particle.lifeTime <= particle.currentTime) {
+            it = RemoveParticle(batch, it);
+            continue;
+        }
+
+        // 動きは発生元の設定に従う（同じグループでもエミッターごとに設定が違う）
+        Spawner &spawner = batch.spawners[particle.spawnerId];
+        const ParticleSetting &particleSetting = spawner.setting;
+
+        // 発生元ごとの範囲（大きさの分だけ広げる）
+        float extent = (std::max)({std::abs(particle.transform.scale_.x), std::abs(particle.transform.scale_.y), std::abs(particle.transform.scale_.z)});
+        Vector3 particleMin = particle.transform.translation_ - Vector3{extent, extent, extent};
+        Vector3 particleMax = particle.transform.translation_ + Vector3{extent, extent, extent};
+        if (spawner.hasBounds) {
+            spawner.bounds.min = {(std::min)(spawner.bounds.min.x, particleMin.x), (std::min)(spawner.bounds.min.y, particleMin.y), (std::min)(spawner.bounds.min.z, particleMin.z)};
+            spawner.bounds.max = {(std::max)(spawner.bounds.max.x, particleMax.x), (std::max)(spawner.bounds.max.y, particleMax.y), (std::max)(spawner.bounds.max.z, particleMax.z)};
+        } else {
+            spawner.bounds = {particleMin, particleMax};
+            spawner.hasBounds = true;
+        }
+
+        // 描画時の補間用にステップ開始時の位置を残す
+        particle.previousTranslation = particle.transform.translation_;
+
+        // 遠い・画面外の発生元は数ステップに1回、まとめた時間で進める（発生元ごとに進めるステップをずらす）
+        if (spawner.updateInterval > 1 && (batch.stepCount + particle.spawnerId) % spawner.updateInterval != 0) {
+            ++it;
+            continue;
+        }
+        const float stepTime = deltaTime * static_cast<float>(spawner.updateInterval);
+
+        // 軌跡の点を一定間隔で記録する（パーティクルは作らず、枠の一番古い点を上書きする）
+        if (particle.trailSlot != ParticleTrailPool::kInvalidSlot) {
+            particle.trailSpawnTimer += stepTime;
+            if (particle.trailSpawnTimer >= particleSetting.trailSpawnInterval) {
+                batch.trailPool.Push(particle.trailSlot, particle.transform.translation_, particle.currentTime);
+                particle.trailSpawnTimer = 0.0f;
+            }
+        }
+
+        float t = particle.currentTime / particle.lifeTime;
+        t = std::clamp(t, 0.0f, 1.0f);
+
+        // --- 色補間処理を追加 ---
+        if (!particleSetting.isRandomColor) {
+            const Vector4 &startColor = particleSetting.startColor;
+            const Vector4 &endColor = particleSetting.endColor;
+            particle.color.x = (1.0f - t) * startColor.x + t * endColor.x;
+            particle.color.y = (1.0f - t) * startColor.y + t * endColor.y;
+            particle.color.z = (1.0f - t) * startColor.z + t * endColor.z;
+            // アルファは既存ロジック
+        }
+
+        if (particleSetting.isSinMove) {
+            float waveScale = 0.5f * (sin(t * DirectX::XM_PI * 18.0f) + 1.0f);
+            float maxScale = (1.0f - t);
+            particle.transform.scale_ =
+                particle.startScale * waveScale * maxScale;
+        } else {
+            particle.transform.scale_ =
+                (1.0f - t) * particle.startScale + t * particle.endScale;
+            if (!(particleSetting.isGatherMode && t >= particleSetting.gatherStartRatio)) {
+                particle.color.w = particle.initialAlpha - (particle.currentTime / particle.lifeTime);
+            }
+        }
+
+        bool isGathering = false;
+        if (particleSetting.isGatherMode && t >= particleSetting.gatherStartRatio) {
+            particle.emitterPosition = spawner.center;
+            isGathering = true;
+            float gatherFactor = (t - particleSetting.gatherStartRatio) / (1.0f - particleSetting.gatherStartRatio);
+            gatherFactor = std::clamp(gatherFactor, 0.0f, 1.0f);
+            Vector3 toEmitter = particle.emitterPosition - particle.transform.translation_;
+            float distance = toEmitter.Length();
+            float distanceBasedAlpha = distance / (distance + 0.5f);
+            particle.color.w = particle.initialAlpha * (1.0f - gatherFactor) * distanceBasedAlpha;
+            if (distance < 0.05f) {
+                it = RemoveParticle(batch, it);
+                continue;
+            }
+            float distanceFactor = std::min(1.0f, distance);
+            toEmitter = toEmitter.Normalize();
+            float gatherSpeed = particleSetting.gatherStrength * gatherFactor * distanceFactor * 3.0f;
+            Vector3 gatherVelocity = toEmitter * gatherSpeed * stepTime;
+            particle.velocity = gatherVelocity;
+            particle.transform.translation_ += particle.velocity;
+        }
+
+        if (!isGathering) {
+            particle.Acce = (1.0f - t) * particle.startAcce + t * particle.endAcce;
+
+            if (particleSetting.isFaceDirection) {
+                Vector3 forward = particle.fixedDirection;
+                Vector3 initialUp = {0.0f, 1.0f, 0.0f};
+                Vector3 rotationAxis = initialUp.Cross(forward).Normalize();
+                float dotProduct = initialUp.Dot(forward);
+                float angle = acosf(std::clamp(dotProduct, -1.0f, 1.0f));
+                particle.transform.eulerRotation_.x = rotationAxis.x * angle;
+                particle.transform.eulerRotation_.y = rotationAxis.y * angle;
+                particle.transform.eulerRotation_.z = rotationAxis.z * angle;
+            } else if (particleSetting.isRandomRotate) {
+                particle.transform.eulerRotation_ += particle.rotateVelocity;
+            } else {
+                particle.transform.eulerRotation_ =
+                    (1.0f - t) * particle.startRote + t * particle.endRote;
+            }
+
+            if (particleSetting.isAcceMultiply) {
+                particle.velocity *= particle.Acce;
+            } else {
+                particle.velocity += particle.Acce;
+            }
+            particle.transform.translation_ +=
+                particle.velocity * stepTime;
+        }
+
+        particle.velocity.y -= particleSetting.gravity * stepTime;
+        particle.currentTime += stepTime;
+        ++it;
+    }
+}
+
+void ParticleSystem::UpdateLod(const Frustum &frustum, const Vector3 &cameraPosition) {
+    for (Batch &batch : batches_) {
+        const ParticleLodSetting &lodSetting = batch.lodSetting;
+        for (Spawner &spawner : batch.spawners) {
+            // 生きているものがあればその範囲、なければ次に発生させる位置までの距離
+            float distance = 0.0f;
+            if (spawner.hasBounds) {
+                Vector3 closest = {
+                    std::clamp(cameraPosition.x, spawner.bounds.min.x, spawner.bounds.max.x),
+                    std::clamp(cameraPosition.y, spawner.bounds.min.y, spawner.bounds.max.y),
+                    std::clamp(cameraPosition.z, spawner.bounds.min.z, spawner.bounds.max.z)};
+                distance = (closest - cameraPosition).Length();
+            } else {
+                distance = (spawner.setting.translate - cameraPosition).Length();
+            }
+
+            if (distance >= lodSetting.cullDistance) {
+                spawner.spawnRate = 0.0f;
+                spawner.updateInterval = (std::max)(lodSetting.farUpdateInterval, 1u);
+                spawner.isCulled = true;
+                continue;
+            }
+
+            float range = lodSetting.farDistance - lodSetting.nearDistance;
+            float t = range > 0.0f ? std::clamp((distance - lodSetting.nearDistance) / range, 0.0f, 1.0f) : (distance > lodSetting.nearDistance ? 1.0f : 0.0f);
+            spawner.spawnRate = Lerp(1.0f, lodSetting.farSpawnRate, t);
+            spawner.updateInterval = 1 + static_cast<uint32_t>(static_cast<float>((std::max)(lodSetting.farUpdateInterval, 1u) - 1) * t);
+
+            // 画面外のものは描画せず、遠いときと同じ間隔で進める（発生は続けるので振り向いたときには出ている）
+            spawner.isCulled = spawner.hasBounds && !IsInFrustum(frustum, spawner.bounds);
+            if (spawner.isCulled) {
+                spawner.updateInterval = (std::max)(lodSetting.farUpdateInterval, 1u);
+            }
+        }
+    }
+}
+
+void ParticleSystem::UpdateInstancingData(const ViewProjection &viewProjection, float alpha) {
+    Matrix4x4 viewProjectionMatrix = viewProjection.matView_ * viewProjection.matProjection_;
+    Matrix4x4 billboardMatrix = viewProjection.matView_;
+    billboardMatrix.m[3][0] = 0.0f;
+    billboardMatrix.m[3][1] = 0.0f;
+    billboardMatrix.m[3][2] = 0.0f;
+    billboardMatrix.m[3][3] = 1.0f;
+    billboardMatrix = InverseAffine(billboardMatrix);
+
+    // ビューのZ（並べ替えのキーにする）
+    const Matrix4x4 &viewMatrix = viewProjection.matView_;
+    double sortTimeMs = 0.0;
+    size_t sortedCount = 0;
+
+    size_t activeParticleCount = 0;
+    size_t culledCount = 0;
+    for (Batch &batch : batches_) {
+        ParticleGroup *particleGroup = batch.particleGroup;
+        uint32_t numInstance = 0;
+        const float batchAlpha = GetBatchAlpha(batch, alpha);
+
+        // 並べるグループは作業用の配列に書き込み、並べた順にインスタンスデータへ写す
+        ParticleForGPU *instances = particleGroup->GetParticleGroupData().instancingData;
+        float minDepth = 0.0f;
+        float maxDepth = 0.0f;
+        if (batch.isDepthSorted) {
+            if (sortInstances_.size() < particleGroup->GetMaxInstance()) {
+                sortInstances_.resize(particleGroup->GetMaxInstance());
+                sortDepths_.resize(particleGroup->GetMaxInstance());
+            }
+            instances = sortInstances_.data();
+        }
+
+        for (Particle &particle : particleGroup->GetParticleGroupData().particles) {
+            const Spawner &spawner = batch.spawners[particle.spawnerId];
+            if (spawner.isCulled) {
+                ++culledCount;
+                continue;
+            }
+            const ParticleSetting &particleSetting = spawner.setting;
+
+            // ブレンドモード設定
+            particleGroup->GetParticleGroupData().blendMode = particle.blendMode;
+
+            Vector3 translation = Lerp(particle.previousTranslation, particle.transform.translation_, batchAlpha);
+
+            Matrix4x4 worldMatrix{};
+
+            // === 各軸ビルボード処理 ===
+            if (particleSetting.isBillboard || particleSetting.isBillboardX ||
+                particleSetting.isBillboardY || particleSetting.isBillboardZ) {
+
+                Matrix4x4 customBillboardMatrix = MakeIdentity4x4();
+                Matrix4x4 viewMatrix = viewProjection.matView_;
+
+                // ビューマトリックスから回転成分を抽出
+                Vector3 right = {viewMatrix.m[0][0], viewMatrix.m[1][0], viewMatrix.m[2][0]};
+                Vector3 up = {viewMatrix.m[0][1], viewMatrix.m[1][1], viewMatrix.m[2][1]};
+                Vector3 forward = {viewMatrix.m[0][2], viewMatrix.m[1][2], viewMatrix.m[2][2]};
+
+                if (particleSetting.isBillboard) {
+                    // 従来の完全ビルボード
+                    customBillboardMatrix = billboardMatrix;
+                } else {
+                    // 各軸のビルボード処理
+                    Vector3 finalRight = right;
+                    Vector3 finalUp = up;
+                    Vector3 finalForward = forward;
+
+                    if (!particleSetting.isBillboardX) {
+                        // X軸を固定（World空間のX軸を使用）
+                        finalRight = {1.0f, 0.0f, 0.0f};
+                        finalForward = finalUp.Cross(finalRight).Normalize();
+                        finalUp = finalRight.Cross(finalForward).Normalize();
+                    }
+
+                    if (!particleSetting.isBillboardY) {
+                        // Y軸を固定（World空間のY軸を使用）
+                        finalUp = {0.0f, 1.0f, 0.0f};
+                        finalRight = finalUp.Cross(finalForward).Normalize();
+                        finalForward = finalRight.Cross(finalUp).Normalize();
+                    }
+
+                    if (!particleSetting.isBillboardZ) {
+                        // Z軸を固定（World空間のZ軸を使用）
+                        finalForward = {0.0f, 0.0f, 1.0f};
+                        finalRight = finalUp.Cross(finalForward).Normalize();
+                        finalUp = finalForward.Cross(finalRight).Normalize();
+                    }
+
+                    // カスタムビルボードマトリックス構築
+                    customBillboardMatrix.m[0][0] = finalRight.x;
+                    customBillboardMatrix.m[1][0] = finalRight.y;
+                    customBillboardMatrix.m[2][0] = finalRight.z;
+                    customBillboardMatrix.m[0][1] = finalUp.x;
+                    customBillboardMatrix.m[1][1] = finalUp.y;
+                    customBillboardMatrix.m[2][1] = finalUp.z;
+                    customBillboardMatrix.m[0][2] = finalForward.x;
+                    customBillboardMatrix.m[1][2] = finalForward.y;
+                    customBillboardMatrix.m[2][2] = finalForward.z;
+                    customBillboardMatrix.m[3][3] = 1.0f;
+                }
+
+                // ビルボード後にZ軸回転を適用
+                Matrix4x4 rotateMatrix = customBillboardMatrix;
+                if (particleSetting.isRandomRotate ||
+                    (!particleSetting.isFaceDirection && (particle.transform.eulerRotation_.z != 0.0f || particle.rotateVelocity.z != 0.0f))) {
+                    // Z軸回転行列 * ビルボード行列 は上2行の線形結合になる
+                    float cosZ = cosf(particle.transform.eulerRotation_.z);
+                    float sinZ = sinf(particle.transform.eulerRotation_.z);
+                    for (int j = 0; j < 3; ++j) {
+                        float row0 = customBillboardMatrix.m[0][j];
+                        float row1 = customBillboardMatrix.m[1][j];
+                        rotateMatrix.m[0][j] = cosZ * row0 - sinZ * row1;
+                        rotateMatrix.m[1][j] = sinZ * row0 + cosZ * row1;
+                    }
+                }
+
+                worldMatrix = MakeAffineMatrix(particle.transform.scale_, rotateMatrix, translation);
+            } else {
+                worldMatrix = MakeAffineMatrix(particle.transform.scale_,
+                                               particle.transform.eulerRotation_,
+                                               translation);
+            }
+
+            Matrix4x4 worldViewProjectionMatrix = worldMatrix * viewProjectionMatrix;
+            if (numInstance < particleGroup->GetMaxInstance()) {
+                instances[numInstance].WVP = worldViewProjectionMatrix;
+                instances[numInstance].World = worldMatrix;
+                instances[numInstance].color = particle.color;
+                if (batch.isDepthSorted) {
+                    float depth = translation.x * viewMatrix.m[0][2] + translation.y * viewMatrix.m[1][2] + translation.z * viewMatrix.m[2][2] + viewMatrix.m[3][2];
+                    sortDepths_[numInstance] = depth;
+                    minDepth = numInstance == 0 ? depth : (std::min)(minDepth, depth);
+                    maxDepth = numInstance == 0 ? depth : (std::max)(maxDepth, depth);
+                }
+                ++numInstance;
+            }
+        }
+        particleGroup->GetParticleGroupData().instanceCount = numInstance;
+
+        if (batch.isDepthSorted && numInstance > 0) {
+            PROFILE_SCOPE("ParticleDepthSort");
+            auto sortBegin = std::chrono::steady_clock::now();
+            const std::vector<uint32_t> &order = depthSorter_.Sort(sortDepths_.data(), numInstance, minDepth, maxDepth);
+            ParticleForGPU *instancingData = particleGroup->GetParticleGroupData().instancingData;
+            for (uint32_t i = 0; i < numInstance; ++i) {
+                instancingData[i] = sortInstances_[order[i]];
+            }
+            sortTimeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sortBegin).count();
+            sortedCount += numInstance;
+        }
+
+        activeParticleCount += particleGroup->GetParticleGroupData().particles.size();
+        STAT_COUNTER_ADD("UploadBytes", numInstance * sizeof(particleGroup->GetParticleGroupData().instancingData[0]));
+    }
+    culledParticleCount_ = culledCount;
+    STAT_GAUGE_SET("ActiveParticles", activeParticleCount);
+    STAT_GAUGE_SET("CulledParticles", culledCount);
+    STAT_GAUGE_SET("SortedParticles", sortedCount);
+    STAT_GAUGE_SET("ParticleSort(ms)", sortTimeMs);
+}
+
+void ParticleSystem::BuildTrailVertices(const Vector3 &cameraPosition, float alpha) {
+    // 描画リソースがないとき（計測用）はCPU側の配列に書き込む
+    ParticleTrailBuilder::Output output;
+    if (trailVertexData_) {
+        output.vertices = trailVertexData_;
+        output.indices = trailIndexData_;
+    } else {
+        trailVertices_.resize(kMaxTrailVertices);
+        trailIndices_.resize(kMaxTrailIndices);
+        output.vertices = trailVertices_.data();
+        output.indices = trailIndices_.data();
+    }
+    output.vertexCapacity = kMaxTrailVertices;
+    output.indexCapacity = kMaxTrailIndices;
+
+    size_t droppedCount = 0;
+    for (Batch &batch : batches_) {
+        batch.trailIndexStart = output.indexCount;
+        const float batchAlpha = GetBatchAlpha(batch, alpha);
+        if (batch.trailPool.GetActiveCount() > 0) {
+            for (const Particle &particle : batch.particleGroup->GetParticleGroupData().particles) {
+                const Spawner &spawner = batch.spawners[particle.spawnerId];
+                if (particle.trailSlot == ParticleTrailPool::kInvalidSlot || spawner.isCulled) {
+                    continue;
+                }
+                const ParticleSetting &particleSetting = spawner.setting;
+                ParticleTrailBuilder::Ribbon ribbon;
+                ribbon.headPosition = Lerp(particle.previousTranslation, particle.transform.translation_, batchAlpha);
+                ribbon.currentTime = particle.currentTime;
+                ribbon.maxAge = particle.lifeTime * particleSetting.trailLifeScale;
+                ribbon.width = particle.transform.scale_.x * particleSetting.trailScaleMultiplier.x;
+                ribbon.color = particle.color * particleSetting.trailColorMultiplier;
+                // 書き込み先が足りなくなったものは描画しない
+                if (!ParticleTrailBuilder::AppendRibbon(batch.trailPool, particle.trailSlot, ribbon, cameraPosition, output) &&
+                    output.vertexCount + 4 > output.vertexCapacity) {
+                    ++droppedCount;
+                }
+            }
+        }
+        batch.trailIndexCount = output.indexCount - batch.trailIndexStart;
+    }
+    trailVertexCount_ = output.vertexCount;
+    STAT_COUNTER_ADD("UploadBytes", output.vertexCount * sizeof(ParticleTrailVertex) + output.indexCount * sizeof(uint32_t));
+    STAT_COUNTER_ADD("DroppedTrails", droppedCount);
+}
+
+void ParticleSystem::Draw() {
+    for (Batch &batch : batches_) {
+        ParticleGroup *particleGroup = batch.particleGroup;
+        if (particleGroup->GetParticleGroupData().instanceCount == 0) {
+            continue;
+        }
+        particleCommon->DrawCommonSetting(particleGroup->GetParticleGroupData().blendMode);
+        const auto &meshes = particleGroup->GetModelData().meshes;
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
+            D3D12_INDEX_BUFFER_VIEW indexBufferView = particleGroup->GetIndexBufferView();
+            D3D12_VERTEX_BUFFER_VIEW vertexBufferView = particleGroup->GetVertexBufferView();
+            particleCommon->GetDxCommon()->GetCommandList()->IASetIndexBuffer(&indexBufferView);
+            particleCommon->GetDxCommon()->GetCommandList()->IASetVertexBuffers(0, 1, &vertexBufferView);
+            if (particleGroup->GetParticleGroupData().instanceCount > 0) {
+                particleCommon->GetDxCommon()->GetCommandList()->SetGraphicsRootConstantBufferView(0, particleGroup->GetmaterialResource()->GetGPUVirtualAddress());
+                srvManager_->SetGraphicsRootDescriptorTable(1, particleGroup->GetParticleGroupData().instancingSRVIndex);
+                srvManager_->SetGraphicsRootDescriptorTable(2, particleGroup->GetParticleGroupData().materials[meshIndex].textureIndex);
+                particleCommon->GetDxCommon()->GetCommandList()->DrawIndexedInstanced(
+                    UINT(meshes[meshIndex].indices.size()),
+                    particleGroup->GetParticleGroupData().instanceCount,
+                    0, 0, 0);
+                STAT_COUNTER_ADD("DrawCalls", 1);
+            }
+        }
+    }
+
+    // 軌跡の帯（頂点は全グループで共有し、グループごとの範囲を描画する）
+    ID3D12GraphicsCommandList *commandList = particleCommon->GetDxCommon()->GetCommandList().Get();
+    for (Batch &batch : batches_) {
+        if (batch.trailIndexCount == 0) {
+            continue;
+        }
+        ParticleGroup *particleGroup = batch.particleGroup;
+        particleCommon->DrawTrailCommonSetting(particleGroup->GetParticleGroupData().blendMode);
+        commandList->IASetVertexBuffers(0, 1, &trailVertexBufferView_);
+        commandList->IASetIndexBuffer(&trailIndexBufferView_);
+        commandList->SetGraphicsRootConstantBufferView(0, particleGroup->GetmaterialResource()->GetGPUVirtualAddress());
+        commandList->SetGraphicsRootConstantBufferView(1, trailCameraResource_->GetGPUVirtualAddress());
+        srvManager_->SetGraphicsRootDescriptorTable(2, particleGroup->GetParticleGroupData().materials[0].textureIndex);
+        commandList->DrawIndexedInstanced(batch.trailIndexCount, 1, batch.trailIndexStart, 0, 0);
+        STAT_COUNTER_ADD("DrawCalls", 1);
+    }
+}
+
+void ParticleSystem::MakeNewParticle(Particle &particle, FastRandom &random, const ParticleSetting &setting) {
+    // 使い回しのノードなので前の値を消してから書く
+    particle = Particle();
+    particle.transform.isUseQuaternion_ = false;
+    Vector3 randomTranslate;
+    particle.emitterPosition = setting.translate;
+    if (setting.isEmitOnEdge) {
+        int selectedEdge = random.Range(0, 11);
+        float position = random.NextFloat();
+        const Vector3 v0 = {-1.0f, -1.0f, -1.0f};
+        const Vector3 v1 = {1.0f, -1.0f, -1.0f};
+        const Vector3 v2 = {-1.0f, 1.0f, -1.0f};
+        const Vector3 v3 = {1.0f, 1.0f, -1.0f};
+        const Vector3 v4 = {-1.0f, -1.0f, 1.0f};
+        const Vector3 v5 = {1.0f, -1.0f, 1.0f};
+        const Vector3 v6 = {-1.0f, 1.0f, 1.0f};
+        const Vector3 v7 = {1.0f, 1.0f, 1.0f};
+        const std::pair<Vector3, Vector3> edges[] = {
+            {v0, v1}, {v1, v3}, {v3, v2}, {v2, v0}, {v4, v5}, {v5, v7}, {v7, v6}, {v6, v4}, {v0, v4}, {v1, v5}, {v2, v6}, {v3, v7}};
+        const Vector3 &start = edges[selectedEdge].first;
+        const Vector3 &end = edges[selectedEdge].second;
+        randomTranslate = {
+            start.x + (end.x - start.x) * position,
+            start.y + (end.y - start.y) * position,
+            start.z + (end.z - start.z) * position};
+        randomTranslate.x *= setting.scale.x;
+        randomTranslate.y *= setting.scale.y;
+        randomTranslate.z *= setting.scale.z;
+    } else {
+        randomTranslate = {
+            random.Range(-1.0f, 1.0f) * setting.scale.x,
+            random.Range(-1.0f, 1.0f) * setting.scale.y,
+            random.Range(-1.0f, 1.0f) * setting.scale.z};
+    }
+    Matrix4x4 rotationMatrix = MakeRotateXYZMatrix(setting.rotation);
+    Vector3 rotatedPosition = {
+        randomTranslate.x * rotationMatrix.m[0][0] + randomTranslate.y * rotationMatrix.m[1][0] + randomTranslate.z * rotationMatrix.m[2][0],
+        randomTranslate.x * rotationMatrix.m[0][1] + randomTranslate.y * rotationMatrix.m[1][1] + randomTranslate.z * rotationMatrix.m[2][1],
+        randomTranslate.x * rotationMatrix.m[0][2] + randomTranslate.y * rotationMatrix.m[1][2] + randomTranslate.z * rotationMatrix.m[2][2]};
+    particle.transform.translation_ = setting.translate + rotatedPosition;
+
+    if (setting.isRandomAllSize) {
+        particle.startScale = {
+            random.Range(setting.allScaleMin.x, setting.allScaleMax.x),
+            random.Range(setting.allScaleMin.y, setting.allScaleMax.y),
+            random.Range(setting.allScaleMin.z, setting.allScaleMax.z)};
+        if (setting.isEndScale) {
+            particle.endScale = particle.startScale;
+        }
+    } else if (setting.isRandomSize) {
+        particle.startScale.x = random.Range(setting.scaleMin, setting.scaleMax);
+        particle.startScale.y = particle.startScale.x;
+        particle.startScale.z = particle.startScale.x;
+    } else {
+        particle.startScale = setting.particleStartScale;
+    }
+    if (!setting.isEndScale) {
+        particle.endScale = setting.particleEndScale;
+    }
+    particle.startAcce = setting.startAcce;
+    particle.endAcce = setting.endAcce;
+    Vector3 randomVelocity = {
+        random.Range(setting.velocityMin.x, setting.velocityMax.x),
+        random.Range(setting.velocityMin.y, setting.velocityMax.y),
+        random.Range(setting.velocityMin.z, setting.velocityMax.z)};
+    particle.velocity = {
+        randomVelocity.x * rotationMatrix.m[0][0] + randomVelocity.y * rotationMatrix.m[1][0] + randomVelocity.z * rotationMatrix.m[2][0],
+        randomVelocity.x * rotationMatrix.m[0][1] + randomVelocity.y * rotationMatrix.m[1][1] + randomVelocity.z * rotationMatrix.m[2][1],
+        randomVelocity.x * rotationMatrix.m[0][2] + randomVelocity.y * rotationMatrix.m[1][2] + randomVelocity.z * rotationMatrix.m[2][2]};
+    if (setting.isRandomRotate) {
+        particle.transform.eulerRotation_.x = random.Range(setting.rotateStartMin.x, setting.rotateStartMax.x);
+        particle.transform.eulerRotation_.y = random.Range(setting.rotateStartMin.y, setting.rotateStartMax.y);
+        particle.transform.eulerRotation_.z = random.Range(setting.rotateStartMin.z, setting.rotateStartMax.z);
+        if (setting.isRotateVelocity) {
+            particle.rotateVelocity.x = random.Range(setting.rotateVelocityMin.x, setting.rotateVelocityMax.x);
+            particle.rotateVelocity.y = random.Range(setting.rotateVelocityMin.y, setting.rotateVelocityMax.y);
+            particle.rotateVelocity.z = random.Range(setting.rotateVelocityMin.z, setting.rotateVelocityMax.z);
+        }
+    } else {
+        particle.startRote = setting.startRote;
+        particle.endRote = setting.endRote;
+    }
+
+    if (setting.isRandomColor) {
+        particle.color = {random.NextFloat(), random.NextFloat(), random.NextFloat(), random.Range(setting.alphaMin, setting.alphaMax)};
+    } else {
+        particle.color = setting.startColor;
+        particle.color.w = random.Range(setting.alphaMin, setting.alphaMax);
+    }
+    if (setting.isFaceDirection) {
+        Vector3 initialUp = {0.0f, 1.0f, 0.0f};
+        Vector3 forward = particle.velocity.Normalize();
+        particle.fixedDirection = forward;
+        Vector3 rotationAxis = initialUp.Cross(forward).Normalize();
+        float dotProduct = initialUp.Dot(forward);
+        float angle = acosf(std::clamp(dotProduct, -1.0f, 1.0f));
+        particle.transform.eulerRotation_.x = rotationAxis.x * angle;
+        particle.transform.eulerRotation_.y = rotationAxis.y * angle;
+        particle.transform.eulerRotation_.z = rotationAxis.z * angle;
+    }
+    particle.initialAlpha = random.Range(setting.alphaMin, setting.alphaMax);
+    particle.lifeTime = random.Range(setting.lifeTimeMin, setting.lifeTimeMax);
+    particle.currentTime = 0.0f;
+
+    particle.blendMode = setting.blendMode;
+    particle.previousTranslation = particle.transform.translation_;
+}
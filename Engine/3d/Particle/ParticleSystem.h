@@ -0,0 +1,277 @@
+#pragma once
+#include "Camera/ViewProjection/ViewProjection.h"
+#include "FastRandom.h"
+#include "Graphics/Srv/SrvManager.h"
+#include "ParticleCommon.h"
+#include "ParticleDepthSort.h"
+#include "ParticleGroup.h"
+#include "ParticleSetting.h"
+#include "ParticleTrail.h"
+#include "myMath.h"
+#include <cstdint>
+#include <list>
+#include <vector>
+#include <wrl.h>
+
+/// <summary>
+/// ParticleSystemに登録した発生元の番号
+/// </summary>
+struct ParticleSpawnerHandle {
+    uint32_t batchIndex = UINT32_MAX; // どのグループか
+    uint32_t spawnerId = UINT32_MAX;  // グループ内の発生元の番号
+
+    bool IsValid() const { return batchIndex != UINT32_MAX && spawnerId != UINT32_MAX; }
+};
+
+/// <summary>
+/// 発生元の優先度（全体の数が予算に近づいたら低いものから発生を絞る）
+/// </summary>
+enum class ParticlePriority {
+    kLow,    // 環境の演出など（予算の6割まで）
+    kNormal, // 通常（予算の8.5割まで）
+    kHigh,   // プレイヤーの攻撃など、消えると困るもの（予算いっぱいまで）
+};
+
+/// <summary>
+/// グループごとの距離による間引き（距離はカメラからパーティクルの範囲まで）
+/// </summary>
+struct ParticleLodSetting {
+    float nearDistance = 30.0f;      // ここまでは間引かない
+    float farDistance = 80.0f;       // ここで発生数がfarSpawnRate倍、更新がfarUpdateInterval回に1回になる
+    float cullDistance = 150.0f;     // これより遠いものは発生させず、描画もしない
+    float farSpawnRate = 0.25f;      // 遠いときの発生数の倍率
+    uint32_t farUpdateInterval = 4;  // 遠いとき・画面外のときに何ステップに1回進めるか
+};
+
+/// <summary>
+/// ワールド全体のパーティクルの更新と描画
+/// 同じグループのパーティクルは、エミッターがいくつあっても1つのリストにまとめて
+/// 1フレームに1回だけ進め、インスタンスデータの書き込みと描画も1回で行う
+/// エミッターは発生元を登録して、発生の依頼（設定と位置）を送るだけにする
+/// </summary>
+class ParticleSystem {
+  private:
+    static ParticleSystem *instance;
+
+    ParticleSystem() = default;
+    ~ParticleSystem() = default;
+    ParticleSystem(ParticleSystem &) = delete;
+    ParticleSystem &operator=(ParticleSystem &) = delete;
+
+  public:
+    /// <summary>
+    /// シングルトンインスタンスの取得
+    /// </summary>
+    static ParticleSystem *GetInstance();
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    void Initialize(SrvManager *srvManager);
+
+    /// <summary>
+    /// 終了
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 更新（1フレームに1回、カメラの更新後に呼ぶ）
+    /// </summary>
+    void Update(const ViewProjection &viewProjection);
+
+    /// <summary>
+    /// 描画（グループごとに1回）
+    /// </summary>
+    void Draw();
+
+    /// <summary>
+    /// Updateの中の各段階（描画リソースなしでも動くので、テストや計測ではこれを直接呼ぶ）
+    /// </summary>
+    // 発生元ごとに、距離による間引きと画面外かどうかを決める
+    void UpdateLod(const Frustum &frustum, const Vector3 &cameraPosition);
+    // パーティクルを進める（全グループを1回）
+    void Simulate(float deltaTime);
+    // 固定ステップを使うグループはfixedDeltaTimeでfixedStepCount回、それ以外はdeltaTimeで1回進める
+    void Simulate(float deltaTime, int fixedStepCount, float fixedDeltaTime);
+    // 軌跡の点をカメラの方を向いた帯にして、全グループ分を1つの頂点バッファに書き込む
+    // （alpha: 固定ステップを使うグループの前のステップとの補間率）
+    void BuildTrailVertices(const Vector3 &cameraPosition, float alpha);
+
+    /// <summary>
+    /// すべてのパーティクルを消す（シーンの切り替え時）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 発生元の登録・解除
+    /// 解除した発生元のパーティクルは寿命まで残り、すべて消えてから番号を使い回す
+    /// </summary>
+    ParticleSpawnerHandle RegisterSpawner(ParticleGroup *particleGroup);
+    void ReleaseSpawner(ParticleSpawnerHandle &handle);
+
+    /// <summary>
+    /// 発生元の設定（次に発生させるものと、生きているものの動きに使う）
+    /// </summary>
+    void SetSpawnerSetting(const ParticleSpawnerHandle &handle, const ParticleSetting &setting);
+    void SetSpawnerCenter(const ParticleSpawnerHandle &handle, const Vector3 &center);
+
+    /// <summary>
+    /// 発生元の優先度（予算を超えそうなときの絞り方）
+    /// </summary>
+    void SetSpawnerPriority(const ParticleSpawnerHandle &handle, ParticlePriority priority);
+
+    /// <summary>
+    /// グループごとの距離による間引きの設定
+    /// </summary>
+    void SetLodSetting(ParticleGroup *particleGroup, const ParticleLodSetting &lodSetting);
+    const ParticleLodSetting &GetLodSetting(ParticleGroup *particleGroup);
+
+    /// <summary>
+    /// グループごとに奥から手前の順に並べて描画するか（kNormalなどのアルファブレンド用。加算なら不要）
+    /// </summary>
+    void SetDepthSort(ParticleGroup *particleGroup, bool isDepthSorted);
+    bool IsDepthSorted(ParticleGroup *particleGroup);
+
+    /// <summary>
+    /// グループごとにFrameの固定ステップで進めるか（無効なら固定ステップが有効でも毎フレーム1回進める）
+    /// </summary>
+    void SetUseFixedTimeStep(ParticleGroup *particleGroup, bool isUseFixedTimeStep);
+
+    /// <summary>
+    /// ワールド全体で同時に存在できるパーティクルの数
+    /// </summary>
+    void SetParticleBudget(uint32_t budget) { particleBudget_ = budget; }
+    uint32_t GetParticleBudget() const { return particleBudget_; }
+
+    /// <summary>
+    /// 発生元の乱数のシード（同じシードなら同じ発生のしかたを再現できる）
+    /// </summary>
+    void SetSpawnerSeed(const ParticleSpawnerHandle &handle, uint64_t seed);
+
+    /// <summary>
+    /// 発生の依頼（設定のcount個を発生させる）
+    /// 使い終わったノードを使い回すので、プールが足りていれば確保は起きない
+    /// </summary>
+    void Spawn(const ParticleSpawnerHandle &handle);
+
+    /// <summary>
+    /// プールをあらかじめcount個まで確保しておく（最初のバーストでの確保を避ける）
+    /// </summary>
+    void ReserveParticles(const ParticleSpawnerHandle &handle, size_t count);
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    size_t GetActiveParticleCount(const ParticleSpawnerHandle &handle) const;
+    size_t GetActiveParticleCount() const;
+    uint32_t GetBatchCount() const { return static_cast<uint32_t>(batches_.size()); }
+    // 直前の更新で画面外・遠すぎるために描画しなかった数
+    size_t GetCulledParticleCount() const { return culledParticleCount_; }
+    // 直前の更新までの1フレームで、間引き・予算・グループの上限のために発生させなかった数
+    size_t GetThrottledParticleCount() const { return throttledParticleCount_; }
+    // 発生元が直前のUpdateLodで画面外・遠すぎると判定されたか
+    bool IsSpawnerCulled(const ParticleSpawnerHandle &handle) const;
+    // 直前の更新で書き込んだ軌跡の帯の頂点数と、頂点・インデックスの書き込み先
+    uint32_t GetTrailVertexCount() const { return trailVertexCount_; }
+    const ParticleTrailVertex *GetTrailVertices() const { return trailVertexData_ ? trailVertexData_ : trailVertices_.data(); }
+    const uint32_t *GetTrailIndices() const { return trailIndexData_ ? trailIndexData_ : trailIndices_.data(); }
+    // 発生元のグループの軌跡の帯のインデックスの範囲
+    uint32_t GetTrailIndexStart(const ParticleSpawnerHandle &handle) const { return batches_[handle.batchIndex].trailIndexStart; }
+    uint32_t GetTrailIndexCount(const ParticleSpawnerHandle &handle) const { return batches_[handle.batchIndex].trailIndexCount; }
+
+  private:
+    // 発生元ごとの情報
+    struct Spawner {
+        ParticleSetting setting;
+        FastRandom random{0};    // 発生元ごとの乱数（ほかのエミッターの発生数に左右されない）
+        Vector3 center{};        // 集まるときの目標
+        uint32_t liveCount = 0;  // 生きているパーティクルの数
+        bool isReleased = false; // 解除済み（パーティクルが消えたら番号を使い回す）
+
+        ParticlePriority priority = ParticlePriority::kNormal;
+        // 距離による間引き（UpdateLodで毎フレーム決める）
+        float spawnRate = 1.0f;      // 発生数の倍率
+        float spawnRemainder = 0.0f; // 倍率をかけた端数（次の発生に持ち越す）
+        uint32_t updateInterval = 1; // 何ステップに1回進めるか
+        bool isCulled = false;       // 描画しない
+        // 生きているパーティクルの範囲（Simulateで毎ステップ求め直す）
+        AABB bounds{};
+        bool hasBounds = false;
+    };
+
+    // グループごとのパーティクルと発生元
+    struct Batch {
+        ParticleGroup *particleGroup = nullptr;
+        std::vector<Spawner> spawners;
+        std::vector<uint32_t> freeSpawnerIds;
+        ParticleLodSetting lodSetting;
+        bool isDepthSorted = false; // 奥から手前の順に描画する
+        bool isUseFixedTimeStep = false; // Frameの固定ステップが有効なとき、固定の刻みで進める
+        // 更新の間引きを発生元ごとにずらすためのステップ数
+        uint32_t stepCount = 0;
+        // 軌跡の点（パーティクルごとの枠をグループでまとめて持つ）
+        ParticleTrailPool trailPool;
+        // 軌跡の帯のインデックスの範囲（BuildTrailVerticesで毎フレーム決める）
+        uint32_t trailIndexStart = 0;
+        uint32_t trailIndexCount = 0;
+    };
+
+    // 同じグループのBatchを探し、なければ作る
+    Batch &FindOrAddBatch(ParticleGroup *particleGroup);
+
+    // 優先度ごとの予算とグループの上限に収まる数にする（収まらなかった分は絞った数に数える）
+    uint32_t ClampToBudget(const Batch &batch, const Spawner &spawner, uint32_t count);
+    // 1グループ分を進める
+    void SimulateBatch(Batch &batch, float deltaTime);
+    // 描画用のインスタンスデータを書き込む（alpha: 固定ステップを使うグループの前のステップとの補間率）
+    void UpdateInstancingData(const ViewProjection &viewProjection, float alpha);
+    // グループの描画時の補間率
+    float GetBatchAlpha(const Batch &batch, float alpha) const { return batch.isUseFixedTimeStep ? alpha : 1.0f; }
+
+    // プールから取り出したノードをその場で初期化する
+    void MakeNewParticle(Particle &particle, FastRandom &random, const ParticleSetting &setting);
+
+    // パーティクルが消えたときの後始末
+    void OnParticleRemoved(Batch &batch, uint32_t spawnerId);
+    // リストから外してプールに戻す（次を指すイテレータを返す）
+    std::list<Particle>::iterator RemoveParticle(Batch &batch, std::list<Particle>::iterator it);
+
+  private:
+    ParticleCommon *particleCommon = nullptr;
+    SrvManager *srvManager_ = nullptr;
+
+    std::vector<Batch> batches_;
+
+    // 発生元の乱数のシードの元（登録順の番号と混ぜて発生元ごとにずらす）
+    uint64_t baseSeed_ = 0;
+    uint64_t spawnerSerial_ = 0;
+
+    // ワールド全体の予算（グループごとの上限はParticleGroup::GetMaxInstance）
+    static constexpr uint32_t kDefaultParticleBudget = 30000;
+    uint32_t particleBudget_ = kDefaultParticleBudget;
+
+    size_t culledParticleCount_ = 0;
+    size_t throttledParticleCount_ = 0;
+    size_t throttledInFrame_ = 0;
+
+    // 軌跡の帯（全グループで1つのバッファを共有し、グループごとに範囲を分けて描画する）
+    static constexpr uint32_t kMaxTrailVertices = 65536;
+    static constexpr uint32_t kMaxTrailIndices = kMaxTrailVertices * 3;
+    Microsoft::WRL::ComPtr<ID3D12Resource> trailVertexResource_;
+    Microsoft::WRL::ComPtr<ID3D12Resource> trailIndexResource_;
+    Microsoft::WRL::ComPtr<ID3D12Resource> trailCameraResource_;
+    D3D12_VERTEX_BUFFER_VIEW trailVertexBufferView_{};
+    D3D12_INDEX_BUFFER_VIEW trailIndexBufferView_{};
+    ParticleTrailVertex *trailVertexData_ = nullptr;
+    uint32_t *trailIndexData_ = nullptr;
+    Matrix4x4 *trailCameraData_ = nullptr;
+    // 描画リソースがないとき（テスト・計測用）の書き込み先
+    std::vector<ParticleTrailVertex> trailVertices_;
+    std::vector<uint32_t> trailIndices_;
+    uint32_t trailVertexCount_ = 0;
+
+    // 奥から手前に並べるグループの書き込み先（並べてからインスタンスデータに写す）
+    ParticleDepthSorter depthSorter_;
+    std::vector<ParticleForGPU> sortInstances_;
+    std::vector<float> sortDepths_;
+};
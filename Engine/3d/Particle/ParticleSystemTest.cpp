@@ -0,0 +1,302 @@
+#include "Particle/ParticleSystem.h"
+#include "Test/Test.h"
+#include "myMath.h"
+
+namespace {
+
+constexpr uint64_t kSeed = 20240601u;
+constexpr float kDeltaTime = 1.0f / 60.0f;
+
+ParticleSetting MakeSetting(uint32_t count) {
+    ParticleSetting setting;
+    setting.count = count;
+    setting.lifeTimeMin = 1.0f;
+    setting.lifeTimeMax = 3.0f;
+    setting.gravity = 9.8f;
+    setting.alphaMin = 0.5f;
+    setting.alphaMax = 1.0f;
+    setting.scaleMin = 0.5f;
+    setting.scaleMax = 1.0f;
+    setting.translate = {0.0f, 0.0f, 0.0f};
+    setting.rotation = {0.0f, 0.0f, 0.0f};
+    setting.scale = {2.0f, 2.0f, 2.0f};
+    setting.velocityMin = {-1.0f, 0.0f, -1.0f};
+    setting.velocityMax = {1.0f, 3.0f, 1.0f};
+    setting.particleStartScale = {1.0f, 1.0f, 1.0f};
+    setting.particleEndScale = {0.0f, 0.0f, 0.0f};
+    setting.startAcce = {0.0f, 0.01f, 0.0f};
+    setting.endAcce = {0.0f, 0.0f, 0.0f};
+    setting.startRote = {0.0f, 0.0f, 0.0f};
+    setting.endRote = {0.0f, 3.14f, 0.0f};
+    setting.isRandomSize = true;
+    return setting;
+}
+
+ParticleSetting MakeTrailSetting(uint32_t count) {
+    ParticleSetting setting = MakeSetting(count);
+    setting.enableTrail = true;
+    setting.trailSpawnInterval = 0.05f;
+    setting.maxTrailParticles = 20;
+    setting.trailLifeScale = 0.5f;
+    setting.trailScaleMultiplier = {0.8f, 0.8f, 0.8f};
+    setting.trailColorMultiplier = {1.0f, 1.0f, 1.0f, 0.7f};
+    return setting;
+}
+
+// 発生元ごとのパーティクルの位置の列
+std::vector<Vector3> CollectPositions(ParticleGroup &group, uint32_t spawnerId) {
+    std::vector<Vector3> positions;
+    for (const Particle &particle : group.GetParticleGroupData().particles) {
+        if (particle.spawnerId == spawnerId) {
+            positions.push_back(particle.transform.translation_);
+        }
+    }
+    return positions;
+}
+
+// 描画リソースを作らずに使う（シングルトンなので、テストごとに作り直す）
+ParticleSystem *CreateParticleSystem() {
+    ParticleSystem::GetInstance()->Finalize();
+    return ParticleSystem::GetInstance();
+}
+
+} // namespace
+
+// 同じシードなら同じ位置に発生し、同じように進む
+TEST(SpawnIsDeterministic) {
+    ParticleGroup group;
+    ParticleSystem *particleSystem = CreateParticleSystem();
+    ParticleSpawnerHandle spawner = particleSystem->RegisterSpawner(&group);
+
+    std::vector<Vector3> runs[2];
+    for (std::vector<Vector3> &positions : runs) {
+        particleSystem->Clear();
+        particleSystem->SetSpawnerSetting(spawner, MakeSetting(1000));
+        particleSystem->SetSpawnerSeed(spawner, kSeed);
+        particleSystem->Spawn(spawner);
+        for (int step = 0; step < 30; ++step) {
+            particleSystem->Simulate(kDeltaTime);
+        }
+        positions = CollectPositions(group, spawner.spawnerId);
+    }
+    CHECK(runs[0].size() == 1000);
+    CHECK(runs[0].size() == runs[1].size());
+    for (size_t i = 0; i < runs[0].size() && i < runs[1].size(); ++i) {
+        CHECK(runs[0][i].x == runs[1][i].x && runs[0][i].y == runs[1][i].y && runs[0][i].z == runs[1][i].z);
+    }
+    particleSystem->Finalize();
+}
+
+// 軌跡の帯は1本ごとに点の数×2の頂点と(点の数-1)×6のインデックスになり、インデックスは頂点の範囲に収まる
+TEST(TrailRibbonIndices) {
+    ParticleGroup group;
+    ParticleSystem *particleSystem = CreateParticleSystem();
+    ParticleSpawnerHandle spawner = particleSystem->RegisterSpawner(&group);
+    particleSystem->SetSpawnerSetting(spawner, MakeTrailSetting(2000));
+    particleSystem->SetSpawnerSeed(spawner, kSeed);
+    particleSystem->Spawn(spawner);
+    for (int step = 0; step < 30; ++step) {
+        particleSystem->Simulate(kDeltaTime);
+    }
+    particleSystem->BuildTrailVertices({0.0f, 5.0f, -20.0f}, 1.0f);
+
+    uint32_t vertexCount = particleSystem->GetTrailVertexCount();
+    uint32_t indexStart = particleSystem->GetTrailIndexStart(spawner);
+    uint32_t indexCount = particleSystem->GetTrailIndexCount(spawner);
+    const uint32_t *indices = particleSystem->GetTrailIndices();
+    CHECK(vertexCount > 0);
+    for (uint32_t i = 0; i < indexCount; ++i) {
+        CHECK(indices[indexStart + i] < vertexCount);
+    }
+    CHECK(indexCount == (vertexCount / 2 - group.GetParticleGroupData().particles.size()) * 6);
+    particleSystem->Finalize();
+}
+
+// 予約しておけば、まとまった発生でもノードは増えない
+TEST(BurstReusesReservedNodes) {
+    constexpr uint32_t kBurstCount = 5000;
+    ParticleGroup group;
+    ParticleSystem *particleSystem = CreateParticleSystem();
+    ParticleSpawnerHandle spawner = particleSystem->RegisterSpawner(&group);
+    particleSystem->ReserveParticles(spawner, kBurstCount);
+
+    ParticleSetting setting = MakeSetting(kBurstCount);
+    setting.isRandomRotate = true;
+    setting.isRandomColor = true;
+    particleSystem->SetSpawnerSetting(spawner, setting);
+    particleSystem->SetSpawnerSeed(spawner, kSeed);
+    const ParticleGroupData &groupData = group.GetParticleGroupData();
+    size_t nodeCount = groupData.particles.size() + groupData.freeParticles.size();
+    for (int i = 0; i < 3; ++i) {
+        particleSystem->Clear();
+        particleSystem->Spawn(spawner);
+        CHECK(groupData.particles.size() == kBurstCount);
+        CHECK(groupData.particles.size() + groupData.freeParticles.size() == nodeCount);
+    }
+    particleSystem->Finalize();
+}
+
+// 同じグループを使うエミッターが増えても、1つのエミッターのパーティクルの動きは変わらない
+TEST(EmitterCountIndependence) {
+    constexpr uint32_t kEmitterCount = 64;
+    constexpr uint32_t kSteps = 120;
+    ParticleSetting setting = MakeSetting(100);
+    // ほかのエミッターは違う設定にして、設定が混ざらないことも確かめる
+    ParticleSetting otherSetting = setting;
+    otherSetting.gravity = 0.0f;
+    otherSetting.velocityMin = {-3.0f, -3.0f, -3.0f};
+    otherSetting.velocityMax = {3.0f, 3.0f, 3.0f};
+    otherSetting.translate = {10.0f, 0.0f, 0.0f};
+
+    // 基準：エミッター1つだけ
+    std::vector<Vector3> expected;
+    {
+        ParticleGroup group;
+        ParticleSystem *particleSystem = CreateParticleSystem();
+        ParticleSpawnerHandle spawner = particleSystem->RegisterSpawner(&group);
+        particleSystem->SetSpawnerSetting(spawner, setting);
+        particleSystem->SetSpawnerSeed(spawner, kSeed);
+        particleSystem->Spawn(spawner);
+        for (uint32_t step = 0; step < kSteps; ++step) {
+            particleSystem->Simulate(kDeltaTime);
+        }
+        expected = CollectPositions(group, spawner.spawnerId);
+        particleSystem->Finalize();
+    }
+
+    ParticleGroup group;
+    ParticleSystem *particleSystem = CreateParticleSystem();
+    std::vector<ParticleSpawnerHandle> spawners;
+    for (uint32_t i = 0; i < kEmitterCount; ++i) {
+        spawners.push_back(particleSystem->RegisterSpawner(&group));
+        particleSystem->SetSpawnerSetting(spawners[i], i == 0 ? setting : otherSetting);
+        particleSystem->SetSpawnerSeed(spawners[i], kSeed + i);
+        particleSystem->Spawn(spawners[i]);
+    }
+    for (uint32_t step = 0; step < kSteps; ++step) {
+        particleSystem->Simulate(kDeltaTime);
+    }
+    std::vector<Vector3> actual = CollectPositions(group, spawners[0].spawnerId);
+    CHECK(!expected.empty());
+    CHECK(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size() && i < expected.size(); ++i) {
+        CHECK(actual[i].x == expected[i].x && actual[i].y == expected[i].y && actual[i].z == expected[i].z);
+    }
+
+    // 発生元ごとの数がリストの中身と合っている
+    size_t spawnerTotal = 0;
+    for (const ParticleSpawnerHandle &handle : spawners) {
+        spawnerTotal += particleSystem->GetActiveParticleCount(handle);
+    }
+    CHECK(spawnerTotal == group.GetParticleGroupData().particles.size());
+    particleSystem->Finalize();
+}
+
+// 予算に対して優先度の低いものから絞り、遠いものは発生させず、向きで画面外を判定する
+TEST(LodBudgetAndCulling) {
+    constexpr uint32_t kBudget = 2000;
+    ParticleGroup group;
+    ParticleSystem *particleSystem = CreateParticleSystem();
+    particleSystem->SetParticleBudget(kBudget);
+    particleSystem->SetLodSetting(&group, ParticleLodSetting{});
+    ParticleSpawnerHandle lowSpawner = particleSystem->RegisterSpawner(&group);
+    ParticleSpawnerHandle normalSpawner = particleSystem->RegisterSpawner(&group);
+    ParticleSpawnerHandle highSpawner = particleSystem->RegisterSpawner(&group);
+    ParticleSpawnerHandle farSpawner = particleSystem->RegisterSpawner(&group);
+    particleSystem->SetSpawnerPriority(lowSpawner, ParticlePriority::kLow);
+    particleSystem->SetSpawnerPriority(highSpawner, ParticlePriority::kHigh);
+
+    ParticleSetting nearSetting = MakeSetting(1000);
+    nearSetting.translate = {0.0f, 0.0f, 20.0f};
+    ParticleSetting farSetting = nearSetting;
+    farSetting.translate = {0.0f, 0.0f, 200.0f};
+    for (const ParticleSpawnerHandle &handle : {lowSpawner, normalSpawner, highSpawner, farSpawner}) {
+        particleSystem->SetSpawnerSetting(handle, handle.spawnerId == farSpawner.spawnerId ? farSetting : nearSetting);
+        particleSystem->SetSpawnerSeed(handle, kSeed + handle.spawnerId);
+    }
+
+    // 原点から+Z向きのカメラと、その逆向きのカメラ
+    Matrix4x4 projection = MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    Frustum frontFrustum = MakeFrustum(projection);
+    Frustum backFrustum = MakeFrustum(MakeRotateYMatrix(3.14159265f) * projection);
+    Vector3 cameraPosition = {0.0f, 0.0f, 0.0f};
+
+    // 低・通常・高の順に1000ずつ（低は2回）発生させる
+    particleSystem->UpdateLod(frontFrustum, cameraPosition);
+    particleSystem->Spawn(farSpawner);
+    particleSystem->Spawn(lowSpawner);
+    particleSystem->Spawn(lowSpawner);
+    particleSystem->Spawn(normalSpawner);
+    particleSystem->Spawn(highSpawner);
+    // 低は予算の6割(1200)まで、通常は8.5割(1700)まで、高は予算いっぱいまで
+    CHECK(particleSystem->GetActiveParticleCount(lowSpawner) == 1200);
+    CHECK(particleSystem->GetActiveParticleCount(normalSpawner) == 500);
+    CHECK(particleSystem->GetActiveParticleCount(highSpawner) == 300);
+    CHECK(particleSystem->GetActiveParticleCount(farSpawner) == 0);
+
+    // 範囲を求めてから、後ろを向くと画面外・前を向くと画面内になる
+    particleSystem->Simulate(kDeltaTime);
+    particleSystem->UpdateLod(backFrustum, cameraPosition);
+    CHECK(particleSystem->IsSpawnerCulled(lowSpawner));
+    CHECK(particleSystem->IsSpawnerCulled(highSpawner));
+    particleSystem->UpdateLod(frontFrustum, cameraPosition);
+    CHECK(!particleSystem->IsSpawnerCulled(lowSpawner));
+    CHECK(particleSystem->IsSpawnerCulled(farSpawner));
+    particleSystem->Finalize();
+}
+
+// 固定ステップはグループごとに選べ、使うグループだけが固定の刻みでステップ数分進む
+TEST(FixedTimeStepIsPerGroup) {
+    constexpr int kFixedStepCount = 3;
+    auto spawnAndStep = [](ParticleSystem *particleSystem, ParticleGroup &group, bool isUseFixedTimeStep) {
+        ParticleSpawnerHandle spawner = particleSystem->RegisterSpawner(&group);
+        particleSystem->SetUseFixedTimeStep(&group, isUseFixedTimeStep);
+        particleSystem->SetSpawnerSetting(spawner, MakeSetting(500));
+        particleSystem->SetSpawnerSeed(spawner, kSeed);
+        particleSystem->Spawn(spawner);
+        return spawner;
+    };
+
+    // 固定の刻みで3回進めたときの位置
+    std::vector<Vector3> expected;
+    {
+        ParticleGroup group;
+        ParticleSystem *particleSystem = CreateParticleSystem();
+        ParticleSpawnerHandle spawner = spawnAndStep(particleSystem, group, true);
+        for (int i = 0; i < kFixedStepCount; ++i) {
+            particleSystem->Simulate(kDeltaTime);
+        }
+        expected = CollectPositions(group, spawner.spawnerId);
+    }
+
+    ParticleGroup fixedGroup;
+    ParticleGroup frameGroup;
+    ParticleSystem *particleSystem = CreateParticleSystem();
+    ParticleSpawnerHandle fixedSpawner = spawnAndStep(particleSystem, fixedGroup, true);
+    ParticleSpawnerHandle frameSpawner = spawnAndStep(particleSystem, frameGroup, false);
+    const std::vector<Vector3> initial = CollectPositions(fixedGroup, fixedSpawner.spawnerId);
+
+    // 固定ステップが貯まっていないフレームでは、固定ステップを使わないグループだけが進む
+    particleSystem->Simulate(kDeltaTime, 0, kDeltaTime);
+    std::vector<Vector3> fixedPositions = CollectPositions(fixedGroup, fixedSpawner.spawnerId);
+    std::vector<Vector3> framePositions = CollectPositions(frameGroup, frameSpawner.spawnerId);
+    CHECK(fixedPositions.size() == initial.size());
+    bool isFixedUnchanged = true;
+    for (size_t i = 0; i < fixedPositions.size() && i < initial.size(); ++i) {
+        isFixedUnchanged &= fixedPositions[i].x == initial[i].x && fixedPositions[i].y == initial[i].y && fixedPositions[i].z == initial[i].z;
+    }
+    CHECK(isFixedUnchanged);
+    bool isFrameMoved = false;
+    for (size_t i = 0; i < framePositions.size() && i < initial.size(); ++i) {
+        isFrameMoved |= framePositions[i].x != initial[i].x || framePositions[i].y != initial[i].y || framePositions[i].z != initial[i].z;
+    }
+    CHECK(isFrameMoved);
+
+    particleSystem->Simulate(kDeltaTime, kFixedStepCount, kDeltaTime);
+    fixedPositions = CollectPositions(fixedGroup, fixedSpawner.spawnerId);
+    CHECK(fixedPositions.size() == expected.size());
+    for (size_t i = 0; i < fixedPositions.size() && i < expected.size(); ++i) {
+        CHECK(fixedPositions[i].x == expected[i].x && fixedPositions[i].y == expected[i].y && fixedPositions[i].z == expected[i].z);
+    }
+    particleSystem->Finalize();
+}
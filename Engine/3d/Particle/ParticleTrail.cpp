@@ -0,0 +1,115 @@
+#include "ParticleTrail.h"
+#include <algorithm>
+#include <cassert>
+
+uint32_t ParticleTrailPool::Acquire(uint32_t maxPoints) {
+    uint32_t slot = 0;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(rings_.size());
+        rings_.emplace_back();
+        points_.resize(points_.size() + kMaxPoints);
+    }
+    Ring &ring = rings_[slot];
+    ring.head = 0;
+    ring.count = 0;
+    ring.capacity = static_cast<uint16_t>(std::clamp(maxPoints, 1u, kMaxPoints));
+    return slot;
+}
+
+void ParticleTrailPool::Release(uint32_t slot) {
+    if (slot == kInvalidSlot) {
+        return;
+    }
+    rings_[slot].count = 0;
+    freeSlots_.push_back(slot);
+}
+
+void ParticleTrailPool::Clear() {
+    freeSlots_.clear();
+    // 若い番号から使われるように逆順に積む
+    for (uint32_t slot = static_cast<uint32_t>(rings_.size()); slot > 0; --slot) {
+        rings_[slot - 1].count = 0;
+        freeSlots_.push_back(slot - 1);
+    }
+}
+
+void ParticleTrailPool::Push(uint32_t slot, const Vector3 &position, float time) {
+    Ring &ring = rings_[slot];
+    points_[slot * kMaxPoints + ring.head] = {position, time};
+    ring.head = static_cast<uint16_t>((ring.head + 1) % ring.capacity);
+    ring.count = (std::min)(static_cast<uint16_t>(ring.count + 1), ring.capacity);
+}
+
+const ParticleTrailPool::Point &ParticleTrailPool::GetPoint(uint32_t slot, uint32_t index) const {
+    const Ring &ring = rings_[slot];
+    assert(index < ring.count);
+    uint32_t position = (ring.head + ring.capacity - 1 - index) % ring.capacity;
+    return points_[slot * kMaxPoints + position];
+}
+
+bool ParticleTrailBuilder::AppendRibbon(const ParticleTrailPool &pool, uint32_t slot, const Ribbon &ribbon, const Vector3 &cameraPosition, Output &output) {
+    if (slot == ParticleTrailPool::kInvalidSlot) {
+        return false;
+    }
+
+    // 先頭（今の位置）と、古すぎない記録の点
+    uint32_t usableCount = 0;
+    uint32_t recordedCount = pool.GetPointCount(slot);
+    while (usableCount < recordedCount && ribbon.currentTime - pool.GetPoint(slot, usableCount).time <= ribbon.maxAge) {
+        ++usableCount;
+    }
+    const uint32_t pointCount = usableCount + 1;
+    if (pointCount < 2) {
+        return false;
+    }
+    const uint32_t vertexCount = pointCount * 2;
+    const uint32_t indexCount = (pointCount - 1) * 6;
+    if (output.vertexCount + vertexCount > output.vertexCapacity || output.indexCount + indexCount > output.indexCapacity) {
+        return false;
+    }
+
+    auto pointAt = [&](uint32_t index) -> const Vector3 & {
+        return index == 0 ? ribbon.headPosition : pool.GetPoint(slot, index - 1).position;
+    };
+
+    const uint32_t baseVertex = output.vertexCount;
+    Vector3 previousSide = {0.0f, 0.0f, 0.0f};
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        const Vector3 &position = pointAt(i);
+        // 前後の点を結ぶ向きと視線の両方に垂直な向きに広げる
+        Vector3 tangent = pointAt(i == 0 ? 0 : i - 1) - pointAt((std::min)(i + 1, pointCount - 1));
+        Vector3 side = tangent.Cross(cameraPosition - position);
+        float length = side.Length();
+        // 止まっている・視線と重なるときは1つ前の向きを使う
+        side = length > 1.0e-6f ? side * (1.0f / length) : previousSide;
+        previousSide = side;
+
+        float t = static_cast<float>(i) / static_cast<float>(pointCount - 1);
+        float halfWidth = ribbon.width * 0.5f * (1.0f - t);
+        Vector4 color = ribbon.color;
+        color.w *= 1.0f - t;
+
+        Vector3 left = position - side * halfWidth;
+        Vector3 right = position + side * halfWidth;
+        output.vertices[baseVertex + i * 2] = {{left.x, left.y, left.z, 1.0f}, {t, 0.0f}, color};
+        output.vertices[baseVertex + i * 2 + 1] = {{right.x, right.y, right.z, 1.0f}, {t, 1.0f}, color};
+    }
+
+    uint32_t *indices = output.indices + output.indexCount;
+    for (uint32_t i = 0; i + 1 < pointCount; ++i) {
+        uint32_t index = baseVertex + i * 2;
+        *indices++ = index;
+        *indices++ = index + 2;
+        *indices++ = index + 1;
+        *indices++ = index + 1;
+        *indices++ = index + 2;
+        *indices++ = index + 3;
+    }
+
+    output.vertexCount += vertexCount;
+    output.indexCount += indexCount;
+    return true;
+}
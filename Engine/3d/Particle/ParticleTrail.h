@@ -0,0 +1,98 @@
+#pragma once
+#include "type/Vector2.h"
+#include "type/Vector3.h"
+#include "type/Vector4.h"
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 軌跡の帯の頂点
+/// </summary>
+struct ParticleTrailVertex {
+    Vector4 position;
+    Vector2 texcoord; // u: 先頭0～末尾1、v: 帯の両端0/1
+    Vector4 color;
+};
+
+/// <summary>
+/// パーティクルごとの軌跡の位置（リングバッファ）をグループ単位でまとめて持つ
+/// 軌跡の点ごとにパーティクルを作らず、点の数だけの固定長の枠を使い回す
+/// </summary>
+class ParticleTrailPool {
+  public:
+    // 1本の軌跡が持てる点の数
+    static constexpr uint32_t kMaxPoints = 32;
+    static constexpr uint32_t kInvalidSlot = UINT32_MAX;
+
+    // 記録した点
+    struct Point {
+        Vector3 position;
+        float time; // 記録したときのパーティクルの経過時間
+    };
+
+    /// <summary>
+    /// 枠の取得と返却（maxPointsはkMaxPointsまで）
+    /// </summary>
+    uint32_t Acquire(uint32_t maxPoints);
+    void Release(uint32_t slot);
+
+    /// <summary>
+    /// すべての枠を返す（確保したメモリは残す）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 点の追加（いっぱいなら一番古いものを上書きする）
+    /// </summary>
+    void Push(uint32_t slot, const Vector3 &position, float time);
+
+    /// <summary>
+    /// getter（indexは0が一番新しい）
+    /// </summary>
+    uint32_t GetPointCount(uint32_t slot) const { return rings_[slot].count; }
+    const Point &GetPoint(uint32_t slot, uint32_t index) const;
+    uint32_t GetActiveCount() const { return static_cast<uint32_t>(rings_.size() - freeSlots_.size()); }
+
+  private:
+    struct Ring {
+        uint16_t head = 0;     // 次に書き込む位置
+        uint16_t count = 0;    // 記録している点の数
+        uint16_t capacity = 0; // この枠で使う点の数
+    };
+
+    std::vector<Point> points_; // 枠ごとにkMaxPoints個ずつ並べる
+    std::vector<Ring> rings_;
+    std::vector<uint32_t> freeSlots_;
+};
+
+/// <summary>
+/// 軌跡の点の列を、カメラの方を向いた帯の頂点にする
+/// 書き込み先は固定長（GPUのアップロード用バッファをそのまま渡せる）
+/// </summary>
+class ParticleTrailBuilder {
+  public:
+    // 書き込み先
+    struct Output {
+        ParticleTrailVertex *vertices = nullptr;
+        uint32_t vertexCapacity = 0;
+        uint32_t vertexCount = 0;
+        uint32_t *indices = nullptr;
+        uint32_t indexCapacity = 0;
+        uint32_t indexCount = 0;
+    };
+
+    // 帯1本分の見た目
+    struct Ribbon {
+        Vector3 headPosition;  // 先頭（パーティクルの今の位置）
+        float currentTime;     // パーティクルの経過時間
+        float maxAge;          // これより古い点は使わない
+        float width;           // 先頭の幅（末尾に向かって細くなる）
+        Vector4 color;         // 先頭の色（末尾に向かって透明になる）
+    };
+
+    /// <summary>
+    /// 帯を1本追加する（点が2つ未満・書き込み先が足りないときは何もしない）
+    /// </summary>
+    /// <returns>追加したか</returns>
+    static bool AppendRibbon(const ParticleTrailPool &pool, uint32_t slot, const Ribbon &ribbon, const Vector3 &cameraPosition, Output &output);
+};
@@ -1,5 +1,6 @@
 #include "PrimitiveModel.h"
 #include <DirectXMath.h>
+#include <Model/MeshOptimizer/MeshOptimizer.h>
 #include <myMath.h>
 using namespace DirectX;
 
@@ -14,6 +15,11 @@ void PrimitiveModel::Initialize() {
     CreateTriangle();
     CreateCone();
     CreatePyramid();
+
+    // 生成したプリミティブの頂点キャッシュ最適化
+    for (auto &[type, primitiveData] : primitiveDataMap_) {
+        MeshOptimizer::Optimize(primitiveData.vertices, primitiveData.indices);
+    }
 }
 
 PrimitiveModel *PrimitiveModel::GetInstance() {
@@ -1,5 +1,6 @@
 #include "SkyBox.h"
 #include "DirectXCommon.h"
+#include "Engine/Frame/FrameStats.h"
 #include "Graphics/PipeLine/PipeLineManager.h"
 #include "Graphics/Srv/SrvManager.h"
 #include "Graphics/Texture/TextureManager.h"
@@ -79,6 +80,7 @@ void SkyBox::Draw(const ViewProjection &viewProjection) {
     commandList->SetGraphicsRootDescriptorTable(2, srvManager_->GetGPUDescriptorHandle(textureIndex_));
 
     commandList->DrawIndexedInstanced(UINT(indices_.size()), 1, 0, 0, 0);
+    STAT_COUNTER_ADD("DrawCalls", 1);
 }
 
 void SkyBox::CreateShape() {
@@ -0,0 +1,147 @@
+#include "TransformBenchmark.h"
+#include "TransformHierarchy.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <random>
+
+namespace {
+
+// 従来の構成を模したノード（個別に確保し、親のポインタと子のリストを辿る）
+struct LegacyNode {
+    Vector3 scale = {1.0f, 1.0f, 1.0f};
+    Quaternion rotation = Quaternion::IdentityQuaternion();
+    Vector3 translation = {0.0f, 0.0f, 0.0f};
+    Matrix4x4 matWorld;
+    const LegacyNode *parent = nullptr;
+    std::list<LegacyNode *> children;
+    uint32_t handle = 0;
+
+    void UpdateHierarchy() {
+        matWorld = MakeAffineMatrix(scale, rotation, translation);
+        if (parent) {
+            matWorld = MultiplyAffine(matWorld, parent->matWorld);
+        }
+        for (LegacyNode *child : children) {
+            child->UpdateHierarchy();
+        }
+    }
+};
+
+// 最適化で計算が消されないよう結果を書き込む先
+volatile float benchmarkSink = 0.0f;
+
+// 動かすノードの割合
+constexpr float kMovingRatios[] = {0.01f, 0.1f, 1.0f};
+
+// ルートの数（残りのノードは前に作ったノードのどれかの子にする）
+constexpr uint32_t kRootCount = 100;
+
+} // namespace
+
+std::vector<TransformBenchmarkResult> TransformBenchmark::Run(uint32_t nodeCount, uint32_t frames) {
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937 random(12345u);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+    // ---- シーンの生成 ----
+    std::vector<std::unique_ptr<LegacyNode>> legacyNodes;
+    std::vector<LegacyNode *> roots;
+    TransformHierarchy hierarchy;
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        auto node = std::make_unique<LegacyNode>();
+        node->scale = {1.0f + value(random) * 0.1f, 1.0f + value(random) * 0.1f, 1.0f + value(random) * 0.1f};
+        node->rotation = Quaternion::FromEulerAngles({value(random), value(random), value(random)});
+        node->translation = {value(random) * 5.0f, value(random) * 5.0f, value(random) * 5.0f};
+        node->handle = hierarchy.Create();
+
+        // 前に作ったノードのどれかを親にする（ランダムな木になる）
+        if (i >= kRootCount) {
+            LegacyNode *parent = legacyNodes[random() % i].get();
+            node->parent = parent;
+            parent->children.push_back(node.get());
+            hierarchy.SetParent(node->handle, parent->handle);
+        } else {
+            roots.push_back(node.get());
+        }
+        hierarchy.SetLocal(node->handle, node->scale, node->rotation, node->translation);
+        legacyNodes.push_back(std::move(node));
+    }
+    for (LegacyNode *root : roots) {
+        root->UpdateHierarchy();
+    }
+    hierarchy.Update();
+
+    // 動かすノードの候補をシャッフルしておく
+    std::vector<uint32_t> shuffled(nodeCount);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        shuffled[i] = i;
+    }
+    std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+    std::vector<TransformBenchmarkResult> results;
+    for (float ratio : kMovingRatios) {
+        TransformBenchmarkResult result;
+        result.name = "moving_" + std::to_string(static_cast<int>(ratio * 100.0f)) + "%";
+        result.nodeCount = nodeCount;
+        result.movingCount = (std::max)(1u, static_cast<uint32_t>(nodeCount * ratio));
+
+        double baselineTotal = 0.0;
+        double optimizedTotal = 0.0;
+        uint64_t updatedTotal = 0;
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            // 動かすノードのローカル座標を書き換える
+            float offset = std::sin(static_cast<float>(frame) * 0.1f) * 0.01f;
+            for (uint32_t i = 0; i < result.movingCount; ++i) {
+                LegacyNode &node = *legacyNodes[shuffled[i]];
+                node.translation.x += offset;
+                node.translation.y -= offset;
+            }
+
+            // 従来の方式：すべてのノードを毎フレーム計算する
+            auto begin = Clock::now();
+            for (LegacyNode *root : roots) {
+                root->UpdateHierarchy();
+            }
+            auto end = Clock::now();
+            baselineTotal += std::chrono::duration<double, std::micro>(end - begin).count();
+
+            // 一括計算：変更を書き込んで変更分だけ計算する
+            begin = Clock::now();
+            for (uint32_t i = 0; i < result.movingCount; ++i) {
+                const LegacyNode &node = *legacyNodes[shuffled[i]];
+                hierarchy.SetLocal(node.handle, node.scale, node.rotation, node.translation);
+            }
+            updatedTotal += hierarchy.Update();
+            end = Clock::now();
+            optimizedTotal += std::chrono::duration<double, std::micro>(end - begin).count();
+
+            benchmarkSink = benchmarkSink + hierarchy.GetWorldMatrix(legacyNodes[frame % nodeCount]->handle).m[3][0];
+        }
+
+        result.baselineUs = baselineTotal / frames;
+        result.optimizedUs = optimizedTotal / frames;
+        result.speedup = result.optimizedUs > 0.0 ? result.baselineUs / result.optimizedUs : 0.0;
+        result.updatedNodes = static_cast<double>(updatedTotal) / frames;
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+void TransformBenchmark::WriteReportCSV(const std::vector<TransformBenchmarkResult> &results, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "name,node_count,moving_count,baseline_us,optimized_us,speedup,updated_nodes\n";
+    for (const auto &result : results) {
+        file << result.name << "," << result.nodeCount << "," << result.movingCount << "," << result.baselineUs << ","
+             << result.optimizedUs << "," << result.speedup << "," << result.updatedNodes << "\n";
+    }
+}
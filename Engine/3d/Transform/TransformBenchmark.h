@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 動くノードの割合1種類分の計測結果
+/// </summary>
+struct TransformBenchmarkResult {
+    std::string name;           // 計測名
+    uint32_t nodeCount = 0;     // ノード数
+    uint32_t movingCount = 0;   // 毎フレーム動かすノード数
+    double baselineUs = 0.0;    // 全ノードを親を辿って再帰的に計算する場合の1フレームの時間(us)
+    double optimizedUs = 0.0;   // TransformHierarchyで変更分だけ計算する場合の1フレームの時間(us)
+    double speedup = 0.0;       // baselineUs / optimizedUs
+    double updatedNodes = 0.0;  // 1フレームあたりに計算したノード数の平均
+};
+
+/// <summary>
+/// ワールド変換の一括計算（TransformHierarchy）の速度比較（結果の一致はTransformHierarchyTestで確かめる）
+/// </summary>
+class TransformBenchmark {
+  public:
+    /// <summary>
+    /// 1% / 10% / 100% のノードを動かしたときを計測する
+    /// </summary>
+    /// <param name="nodeCount">シーンのノード数</param>
+    /// <param name="frames">計測するフレーム数</param>
+    static std::vector<TransformBenchmarkResult> Run(uint32_t nodeCount = 10000, uint32_t frames = 200);
+
+    /// <summary>
+    /// 結果をCSVに書き出す
+    /// </summary>
+    static void WriteReportCSV(const std::vector<TransformBenchmarkResult> &results, const std::string &filePath);
+};
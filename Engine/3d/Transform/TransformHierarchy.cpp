@@ -0,0 +1,319 @@
+#include "TransformHierarchy.h"
+#include "Job/JobSystem.h"
+#include <algorithm>
+#include <cassert>
+
+uint32_t TransformHierarchy::Create(uint32_t parent) {
+    // 解放済みのハンドルがあれば再利用する
+    uint32_t handle;
+    if (!freeHandles_.empty()) {
+        handle = freeHandles_.back();
+        freeHandles_.pop_back();
+    } else {
+        handle = static_cast<uint32_t>(handleToSlot_.size());
+        handleToSlot_.push_back(kInvalidHandle);
+        parentHandles_.push_back(kInvalidHandle);
+        isDirty_.push_back(0);
+    }
+
+    // 末尾に追加（ルートなら並び順は崩れない）
+    uint32_t slot = static_cast<uint32_t>(slotToHandle_.size());
+    scales_.push_back({1.0f, 1.0f, 1.0f});
+    rotations_.push_back(Quaternion::IdentityQuaternion());
+    eulerRotations_.push_back({0.0f, 0.0f, 0.0f});
+    isUseQuaternion_.push_back(1);
+    translations_.push_back({0.0f, 0.0f, 0.0f});
+    worldMatrices_.push_back(MakeIdentity4x4());
+    parentSlots_.push_back(kInvalidHandle);
+    subtreeEnds_.push_back(slot + 1);
+    slotToHandle_.push_back(handle);
+
+    handleToSlot_[handle] = slot;
+    parentHandles_[handle] = kInvalidHandle;
+    isDirty_[handle] = 0;
+    ++nodeCount_;
+
+    if (parent != kInvalidHandle) {
+        SetParent(handle, parent);
+    }
+    MarkDirty(handle);
+    return handle;
+}
+
+void TransformHierarchy::Destroy(uint32_t handle) {
+    if (!IsValid(handle)) {
+        return;
+    }
+
+    // 子はルートにする（ローカルのSRTはそのまま）
+    for (uint32_t child = 0; child < parentHandles_.size(); ++child) {
+        if (parentHandles_[child] == handle) {
+            SetParent(child, kInvalidHandle);
+        }
+    }
+
+    // スロットは次の並べ直しで詰める
+    slotToHandle_[handleToSlot_[handle]] = kInvalidHandle;
+    handleToSlot_[handle] = kInvalidHandle;
+    parentHandles_[handle] = kInvalidHandle;
+    isDirty_[handle] = 0;
+    freeHandles_.push_back(handle);
+    --nodeCount_;
+
+    isOrderDirty_ = true;
+    updatedRanges_.clear();
+}
+
+void TransformHierarchy::Clear() {
+    scales_.clear();
+    rotations_.clear();
+    eulerRotations_.clear();
+    isUseQuaternion_.clear();
+    translations_.clear();
+    worldMatrices_.clear();
+    parentSlots_.clear();
+    subtreeEnds_.clear();
+    slotToHandle_.clear();
+    handleToSlot_.clear();
+    parentHandles_.clear();
+    isDirty_.clear();
+    freeHandles_.clear();
+    dirtyHandles_.clear();
+    updatedRanges_.clear();
+    nodeCount_ = 0;
+    isOrderDirty_ = false;
+}
+
+void TransformHierarchy::SetParent(uint32_t handle, uint32_t parent) {
+    assert(IsValid(handle));
+    if (parentHandles_[handle] == parent) {
+        return;
+    }
+
+    // 自分の子孫を親にすると循環するので禁止
+    for (uint32_t ancestor = parent; ancestor != kInvalidHandle; ancestor = parentHandles_[ancestor]) {
+        assert(IsValid(ancestor));
+        assert(ancestor != handle && "TransformHierarchy: cyclic parent");
+        if (ancestor == handle) {
+            return;
+        }
+    }
+
+    parentHandles_[handle] = parent;
+    isOrderDirty_ = true;
+    MarkDirty(handle);
+}
+
+bool TransformHierarchy::SetLocal(uint32_t handle, const Vector3 &scale, const Quaternion &rotation, const Vector3 &translation) {
+    uint32_t slot = handleToSlot_[handle];
+    const Quaternion &current = rotations_[slot];
+    if (isUseQuaternion_[slot] && scales_[slot] == scale && translations_[slot] == translation && current.x == rotation.x &&
+        current.y == rotation.y && current.z == rotation.z && current.w == rotation.w) {
+        return false;
+    }
+
+    scales_[slot] = scale;
+    rotations_[slot] = rotation;
+    translations_[slot] = translation;
+    isUseQuaternion_[slot] = 1;
+    MarkDirty(handle);
+    return true;
+}
+
+bool TransformHierarchy::SetLocal(uint32_t handle, const Vector3 &scale, const Vector3 &eulerRotation, const Vector3 &translation) {
+    uint32_t slot = handleToSlot_[handle];
+    if (!isUseQuaternion_[slot] && scales_[slot] == scale && translations_[slot] == translation &&
+        eulerRotations_[slot] == eulerRotation) {
+        return false;
+    }
+
+    scales_[slot] = scale;
+    eulerRotations_[slot] = eulerRotation;
+    translations_[slot] = translation;
+    isUseQuaternion_[slot] = 0;
+    MarkDirty(handle);
+    return true;
+}
+
+void TransformHierarchy::SetTranslation(uint32_t handle, const Vector3 &translation) {
+    translations_[handleToSlot_[handle]] = translation;
+    MarkDirty(handle);
+}
+
+void TransformHierarchy::MarkDirty(uint32_t handle) {
+    // 子孫はUpdateで部分木ごと計算するので、ここでは変更したノードだけを積む
+    if (!isDirty_[handle]) {
+        isDirty_[handle] = 1;
+        dirtyHandles_.push_back(handle);
+    }
+}
+
+uint32_t TransformHierarchy::Update() {
+    if (isOrderDirty_) {
+        RebuildOrder();
+    }
+
+    updatedRanges_.clear();
+    if (dirtyHandles_.empty()) {
+        return 0;
+    }
+
+    // 部分木は連続した範囲なので、ほかの範囲に含まれるものを除いて計算範囲にまとめる
+    uint32_t updateCount = 0;
+    if (dirtyHandles_.size() * kScanRatio >= nodeCount_) {
+        // 変更が多いときは並べ替えずに先頭から走査する
+        for (uint32_t slot = 0; slot < slotToHandle_.size();) {
+            if (isDirty_[slotToHandle_[slot]]) {
+                updatedRanges_.push_back({slot, subtreeEnds_[slot]});
+                updateCount += subtreeEnds_[slot] - slot;
+                slot = subtreeEnds_[slot];
+            } else {
+                ++slot;
+            }
+        }
+        for (uint32_t handle : dirtyHandles_) {
+            isDirty_[handle] = 0;
+        }
+    } else {
+        // 変更が少ないときは変更があったノードだけを並び順に直す
+        dirtySlots_.clear();
+        for (uint32_t handle : dirtyHandles_) {
+            isDirty_[handle] = 0;
+            if (handleToSlot_[handle] != kInvalidHandle) {
+                dirtySlots_.push_back(handleToSlot_[handle]);
+            }
+        }
+        std::sort(dirtySlots_.begin(), dirtySlots_.end());
+
+        for (uint32_t slot : dirtySlots_) {
+            if (!updatedRanges_.empty() && slot < updatedRanges_.back().end) {
+                continue;
+            }
+            updatedRanges_.push_back({slot, subtreeEnds_[slot]});
+            updateCount += subtreeEnds_[slot] - slot;
+        }
+    }
+    dirtyHandles_.clear();
+
+    // 範囲の外の親は変更がないので、範囲どうしは独立して計算できる
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    if (updateCount >= kParallelThreshold && updatedRanges_.size() > 1 && jobSystem->IsInitialized()) {
+        // 1ワーカーあたり数個のジョブになるよう範囲をまとめる
+        uint32_t rangeCount = static_cast<uint32_t>(updatedRanges_.size());
+        uint32_t grainSize = (std::max)(rangeCount / ((jobSystem->GetWorkerCount() + 1) * 4), 1u);
+        jobSystem->ParallelFor(rangeCount, grainSize, [this](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                UpdateRange(updatedRanges_[i]);
+            }
+        });
+    } else {
+        for (const Range &range : updatedRanges_) {
+            UpdateRange(range);
+        }
+    }
+
+    return updateCount;
+}
+
+void TransformHierarchy::UpdateRange(const Range &range) {
+    for (uint32_t slot = range.begin; slot < range.end; ++slot) {
+        Matrix4x4 local = isUseQuaternion_[slot] ? MakeAffineMatrix(scales_[slot], rotations_[slot], translations_[slot])
+                                                 : MakeAffineMatrix(scales_[slot], eulerRotations_[slot], translations_[slot]);
+
+        // 親は前にあるので計算済み
+        uint32_t parentSlot = parentSlots_[slot];
+        worldMatrices_[slot] = parentSlot == kInvalidHandle ? local : MultiplyAffine(local, worldMatrices_[parentSlot]);
+    }
+}
+
+void TransformHierarchy::RebuildOrder() {
+    isOrderDirty_ = false;
+
+    // 今の並び順を保ったまま子の一覧を作る（ハンドルで引く）
+    const uint32_t handleCount = static_cast<uint32_t>(handleToSlot_.size());
+    std::vector<uint32_t> childOffsets(handleCount + 1, 0);
+    std::vector<uint32_t> roots;
+    for (uint32_t handle : slotToHandle_) {
+        if (handle == kInvalidHandle) {
+            continue;
+        }
+        if (parentHandles_[handle] == kInvalidHandle) {
+            roots.push_back(handle);
+        } else {
+            ++childOffsets[parentHandles_[handle] + 1];
+        }
+    }
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        childOffsets[i + 1] += childOffsets[i];
+    }
+    std::vector<uint32_t> children(childOffsets[handleCount]);
+    std::vector<uint32_t> childFill(childOffsets.begin(), childOffsets.end() - 1);
+    for (uint32_t handle : slotToHandle_) {
+        if (handle != kInvalidHandle && parentHandles_[handle] != kInvalidHandle) {
+            children[childFill[parentHandles_[handle]]++] = handle;
+        }
+    }
+
+    // 深さ優先の前順に並べる（部分木が連続した範囲になる）
+    std::vector<uint32_t> order;
+    order.reserve(nodeCount_);
+    std::vector<uint32_t> stack;
+    for (uint32_t root : roots) {
+        stack.push_back(root);
+        while (!stack.empty()) {
+            uint32_t handle = stack.back();
+            stack.pop_back();
+            order.push_back(handle);
+            // 先頭の子から取り出されるよう逆順に積む
+            for (uint32_t i = childOffsets[handle + 1]; i > childOffsets[handle]; --i) {
+                stack.push_back(children[i - 1]);
+            }
+        }
+    }
+    assert(order.size() == nodeCount_);
+
+    // 新しい並び順に配列を詰め直す
+    const uint32_t count = static_cast<uint32_t>(order.size());
+    std::vector<Vector3> scales(count);
+    std::vector<Quaternion> rotations(count);
+    std::vector<Vector3> eulerRotations(count);
+    std::vector<uint8_t> isUseQuaternion(count);
+    std::vector<Vector3> translations(count);
+    std::vector<Matrix4x4> worldMatrices(count);
+    std::vector<uint32_t> parentSlots(count);
+    std::vector<uint32_t> subtreeEnds(count);
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        uint32_t handle = order[slot];
+        uint32_t oldSlot = handleToSlot_[handle];
+        scales[slot] = scales_[oldSlot];
+        rotations[slot] = rotations_[oldSlot];
+        eulerRotations[slot] = eulerRotations_[oldSlot];
+        isUseQuaternion[slot] = isUseQuaternion_[oldSlot];
+        translations[slot] = translations_[oldSlot];
+        worldMatrices[slot] = worldMatrices_[oldSlot];
+        subtreeEnds[slot] = slot + 1;
+    }
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        handleToSlot_[order[slot]] = slot;
+    }
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        uint32_t parent = parentHandles_[order[slot]];
+        parentSlots[slot] = parent == kInvalidHandle ? kInvalidHandle : handleToSlot_[parent];
+    }
+    // 子は親より後ろにあるので、後ろから親へ部分木の終端を伝える
+    for (uint32_t slot = count; slot-- > 0;) {
+        if (parentSlots[slot] != kInvalidHandle) {
+            subtreeEnds[parentSlots[slot]] = (std::max)(subtreeEnds[parentSlots[slot]], subtreeEnds[slot]);
+        }
+    }
+
+    scales_ = std::move(scales);
+    rotations_ = std::move(rotations);
+    eulerRotations_ = std::move(eulerRotations);
+    isUseQuaternion_ = std::move(isUseQuaternion);
+    translations_ = std::move(translations);
+    worldMatrices_ = std::move(worldMatrices);
+    parentSlots_ = std::move(parentSlots);
+    subtreeEnds_ = std::move(subtreeEnds);
+    slotToHandle_ = std::move(order);
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "myMath.h"
+#include "type/Quaternion.h"
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// ワールド変換の一括計算
+/// ローカルのSRTとワールド行列を親→子の順（深さ優先の前順）に並べた配列で持ち、
+/// 変更があったノードの部分木だけを1回の線形走査で再計算する
+/// </summary>
+class TransformHierarchy {
+  public:
+    // 無効なハンドル
+    static constexpr uint32_t kInvalidHandle = UINT32_MAX;
+    // この数以上のノードを更新するときは部分木ごとに並列で計算する
+    static constexpr uint32_t kParallelThreshold = 4096;
+    // 変更があったノードがノード数のこの分の1以上なら、並べ替えずに全体を走査して計算範囲を集める
+    static constexpr size_t kScanRatio = 16;
+
+    /// <summary>
+    /// ノードの追加（追加したノードは次のUpdateで計算される）
+    /// </summary>
+    /// <param name="parent">親のハンドル（kInvalidHandleならルート）</param>
+    /// <returns>ハンドル</returns>
+    uint32_t Create(uint32_t parent = kInvalidHandle);
+
+    /// <summary>
+    /// ノードの削除（子はルートになる）
+    /// </summary>
+    void Destroy(uint32_t handle);
+
+    /// <summary>
+    /// すべてのノードの削除
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 親の設定（kInvalidHandleで親子解除）
+    /// </summary>
+    void SetParent(uint32_t handle, uint32_t parent);
+
+    /// <summary>
+    /// ローカルのSRTを設定（値が変わったときだけ部分木を再計算の対象にする）
+    /// </summary>
+    /// <returns>値が変わったか</returns>
+    bool SetLocal(uint32_t handle, const Vector3 &scale, const Quaternion &rotation, const Vector3 &translation);
+
+    /// <summary>
+    /// ローカルのSRTを設定（回転はオイラー角）
+    /// </summary>
+    /// <returns>値が変わったか</returns>
+    bool SetLocal(uint32_t handle, const Vector3 &scale, const Vector3 &eulerRotation, const Vector3 &translation);
+
+    /// <summary>
+    /// 平行移動だけを設定
+    /// </summary>
+    void SetTranslation(uint32_t handle, const Vector3 &translation);
+
+    /// <summary>
+    /// 部分木を再計算の対象にする
+    /// </summary>
+    void MarkDirty(uint32_t handle);
+
+    /// <summary>
+    /// 変更があったノードとその子孫のワールド行列を計算する
+    /// </summary>
+    /// <returns>計算したノード数</returns>
+    uint32_t Update();
+
+    /// <summary>
+    /// 直前のUpdateで計算したノードを列挙する
+    /// </summary>
+    /// <param name="function">void(uint32_t handle, const Matrix4x4 &world)</param>
+    template <typename Function>
+    void ForEachUpdated(Function function) const;
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    const Matrix4x4 &GetWorldMatrix(uint32_t handle) const { return worldMatrices_[handleToSlot_[handle]]; }
+    uint32_t GetParent(uint32_t handle) const { return parentHandles_[handle]; }
+    uint32_t GetNodeCount() const { return nodeCount_; }
+    bool IsValid(uint32_t handle) const { return handle < handleToSlot_.size() && handleToSlot_[handle] != kInvalidHandle; }
+
+  private:
+    // 連続した計算範囲 [begin, end)
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    /// <summary>
+    /// 親子関係が変わったときに配列を深さ優先の前順に並べ直す
+    /// </summary>
+    void RebuildOrder();
+
+    /// <summary>
+    /// 範囲内のワールド行列を計算（範囲の外の親は計算済み）
+    /// </summary>
+    void UpdateRange(const Range &range);
+
+  private:
+    // ---- 配列の並び順（スロット）で持つデータ ----
+    std::vector<Vector3> scales_;
+    std::vector<Quaternion> rotations_;
+    std::vector<Vector3> eulerRotations_;
+    std::vector<uint8_t> isUseQuaternion_;
+    std::vector<Vector3> translations_;
+    std::vector<Matrix4x4> worldMatrices_;
+    std::vector<uint32_t> parentSlots_; // 親のスロット（親は必ず前にある）
+    std::vector<uint32_t> subtreeEnds_; // 部分木の終端（[slot, subtreeEnd) が部分木）
+    std::vector<uint32_t> slotToHandle_;
+
+    // ---- ハンドルで引くデータ ----
+    std::vector<uint32_t> handleToSlot_;
+    std::vector<uint32_t> parentHandles_;
+    std::vector<uint8_t> isDirty_;
+    std::vector<uint32_t> freeHandles_;
+
+    // 変更があったノード
+    std::vector<uint32_t> dirtyHandles_;
+    std::vector<uint32_t> dirtySlots_;
+    // 直前のUpdateで計算した範囲
+    std::vector<Range> updatedRanges_;
+
+    uint32_t nodeCount_ = 0;
+    // 親子関係が変わり並べ直しが必要か
+    bool isOrderDirty_ = false;
+};
+
+template <typename Function>
+void TransformHierarchy::ForEachUpdated(Function function) const {
+    for (const Range &range : updatedRanges_) {
+        for (uint32_t slot = range.begin; slot < range.end; ++slot) {
+            function(slotToHandle_[slot], worldMatrices_[slot]);
+        }
+    }
+}
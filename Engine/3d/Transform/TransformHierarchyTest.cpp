@@ -0,0 +1,175 @@
+#include "Job/JobSystem.h"
+#include "Test/Test.h"
+#include "Transform/TransformHierarchy.h"
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+namespace {
+
+// 確かめる用のシーン（親は必ず前のノード。ワールド行列は素直に親から順に計算する）
+struct ReferenceScene {
+    std::vector<Vector3> scales;
+    std::vector<Quaternion> rotations;
+    std::vector<Vector3> translations;
+    std::vector<uint32_t> parents; // 親のインデックス（ルートはUINT32_MAX）
+    std::vector<uint32_t> handles;
+
+    void ComputeWorld(std::vector<Matrix4x4> &world) const {
+        world.resize(parents.size());
+        for (size_t i = 0; i < parents.size(); ++i) {
+            world[i] = MakeAffineMatrix(scales[i], rotations[i], translations[i]);
+            if (parents[i] != UINT32_MAX) {
+                world[i] = MultiplyAffine(world[i], world[parents[i]]);
+            }
+        }
+    }
+};
+
+// ルートをいくつか作り、残りは前に作ったノードのどれかの子にしたランダムな木
+ReferenceScene MakeScene(TransformHierarchy &hierarchy, uint32_t nodeCount, uint32_t rootCount, std::mt19937 &random) {
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    ReferenceScene scene;
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        uint32_t parent = i < rootCount ? UINT32_MAX : static_cast<uint32_t>(random() % i);
+        scene.scales.push_back({1.0f + value(random) * 0.1f, 1.0f + value(random) * 0.1f, 1.0f + value(random) * 0.1f});
+        scene.rotations.push_back(Quaternion::FromEulerAngles({value(random), value(random), value(random)}));
+        scene.translations.push_back({value(random) * 5.0f, value(random) * 5.0f, value(random) * 5.0f});
+        scene.parents.push_back(parent);
+        scene.handles.push_back(hierarchy.Create(parent == UINT32_MAX ? TransformHierarchy::kInvalidHandle : scene.handles[parent]));
+        hierarchy.SetLocal(scene.handles[i], scene.scales[i], scene.rotations[i], scene.translations[i]);
+    }
+    return scene;
+}
+
+bool MatchesReference(const TransformHierarchy &hierarchy, const ReferenceScene &scene) {
+    std::vector<Matrix4x4> expected;
+    scene.ComputeWorld(expected);
+    for (size_t i = 0; i < scene.handles.size(); ++i) {
+        const Matrix4x4 &actual = hierarchy.GetWorldMatrix(scene.handles[i]);
+        // 同じ関数で同じ順に計算しているので完全に一致する
+        if (std::memcmp(&actual, &expected[i], sizeof(Matrix4x4)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 1% / 10% / 100% のノードを動かし、動かしたノードの部分木だけが計算し直されることを確かめる
+void CheckDirtyPropagation(float movingRatio) {
+    constexpr uint32_t kNodeCount = 10000;
+    std::mt19937 random(12345u);
+    TransformHierarchy hierarchy;
+    ReferenceScene scene = MakeScene(hierarchy, kNodeCount, 100, random);
+    CHECK(hierarchy.Update() == kNodeCount);
+    CHECK(MatchesReference(hierarchy, scene));
+
+    std::vector<uint32_t> shuffled(kNodeCount);
+    for (uint32_t i = 0; i < kNodeCount; ++i) {
+        shuffled[i] = i;
+    }
+    std::shuffle(shuffled.begin(), shuffled.end(), random);
+    const uint32_t movingCount = (std::max)(1u, static_cast<uint32_t>(kNodeCount * movingRatio));
+
+    std::vector<uint32_t> handleToIndex(kNodeCount);
+    for (uint32_t i = 0; i < kNodeCount; ++i) {
+        handleToIndex[scene.handles[i]] = i;
+    }
+
+    for (int frame = 0; frame < 3; ++frame) {
+        std::vector<uint8_t> isAffected(kNodeCount, 0);
+        for (uint32_t i = 0; i < movingCount; ++i) {
+            uint32_t index = shuffled[(i + frame * movingCount) % kNodeCount];
+            scene.translations[index].x += 0.5f;
+            CHECK(hierarchy.SetLocal(scene.handles[index], scene.scales[index], scene.rotations[index], scene.translations[index]));
+            isAffected[index] = 1;
+        }
+        // 親は必ず前にあるので、前から見れば子孫まで伝わる
+        uint32_t expectedCount = 0;
+        for (uint32_t i = 0; i < kNodeCount; ++i) {
+            if (scene.parents[i] != UINT32_MAX && isAffected[scene.parents[i]]) {
+                isAffected[i] = 1;
+            }
+            expectedCount += isAffected[i];
+        }
+
+        CHECK(hierarchy.Update() == expectedCount);
+        uint32_t updatedCount = 0;
+        bool isOnlyAffected = true;
+        hierarchy.ForEachUpdated([&](uint32_t handle, const Matrix4x4 &) {
+            isOnlyAffected = isOnlyAffected && isAffected[handleToIndex[handle]];
+            ++updatedCount;
+        });
+        CHECK(updatedCount == expectedCount);
+        CHECK(isOnlyAffected);
+        CHECK(MatchesReference(hierarchy, scene));
+    }
+
+    // 何も変えなければ計算しない
+    CHECK(hierarchy.Update() == 0);
+}
+
+} // namespace
+
+// 1%のノードを動かす
+TEST(DirtyPropagationOnePercent) { CheckDirtyPropagation(0.01f); }
+
+// 10%のノードを動かす
+TEST(DirtyPropagationTenPercent) { CheckDirtyPropagation(0.1f); }
+
+// すべてのノードを動かす（ジョブシステムがあれば部分木ごとに並列で計算する）
+TEST(DirtyPropagationAllNodes) {
+    CheckDirtyPropagation(1.0f);
+    JobSystem::GetInstance()->Initialize(3);
+    CheckDirtyPropagation(1.0f);
+    JobSystem::GetInstance()->Finalize();
+}
+
+// 同じ値を設定しても計算し直さない
+TEST(UnchangedLocalIsNotDirty) {
+    std::mt19937 random(7u);
+    TransformHierarchy hierarchy;
+    ReferenceScene scene = MakeScene(hierarchy, 64, 4, random);
+    hierarchy.Update();
+    for (size_t i = 0; i < scene.handles.size(); ++i) {
+        CHECK(!hierarchy.SetLocal(scene.handles[i], scene.scales[i], scene.rotations[i], scene.translations[i]));
+    }
+    CHECK(hierarchy.Update() == 0);
+}
+
+// 親の付け替えと削除の後も、親子の順に正しく計算される
+TEST(ReparentAndDestroy) {
+    std::mt19937 random(9u);
+    TransformHierarchy hierarchy;
+    ReferenceScene scene = MakeScene(hierarchy, 256, 8, random);
+    hierarchy.Update();
+
+    // 後ろのノードを最初のルートの子にする（親は前のノードのままなので確かめる側の計算順は変わらない）
+    for (uint32_t i = 200; i < 256; i += 7) {
+        scene.parents[i] = 0;
+        hierarchy.SetParent(scene.handles[i], scene.handles[0]);
+    }
+    hierarchy.Update();
+    CHECK(MatchesReference(hierarchy, scene));
+    CHECK(hierarchy.GetParent(scene.handles[207]) == scene.handles[0]);
+
+    // 削除したノードの子はルートになる
+    const uint32_t destroyed = 0;
+    hierarchy.Destroy(scene.handles[destroyed]);
+    CHECK(!hierarchy.IsValid(scene.handles[destroyed]));
+    CHECK(hierarchy.GetNodeCount() == 255);
+    for (uint32_t i = 1; i < 256; ++i) {
+        if (scene.parents[i] == destroyed) {
+            scene.parents[i] = UINT32_MAX;
+            CHECK(hierarchy.GetParent(scene.handles[i]) == TransformHierarchy::kInvalidHandle);
+        }
+    }
+    hierarchy.Update();
+    std::vector<Matrix4x4> expected;
+    scene.ComputeWorld(expected);
+    bool isMatched = true;
+    for (uint32_t i = 1; i < 256; ++i) {
+        isMatched = isMatched && std::memcmp(&hierarchy.GetWorldMatrix(scene.handles[i]), &expected[i], sizeof(Matrix4x4)) == 0;
+    }
+    CHECK(isMatched);
+}
@@ -46,9 +46,9 @@ void WorldTransform::UpdateMatrix() {
     // クォータニオンorオイラー
     isUseQuaternion_ ? UpdateQuaternion() : UpdateEuler();
 
-    // 親があれば親のワールド行列を掛ける
+    // 親があれば親のワールド行列を掛ける（どちらもアフィン行列）
     if (parent_) {
-        matWorld_ = matWorld_ * parent_->matWorld_;
+        matWorld_ = MultiplyAffine(matWorld_, parent_->matWorld_);
     }
 
     // 定数バッファに転送する
@@ -102,11 +102,15 @@ void WorldTransform::UpdateEuler() {
 
 void WorldTransform::UpdateQuaternion() {
     // 回転処理（オイラー角が変更された場合にクォータニオンを更新）
+    ApplyEulerRotation();
+    // クォータニオンから行列を作成
+    matWorld_ = MakeAffineMatrix(scale_, quateRotation_, translation_);
+}
+
+void WorldTransform::ApplyEulerRotation() {
     if (eulerRotation_.x != preRotate_.x || eulerRotation_.y != preRotate_.y || eulerRotation_.z != preRotate_.z) {
         RotateQuaternion();
     }
-    // クォータニオンから行列を作成
-    matWorld_ = MakeAffineMatrix(scale_, quateRotation_, translation_);
     // 回転量計算用変数に挿入
     preRotate_ = eulerRotation_;
 }
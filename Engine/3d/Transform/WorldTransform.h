@@ -47,6 +47,11 @@ class WorldTransform {
     /// </summary>
     void UpdateMatrix();
 
+    /// <summary>
+    /// オイラー角が変更されていればクォータニオンに反映する（クォータニオン使用時）
+    /// </summary>
+    void ApplyEulerRotation();
+
     /// <summary>
     /// オイラー角で回転を設定
     /// </summary>
@@ -1,6 +1,7 @@
 #include "Audio.h"
+#include <algorithm>
 #include <cassert>
-#include <fstream>
+#include <chrono>
 
 Audio* Audio::instance = nullptr;
 
@@ -13,6 +14,9 @@ void Audio::Initialize(const std::string& directoryPath)
 	hr = XAudio2Create(&xAudio2, 0, XAUDIO2_DEFAULT_PROCESSOR);
 	hr = xAudio2->CreateMasteringVoice(&masterVoice);
 
+	// ストリーミングスレッドの開始
+	isStreamRunning_ = true;
+	streamThread_ = std::thread(&Audio::StreamThread, this);
 }
 
 Audio* Audio::GetInstance()
@@ -26,115 +30,84 @@ Audio* Audio::GetInstance()
 uint32_t Audio::LoadWave(const std::string& filename) {
 
 	// ファイルがすでに読み込まれているかチェック
-	if (loadedFiles.find(filename) != loadedFiles.end()) {
+	auto found = soundIndices_.find(filename);
+	if (found != soundIndices_.end() && !soundDatas_[found->second].isStream) {
 		// 既に読み込まれている場合はインデックスを返す
-		for (size_t i = 0; i < kMaxSoundData; ++i) {
-			if (soundDatas_[i].name_ == filename) {
-				return static_cast<uint32_t>(i);
-			}
-		}
+		return found->second;
 	}
 
 	// ディレクトリパスとファイル名を組み合わせたフルパスを作成
 	std::string fullPath = directoryPath_ + "/" + filename;
 
-	// ファイル入力ストリームのインスタンス
-	std::ifstream file;
-	// .wavファイルをバイナリモードで開く
-	file.open(fullPath, std::ios_base::binary);
-	assert(file.is_open());
-
-	// RIFFヘッダーの読み込み
-	RiffHeader riff;
-	file.read((char*)&riff, sizeof(riff));
-
-	// ファイルがRIFFかチェック
-	if (strncmp(riff.chunk.id, "RIFF", 4) != 0) {
-		assert(0);
-	}
-	// タイプがWAVEかチェック
-	if (strncmp(riff.type, "WAVE", 4) != 0) {
-		assert(0);
-	}
-
-	// チャンクのループを開始
-	ChunkHeader chunkHeader;
-	FormatChunk format = {};
+	// 拡張子に応じたデコーダで全体をデコード
+	AudioFormat format;
+	std::vector<uint8_t> buffer;
+	bool result = AudioDecoder::DecodeAll(fullPath, format, buffer);
+	assert(result);
 
-	while (file.read((char*)&chunkHeader, sizeof(chunkHeader))) {
-		// チャンクIDが "fmt" か確認
-		if (strncmp(chunkHeader.id, "fmt ", 4) == 0) {
-			// Formatチャンクのサイズを確認、データを読み込む
-			assert(chunkHeader.size <= sizeof(format.fmt));
-
-			format.chunk = chunkHeader; // チャンクヘッダーをコピー
-			file.read((char*)&format.fmt, chunkHeader.size); // fmtのデータを読み込み
+	// 空いているインデックスにデータを格納
+	uint32_t currentIndex = found != soundIndices_.end() ? found->second : AllocateSoundIndex();
+	SoundData& soundData = soundDatas_[currentIndex];
+	soundData.wfex = ToWaveFormat(format);
+	soundData.buffer = std::move(buffer);  // std::vector のムーブ
+	soundData.name_ = filename;  // ファイル名を name_ にセット
+	soundData.fullPath = fullPath;
+	soundData.isStream = false;
 
-			break;
-		}
-		else {
-			// 次のチャンクに移動
-			file.seekg(chunkHeader.size, std::ios_base::cur);
-		}
-	}
+	soundIndices_[filename] = currentIndex;
 
-	// "fmt"チャンクが見つからなかった場合のエラーとしてだす
-	if (strncmp(format.chunk.id, "fmt ", 4) != 0) {
-		assert(0);
-	}
+	return currentIndex;
+}
 
-	// Dataチャンクの読み込み
-	// Dataチャンクの読み込みとスキップ処理
-	ChunkHeader data;
-	while (file.read((char*)&data, sizeof(data))) {
-		if (strncmp(data.id, "data", 4) == 0) {
-			break; // "data" チャンクを見つけたらループを抜ける
-		}
-		else {
-			// 現在のチャンクが "data" でない場合、そのサイズ分シーク
-			file.seekg(data.size, std::ios_base::cur);
-		}
-	}
+uint32_t Audio::LoadStream(const std::string& filename) {
 
-	if (strncmp(data.id, "data", 4) != 0) {
-		assert(0);
+	// ファイルがすでに登録されているかチェック
+	auto found = soundIndices_.find(filename);
+	if (found != soundIndices_.end() && soundDatas_[found->second].isStream) {
+		return found->second;
 	}
 
-	// Dataチャンクのデータ部（波形データの読み込み）
-	std::vector<uint8_t> buffer(data.size);
-	file.read(reinterpret_cast<char*>(buffer.data()), data.size);
-
-	// waveファイルを閉じる
-	file.close();
-
-	// 次のインデックスにデータを格納
-	SoundData& soundData = soundDatas_[soundDataIndex];
-	soundData.wfex = format.fmt;
-	soundData.buffer = std::move(buffer);  // std::vector のムーブ
-	soundData.name_ = filename;  // ファイル名を name_ にセット
+	std::string fullPath = directoryPath_ + "/" + filename;
 
-	loadedFiles.insert(filename); // 読み込んだファイル名をセットに追加
+	// フォーマットだけ読み取る（波形データは再生時に読む）
+	std::unique_ptr<AudioDecoder> decoder = AudioDecoder::Create(fullPath);
+	assert(decoder);
 
-	// 現在のインデックスを返す
-	uint32_t currentIndex = static_cast<uint32_t>(soundDataIndex);
+	uint32_t currentIndex = found != soundIndices_.end() ? found->second : AllocateSoundIndex();
+	SoundData& soundData = soundDatas_[currentIndex];
+	soundData.wfex = ToWaveFormat(decoder->GetFormat());
+	soundData.buffer.clear();
+	soundData.buffer.shrink_to_fit();
+	soundData.name_ = filename;
+	soundData.fullPath = fullPath;
+	soundData.isStream = true;
 
-	// インデックスを更新
-	soundDataIndex = (soundDataIndex + 1) % kMaxSoundData;
+	soundIndices_[filename] = currentIndex;
 
 	return currentIndex;
 }
 
-
-
 void Audio::Unload(uint32_t soundIndex)
 {
+	if (soundIndex >= soundDatas_.size() || soundDatas_[soundIndex].name_.empty()) {
+		return;
+	}
+
+	// 再生中のボイスがバッファを参照しているので先に止める
+	StopWave(soundIndex);
 
 	SoundData& soundData = soundDatas_[soundIndex];
+	soundIndices_.erase(soundData.name_);
 
 	// メモリ解放は不要。vectorは自動的にメモリを管理する
 	soundData.buffer.clear();  // バッファを空にする
+	soundData.buffer.shrink_to_fit();
 	soundData.wfex = {};
 	soundData.name_.clear();  // 名前もクリア
+	soundData.fullPath.clear();
+	soundData.isStream = false;
+
+	freeIndices_.push_back(soundIndex);
 }
 
 void Audio::PlayWave(uint32_t soundIndex, float volume, bool loop) {
@@ -145,32 +118,48 @@ void Audio::PlayWave(uint32_t soundIndex, float volume, bool loop) {
 	Voice* voice = new Voice(); // Voiceインスタンスを作成
 	voice->handle = soundIndex; // 音声ハンドルを設定
 	voice->volume = volume;     // 指定された音量を設定
-
-	// XAudio2のコールバックインスタンスを作成
-	VoiceCallback* voiceCallback = new VoiceCallback();
+	voice->loop = loop;
 
 	// ソースボイスを作成
-	result = xAudio2->CreateSourceVoice(&voice->sourceVoice, &soundData.wfex, 0, XAUDIO2_DEFAULT_FREQ_RATIO, voiceCallback);
+	result = xAudio2->CreateSourceVoice(&voice->sourceVoice, &soundData.wfex, 0, XAUDIO2_DEFAULT_FREQ_RATIO, &voiceCallback_);
 	assert(SUCCEEDED(result));
 
-	// バッファを設定
-	XAUDIO2_BUFFER buf{};
-	buf.pAudioData = soundData.buffer.data();  // vectorから直接バッファを取得
-	buf.AudioBytes = static_cast<uint32_t>(soundData.buffer.size());
-	buf.Flags = XAUDIO2_END_OF_STREAM;
-	buf.pContext = voice;  // コールバック用のコンテキストとしてVoiceインスタンスを渡す
+	if (soundData.isStream) {
+		// デコーダを開いてバッファのリングを用意
+		voice->decoder = AudioDecoder::Create(soundData.fullPath);
+		assert(voice->decoder);
 
-	// ループ再生の設定
-	if (loop) {
-		buf.LoopCount = XAUDIO2_LOOP_INFINITE;  // 無限ループで再生
+		// バッファサイズはブロック境界に揃える
+		size_t blockAlign = (std::max)(static_cast<size_t>(soundData.wfex.nBlockAlign), size_t(1));
+		size_t bufferSize = kStreamBufferSize / blockAlign * blockAlign;
+		for (auto& buffer : voice->streamBuffers) {
+			buffer.resize(bufferSize);
+		}
+
+		// 再生開始前にバッファを埋めておく（まだ他のスレッドから見えないのでロックはいらない）
+		DecodeStreamBuffers(voice, kStreamBufferCount);
+		SubmitStreamBuffers(voice);
 	}
 	else {
-		buf.LoopCount = 0;  // ループしない
-	}
+		// バッファを設定
+		XAUDIO2_BUFFER buf{};
+		buf.pAudioData = soundData.buffer.data();  // vectorから直接バッファを取得
+		buf.AudioBytes = static_cast<uint32_t>(soundData.buffer.size());
+		buf.Flags = XAUDIO2_END_OF_STREAM;
+		buf.pContext = voice;  // コールバック用のコンテキストとしてVoiceインスタンスを渡す
+
+		// ループ再生の設定
+		if (loop) {
+			buf.LoopCount = XAUDIO2_LOOP_INFINITE;  // 無限ループで再生
+		}
+		else {
+			buf.LoopCount = 0;  // ループしない
+		}
 
-	// ソースボイスにバッファを送信
-	result = voice->sourceVoice->SubmitSourceBuffer(&buf);
-	assert(SUCCEEDED(result));
+		// ソースボイスにバッファを送信
+		result = voice->sourceVoice->SubmitSourceBuffer(&buf);
+		assert(SUCCEEDED(result));
+	}
 
 	// ソースボイスを開始
 	result = voice->sourceVoice->Start();
@@ -180,21 +169,24 @@ void Audio::PlayWave(uint32_t soundIndex, float volume, bool loop) {
 	voice->sourceVoice->SetVolume(voice->volume);
 
 	// 再生中のボイスをセットに追加
+	std::lock_guard<std::mutex> lock(voiceMutex_);
 	voices_.insert(voice);
 }
 
 void Audio::StopWave(uint32_t soundIndex)
 {
+	std::lock_guard<std::mutex> lock(voiceMutex_);
 
 	// 再生中の音声を探す
 	for (auto it = voices_.begin(); it != voices_.end(); ) {
-		if ((*it)->handle == soundIndex) {
-			// 音声を停止
-			if ((*it)->sourceVoice != nullptr) {
-				(*it)->sourceVoice->Stop(0); // 音声を停止
-				(*it)->sourceVoice->DestroyVoice(); // ソースボイスを解放
-			}
-			delete* it; // Voiceオブジェクトを解放
+		if ((*it)->handle == soundIndex && (*it)->isDecoding) {
+			// デコード中のバッファがあるので止めるだけにして、破棄はストリーミングスレッドに任せる
+			(*it)->sourceVoice->Stop(0);
+			(*it)->isStopRequested = true;
+			++it;
+		}
+		else if ((*it)->handle == soundIndex) {
+			DestroyVoice(*it);
 			it = voices_.erase(it); // セットから削除
 		}
 		else {
@@ -205,6 +197,8 @@ void Audio::StopWave(uint32_t soundIndex)
 
 void Audio::SetVolume(uint32_t soundIndex, float volume)
 {
+	std::lock_guard<std::mutex> lock(voiceMutex_);
+
 	// 再生中の音声を探す
 	for (auto& voice : voices_) {
 		if (voice->handle == soundIndex) {
@@ -218,29 +212,187 @@ void Audio::SetVolume(uint32_t soundIndex, float volume)
 
 void Audio::Finalize()
 {
+	// ストリーミングスレッドを止める
+	isStreamRunning_ = false;
+	streamCondition_.notify_all();
+	if (streamThread_.joinable()) {
+		streamThread_.join();
+	}
+
+	// 再生中の音声の解放（マスターボイスより先に破棄する）
+	for (auto voice : voices_) {
+		DestroyVoice(voice);
+	}
+	voices_.clear(); // セットをクリア
+
 	// マスターボイスを解放
 	if (masterVoice) {
 		masterVoice->DestroyVoice();
 		masterVoice = nullptr;
 	}
 
-	// 再生中の音声の解放
-	for (auto voice : voices_) {
-		if (voice->sourceVoice) {
-			// 音声の破棄を試みる
-			voice->sourceVoice->DestroyVoice();
-
-		}
-		delete voice; // Voiceオブジェクトを解放
-	}
 	// XAudio2を解放
 	if (xAudio2) {
 		xAudio2.Reset();
 	}
 
-	voices_.clear(); // セットをクリア
 	delete instance;
 	instance = nullptr;
 
 }
 
+uint32_t Audio::AllocateSoundIndex()
+{
+	// 解放済みのインデックスがあれば再利用する
+	if (!freeIndices_.empty()) {
+		uint32_t index = freeIndices_.back();
+		freeIndices_.pop_back();
+		return index;
+	}
+	soundDatas_.emplace_back();
+	return static_cast<uint32_t>(soundDatas_.size() - 1);
+}
+
+void Audio::DecodeStreamBuffers(Voice* voice, uint32_t freeCount)
+{
+	// XAudio2は送信順にバッファを消費するので、キューに入っていないバッファはnextBufferから順に使える
+	voice->decodedCount = 0;
+	uint32_t bufferIndex = voice->nextBuffer;
+	while (voice->decodedCount < freeCount && !voice->isEndDecoded) {
+		std::vector<uint8_t>& buffer = voice->streamBuffers[bufferIndex];
+
+		size_t size = voice->decoder->Read(buffer.data(), buffer.size());
+		// ループ再生なら先頭に戻って続きを埋める
+		while (size < buffer.size() && voice->loop) {
+			if (!voice->decoder->Rewind()) {
+				break;
+			}
+			size_t readSize = voice->decoder->Read(buffer.data() + size, buffer.size() - size);
+			if (readSize == 0) {
+				break;
+			}
+			size += readSize;
+		}
+
+		voice->decodedSizes[voice->decodedCount++] = size;
+		if (size < buffer.size()) {
+			voice->isEndDecoded = true;
+		}
+		bufferIndex = (bufferIndex + 1) % kStreamBufferCount;
+	}
+}
+
+void Audio::SubmitStreamBuffers(Voice* voice)
+{
+	for (uint32_t i = 0; i < voice->decodedCount; ++i) {
+		std::vector<uint8_t>& buffer = voice->streamBuffers[voice->nextBuffer];
+		size_t size = voice->decodedSizes[i];
+
+		if (size == 0) {
+			// ちょうど終端だった場合は送信済みのバッファで終わる
+			voice->sourceVoice->Discontinuity();
+			voice->isEndSubmitted = true;
+			break;
+		}
+
+		XAUDIO2_BUFFER buf{};
+		buf.pAudioData = buffer.data();
+		buf.AudioBytes = static_cast<uint32_t>(size);
+		if (size < buffer.size()) {
+			buf.Flags = XAUDIO2_END_OF_STREAM;
+			voice->isEndSubmitted = true;
+		}
+		HRESULT result = voice->sourceVoice->SubmitSourceBuffer(&buf);
+		assert(SUCCEEDED(result));
+
+		voice->nextBuffer = (voice->nextBuffer + 1) % kStreamBufferCount;
+	}
+	voice->decodedCount = 0;
+}
+
+void Audio::DestroyVoice(Voice* voice)
+{
+	if (voice->sourceVoice != nullptr) {
+		voice->sourceVoice->Stop(0); // 音声を停止
+		voice->sourceVoice->DestroyVoice(); // ソースボイスを解放
+	}
+	delete voice; // Voiceオブジェクトを解放
+}
+
+void Audio::StreamThread()
+{
+	// デコードするボイスと空いているバッファの数
+	std::vector<std::pair<Voice*, uint32_t>> decodeVoices;
+
+	std::unique_lock<std::mutex> lock(voiceMutex_);
+	while (isStreamRunning_) {
+		// バッファ終了の通知か一定時間ごとに起きる
+		streamCondition_.wait_for(lock, std::chrono::milliseconds(10));
+		if (!isStreamRunning_) {
+			break;
+		}
+
+		// ロック中は状態の確認と破棄だけ行い、デコードするボイスを集める
+		decodeVoices.clear();
+		for (auto it = voices_.begin(); it != voices_.end(); ) {
+			Voice* voice = *it;
+			bool isFinished = voice->isFinished;
+
+			if (voice->decoder) {
+				XAUDIO2_VOICE_STATE state;
+				voice->sourceVoice->GetState(&state, XAUDIO2_VOICE_NOSAMPLESPLAYED);
+				if (voice->isEndSubmitted) {
+					// 終端まで送信し、すべて再生し終えたら終了
+					isFinished = state.BuffersQueued == 0;
+				}
+				else if (state.BuffersQueued < kStreamBufferCount) {
+					voice->isDecoding = true;
+					decodeVoices.emplace_back(voice, kStreamBufferCount - state.BuffersQueued);
+				}
+			}
+
+			if (isFinished) {
+				DestroyVoice(voice);
+				it = voices_.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+
+		if (decodeVoices.empty()) {
+			continue;
+		}
+
+		// デコードはロックの外で行い、PlayWave・StopWave・SetVolumeを待たせない
+		lock.unlock();
+		for (auto& [voice, freeCount] : decodeVoices) {
+			DecodeStreamBuffers(voice, freeCount);
+		}
+		lock.lock();
+
+		for (auto& [voice, freeCount] : decodeVoices) {
+			voice->isDecoding = false;
+			// デコード中に停止されたボイスはここで破棄する
+			if (voice->isStopRequested) {
+				voices_.erase(voice);
+				DestroyVoice(voice);
+				continue;
+			}
+			SubmitStreamBuffers(voice);
+		}
+	}
+}
+
+WAVEFORMATEX Audio::ToWaveFormat(const AudioFormat& format)
+{
+	WAVEFORMATEX wfex{};
+	wfex.wFormatTag = format.formatTag;
+	wfex.nChannels = format.channels;
+	wfex.nSamplesPerSec = format.sampleRate;
+	wfex.wBitsPerSample = format.bitsPerSample;
+	wfex.nBlockAlign = format.GetBlockAlign();
+	wfex.nAvgBytesPerSec = format.GetBytesPerSecond();
+	wfex.cbSize = 0;
+	return wfex;
+}
@@ -5,7 +5,14 @@
 #include "xaudio2.h"
 #include"wrl.h"
 #include"array"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <thread>
+#include <unordered_map>
+#include <Decoder/AudioDecoder.h>
 
 class Audio
 {
@@ -21,19 +28,22 @@ class Audio
 		void STDMETHODCALLTYPE OnVoiceError(void*, HRESULT) override {}
 
 		// バッファが終了したときに呼ばれるコールバック
+		// コールバック内でボイスを破棄するとデッドロックするため、終了フラグを立ててストリーミングスレッドに任せる
 		void STDMETHODCALLTYPE OnBufferEnd(void* pBufferContext) override {
 			if (pBufferContext) {
 				Voice* voice = reinterpret_cast<Voice*>(pBufferContext);
-				if (voice) {
-					// Audioシステムから該当の音声を停止
-					Audio::GetInstance()->StopWave(voice->handle);
-				}
+				voice->isFinished = true;
 			}
+			// ストリーミング再生のバッファ補充を促す
+			Audio::GetInstance()->streamCondition_.notify_one();
 		}
 	};
 
 private:
-	static const int kMaxSoundData = 2108;
+	// ストリーミング1バッファ分のサイズ
+	static constexpr size_t kStreamBufferSize = 64 * 1024;
+	// ストリーミングのバッファ数
+	static constexpr uint32_t kStreamBufferCount = 3;
 
 	static Audio* instance;
 
@@ -43,27 +53,6 @@ private:
 	Audio& operator=(Audio&) = default;
 private:
 
-	// チャンクヘッダー
-	struct ChunkHeader
-	{
-		char id[4]; // チャンク等のID
-		int32_t size; // チャンクサイズ
-	};
-
-	// RIFFヘッダチャンク
-	struct RiffHeader
-	{
-		ChunkHeader chunk; // "RIFF"
-		char type[4]; // "WAVE"
-	};
-
-	// FMTチャンク
-	struct FormatChunk
-	{
-		ChunkHeader chunk; // "fmt"
-		WAVEFORMATEX fmt; // 波形フォーマット
-	};
-
 	// 音声データ
 	struct SoundData {
 		// 波形フォーマット
@@ -72,6 +61,10 @@ private:
 		std::vector<uint8_t> buffer;
 		// 名前
 		std::string name_;
+		// フルパス
+		std::string fullPath;
+		// ストリーミング再生するか
+		bool isStream = false;
 	};
 
 	// 再生データ
@@ -79,6 +72,21 @@ private:
 		uint32_t handle = 0u; // 音声ハンドル
 		IXAudio2SourceVoice* sourceVoice = nullptr; // ソースボイス
 		float volume = 1.0f; // 音量 (0.0 ～ 1.0)
+		std::atomic<bool> isFinished = false; // 再生が終わったか
+
+		// ストリーミング再生用
+		std::unique_ptr<AudioDecoder> decoder; // デコーダ（nullptrならメモリ上のバッファを再生）
+		std::array<std::vector<uint8_t>, kStreamBufferCount> streamBuffers; // バッファのリング
+		uint32_t nextBuffer = 0; // 次に書き込むバッファ
+		bool loop = false; // ループ再生するか
+		bool isEndSubmitted = false; // 終端まで送信したか
+
+		// ロックの外でデコードした、送信待ちのバッファ（nextBufferから順に）
+		std::array<size_t, kStreamBufferCount> decodedSizes{};
+		uint32_t decodedCount = 0;
+		bool isEndDecoded = false; // 終端までデコードしたか
+		bool isDecoding = false; // ストリーミングスレッドがデコード中か（voiceMutex_で保護）
+		bool isStopRequested = false; // デコード中に停止されたか（破棄はストリーミングスレッドが行う）
 	};
 
 public:
@@ -96,12 +104,20 @@ public:
 	static Audio* GetInstance();
 
 	/// <summary>
-	/// 音声読み込み
+	/// 音声読み込み（全体をメモリに展開する。.wav / .flac）
 	/// </summary>
 	/// <param name="filename"></param>
 	/// <returns></returns>
 	uint32_t LoadWave(const std::string& filename);
 
+	/// <summary>
+	/// ストリーミング再生用の音声登録（BGMなど長い音声向け。.wav / .flac）
+	/// 再生時にディスクから少しずつデコードする
+	/// </summary>
+	/// <param name="filename"></param>
+	/// <returns></returns>
+	uint32_t LoadStream(const std::string& filename);
+
 	/// <summary>
 	/// 音声データ解放
 	/// </summary>
@@ -133,20 +149,53 @@ public:
 	/// </summary>
 	void Finalize();
 
+private:
+
+	/// <summary>
+	/// 音声データの登録先インデックスを確保
+	/// </summary>
+	uint32_t AllocateSoundIndex();
+
+	/// <summary>
+	/// 空いているストリーミングのバッファにデコードする（voiceMutex_をロックせずに呼ぶ）
+	/// </summary>
+	/// <param name="freeCount">XAudio2のキューに入っていないバッファの数</param>
+	void DecodeStreamBuffers(Voice* voice, uint32_t freeCount);
+
+	/// <summary>
+	/// デコード済みのバッファを送信（再生中のボイスはvoiceMutex_をロックした状態で呼ぶ）
+	/// </summary>
+	void SubmitStreamBuffers(Voice* voice);
+
+	/// <summary>
+	/// ボイスの破棄（voiceMutex_をロックした状態で呼ぶ）
+	/// </summary>
+	void DestroyVoice(Voice* voice);
+
+	/// <summary>
+	/// ストリーミングスレッド（バッファの補充と再生が終わったボイスの破棄）
+	/// </summary>
+	void StreamThread();
+
+	/// <summary>
+	/// AudioFormatからWAVEFORMATEXを作成
+	/// </summary>
+	static WAVEFORMATEX ToWaveFormat(const AudioFormat& format);
+
 private:
 
 	Microsoft::WRL::ComPtr<IXAudio2>xAudio2;
 	IXAudio2MasteringVoice* masterVoice;
 	std::string directoryPath_;
-	std::array<SoundData, kMaxSoundData> soundDatas_;
-	size_t soundDataIndex = 0;  // 次に保存する音声データのインデックス
+	std::vector<SoundData> soundDatas_;
+	std::unordered_map<std::string, uint32_t> soundIndices_; // ファイル名から音声データのインデックスを引く
+	std::vector<uint32_t> freeIndices_; // 解放済みで再利用できるインデックス
 	std::set<Voice*> voices_; // 再生中の音声データを管理するセット
-	std::set<std::string> loadedFiles; // 読み込まれたファイルのセット
-	// フォーマット情報を読み込む
-	uint16_t audioFormat;
-	uint16_t numChannels;
-	uint32_t sampleRate;
-	uint32_t byteRate;
-	uint16_t blockAlign;
-	uint16_t bitsPerSample;
+	VoiceCallback voiceCallback_; // 全ボイス共通のコールバック
+
+	// ストリーミングスレッド
+	std::thread streamThread_;
+	std::mutex voiceMutex_; // voices_ の排他
+	std::condition_variable streamCondition_;
+	std::atomic<bool> isStreamRunning_ = false;
 };
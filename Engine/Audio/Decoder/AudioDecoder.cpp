@@ -0,0 +1,113 @@
+#include "AudioDecoder.h"
+#include "FlacDecoder.h"
+#include "WaveDecoder.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+std::unique_ptr<AudioDecoder> AudioDecoder::Create(const std::string &filePath) {
+    std::string extension = std::filesystem::path(filePath).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    std::unique_ptr<AudioDecoder> decoder;
+    if (extension == ".wav") {
+        decoder = std::make_unique<WaveDecoder>();
+    } else if (extension == ".flac") {
+        decoder = std::make_unique<FlacDecoder>();
+    } else {
+        return nullptr;
+    }
+
+    if (!decoder->Open(filePath)) {
+        return nullptr;
+    }
+    return decoder;
+}
+
+bool AudioDecoder::DecodeAll(const std::string &filePath, AudioFormat &format, std::vector<uint8_t> &buffer) {
+    std::unique_ptr<AudioDecoder> decoder = Create(filePath);
+    if (!decoder) {
+        return false;
+    }
+    format = decoder->GetFormat();
+
+    // サイズが分かっていれば一度で確保する
+    buffer.clear();
+    if (decoder->GetTotalBytes() > 0) {
+        buffer.resize(static_cast<size_t>(decoder->GetTotalBytes()));
+        size_t readSize = decoder->Read(buffer.data(), buffer.size());
+        buffer.resize(readSize);
+        return true;
+    }
+
+    const size_t kChunkSize = 64 * 1024;
+    size_t totalSize = 0;
+    while (true) {
+        buffer.resize(totalSize + kChunkSize);
+        size_t readSize = decoder->Read(buffer.data() + totalSize, kChunkSize);
+        totalSize += readSize;
+        if (readSize < kChunkSize) {
+            break;
+        }
+    }
+    buffer.resize(totalSize);
+    buffer.shrink_to_fit();
+    return true;
+}
+
+std::vector<AudioDecodeReport> AudioDecoder::ReportDirectory(const std::string &directoryPath, size_t streamBufferSize, size_t streamBufferCount) {
+    std::vector<AudioDecodeReport> reports;
+    if (!std::filesystem::exists(directoryPath)) {
+        return reports;
+    }
+
+    std::vector<uint8_t> chunk(streamBufferSize);
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(directoryPath)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::unique_ptr<AudioDecoder> decoder = Create(entry.path().string());
+        if (!decoder) {
+            continue;
+        }
+
+        // ストリーミング再生と同じ単位でデコードする
+        uint64_t decodedBytes = 0;
+        size_t readSize = 0;
+        while ((readSize = decoder->Read(chunk.data(), chunk.size())) > 0) {
+            decodedBytes += readSize;
+        }
+        std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+
+        AudioDecodeReport report;
+        report.name = std::filesystem::relative(entry.path(), directoryPath).generic_string();
+        report.format = decoder->GetFormat();
+        report.durationSeconds = report.format.GetBytesPerSecond() > 0 ? static_cast<float>(decodedBytes) / report.format.GetBytesPerSecond() : 0.0f;
+        report.decodeSeconds = elapsed.count();
+        report.realtimeFactor = report.decodeSeconds > 0.0f ? report.durationSeconds / report.decodeSeconds : 0.0f;
+        report.fileBytes = entry.file_size();
+        report.bufferedBytes = decodedBytes;
+        report.streamingBytes = streamBufferSize * streamBufferCount + decoder->GetWorkingMemorySize();
+        reports.push_back(report);
+    }
+    return reports;
+}
+
+void AudioDecoder::WriteReportCSV(const std::vector<AudioDecodeReport> &reports, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "name,channels,sample_rate,bits,duration_sec,decode_sec,realtime_factor,file_bytes,buffered_bytes,streaming_bytes\n";
+    for (const auto &report : reports) {
+        file << report.name << "," << report.format.channels << "," << report.format.sampleRate << ","
+             << report.format.bitsPerSample << "," << report.durationSeconds << "," << report.decodeSeconds << ","
+             << report.realtimeFactor << "," << report.fileBytes << "," << report.bufferedBytes << ","
+             << report.streamingBytes << "\n";
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// デコード後のPCMフォーマット
+/// </summary>
+struct AudioFormat {
+    uint16_t formatTag = 1;     // 1: 整数PCM, 3: 浮動小数点PCM
+    uint16_t channels = 0;      // チャンネル数
+    uint32_t sampleRate = 0;    // サンプリングレート
+    uint16_t bitsPerSample = 0; // 1サンプルのビット数
+
+    uint16_t GetBlockAlign() const { return static_cast<uint16_t>(channels * bitsPerSample / 8); }
+    uint32_t GetBytesPerSecond() const { return sampleRate * GetBlockAlign(); }
+};
+
+/// <summary>
+/// デコード速度とメモリ使用量のレポート
+/// </summary>
+struct AudioDecodeReport {
+    std::string name;              // ファイル名
+    AudioFormat format;            // デコード後のフォーマット
+    float durationSeconds = 0.0f;  // 再生時間
+    float decodeSeconds = 0.0f;    // デコードにかかった時間
+    float realtimeFactor = 0.0f;   // 再生時間 / デコード時間
+    uint64_t fileBytes = 0;        // ファイルサイズ
+    uint64_t bufferedBytes = 0;    // 全体をメモリに展開した場合のサイズ
+    uint64_t streamingBytes = 0;   // ストリーミング再生時のメモリ使用量
+};
+
+/// <summary>
+/// ファイルから少しずつPCMを取り出すデコーダ
+/// </summary>
+class AudioDecoder {
+  public:
+    virtual ~AudioDecoder() = default;
+
+    /// <summary>
+    /// ファイルを開いてフォーマットを読み取る
+    /// </summary>
+    virtual bool Open(const std::string &filePath) = 0;
+
+    /// <summary>
+    /// PCMを読み込む（終端に達しない限りsize分埋める）
+    /// </summary>
+    /// <returns>書き込んだバイト数（終端では0）</returns>
+    virtual size_t Read(uint8_t *dst, size_t size) = 0;
+
+    /// <summary>
+    /// 先頭に戻る
+    /// </summary>
+    virtual bool Rewind() = 0;
+
+    /// <summary>
+    /// デコーダが内部で確保しているメモリ量
+    /// </summary>
+    virtual size_t GetWorkingMemorySize() const = 0;
+
+    const AudioFormat &GetFormat() const { return format_; }
+
+    // デコード後の総バイト数（不明な場合は0）
+    uint64_t GetTotalBytes() const { return totalBytes_; }
+
+    /// <summary>
+    /// 拡張子に応じたデコーダを作成して開く（.wav / .flac）
+    /// </summary>
+    static std::unique_ptr<AudioDecoder> Create(const std::string &filePath);
+
+    /// <summary>
+    /// ファイルを最後までデコードする
+    /// </summary>
+    static bool DecodeAll(const std::string &filePath, AudioFormat &format, std::vector<uint8_t> &buffer);
+
+    /// <summary>
+    /// ディレクトリ内の音声をデコードし、速度とメモリ使用量をレポートする（オーディオデバイス不要）
+    /// </summary>
+    /// <param name="directoryPath">音声ディレクトリ</param>
+    /// <param name="streamBufferSize">ストリーミング1バッファ分のサイズ</param>
+    /// <param name="streamBufferCount">ストリーミングのバッファ数</param>
+    static std::vector<AudioDecodeReport> ReportDirectory(const std::string &directoryPath, size_t streamBufferSize, size_t streamBufferCount);
+
+    /// <summary>
+    /// レポートをCSVに書き出す
+    /// </summary>
+    static void WriteReportCSV(const std::vector<AudioDecodeReport> &reports, const std::string &filePath);
+
+  protected:
+    AudioFormat format_;
+    uint64_t totalBytes_ = 0;
+};
@@ -0,0 +1,536 @@
+#include "FlacDecoder.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+namespace {
+
+// ファイルからの1回の読み込みサイズ
+const size_t kReadBufferSize = 16 * 1024;
+
+// フレームヘッダーのブロックサイズ
+uint32_t BlockSizeFromCode(uint32_t code) {
+    if (code == 1) {
+        return 192;
+    }
+    if (code >= 2 && code <= 5) {
+        return 576u << (code - 2);
+    }
+    if (code >= 8) {
+        return 256u << (code - 8);
+    }
+    return 0; // 6, 7 はヘッダーの後ろに実際の値がある
+}
+
+// フレームヘッダーのビット深度（0はSTREAMINFOの値を使う）
+const uint32_t kSampleSizeTable[8] = {0, 8, 12, 0, 16, 20, 24, 32};
+
+// フレームヘッダーのCRC-8（多項式 x^8 + x^2 + x + 1）
+constexpr std::array<uint8_t, 256> MakeCrc8Table() {
+    std::array<uint8_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+        }
+        table[i] = static_cast<uint8_t>(crc);
+    }
+    return table;
+}
+
+// フレーム全体のCRC-16（多項式 x^16 + x^15 + x^2 + 1）
+constexpr std::array<uint16_t, 256> MakeCrc16Table() {
+    std::array<uint16_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i << 8;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x8005) : (crc << 1);
+        }
+        table[i] = static_cast<uint16_t>(crc);
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> kCrc8Table = MakeCrc8Table();
+constexpr std::array<uint16_t, 256> kCrc16Table = MakeCrc16Table();
+
+} // namespace
+
+///=============================================================================
+///                         BitReader
+///=============================================================================
+
+void FlacDecoder::BitReader::Reset(std::ifstream *file) {
+    file_ = file;
+    buffer_.resize(kReadBufferSize);
+    position_ = 0;
+    size_ = 0;
+    cache_ = 0;
+    cacheBits_ = 0;
+    isEnd_ = false;
+    crc8_ = 0;
+    crc16_ = 0;
+}
+
+void FlacDecoder::BitReader::ResetCrc(const uint8_t *bytes, size_t count) {
+    crc8_ = 0;
+    crc16_ = 0;
+    for (size_t i = 0; i < count; ++i) {
+        crc8_ = kCrc8Table[crc8_ ^ bytes[i]];
+        crc16_ = static_cast<uint16_t>((crc16_ << 8) ^ kCrc16Table[(crc16_ >> 8) ^ bytes[i]]);
+    }
+}
+
+bool FlacDecoder::BitReader::FillByte() {
+    if (position_ == size_) {
+        file_->read(reinterpret_cast<char *>(buffer_.data()), buffer_.size());
+        size_ = static_cast<size_t>(file_->gcount());
+        position_ = 0;
+        if (size_ == 0) {
+            // 終端以降は0を返し続ける
+            isEnd_ = true;
+            cache_ <<= 8;
+            cacheBits_ += 8;
+            return false;
+        }
+    }
+    uint8_t byte = buffer_[position_++];
+    crc8_ = kCrc8Table[crc8_ ^ byte];
+    crc16_ = static_cast<uint16_t>((crc16_ << 8) ^ kCrc16Table[(crc16_ >> 8) ^ byte]);
+    cache_ = (cache_ << 8) | byte;
+    cacheBits_ += 8;
+    return true;
+}
+
+uint32_t FlacDecoder::BitReader::ReadBits(uint32_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    while (cacheBits_ < count) {
+        FillByte();
+    }
+    cacheBits_ -= count;
+    return static_cast<uint32_t>((cache_ >> cacheBits_) & ((1ull << count) - 1));
+}
+
+int32_t FlacDecoder::BitReader::ReadSigned(uint32_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    uint32_t value = ReadBits(count);
+    // 符号拡張
+    uint32_t shift = 32 - count;
+    return static_cast<int32_t>(value << shift) >> shift;
+}
+
+uint32_t FlacDecoder::BitReader::ReadUnary() {
+    uint32_t count = 0;
+    while (true) {
+        if (cacheBits_ == 0) {
+            if (!FillByte() && isEnd_) {
+                return count;
+            }
+        }
+        uint64_t bits = cache_ & ((1ull << cacheBits_) - 1);
+        if (bits == 0) {
+            count += cacheBits_;
+            cacheBits_ = 0;
+            continue;
+        }
+        // 最初の1までの0の数を数える
+        uint32_t zeros = cacheBits_ - static_cast<uint32_t>(std::bit_width(bits));
+        count += zeros;
+        cacheBits_ -= zeros + 1;
+        return count;
+    }
+}
+
+///=============================================================================
+///                         FlacDecoder
+///=============================================================================
+
+bool FlacDecoder::Open(const std::string &filePath) {
+    file_.open(filePath, std::ios_base::binary);
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    char marker[4];
+    file_.read(marker, sizeof(marker));
+    if (!file_ || std::strncmp(marker, "fLaC", 4) != 0) {
+        return false;
+    }
+
+    // メタデータブロック（STREAMINFO以外は読み飛ばす）
+    bool hasStreamInfo = false;
+    bool isLast = false;
+    while (!isLast) {
+        uint8_t header[4];
+        file_.read(reinterpret_cast<char *>(header), sizeof(header));
+        if (!file_) {
+            return false;
+        }
+        isLast = (header[0] & 0x80) != 0;
+        uint32_t type = header[0] & 0x7f;
+        uint32_t length = (header[1] << 16) | (header[2] << 8) | header[3];
+
+        if (type == 0 && length >= 34) {
+            uint8_t info[34];
+            file_.read(reinterpret_cast<char *>(info), sizeof(info));
+            file_.seekg(length - sizeof(info), std::ios_base::cur);
+
+            maxBlockSize_ = (info[2] << 8) | info[3];
+            uint32_t sampleRate = (info[10] << 12) | (info[11] << 4) | (info[12] >> 4);
+            uint32_t channels = ((info[12] >> 1) & 0x07) + 1;
+            sourceBitsPerSample_ = (((info[12] & 0x01) << 4) | (info[13] >> 4)) + 1;
+            uint64_t totalSamples = (static_cast<uint64_t>(info[13] & 0x0f) << 32) |
+                                    (static_cast<uint64_t>(info[14]) << 24) | (info[15] << 16) | (info[16] << 8) | info[17];
+
+            // 16bit以下は16bit整数、それより大きい場合は32bit浮動小数点で出力する
+            format_.channels = static_cast<uint16_t>(channels);
+            format_.sampleRate = sampleRate;
+            if (sourceBitsPerSample_ <= 16) {
+                format_.formatTag = 1;
+                format_.bitsPerSample = 16;
+            } else {
+                format_.formatTag = 3;
+                format_.bitsPerSample = 32;
+            }
+            totalBytes_ = totalSamples * format_.GetBlockAlign();
+            hasStreamInfo = true;
+        } else {
+            file_.seekg(length, std::ios_base::cur);
+        }
+    }
+
+    if (!hasStreamInfo || sourceBitsPerSample_ > 32) {
+        return false;
+    }
+
+    firstFrameOffset_ = file_.tellg();
+    channelSamples_.assign(format_.channels, std::vector<int32_t>(maxBlockSize_));
+    pcm_.reserve(static_cast<size_t>(maxBlockSize_) * format_.GetBlockAlign());
+    reader_.Reset(&file_);
+    return true;
+}
+
+bool FlacDecoder::Rewind() {
+    file_.clear();
+    file_.seekg(firstFrameOffset_, std::ios_base::beg);
+    reader_.Reset(&file_);
+    pcm_.clear();
+    pcmPosition_ = 0;
+    return static_cast<bool>(file_);
+}
+
+size_t FlacDecoder::GetWorkingMemorySize() const {
+    size_t size = sizeof(*this) + reader_.GetBufferSize() + pcm_.capacity();
+    for (const auto &samples : channelSamples_) {
+        size += samples.capacity() * sizeof(int32_t);
+    }
+    return size;
+}
+
+size_t FlacDecoder::Read(uint8_t *dst, size_t size) {
+    size_t written = 0;
+    while (written < size) {
+        if (pcmPosition_ == pcm_.size()) {
+            if (!DecodeFrame()) {
+                break;
+            }
+        }
+        size_t copySize = std::min(size - written, pcm_.size() - pcmPosition_);
+        std::memcpy(dst + written, pcm_.data() + pcmPosition_, copySize);
+        pcmPosition_ += copySize;
+        written += copySize;
+    }
+    return written;
+}
+
+bool FlacDecoder::DecodeFrame() {
+    pcm_.clear();
+    pcmPosition_ = 0;
+
+    uint32_t blockSize = 0;
+    uint32_t channelAssignment = 0;
+    uint32_t bitsPerSample = 0;
+    uint32_t channels = 0;
+    while (true) {
+        // 同期コード(0b11111111111110)を探す
+        reader_.AlignToByte();
+        uint32_t previous = 0;
+        uint32_t current = 0;
+        while (true) {
+            current = reader_.ReadBits(8);
+            if (reader_.IsEnd()) {
+                return false;
+            }
+            if (previous == 0xff && (current & 0xfe) == 0xf8) {
+                break;
+            }
+            previous = current;
+        }
+
+        // 同期コードからフレーム末尾までのCRCを計算する
+        const uint8_t syncBytes[2] = {0xff, static_cast<uint8_t>(current)};
+        reader_.ResetCrc(syncBytes, sizeof(syncBytes));
+
+        uint32_t blockSizeCode = reader_.ReadBits(4);
+        uint32_t sampleRateCode = reader_.ReadBits(4);
+        channelAssignment = reader_.ReadBits(4);
+        uint32_t sampleSizeCode = reader_.ReadBits(3);
+        reader_.ReadBits(1);
+
+        // フレーム番号(UTF-8形式)は使わないので読み飛ばす
+        uint32_t first = reader_.ReadBits(8);
+        uint32_t extraBytes = 0;
+        while (extraBytes < 7 && (first & (0x80 >> extraBytes))) {
+            ++extraBytes;
+        }
+        for (uint32_t i = 1; i < extraBytes; ++i) {
+            reader_.ReadBits(8);
+        }
+
+        blockSize = BlockSizeFromCode(blockSizeCode);
+        if (blockSizeCode == 6) {
+            blockSize = reader_.ReadBits(8) + 1;
+        } else if (blockSizeCode == 7) {
+            blockSize = reader_.ReadBits(16) + 1;
+        }
+        if (sampleRateCode == 12) {
+            reader_.ReadBits(8);
+        } else if (sampleRateCode == 13 || sampleRateCode == 14) {
+            reader_.ReadBits(16);
+        }
+
+        // ヘッダーはバイト単位なので、ここまでに読んだバイトのCRC-8と比べる
+        uint8_t headerCrc = reader_.GetCrc8();
+        if (reader_.ReadBits(8) != headerCrc) {
+            // データ中に同期コードと同じビット列があった（か壊れている）ので次の同期コードを探す
+            ++crcErrorCount_;
+            continue;
+        }
+
+        bitsPerSample = kSampleSizeTable[sampleSizeCode];
+        if (bitsPerSample == 0) {
+            bitsPerSample = sourceBitsPerSample_;
+        }
+        channels = channelAssignment < 8 ? channelAssignment + 1 : 2;
+        break;
+    }
+    if (blockSize == 0 || channelAssignment > 10 || channels != format_.channels) {
+        return false;
+    }
+
+    // サブフレーム（ステレオ相関のサイドチャンネルは1bit多い）
+    bool isValid = true;
+    for (uint32_t channel = 0; channel < channels && isValid; ++channel) {
+        bool isSide = (channelAssignment == 8 && channel == 1) || (channelAssignment == 9 && channel == 0) ||
+                      (channelAssignment == 10 && channel == 1);
+        std::vector<int32_t> &samples = channelSamples_[channel];
+        if (samples.size() < blockSize) {
+            samples.resize(blockSize);
+        }
+        isValid = DecodeSubframe(samples, blockSize, bitsPerSample + (isSide ? 1 : 0));
+    }
+    if (!isValid && reader_.IsEnd()) {
+        return false;
+    }
+
+    // フレーム全体のCRC-16を確認（サブフレームが読めなかった場合は次のフレームの同期コードから再開する）
+    if (isValid) {
+        reader_.AlignToByte();
+        uint16_t frameCrc = reader_.GetCrc16();
+        isValid = reader_.ReadBits(16) == frameCrc;
+    }
+    if (!isValid) {
+        // 壊れたフレームは長さを保ったまま無音にする
+        ++crcErrorCount_;
+        for (uint32_t channel = 0; channel < channels; ++channel) {
+            std::fill(channelSamples_[channel].begin(), channelSamples_[channel].begin() + blockSize, 0);
+        }
+    }
+
+    // ステレオ相関を戻す
+    if (channelAssignment >= 8) {
+        std::vector<int32_t> &left = channelSamples_[0];
+        std::vector<int32_t> &right = channelSamples_[1];
+        for (uint32_t i = 0; i < blockSize; ++i) {
+            if (channelAssignment == 8) {
+                right[i] = left[i] - right[i];
+            } else if (channelAssignment == 9) {
+                left[i] = left[i] + right[i];
+            } else {
+                int32_t side = right[i];
+                int32_t mid = (left[i] * 2) | (side & 1);
+                left[i] = (mid + side) >> 1;
+                right[i] = (mid - side) >> 1;
+            }
+        }
+    }
+
+    // インターリーブして出力フォーマットに変換
+    pcm_.resize(static_cast<size_t>(blockSize) * format_.GetBlockAlign());
+    if (format_.bitsPerSample == 16) {
+        int16_t *out = reinterpret_cast<int16_t *>(pcm_.data());
+        uint32_t shift = 16 - bitsPerSample;
+        for (uint32_t i = 0; i < blockSize; ++i) {
+            for (uint32_t channel = 0; channel < channels; ++channel) {
+                *out++ = static_cast<int16_t>(channelSamples_[channel][i] << shift);
+            }
+        }
+    } else {
+        float *out = reinterpret_cast<float *>(pcm_.data());
+        float scale = 1.0f / static_cast<float>(1ull << (bitsPerSample - 1));
+        for (uint32_t i = 0; i < blockSize; ++i) {
+            for (uint32_t channel = 0; channel < channels; ++channel) {
+                *out++ = static_cast<float>(channelSamples_[channel][i]) * scale;
+            }
+        }
+    }
+    return true;
+}
+
+bool FlacDecoder::DecodeSubframe(std::vector<int32_t> &samples, uint32_t blockSize, uint32_t bitsPerSample) {
+    reader_.ReadBits(1);
+    uint32_t type = reader_.ReadBits(6);
+
+    // 下位の0ビット(wasted bits)
+    uint32_t wastedBits = 0;
+    if (reader_.ReadBits(1)) {
+        wastedBits = reader_.ReadUnary() + 1;
+        bitsPerSample -= wastedBits;
+    }
+    if (bitsPerSample == 0 || bitsPerSample > 32) {
+        return false;
+    }
+
+    if (type == 0) {
+        // CONSTANT
+        int32_t value = reader_.ReadSigned(bitsPerSample);
+        std::fill(samples.begin(), samples.begin() + blockSize, value);
+    } else if (type == 1) {
+        // VERBATIM
+        for (uint32_t i = 0; i < blockSize; ++i) {
+            samples[i] = reader_.ReadSigned(bitsPerSample);
+        }
+    } else if (type >= 8 && type <= 12) {
+        // FIXED
+        uint32_t order = type - 8;
+        if (order > blockSize) {
+            return false;
+        }
+        for (uint32_t i = 0; i < order; ++i) {
+            samples[i] = reader_.ReadSigned(bitsPerSample);
+        }
+        if (!DecodeResidual(samples, blockSize, order)) {
+            return false;
+        }
+        int32_t *s = samples.data();
+        switch (order) {
+        case 1:
+            for (uint32_t i = 1; i < blockSize; ++i) {
+                s[i] += s[i - 1];
+            }
+            break;
+        case 2:
+            for (uint32_t i = 2; i < blockSize; ++i) {
+                s[i] += 2 * s[i - 1] - s[i - 2];
+            }
+            break;
+        case 3:
+            for (uint32_t i = 3; i < blockSize; ++i) {
+                s[i] += 3 * s[i - 1] - 3 * s[i - 2] + s[i - 3];
+            }
+            break;
+        case 4:
+            for (uint32_t i = 4; i < blockSize; ++i) {
+                s[i] += 4 * s[i - 1] - 6 * s[i - 2] + 4 * s[i - 3] - s[i - 4];
+            }
+            break;
+        default:
+            break;
+        }
+    } else if (type >= 32) {
+        // LPC
+        uint32_t order = (type & 31) + 1;
+        if (order > blockSize) {
+            return false;
+        }
+        for (uint32_t i = 0; i < order; ++i) {
+            samples[i] = reader_.ReadSigned(bitsPerSample);
+        }
+        uint32_t precision = reader_.ReadBits(4) + 1;
+        if (precision == 16) {
+            return false;
+        }
+        int32_t shift = reader_.ReadSigned(5);
+        if (shift < 0) {
+            return false;
+        }
+        int32_t coefficients[32];
+        for (uint32_t i = 0; i < order; ++i) {
+            coefficients[i] = reader_.ReadSigned(precision);
+        }
+        if (!DecodeResidual(samples, blockSize, order)) {
+            return false;
+        }
+        int32_t *s = samples.data();
+        for (uint32_t i = order; i < blockSize; ++i) {
+            int64_t sum = 0;
+            for (uint32_t j = 0; j < order; ++j) {
+                sum += static_cast<int64_t>(coefficients[j]) * s[i - 1 - j];
+            }
+            s[i] += static_cast<int32_t>(sum >> shift);
+        }
+    } else {
+        return false;
+    }
+
+    if (wastedBits > 0) {
+        for (uint32_t i = 0; i < blockSize; ++i) {
+            samples[i] <<= wastedBits;
+        }
+    }
+    return !reader_.IsEnd();
+}
+
+bool FlacDecoder::DecodeResidual(std::vector<int32_t> &samples, uint32_t blockSize, uint32_t predictorOrder) {
+    uint32_t method = reader_.ReadBits(2);
+    if (method > 1) {
+        return false;
+    }
+    uint32_t parameterBits = method == 0 ? 4 : 5;
+    uint32_t escapeCode = method == 0 ? 15 : 31;
+
+    uint32_t partitionOrder = reader_.ReadBits(4);
+    uint32_t partitionCount = 1u << partitionOrder;
+    uint32_t partitionSize = blockSize >> partitionOrder;
+    if (partitionSize < predictorOrder) {
+        return false;
+    }
+
+    uint32_t index = predictorOrder;
+    for (uint32_t partition = 0; partition < partitionCount; ++partition) {
+        uint32_t count = partitionSize - (partition == 0 ? predictorOrder : 0);
+        uint32_t parameter = reader_.ReadBits(parameterBits);
+
+        if (parameter == escapeCode) {
+            // ライス符号を使わず、固定ビット数の符号付き整数で格納されている
+            uint32_t rawBits = reader_.ReadBits(5);
+            for (uint32_t i = 0; i < count; ++i) {
+                samples[index++] = reader_.ReadSigned(rawBits);
+            }
+            continue;
+        }
+
+        // ライス符号
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t quotient = reader_.ReadUnary();
+            uint32_t value = (quotient << parameter) | reader_.ReadBits(parameter);
+            samples[index++] = static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "AudioDecoder.h"
+#include <fstream>
+
+/// <summary>
+/// FLACファイルのデコーダ
+/// フレーム単位でデコードするので、ファイル全体を展開せずにストリーミングできる
+/// </summary>
+class FlacDecoder : public AudioDecoder {
+  public:
+    bool Open(const std::string &filePath) override;
+    size_t Read(uint8_t *dst, size_t size) override;
+    bool Rewind() override;
+    size_t GetWorkingMemorySize() const override;
+
+    /// <summary>
+    /// CRCが一致せずに捨てたフレームの数（ヘッダーのCRC-8はフレームの誤検出としてスキップ、
+    /// フレーム全体のCRC-16は無音に置き換える）
+    /// </summary>
+    uint32_t GetCrcErrorCount() const { return crcErrorCount_; }
+
+  private:
+    /// <summary>
+    /// ファイルからビット単位で読み出す
+    /// 読み込んだバイトのCRC-8/CRC-16も計算する（バイト境界でだけ読み出した分と一致する）
+    /// </summary>
+    class BitReader {
+      public:
+        void Reset(std::ifstream *file);
+        uint32_t ReadBits(uint32_t count);
+        int32_t ReadSigned(uint32_t count);
+        uint32_t ReadUnary();
+        void AlignToByte() { cacheBits_ -= cacheBits_ % 8; }
+        bool IsEnd() const { return isEnd_; }
+        size_t GetBufferSize() const { return buffer_.size(); }
+
+        // CRCの計算をやり直す（bytesは計算を始める前に読み込み済みだった分）
+        void ResetCrc(const uint8_t *bytes, size_t count);
+        uint8_t GetCrc8() const { return crc8_; }
+        uint16_t GetCrc16() const { return crc16_; }
+
+      private:
+        bool FillByte();
+
+        std::ifstream *file_ = nullptr;
+        std::vector<uint8_t> buffer_;
+        size_t position_ = 0;
+        size_t size_ = 0;
+        uint64_t cache_ = 0;
+        uint32_t cacheBits_ = 0;
+        bool isEnd_ = false;
+        uint8_t crc8_ = 0;
+        uint16_t crc16_ = 0;
+    };
+
+    // 1フレームをデコードしてpcm_に書き出す
+    bool DecodeFrame();
+    bool DecodeSubframe(std::vector<int32_t> &samples, uint32_t blockSize, uint32_t bitsPerSample);
+    bool DecodeResidual(std::vector<int32_t> &samples, uint32_t blockSize, uint32_t predictorOrder);
+
+  private:
+    std::ifstream file_;
+    std::streamoff firstFrameOffset_ = 0;
+    BitReader reader_;
+
+    uint32_t sourceBitsPerSample_ = 0; // ファイル上のビット深度
+    uint32_t maxBlockSize_ = 0;
+
+    std::vector<std::vector<int32_t>> channelSamples_; // チャンネルごとのデコード結果
+    std::vector<uint8_t> pcm_;                         // インターリーブ済みの出力待ちPCM
+    size_t pcmPosition_ = 0;
+    uint32_t crcErrorCount_ = 0;
+};
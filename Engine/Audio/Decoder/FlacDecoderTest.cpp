@@ -0,0 +1,207 @@
+#include "Decoder/AudioDecoder.h"
+#include "Decoder/FlacDecoder.h"
+#include "Test/Test.h"
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+
+// テスト用のFLACはlibFLAC（libsndfile経由）でエンコードしたもの
+// STREAMINFOには元のサンプルのMD5が入っているので、デコード結果から同じ形に戻してMD5を比べる
+
+namespace {
+
+const std::string kTestDataDirectory = std::string(HAGINE_SOURCE_DIR) + "/Engine/Audio/Decoder/TestData/";
+
+// RFC 1321 のMD5
+class Md5 {
+  public:
+    void Update(const uint8_t *data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            block_[blockSize_++] = data[i];
+            if (blockSize_ == 64) {
+                Transform();
+                blockSize_ = 0;
+            }
+        }
+        length_ += size;
+    }
+
+    std::array<uint8_t, 16> Finish() {
+        const uint64_t bitLength = length_ * 8;
+        const uint8_t padding = 0x80;
+        const uint8_t zero = 0;
+        Update(&padding, 1);
+        while (blockSize_ != 56) {
+            Update(&zero, 1);
+        }
+        for (int i = 0; i < 8; ++i) {
+            uint8_t byte = static_cast<uint8_t>(bitLength >> (i * 8));
+            Update(&byte, 1);
+        }
+        std::array<uint8_t, 16> digest;
+        for (int i = 0; i < 16; ++i) {
+            digest[i] = static_cast<uint8_t>(state_[i / 4] >> ((i % 4) * 8));
+        }
+        return digest;
+    }
+
+  private:
+    void Transform() {
+        static const uint32_t kShift[64] = {7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+                                            4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
+        uint32_t words[16];
+        for (int i = 0; i < 16; ++i) {
+            words[i] = block_[i * 4] | (block_[i * 4 + 1] << 8) | (block_[i * 4 + 2] << 16) | (static_cast<uint32_t>(block_[i * 4 + 3]) << 24);
+        }
+        uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+        for (uint32_t i = 0; i < 64; ++i) {
+            uint32_t f, g;
+            if (i < 16) {
+                f = (b & c) | (~b & d);
+                g = i;
+            } else if (i < 32) {
+                f = (d & b) | (~d & c);
+                g = (5 * i + 1) % 16;
+            } else if (i < 48) {
+                f = b ^ c ^ d;
+                g = (3 * i + 5) % 16;
+            } else {
+                f = c ^ (b | ~d);
+                g = (7 * i) % 16;
+            }
+            uint32_t k = static_cast<uint32_t>(std::floor(std::abs(std::sin(static_cast<double>(i + 1))) * 4294967296.0));
+            uint32_t rotated = a + f + k + words[g];
+            a = d;
+            d = c;
+            c = b;
+            b += (rotated << kShift[i]) | (rotated >> (32 - kShift[i]));
+        }
+        state_[0] += a;
+        state_[1] += b;
+        state_[2] += c;
+        state_[3] += d;
+    }
+
+    uint32_t state_[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    uint8_t block_[64] = {};
+    size_t blockSize_ = 0;
+    uint64_t length_ = 0;
+};
+
+// STREAMINFO（必ず最初のメタデータブロック）のビット深度とMD5
+struct StreamInfo {
+    uint32_t bitsPerSample = 0;
+    std::array<uint8_t, 16> md5 = {};
+};
+
+StreamInfo ReadStreamInfo(const std::string &filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    std::vector<uint8_t> header(4 + 4 + 34);
+    file.read(reinterpret_cast<char *>(header.data()), header.size());
+    StreamInfo info;
+    const uint8_t *streamInfo = header.data() + 8;
+    info.bitsPerSample = (((streamInfo[12] & 0x01) << 4) | (streamInfo[13] >> 4)) + 1;
+    std::memcpy(info.md5.data(), streamInfo + 18, 16);
+    return info;
+}
+
+// デコード結果（16bit整数か32bit浮動小数点）を元のビット深度のリトルエンディアンに戻してMD5を取る
+std::array<uint8_t, 16> HashSamples(const std::vector<uint8_t> &pcm, const AudioFormat &format, uint32_t bitsPerSample) {
+    Md5 md5;
+    const uint32_t bytesPerSample = (bitsPerSample + 7) / 8;
+    const size_t sampleCount = pcm.size() / (format.bitsPerSample / 8);
+    for (size_t i = 0; i < sampleCount; ++i) {
+        int32_t sample;
+        if (format.formatTag == 1) {
+            int16_t value;
+            std::memcpy(&value, &pcm[i * 2], sizeof(value));
+            sample = value >> (16 - bitsPerSample);
+        } else {
+            float value;
+            std::memcpy(&value, &pcm[i * 4], sizeof(value));
+            sample = static_cast<int32_t>(std::lround(value * static_cast<float>(1u << (bitsPerSample - 1))));
+        }
+        for (uint32_t b = 0; b < bytesPerSample; ++b) {
+            uint8_t byte = static_cast<uint8_t>(static_cast<uint32_t>(sample) >> (b * 8));
+            md5.Update(&byte, 1);
+        }
+    }
+    return md5.Finish();
+}
+
+// chunkSizeずつ最後まで読む
+std::vector<uint8_t> ReadAll(AudioDecoder &decoder, size_t chunkSize) {
+    std::vector<uint8_t> pcm;
+    std::vector<uint8_t> chunk(chunkSize);
+    while (size_t size = decoder.Read(chunk.data(), chunk.size())) {
+        pcm.insert(pcm.end(), chunk.begin(), chunk.begin() + size);
+    }
+    return pcm;
+}
+
+} // namespace
+
+// 参照エンコーダーのMD5と一致する（ビット単位で同じ）
+TEST(DecodesBitExact) {
+    const char *fileNames[] = {"mono_8bit.flac", "mono_16bit.flac", "stereo_16bit.flac", "stereo_24bit.flac"};
+    for (const char *fileName : fileNames) {
+        const std::string filePath = kTestDataDirectory + fileName;
+        StreamInfo info = ReadStreamInfo(filePath);
+        std::unique_ptr<AudioDecoder> decoder = AudioDecoder::Create(filePath);
+        CHECK(decoder != nullptr);
+        if (!decoder) {
+            continue;
+        }
+        // 読み出しの大きさがフレームの切れ目とずれていても結果は同じ
+        std::vector<uint8_t> pcm = ReadAll(*decoder, 1000);
+        CHECK(!pcm.empty());
+        CHECK(pcm.size() == decoder->GetTotalBytes());
+        CHECK(HashSamples(pcm, decoder->GetFormat(), info.bitsPerSample) == info.md5);
+
+        // 先頭に戻して読み直しても同じ
+        CHECK(decoder->Rewind());
+        CHECK(ReadAll(*decoder, 4096 * 3 + 7) == pcm);
+    }
+}
+
+// フレームの中身が壊れていたらCRC-16で検出し、長さは変えずに無音に置き換える
+TEST(DetectsCorruptedFrame) {
+    const std::string sourcePath = kTestDataDirectory + "stereo_16bit.flac";
+    const std::string corruptedPath = "flac_decoder_corrupted_test.flac";
+    std::vector<uint8_t> bytes;
+    {
+        std::ifstream file(sourcePath, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    CHECK(bytes.size() > 1000);
+    if (bytes.size() <= 1000) {
+        return;
+    }
+    bytes[bytes.size() / 2] ^= 0x10;
+    {
+        std::ofstream file(corruptedPath, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    }
+
+    FlacDecoder original;
+    CHECK(original.Open(sourcePath));
+    std::vector<uint8_t> expected = ReadAll(original, 4096);
+    CHECK(original.GetCrcErrorCount() == 0);
+
+    FlacDecoder decoder;
+    CHECK(decoder.Open(corruptedPath));
+    std::vector<uint8_t> pcm = ReadAll(decoder, 4096);
+    std::filesystem::remove(corruptedPath);
+    CHECK(decoder.GetCrcErrorCount() == 1);
+    CHECK(pcm.size() == expected.size());
+    CHECK(pcm != expected);
+
+    // 違うところは無音になっている
+    for (size_t i = 0; i + 1 < pcm.size() && pcm.size() == expected.size(); i += 2) {
+        if (pcm[i] != expected[i] || pcm[i + 1] != expected[i + 1]) {
+            CHECK(pcm[i] == 0 && pcm[i + 1] == 0);
+        }
+    }
+}
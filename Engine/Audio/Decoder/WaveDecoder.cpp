@@ -0,0 +1,103 @@
+#include "WaveDecoder.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// チャンクヘッダー
+struct ChunkHeader {
+    char id[4];   // チャンク等のID
+    int32_t size; // チャンクサイズ
+};
+
+// fmtチャンクの先頭部分
+struct FormatHeader {
+    uint16_t formatTag;
+    uint16_t channels;
+    uint32_t sampleRate;
+    uint32_t bytesPerSecond;
+    uint16_t blockAlign;
+    uint16_t bitsPerSample;
+};
+
+} // namespace
+
+bool WaveDecoder::Open(const std::string &filePath) {
+    file_.open(filePath, std::ios_base::binary);
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    // RIFFヘッダーの確認
+    ChunkHeader riff;
+    char type[4];
+    file_.read(reinterpret_cast<char *>(&riff), sizeof(riff));
+    file_.read(type, sizeof(type));
+    if (!file_ || std::strncmp(riff.id, "RIFF", 4) != 0 || std::strncmp(type, "WAVE", 4) != 0) {
+        return false;
+    }
+
+    // fmt と data チャンクを探す
+    bool hasFormat = false;
+    ChunkHeader chunk;
+    while (file_.read(reinterpret_cast<char *>(&chunk), sizeof(chunk))) {
+        // チャンクは2バイト境界に揃えられている
+        std::streamoff chunkSize = static_cast<uint32_t>(chunk.size);
+        std::streamoff paddedSize = chunkSize + (chunkSize & 1);
+
+        if (std::strncmp(chunk.id, "fmt ", 4) == 0) {
+            FormatHeader header = {};
+            if (chunkSize < static_cast<std::streamoff>(sizeof(header))) {
+                return false;
+            }
+            file_.read(reinterpret_cast<char *>(&header), sizeof(header));
+            std::streamoff readSize = sizeof(header);
+
+            // WAVE_FORMAT_EXTENSIBLE はサブフォーマットGUIDの先頭2バイトが実際の形式
+            if (header.formatTag == 0xFFFE && chunkSize >= static_cast<std::streamoff>(sizeof(header) + 10)) {
+                file_.seekg(8, std::ios_base::cur);
+                file_.read(reinterpret_cast<char *>(&header.formatTag), sizeof(header.formatTag));
+                readSize += 10;
+            }
+            file_.seekg(paddedSize - readSize, std::ios_base::cur);
+
+            format_.formatTag = header.formatTag;
+            format_.channels = header.channels;
+            format_.sampleRate = header.sampleRate;
+            format_.bitsPerSample = header.bitsPerSample;
+            hasFormat = true;
+        } else if (std::strncmp(chunk.id, "data", 4) == 0) {
+            if (!hasFormat) {
+                return false;
+            }
+            dataOffset_ = file_.tellg();
+            dataSize_ = static_cast<uint32_t>(chunk.size);
+            totalBytes_ = dataSize_;
+            readPosition_ = 0;
+            return true;
+        } else {
+            file_.seekg(paddedSize, std::ios_base::cur);
+        }
+    }
+    return false;
+}
+
+size_t WaveDecoder::Read(uint8_t *dst, size_t size) {
+    uint64_t remaining = dataSize_ - readPosition_;
+    size_t readSize = static_cast<size_t>(std::min<uint64_t>(size, remaining));
+    if (readSize == 0) {
+        return 0;
+    }
+
+    file_.read(reinterpret_cast<char *>(dst), readSize);
+    readSize = static_cast<size_t>(file_.gcount());
+    readPosition_ += readSize;
+    return readSize;
+}
+
+bool WaveDecoder::Rewind() {
+    file_.clear();
+    file_.seekg(dataOffset_, std::ios_base::beg);
+    readPosition_ = 0;
+    return static_cast<bool>(file_);
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "AudioDecoder.h"
+#include <fstream>
+
+/// <summary>
+/// WAVファイル（非圧縮PCM）のデコーダ
+/// dataチャンクをそのまま少しずつ読み出す
+/// </summary>
+class WaveDecoder : public AudioDecoder {
+  public:
+    bool Open(const std::string &filePath) override;
+    size_t Read(uint8_t *dst, size_t size) override;
+    bool Rewind() override;
+    size_t GetWorkingMemorySize() const override { return sizeof(*this); }
+
+  private:
+    std::ifstream file_;
+    std::streamoff dataOffset_ = 0; // dataチャンクの先頭位置
+    uint64_t dataSize_ = 0;         // dataチャンクのサイズ
+    uint64_t readPosition_ = 0;     // dataチャンク内の読み込み位置
+};
@@ -1,11 +1,12 @@
 #pragma once
+#include "FramePacer.h"
 #include "WinApp.h"
-#include "chrono"
 #include "d3d12.h"
 #include "dxcapi.h"
 #include "dxgi1_6.h"
 #include "externals/DirectXTex/DirectXTex.h"
 #include "string"
+#include <vector>
 #include "wrl.h"
 #include <type/Vector4.h>
 
@@ -165,6 +166,7 @@ class DirectXCommon {
     uint32_t GetDepthSrvIndex() { return depthSrvIndex; }
     D3D12_CLEAR_VALUE GetClearColorValue() const { return clearColorValue; }
     IDXGISwapChain4 *GetSwapChain() { return swapChain.Get(); }
+    FramePacer *GetFramePacer() { return &framePacer_; }
     Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> GetRTVDescriptorHeap() { return rtvDescriptorHeap; }
 #pragma endregion
 
@@ -320,8 +322,7 @@ class DirectXCommon {
     D3D12_CPU_DESCRIPTOR_HANDLE depthSrvHandleCPU; // SRV作成時に必要なCPUハンドル
     D3D12_GPU_DESCRIPTOR_HANDLE depthSrvHandleGPU; // 描画コマンドに必要なGPUハンドル
 
-    // FPS固定用の時間計測
-    std::chrono::steady_clock::time_point reference_;
+    // FPS固定
+    FramePacer framePacer_;
     const double targetFPS_ = 60.0;
-    const std::chrono::microseconds frameTime_{static_cast<uint64_t>(1000000.0 / targetFPS_)};
 };
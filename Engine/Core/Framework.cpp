@@ -7,20 +7,44 @@ void Framework::Run() {
 
     while (true) // ゲームループ
     {
+        // 前のフレームの計測結果をまとめる
+        Profiler::NewFrame();
+
         // 更新
-        Update();
+        {
+            PROFILE_SCOPE("Framework::Update");
+            Update();
+        }
         // 終了リクエストが来たら抜ける
         if (IsEndRequest()) {
             break;
         }
         // 描画
-        Draw();
+        {
+            PROFILE_SCOPE("Framework::Draw");
+            Draw();
+        }
     }
     // ゲームの終了
     Finalize();
 }
 
 void Framework::Initialize() {
+    // プロファイラにメインスレッドとして表示する
+    Profiler::SetThreadName("Main");
+
+    ///---------JobSystem--------
+    // ワーカースレッドの起動（このスレッドをメインスレッドとする）
+    jobSystem_ = JobSystem::GetInstance();
+    jobSystem_->Initialize();
+    ///--------------------------
+
+    ///---------FrameAllocator--------
+    // フレーム内だけで使う一時データの確保先
+    frameAllocator_ = FrameAllocator::GetInstance();
+    frameAllocator_->Initialize();
+    ///-------------------------------
+
     ///---------WinApp--------
     // WindowsAPIの初期化
     winApp_ = WinApp::GetInstance();
@@ -33,6 +57,18 @@ void Framework::Initialize() {
     dxCommon_->Initialize(winApp_);
     ///--------------------------------
 
+    ///--------AssetDatabase--------
+    // resources/ を走査してアセットIDを登録（内容ハッシュと依存関係は参照したときに計算）
+    assetDatabase_ = AssetDatabase::GetInstance();
+    assetDatabase_->Initialize();
+    ///-----------------------------
+
+    ///--------JsonHotReloader--------
+    // resources/jsons の変更を監視して調整データを読み直す
+    jsonHotReloader_ = JsonHotReloader::GetInstance();
+    jsonHotReloader_->Initialize();
+    ///-------------------------------
+
     ///--------SRVManager--------
     // SRVマネージャの初期化
     srvManager_ = SrvManager::GetInstance();
@@ -93,15 +129,21 @@ void Framework::Initialize() {
     modelManager_->Initialize(srvManager_);
     ///----------------------------------
 
+    ///----------ModelInstancing----------
+    // まとめて描画するモデルの行列と色の置き場
+    modelInstancing_ = ModelInstancing::GetInstance();
+    modelInstancing_->Initialize(dxCommon_, srvManager_);
+    ///-----------------------------------
+
     ///----------PrimitiveModel-----------
     primitiveModel_ = PrimitiveModel::GetInstance();
     primitiveModel_->Initialize();
     ///-----------------------------------
 
-    ///----------SpriteCommon------------
-    // スプライト共通部の初期化
-    spriteCommon_ = SpriteCommon::GetInstance();
-    spriteCommon_->Initialize();
+    ///----------SpriteBatch-------------
+    // スプライトをまとめて描く頂点の置き場
+    spriteBatch_ = SpriteBatch::GetInstance();
+    spriteBatch_->Initialize(dxCommon_, srvManager_);
     ///----------------------------------
 
     ///----------ParticleCommon------------
@@ -154,6 +196,11 @@ void Framework::Initialize() {
     particleGroupManager_->Initialize();
     ///---------------------------------
 
+    ///-------ParticleSystem-------
+    particleSystem_ = ParticleSystem::GetInstance();
+    particleSystem_->Initialize(srvManager_);
+    ///----------------------------
+
     ///--------ShortcutManager------------
     shortcutManager_ = ShortcutManager::GetInstance();
     shortcutManager_->Initialize(input_);
@@ -165,6 +212,7 @@ void Framework::Initialize() {
 
     /// 時間の初期化
     Frame::Init();
+    Frame::SetFixedTimeStep(kUseFixedTimeStep, kFixedDeltaTime, kMaxFixedSteps);
 }
 
 void Framework::Finalize() {
@@ -191,6 +239,10 @@ void Framework::Finalize() {
     modelManager_->Finalize();
     ///---------------------------
 
+    ///-------ModelInstancing-------
+    modelInstancing_->Finalize();
+    ///-----------------------------
+
     ///-------PrimitiveModel-------
     primitiveModel_->Finalize();
     ///-----------------------------
@@ -213,9 +265,18 @@ void Framework::Finalize() {
     motionEditor_->Finalize();
     LightGroup::GetInstance()->Finalize();
     particleEditor_->Finalize();
-    spriteCommon_->Finalize();
+    // エミッターがすべて破棄されてから終了する
+    particleSystem_->Finalize();
+    spriteBatch_->Finalize();
     particleCommon_->Finalize();
     modelCommon_->Finalize();
+    jsonHotReloader_->Finalize();
+    // アセットブラウザの一覧作成スレッドを停止
+    DirectoryIndex::GetInstance()->Finalize();
+    assetDatabase_->Finalize();
+    // ワーカースレッドを止める
+    jobSystem_->Finalize();
+    frameAllocator_->Finalize();
     dxCommon_->Finalize();
     delete sceneFactory_;
 }
@@ -225,6 +286,11 @@ void Framework::RegisterShortcutKey() {
     shortcutManager_->RegisterShortcut("FullScreen", DIK_F11, [this]() {
         winApp_->ToggleFullScreen();
     });
+    // フレーム統計のCSV出力（プレイテスト中にリリースビルドでも取れるようにする）
+    shortcutManager_->RegisterShortcut("DumpFrameStats", DIK_F9, []() {
+        FrameStats::DumpCSV("frame_stats.csv");
+        FrameStats::DumpHistoryCSV("frame_stats_history.csv");
+    });
 #ifdef _DEBUG
     shortcutManager_->RegisterShortcut("ShowShortcuts", DIK_F1, [this]() {
         imGuiManager_->SetShortcutWindow(true);
@@ -281,21 +347,73 @@ void Framework::Update() {
     /// deltaTimeの更新
     Frame::Update();
 
-    sceneManager_->Update();
+    // ワーカーから依頼されたメインスレッド専用の処理（D3D12・ImGui）を実行
+    jobSystem_->ExecuteMainThreadJobs();
+
+    // 外部で編集されたJSONを読み直して登録先へ反映
+    {
+        ALLOCATION_SCOPE("JsonHotReloader");
+        PROFILE_SCOPE("JsonHotReloader::Update");
+        jsonHotReloader_->Update(Frame::DeltaTime());
+    }
+
+    {
+        ALLOCATION_SCOPE("Scene");
+        PROFILE_SCOPE("SceneManager::Update");
+        sceneManager_->Update();
+    }
 
-    baseObjectManager_->Update();
+    // 固定ステップで進めるものを貯まった時間の分だけ進める
+    for (int i = 0; i < Frame::GetFixedStepCount(); ++i) {
+        PROFILE_SCOPE("FixedUpdate");
+        Frame::BeginFixedStep();
+        input_->BeginFixedStep();
+        FixedUpdate();
+        input_->EndFixedStep();
+        Frame::EndFixedStep();
+    }
 
-    collisionManager_->Update();
+    {
+        ALLOCATION_SCOPE("BaseObject");
+        baseObjectManager_->Update();
+    }
 
-    LightGroup::GetInstance()->Update(*sceneManager_->GetBaseScene()->GetViewProjection());
+    if (!Frame::IsFixedTimeStep() || !collisionManager_->IsUseFixedTimeStep()) {
+        ALLOCATION_SCOPE("Collision");
+        collisionManager_->Update();
+    }
 
-    input_->Update();
+    {
+        ALLOCATION_SCOPE("Light");
+        PROFILE_SCOPE("LightGroup::Update");
+        LightGroup::GetInstance()->Update(*sceneManager_->GetBaseScene()->GetViewProjection());
+    }
 
-    shortcutManager_->Update();
+    // パーティクルはエミッターの数によらず、グループごとに1フレーム1回だけ進める
+    particleSystem_->Update(*sceneManager_->GetBaseScene()->GetViewProjection());
+
+    {
+        ALLOCATION_SCOPE("Input");
+        PROFILE_SCOPE("Input::Update");
+        input_->Update();
+        shortcutManager_->Update();
+    }
 
     endRequest_ = winApp_->ProcessMessage();
 }
 
+void Framework::FixedUpdate() {
+    {
+        ALLOCATION_SCOPE("BaseObject");
+        baseObjectManager_->FixedUpdate();
+    }
+
+    if (collisionManager_->IsUseFixedTimeStep()) {
+        ALLOCATION_SCOPE("Collision");
+        collisionManager_->Update();
+    }
+}
+
 void Framework::LoadResource() {
     particleEditor_->AddParticleEmitter("fire");
     particleEditor_->AddParticleEmitter("hitEmitter");
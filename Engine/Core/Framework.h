@@ -2,29 +2,39 @@
 #include "DirectXCommon.h"
 #ifdef _DEBUG
 #endif // _DEBUG
+#include "Asset/AssetDatabase.h"
 #include "Audio.h"
 #include "Collider/CollisionManager.h"
+#include "Data/JsonHotReloader.h"
 #include "Debug/ImGui/ImGuiManager.h"
 #include "Debug/ImGui/ImGuizmoManager.h"
+#include "Debug/Profiler/Profiler.h"
+#include "Engine/Frame/FrameStats.h"
 #include "Debug/ResourceLeakChecker/D3DResourceLeakChecker.h"
 #include "Edit/ShortcutManager/ShortcutManager.h"
-#include "Engine/offscreen/OffScreen.h"
+#include "Engine/Offscreen/OffScreen.h"
 #include "Graphics/Model/ModelManager.h"
 #include "Graphics/PipeLine/ComputePipeLineManager.h"
 #include "Graphics/PipeLine/PipeLineManager.h"
 #include "Graphics/Srv/SrvManager.h"
 #include "Graphics/Texture/TextureManager.h"
 #include "Input.h"
+#include "Job/JobSystem.h"
+#include "Memory/AllocationTracker.h"
+#include "Memory/FrameAllocator.h"
 #include "Model/ModelCommon.h"
 #include "Object/Base/BaseObjectManager.h"
+#include "Object/ModelInstancing.h"
 #include "Particle/ParticleCommon.h"
 #include "Particle/ParticleEditor.h"
 #include "Particle/ParticleGroupManager.h"
+#include "Particle/ParticleSystem.h"
 #include "Scene/AbstractSceneFactory.h"
 #include "Scene/SceneManager.h"
+#include "ShowFolder/DirectoryIndex.h"
 #include "SkyBox/SkyBox.h"
-#include "SpriteCommon.h"
-#include "line/DrawLine3D.h"
+#include "SpriteBatch.h"
+#include "Line/DrawLine3D.h"
 #include <Application/Utility/MotionEditor/MotionEditor.h>
 
 class Framework {
@@ -56,6 +66,11 @@ class Framework {
     /// </summary>
     virtual void Update();
 
+    /// <summary>
+    /// 固定ステップの更新（Frameの固定ステップが有効なとき、1フレームに0回以上呼ばれる）
+    /// </summary>
+    virtual void FixedUpdate();
+
     /// <summary>
     /// リソース
     /// </summary>
@@ -76,10 +91,19 @@ class Framework {
 
   private:
   protected:
+    // 固定ステップの設定（既定では使わない。使うゲームはInitializeの後でFrame::SetFixedTimeStepを呼ぶ）
+    static constexpr bool kUseFixedTimeStep = false;
+    static constexpr float kFixedDeltaTime = 1.0f / 60.0f;
+    static constexpr int kMaxFixedSteps = 5; // これ以上遅れた分は捨てる
+
     Input *input_ = nullptr;
     Audio *audio_ = nullptr;
     DirectXCommon *dxCommon_ = nullptr;
     WinApp *winApp_ = nullptr;
+    JobSystem *jobSystem_ = nullptr;
+    FrameAllocator *frameAllocator_ = nullptr;
+    AssetDatabase *assetDatabase_ = nullptr;
+    JsonHotReloader *jsonHotReloader_ = nullptr;
     DrawLine3D *line3d_ = nullptr;
     SkyBox *skyBox_ = nullptr;
 
@@ -90,16 +114,18 @@ class Framework {
     SrvManager *srvManager_ = nullptr;
     TextureManager *textureManager_ = nullptr;
     ModelManager *modelManager_ = nullptr;
+    ModelInstancing *modelInstancing_ = nullptr;
     ImGuiManager *imGuiManager_ = nullptr;
     ImGuizmoManager *imGuizmoManager_ = nullptr;
     BaseObjectManager *baseObjectManager_ = nullptr;
     ParticleGroupManager *particleGroupManager_ = nullptr;
+    ParticleSystem *particleSystem_ = nullptr;
     PipeLineManager *pipeLineManager_ = nullptr;
     MotionEditor *motionEditor_ = nullptr;
     ComputePipeLineManager *computePipeLineManager_ = nullptr;
     ShortcutManager *shortcutManager_ = nullptr;
 
-    SpriteCommon *spriteCommon_ = nullptr;
+    SpriteBatch *spriteBatch_ = nullptr;
     ParticleCommon *particleCommon_ = nullptr;
     ModelCommon *modelCommon_ = nullptr;
 
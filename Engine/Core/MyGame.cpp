@@ -9,6 +9,9 @@ void MyGame::Initialize() {
     Framework::RegisterShortcutKey();
     // -----ゲーム固有の処理-----
 
+    // プレイヤーの移動を描画のフレームレートによらず一定の刻みで進める
+    Frame::SetFixedTimeStep(true, kFixedDeltaTime, kMaxFixedSteps);
+
     // 最初のシーンの生成
     sceneFactory_ = new SceneFactory();
     // シーンマネージャに最初のシーンをセット
@@ -30,20 +33,24 @@ void MyGame::Update() {
 
     // -----ゲーム固有の処理-----
 #ifdef _DEBUG
-
-    imGuiManager_->Begin();
-    imGuizmoManager_->BeginFrame();
-    imGuizmoManager_->SetViewProjection(sceneManager_->GetBaseScene()->GetViewProjection());
-    imGuiManager_->UpdateIni();
-    imGuiManager_->SetCurrentScene(sceneManager_->GetBaseScene());
-    imGuiManager_->ShowMainMenu();
-    if (imGuiManager_->GetIsShowMainUI()) {
-        imGuiManager_->ShowDockSpace();
-        imGuiManager_->ShowSceneWindow(offscreen_.get(), sceneManager_->GetCurrentSceneName());
+    {
+        ALLOCATION_SCOPE("ImGui");
+        PROFILE_SCOPE("ImGui");
+
+        imGuiManager_->Begin();
+        imGuizmoManager_->BeginFrame();
+        imGuizmoManager_->SetViewProjection(sceneManager_->GetBaseScene()->GetViewProjection());
+        imGuiManager_->UpdateIni();
+        imGuiManager_->SetCurrentScene(sceneManager_->GetBaseScene());
+        imGuiManager_->ShowMainMenu();
+        if (imGuiManager_->GetIsShowMainUI()) {
+            imGuiManager_->ShowDockSpace();
+            imGuiManager_->ShowSceneWindow(offscreen_.get(), sceneManager_->GetCurrentSceneName());
+        }
+        imGuiManager_->ShowMainUI(offscreen_.get());
+        baseObjectManager_->DrawImGui();
+        imGuiManager_->End();
     }
-    imGuiManager_->ShowMainUI(offscreen_.get());
-    baseObjectManager_->DrawImGui();
-    imGuiManager_->End();
 #endif // _DEBUG
 
     motionEditor_->Update(Frame::DeltaTime());
@@ -54,9 +61,12 @@ void MyGame::Update() {
 void MyGame::Draw() {
     dxCommon_->PreRenderTexture();
     srvManager_->PreDraw();
+    modelInstancing_->BeginFrame();
+    spriteBatch_->BeginFrame();
     // -----描画開始-----
 
     // -----シーンごとの処理------
+    ALLOCATION_SCOPE("Draw");
 
     if (sceneManager_->GetTransitionEnd()) {
         collisionManager_->Draw(*sceneManager_->GetBaseScene()->GetViewProjection());
@@ -1,4 +1,8 @@
 #include "Frame.h"
+#include "FrameStats.h"
+#include "Memory/AllocationTracker.h"
+#include "Memory/FrameAllocator.h"
+#include <algorithm>
 #include <chrono>
 
 /// <summary>
@@ -10,6 +14,13 @@ std::chrono::high_resolution_clock::time_point Frame::fpsCalcTime_ = std::chrono
 float Frame::deltaTime_ = 0.0f;
 float Frame::fps_ = 0.0f;
 int Frame::frameCount_ = 0;
+bool Frame::isFixedTimeStep_ = false;
+bool Frame::isInFixedStep_ = false;
+float Frame::fixedDeltaTime_ = 1.0f / 60.0f;
+int Frame::maxFixedSteps_ = 5;
+float Frame::accumulator_ = 0.0f;
+int Frame::fixedStepCount_ = 0;
+float Frame::interpolationAlpha_ = 1.0f;
 
 /// <summary>
 /// フレームの初期化処理
@@ -21,6 +32,9 @@ void Frame::Init() {
     deltaTime_ = 0.0f;
     fps_ = 0.0f;
     frameCount_ = 0;
+    accumulator_ = 0.0f;
+    fixedStepCount_ = 0;
+    interpolationAlpha_ = 1.0f;
 }
 
 /// <summary>
@@ -50,6 +64,35 @@ void Frame::Update() {
 
     // 次回の更新のために現在の時刻を記録
     lastTime_ = currentTime;
+
+    // 固定ステップで進める回数と描画時の補間率を求める
+    if (isFixedTimeStep_) {
+        accumulator_ += deltaTime_;
+        fixedStepCount_ = static_cast<int>(accumulator_ / fixedDeltaTime_);
+        if (fixedStepCount_ > maxFixedSteps_) {
+            // 処理落ちで追いつけない分は捨てる（追いつこうとしてさらに重くなるのを防ぐ）
+            fixedStepCount_ = maxFixedSteps_;
+            accumulator_ = fixedDeltaTime_ * static_cast<float>(maxFixedSteps_);
+        }
+        accumulator_ -= fixedDeltaTime_ * static_cast<float>(fixedStepCount_);
+        interpolationAlpha_ = std::clamp(accumulator_ / fixedDeltaTime_, 0.0f, 1.0f);
+    } else {
+        fixedStepCount_ = 0;
+        interpolationAlpha_ = 1.0f;
+    }
+
+    // ヒープ確保の集計を確定し、フレームアロケータを次の面に切り替える
+    AllocationTracker::EndFrame();
+    FrameAllocator::GetInstance()->BeginFrame();
+
+    // 前のフレームの統計値を履歴に積む
+    STAT_GAUGE_SET("FrameTime(ms)", deltaTime_ * 1000.0f);
+    STAT_GAUGE_SET("FrameArena(KB)", FrameAllocator::GetInstance()->GetLastFrameUsedBytes() / 1024.0f);
+    STAT_GAUGE_SET("FrameArenaOverflow(KB)", FrameAllocator::GetInstance()->GetLastFrameOverflowBytes() / 1024.0f);
+#ifdef ENABLE_ALLOCATION_TRACKING
+    STAT_GAUGE_SET("Allocations", AllocationTracker::GetLastFrameTotalCount());
+#endif // ENABLE_ALLOCATION_TRACKING
+    FrameStats::EndFrame();
 }
 
 
@@ -58,7 +101,7 @@ void Frame::Update() {
 /// </summary>
 /// <returns>前回の更新からの経過時間</returns>
 float Frame::DeltaTime() {
-    return deltaTime_;
+    return isInFixedStep_ ? fixedDeltaTime_ : deltaTime_;
 }
 
 /// <summary>
@@ -68,3 +111,32 @@ float Frame::DeltaTime() {
 float Frame::GetFPS() {
     return fps_; // 現在のFPSを返す
 }
+
+/// <summary>
+/// 固定ステップの設定
+/// </summary>
+/// <param name="isFixedTimeStep">固定ステップで更新するか</param>
+/// <param name="fixedDeltaTime">1ステップの時間(秒)</param>
+/// <param name="maxFixedSteps">1フレームで進める最大ステップ数</param>
+void Frame::SetFixedTimeStep(bool isFixedTimeStep, float fixedDeltaTime, int maxFixedSteps) {
+    isFixedTimeStep_ = isFixedTimeStep;
+    fixedDeltaTime_ = fixedDeltaTime;
+    maxFixedSteps_ = (std::max)(maxFixedSteps, 1);
+    accumulator_ = 0.0f;
+    fixedStepCount_ = 0;
+    interpolationAlpha_ = 1.0f;
+}
+
+/// <summary>
+/// 固定ステップの更新開始（この間DeltaTime()は刻み幅を返す）
+/// </summary>
+void Frame::BeginFixedStep() {
+    isInFixedStep_ = true;
+}
+
+/// <summary>
+/// 固定ステップの更新終了
+/// </summary>
+void Frame::EndFixedStep() {
+    isInFixedStep_ = false;
+}
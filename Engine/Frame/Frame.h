@@ -15,6 +15,15 @@ class Frame {
     static float deltaTime_; ///< 前回のフレームからの経過時間
     static float fps_;       ///< FPS
 
+    // 固定ステップ
+    static bool isFixedTimeStep_;     ///< 固定ステップで更新するか
+    static bool isInFixedStep_;       ///< 固定ステップの更新中か
+    static float fixedDeltaTime_;     ///< 1ステップの時間
+    static int maxFixedSteps_;        ///< 1フレームで進める最大ステップ数
+    static float accumulator_;        ///< まだ進めていない時間
+    static int fixedStepCount_;       ///< このフレームで進めるステップ数
+    static float interpolationAlpha_; ///< 描画時の補間率
+
   public:
     /// ========================================================
     /// 静的メンバ関数
@@ -23,4 +32,19 @@ class Frame {
     static void Update();     ///< フレームの更新処理
     static float DeltaTime(); ///< 前回の更新からの経過時間を取得
     static float GetFPS();    ///< 現在のFPSを取得
+
+    /// ========================================================
+    /// 固定ステップ
+    /// 有効にすると経過時間を貯めて一定の刻みで消費する。
+    /// 固定ステップの更新中はDeltaTime()が刻み幅を返すので、各処理はそのまま使える
+    /// ========================================================
+    static void SetFixedTimeStep(bool isFixedTimeStep, float fixedDeltaTime = 1.0f / 60.0f, int maxFixedSteps = 5);
+    static bool IsFixedTimeStep() { return isFixedTimeStep_; }
+    static bool IsInFixedStep() { return isInFixedStep_; }
+    static float FixedDeltaTime() { return fixedDeltaTime_; }
+    static int GetMaxFixedSteps() { return maxFixedSteps_; }
+    static int GetFixedStepCount() { return fixedStepCount_; }    ///< このフレームで進めるステップ数
+    static float GetInterpolationAlpha() { return interpolationAlpha_; } ///< 直前のステップから次のステップまでの割合（0～1）
+    static void BeginFixedStep(); ///< 固定ステップの更新開始
+    static void EndFixedStep();   ///< 固定ステップの更新終了
 };
@@ -0,0 +1,263 @@
+#include "FramePacer.h"
+#include "Debug/Profiler/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#ifdef _WIN32
+#include <Windows.h>
+#include <timeapi.h>
+
+#pragma comment(lib, "winmm.lib")
+
+// 古いSDKでは定義されていない
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif // _WIN32
+#if defined(_M_X64) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#ifdef _DEBUG
+#include "imgui.h"
+#endif // _DEBUG
+
+namespace {
+// SleepSpinで最後にスピンする時間
+constexpr std::chrono::microseconds kSpinThreshold{1000};
+// AdaptiveSleepで1回に寝る時間
+constexpr double kSleepChunkUs = 1000.0;
+// 寝過ごし量の学習率
+constexpr double kOversleepLearningRate = 0.1;
+// ウィンドウのドラッグなどで極端に止まったときの値は学習に使わない
+constexpr double kMaxOversleepUs = 20000.0;
+
+// スピン中にコアを占有しすぎないようにする
+void SpinPause() {
+#if defined(_M_X64) || defined(__SSE2__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+} // namespace
+
+FramePacer::~FramePacer() {
+    Finalize();
+}
+
+void FramePacer::Initialize(double targetFPS, FramePacingMode mode) {
+#ifdef _WIN32
+    // sleepの分解能を1msにする
+    if (!isTimerPeriodSet_) {
+        isTimerPeriodSet_ = timeBeginPeriod(1) == TIMERR_NOERROR;
+    }
+    // 高精度タイマーが作れない環境では通常のタイマーを使う
+    if (timer_ == nullptr) {
+        timer_ = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (timer_ == nullptr) {
+            timer_ = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+        }
+    }
+#endif // _WIN32
+    mode_ = mode;
+    SetTargetFPS(targetFPS);
+    Reset();
+}
+
+void FramePacer::Finalize() {
+#ifdef _WIN32
+    if (timer_) {
+        CloseHandle(timer_);
+        timer_ = nullptr;
+    }
+    if (isTimerPeriodSet_) {
+        timeEndPeriod(1);
+        isTimerPeriodSet_ = false;
+    }
+#endif // _WIN32
+}
+
+void FramePacer::Wait() {
+    PROFILE_FUNCTION();
+    // 次のフレームの開始時刻まで待つ
+    Clock::time_point deadline = reference_ + frameTime_;
+    if (Clock::now() < deadline) {
+        WaitUntil(deadline);
+    }
+
+    // 前回起きた時刻からの時間を目標と比べて記録
+    Clock::time_point wakeTime = Clock::now();
+    if (hasLastWake_) {
+        double frameUs = std::chrono::duration<double, std::micro>(wakeTime - lastWakeTime_).count();
+        double targetUs = std::chrono::duration<double, std::micro>(frameTime_).count();
+        errorHistoryUs_[historyIndex_] = static_cast<float>(frameUs - targetUs);
+        frameHistoryUs_[historyIndex_] = static_cast<float>(frameUs);
+        historyIndex_ = (historyIndex_ + 1) % kHistorySize;
+        historyCount_ = (std::min)(historyCount_ + 1, kHistorySize);
+    }
+    lastWakeTime_ = wakeTime;
+    hasLastWake_ = true;
+
+    // 次のフレームの基準時間を更新
+    // 精確なフレームレートを維持するため、理想的なフレーム時間を加算
+    reference_ += frameTime_;
+
+    // もし大幅に遅れている場合は現在時刻に調整（フレームスキップ）
+    if (Clock::now() > reference_ + frameTime_) {
+        reference_ = Clock::now();
+    }
+}
+
+void FramePacer::Reset() {
+    reference_ = Clock::now();
+    historyIndex_ = 0;
+    historyCount_ = 0;
+    hasLastWake_ = false;
+}
+
+FramePacer::Stats FramePacer::GetStats() const {
+    Stats stats;
+    stats.sampleCount = static_cast<uint32_t>(historyCount_);
+    if (historyCount_ == 0) {
+        return stats;
+    }
+
+    std::array<float, kHistorySize> errors{};
+    double frameSum = 0.0;
+    for (size_t i = 0; i < historyCount_; ++i) {
+        errors[i] = std::fabs(errorHistoryUs_[i]);
+        frameSum += frameHistoryUs_[i];
+    }
+    auto begin = errors.begin();
+    auto end = errors.begin() + historyCount_;
+    auto p50 = begin + (historyCount_ - 1) / 2;
+    std::nth_element(begin, p50, end);
+    stats.p50ErrorUs = *p50;
+    auto p99 = begin + (historyCount_ - 1) * 99 / 100;
+    std::nth_element(begin, p99, end);
+    stats.p99ErrorUs = *p99;
+    stats.averageFrameUs = frameSum / static_cast<double>(historyCount_);
+    return stats;
+}
+
+void FramePacer::ImGui() {
+#ifdef _DEBUG
+    if (ImGui::CollapsingHeader("フレームレート固定")) {
+        int mode = static_cast<int>(mode_);
+        const char *modeNames[] = {
+            GetModeName(FramePacingMode::kSleepSpin),
+            GetModeName(FramePacingMode::kWaitableTimer),
+            GetModeName(FramePacingMode::kAdaptiveSleep),
+        };
+        if (ImGui::Combo("待ち方", &mode, modeNames, IM_ARRAYSIZE(modeNames))) {
+            SetMode(static_cast<FramePacingMode>(mode));
+        }
+        Stats stats = GetStats();
+        ImGui::Text("誤差 p50: %.0f us  p99: %.0f us", stats.p50ErrorUs, stats.p99ErrorUs);
+        ImGui::Text("平均: %.2f ms (目標 %.2f ms)", stats.averageFrameUs / 1000.0, 1000.0 / targetFPS_);
+        if (mode_ == FramePacingMode::kAdaptiveSleep) {
+            ImGui::Text("寝過ごし見込み: %.0f us", GetAdaptiveSlackUs());
+        }
+    }
+#endif // _DEBUG
+}
+
+const char *FramePacer::GetModeName(FramePacingMode mode) {
+    switch (mode) {
+    case FramePacingMode::kSleepSpin:
+        return "sleep_spin";
+    case FramePacingMode::kWaitableTimer:
+        return "waitable_timer";
+    case FramePacingMode::kAdaptiveSleep:
+        return "adaptive_sleep";
+    default:
+        return "unknown";
+    }
+}
+
+void FramePacer::SetMode(FramePacingMode mode) {
+    mode_ = mode;
+    // 待ち方ごとの誤差を見たいので記録は取り直す
+    historyIndex_ = 0;
+    historyCount_ = 0;
+    hasLastWake_ = false;
+}
+
+void FramePacer::SetTargetFPS(double targetFPS) {
+    targetFPS_ = targetFPS;
+    frameTime_ = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetFPS));
+}
+
+void FramePacer::WaitUntil(Clock::time_point deadline) {
+    switch (mode_) {
+    case FramePacingMode::kSleepSpin:
+        SleepSpin(deadline);
+        break;
+    case FramePacingMode::kWaitableTimer:
+        WaitTimer(deadline);
+        break;
+    case FramePacingMode::kAdaptiveSleep:
+        AdaptiveSleep(deadline);
+        break;
+    default:
+        break;
+    }
+}
+
+void FramePacer::SleepSpin(Clock::time_point deadline) {
+    // まず大部分の時間をsleep_forで待機
+    Clock::duration remaining = deadline - Clock::now();
+    if (remaining > kSpinThreshold) {
+        std::this_thread::sleep_for(remaining - kSpinThreshold);
+    }
+    // 残りの短い時間はスピンで待つ
+    while (Clock::now() < deadline) {
+        SpinPause();
+    }
+}
+
+void FramePacer::WaitTimer(Clock::time_point deadline) {
+    // タイマーを作れなかった環境（Windows以外を含む）ではsleepとスピンで待つ
+    if (timer_ == nullptr) {
+        SleepSpin(deadline);
+        return;
+    }
+#ifdef _WIN32
+    // 相対時間（100ns単位、負の値）で指定する
+    Clock::duration remaining = deadline - Clock::now();
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -static_cast<LONGLONG>(std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count() / 100);
+    if (dueTime.QuadPart >= 0) {
+        return;
+    }
+    if (SetWaitableTimerEx(timer_, &dueTime, 0, nullptr, nullptr, nullptr, 0)) {
+        WaitForSingleObject(timer_, INFINITE);
+    }
+#endif // _WIN32
+}
+
+void FramePacer::AdaptiveSleep(Clock::time_point deadline) {
+    // 寝過ごす見込みの分だけ早めに切り上げ、スピンはしない
+    while (true) {
+        Clock::time_point now = Clock::now();
+        double remainingUs = std::chrono::duration<double, std::micro>(deadline - now).count();
+        double slackUs = GetAdaptiveSlackUs();
+        if (remainingUs <= slackUs) {
+            break;
+        }
+        double requestUs = (std::min)(remainingUs - slackUs, kSleepChunkUs);
+        std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(requestUs));
+        double sleptUs = std::chrono::duration<double, std::micro>(Clock::now() - now).count();
+        RecordOversleep(sleptUs - requestUs);
+    }
+}
+
+void FramePacer::RecordOversleep(double oversleepUs) {
+    oversleepUs = std::clamp(oversleepUs, 0.0, kMaxOversleepUs);
+    if (oversleepUs >= kMaxOversleepUs) {
+        return;
+    }
+    double difference = oversleepUs - oversleepMeanUs_;
+    oversleepMeanUs_ += kOversleepLearningRate * difference;
+    oversleepDeviationUs_ += kOversleepLearningRate * (std::fabs(difference) - oversleepDeviationUs_);
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+/// <summary>
+/// フレームの待ち方
+/// </summary>
+enum class FramePacingMode {
+    kSleepSpin,     // 大部分をsleepで待ち、最後の少しを_mm_pauseでスピンする
+    kWaitableTimer, // 高精度のWaitableTimerで待つ（Windows以外ではkSleepSpinと同じ）
+    kAdaptiveSleep, // sleepだけで待つ（寝過ごす量を計測して早めに起きる）
+    kCount,
+};
+
+/// <summary>
+/// フレームレートの固定（目標のフレーム時間になるまで待つ）
+/// 待ち方を切り替えられ、実際のフレーム時間と目標との誤差を記録する
+/// </summary>
+class FramePacer {
+  public:
+    // 誤差を記録するフレーム数
+    static constexpr size_t kHistorySize = 240;
+
+    // 誤差の統計
+    struct Stats {
+        double p50ErrorUs = 0.0;     // 誤差（絶対値）の中央値(μs)
+        double p99ErrorUs = 0.0;     // 誤差（絶対値）の99パーセンタイル(μs)
+        double averageFrameUs = 0.0; // 平均フレーム時間(μs)
+        uint32_t sampleCount = 0;
+    };
+
+    FramePacer() = default;
+    ~FramePacer();
+    FramePacer(const FramePacer &) = delete;
+    FramePacer &operator=(const FramePacer &) = delete;
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    void Initialize(double targetFPS, FramePacingMode mode = FramePacingMode::kWaitableTimer);
+
+    /// <summary>
+    /// 終了（タイマーとタイマー分解能の設定を戻す）
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 次のフレームの開始時刻まで待つ
+    /// </summary>
+    void Wait();
+
+    /// <summary>
+    /// 記録をリセットして基準時刻を現在にする
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// 直近kHistorySizeフレームの統計
+    /// </summary>
+    Stats GetStats() const;
+
+    /// <summary>
+    /// 待ち方の切り替えと統計の表示
+    /// </summary>
+    void ImGui();
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    FramePacingMode GetMode() const { return mode_; }
+    double GetTargetFPS() const { return targetFPS_; }
+    // 学習した寝過ごし量(μs)
+    double GetAdaptiveSlackUs() const { return oversleepMeanUs_ + 2.0 * oversleepDeviationUs_; }
+    static const char *GetModeName(FramePacingMode mode);
+
+    /// <summary>
+    /// setter
+    /// </summary>
+    void SetMode(FramePacingMode mode);
+    void SetTargetFPS(double targetFPS);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    void WaitUntil(Clock::time_point deadline);
+    void SleepSpin(Clock::time_point deadline);
+    void WaitTimer(Clock::time_point deadline);
+    void AdaptiveSleep(Clock::time_point deadline);
+
+    // 寝過ごし量の学習
+    void RecordOversleep(double oversleepUs);
+
+  private:
+    FramePacingMode mode_ = FramePacingMode::kWaitableTimer;
+    double targetFPS_ = 60.0;
+    Clock::duration frameTime_{};
+    Clock::time_point reference_;
+
+    // 高精度WaitableTimer（HANDLE）
+    void *timer_ = nullptr;
+    bool isTimerPeriodSet_ = false;
+
+    // sleepの寝過ごし量（指数移動平均）
+    double oversleepMeanUs_ = 1000.0;
+    double oversleepDeviationUs_ = 500.0;
+
+    // フレーム時間と目標との誤差の記録
+    std::array<float, kHistorySize> errorHistoryUs_{};
+    std::array<float, kHistorySize> frameHistoryUs_{};
+    size_t historyIndex_ = 0;
+    size_t historyCount_ = 0;
+    Clock::time_point lastWakeTime_;
+    bool hasLastWake_ = false;
+};
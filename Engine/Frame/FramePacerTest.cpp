@@ -0,0 +1,67 @@
+#include "FramePacer.h"
+#include "Test/Test.h"
+#include <cmath>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 目標の100FPSで、毎フレーム少し処理をしながら待ったときの平均フレーム時間(us)
+double MeasureAverageFrameUs(FramePacingMode mode, uint32_t frameCount) {
+    FramePacer pacer;
+    pacer.Initialize(100.0, mode);
+    pacer.Wait();
+    Clock::time_point begin = Clock::now();
+    for (uint32_t frame = 0; frame < frameCount; ++frame) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1 + frame % 4));
+        pacer.Wait();
+    }
+    double averageUs = std::chrono::duration<double, std::micro>(Clock::now() - begin).count() / frameCount;
+    pacer.Finalize();
+    return averageUs;
+}
+
+} // namespace
+
+// どの待ち方でも平均フレーム時間が目標どおりになる（待つ時刻は前の目標時刻から積み上げるので誤差がたまらない）
+TEST(AverageMatchesTarget) {
+    for (int mode = 0; mode < static_cast<int>(FramePacingMode::kCount); ++mode) {
+        double averageUs = MeasureAverageFrameUs(static_cast<FramePacingMode>(mode), 50);
+        CHECK(std::fabs(averageUs - 10000.0) <= 10000.0 * 0.05);
+    }
+}
+
+// 大きく遅れたフレームの後は取り戻そうと連続で返さず、そこから1フレーム分待つ
+TEST(SkipsAheadAfterStall) {
+    FramePacer pacer;
+    pacer.Initialize(100.0, FramePacingMode::kSleepSpin);
+    pacer.Wait();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pacer.Wait();
+
+    Clock::time_point begin = Clock::now();
+    pacer.Wait();
+    double waitedMs = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+    CHECK(waitedMs >= 9.0);
+    pacer.Finalize();
+}
+
+// 記録は待ち方を変えると取り直し、2回目のWaitからフレーム時間を記録する
+TEST(StatsTrackFrames) {
+    FramePacer pacer;
+    pacer.Initialize(200.0, FramePacingMode::kSleepSpin);
+    CHECK(pacer.GetStats().sampleCount == 0);
+    for (int i = 0; i < 5; ++i) {
+        pacer.Wait();
+    }
+    FramePacer::Stats stats = pacer.GetStats();
+    CHECK(stats.sampleCount == 4);
+    CHECK(stats.averageFrameUs > 4000.0);
+    CHECK(stats.p99ErrorUs >= stats.p50ErrorUs);
+
+    pacer.SetMode(FramePacingMode::kAdaptiveSleep);
+    CHECK(pacer.GetStats().sampleCount == 0);
+    CHECK(pacer.GetMode() == FramePacingMode::kAdaptiveSleep);
+    pacer.Finalize();
+}
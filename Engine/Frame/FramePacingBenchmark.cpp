@@ -0,0 +1,102 @@
+#include "FramePacingBenchmark.h"
+#include "FramePacer.h"
+#include <chrono>
+#include <fstream>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <ctime>
+#endif // _WIN32
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 指定した時間だけCPUを使う（ゲームの更新・描画の代わり）
+void BusyWork(std::chrono::microseconds duration) {
+    Clock::time_point end = Clock::now() + duration;
+    while (Clock::now() < end) {
+    }
+}
+
+// このスレッドが使ったCPU時間（Windowsはサイクル数、それ以外はナノ秒）
+uint64_t ReadThreadCpuTime() {
+#ifdef _WIN32
+    ULONG64 cycles = 0;
+    QueryThreadCycleTime(GetCurrentThread(), &cycles);
+    return cycles;
+#else
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+#endif // _WIN32
+}
+
+// スピンし続けたときの1秒あたりのCPU時間（CPU使用率100%の基準）
+double MeasureCpuTimePerSecond() {
+    uint64_t beginCpuTime = ReadThreadCpuTime();
+    Clock::time_point begin = Clock::now();
+    BusyWork(std::chrono::milliseconds(50));
+    uint64_t endCpuTime = ReadThreadCpuTime();
+    double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return static_cast<double>(endCpuTime - beginCpuTime) / seconds;
+}
+
+FramePacingBenchmarkResult Measure(FramePacingMode mode, double targetFPS, uint32_t frameCount, double cpuTimePerSecond) {
+    FramePacer pacer;
+    pacer.Initialize(targetFPS, mode);
+
+    uint64_t waitCpuTime = 0;
+    double waitSeconds = 0.0;
+    double frameUs = 1.0e6 / targetFPS;
+    for (uint32_t frame = 0; frame < frameCount; ++frame) {
+        // 目標の20%～60%の処理時間がフレームごとに変わる負荷
+        double load = 0.2 + 0.1 * static_cast<double>(frame % 5);
+        BusyWork(std::chrono::microseconds(static_cast<int64_t>(frameUs * load)));
+
+        uint64_t beginCpuTime = ReadThreadCpuTime();
+        Clock::time_point begin = Clock::now();
+        pacer.Wait();
+        waitSeconds += std::chrono::duration<double>(Clock::now() - begin).count();
+        waitCpuTime += ReadThreadCpuTime() - beginCpuTime;
+    }
+
+    FramePacer::Stats stats = pacer.GetStats();
+    pacer.Finalize();
+
+    FramePacingBenchmarkResult result;
+    result.name = FramePacer::GetModeName(mode);
+    result.frames = frameCount;
+    result.p50ErrorUs = stats.p50ErrorUs;
+    result.p99ErrorUs = stats.p99ErrorUs;
+    result.averageFrameMs = stats.averageFrameUs / 1000.0;
+    if (waitSeconds > 0.0 && cpuTimePerSecond > 0.0) {
+        result.waitCpuPercent = static_cast<double>(waitCpuTime) / cpuTimePerSecond / waitSeconds * 100.0;
+    }
+    return result;
+}
+
+} // namespace
+
+std::vector<FramePacingBenchmarkResult> FramePacingBenchmark::Run(double targetFPS, uint32_t frameCount) {
+    double cpuTimePerSecond = MeasureCpuTimePerSecond();
+
+    std::vector<FramePacingBenchmarkResult> results;
+    for (int mode = 0; mode < static_cast<int>(FramePacingMode::kCount); ++mode) {
+        results.push_back(Measure(static_cast<FramePacingMode>(mode), targetFPS, frameCount, cpuTimePerSecond));
+    }
+    return results;
+}
+
+void FramePacingBenchmark::WriteReportCSV(const std::vector<FramePacingBenchmarkResult> &results, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "name,frames,p50_error_us,p99_error_us,average_frame_ms,wait_cpu_percent\n";
+    for (const auto &result : results) {
+        file << result.name << "," << result.frames << "," << result.p50ErrorUs << "," << result.p99ErrorUs << ","
+             << result.averageFrameMs << "," << result.waitCpuPercent << "\n";
+    }
+}
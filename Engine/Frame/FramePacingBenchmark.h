@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 待ち方1つ分の計測結果
+/// </summary>
+struct FramePacingBenchmarkResult {
+    std::string name;            // 待ち方
+    uint32_t frames = 0;         // 計測したフレーム数
+    double p50ErrorUs = 0.0;     // フレーム時間の誤差の中央値(μs)
+    double p99ErrorUs = 0.0;     // フレーム時間の誤差の99パーセンタイル(μs)
+    double averageFrameMs = 0.0; // 平均フレーム時間(ms)
+    double waitCpuPercent = 0.0; // 待っている間のCPU使用率(%)
+};
+
+/// <summary>
+/// フレームレート固定の待ち方ごとの精度とCPU使用率の計測
+/// 毎フレーム処理時間の変わる仮の負荷をかけて、FramePacer::Waitの誤差と待機中のCPU時間を測る（目標どおりに待てるかはFramePacerTest）
+/// </summary>
+class FramePacingBenchmark {
+  public:
+    /// <summary>
+    /// すべての待ち方を計測する
+    /// </summary>
+    /// <param name="targetFPS">目標のフレームレート</param>
+    /// <param name="frameCount">待ち方ごとのフレーム数</param>
+    static std::vector<FramePacingBenchmarkResult> Run(double targetFPS = 60.0, uint32_t frameCount = 180);
+
+    /// <summary>
+    /// 結果をCSVに書き出す
+    /// </summary>
+    static void WriteReportCSV(const std::vector<FramePacingBenchmarkResult> &results, const std::string &filePath);
+};
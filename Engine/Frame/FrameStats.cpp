@@ -0,0 +1,265 @@
+#include "FrameStats.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#ifdef _DEBUG
+#include "imgui.h"
+#endif // _DEBUG
+
+namespace {
+// Add/Setはワーカースレッドからも呼ばれるので、登録情報と今の値はatomicで持つ
+std::atomic<const char *> statNames[FrameStats::kMaxStats] = {};
+std::atomic<StatType> statTypes[FrameStats::kMaxStats] = {};
+std::atomic<double> currentValues[FrameStats::kMaxStats] = {};
+std::atomic<uint32_t> statCount = 0;
+std::mutex registerMutex;
+
+// 履歴はメインスレッドだけが触る
+std::array<std::array<float, FrameStats::kWindowSize>, FrameStats::kMaxStats> history = {};
+std::array<uint32_t, FrameStats::kMaxStats> sampleCounts = {};
+uint32_t historyIndex = 0;
+
+// 簡易表示
+#ifdef _DEBUG
+bool isShowOverlay = false;
+#endif // _DEBUG
+std::array<bool, FrameStats::kMaxStats> isShowInOverlay = {};
+
+// 直前のフレームの値が入っている位置
+uint32_t LastIndex() {
+    return (historyIndex + FrameStats::kWindowSize - 1) % FrameStats::kWindowSize;
+}
+} // namespace
+
+uint32_t FrameStats::Register(const char *name, StatType type) {
+    std::lock_guard<std::mutex> lock(registerMutex);
+
+    uint32_t count = statCount;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (std::strcmp(statNames[i], name) == 0) {
+            return i;
+        }
+    }
+    // 上限を超えたものは記録しない
+    if (count >= kMaxStats) {
+        return kInvalidId;
+    }
+    statNames[count] = name;
+    statTypes[count] = type;
+    isShowInOverlay[count] = true;
+    statCount = count + 1;
+    return count;
+}
+
+void FrameStats::Add(uint32_t id, double value) {
+    if (id >= kMaxStats) {
+        return;
+    }
+    currentValues[id].fetch_add(value, std::memory_order_relaxed);
+}
+
+void FrameStats::Set(uint32_t id, double value) {
+    if (id >= kMaxStats) {
+        return;
+    }
+    currentValues[id].store(value, std::memory_order_relaxed);
+}
+
+void FrameStats::EndFrame() {
+    uint32_t count = statCount;
+    for (uint32_t i = 0; i < count; ++i) {
+        double value = statTypes[i] == StatType::kCounter
+                           ? currentValues[i].exchange(0.0, std::memory_order_relaxed)
+                           : currentValues[i].load(std::memory_order_relaxed);
+        history[i][historyIndex] = static_cast<float>(value);
+        sampleCounts[i] = (std::min)(sampleCounts[i] + 1, kWindowSize);
+    }
+    historyIndex = (historyIndex + 1) % kWindowSize;
+}
+
+void FrameStats::Reset() {
+    sampleCounts.fill(0);
+    historyIndex = 0;
+}
+
+uint32_t FrameStats::GetStatCount() {
+    return statCount;
+}
+
+const char *FrameStats::GetName(uint32_t id) {
+    return id < GetStatCount() ? statNames[id].load() : nullptr;
+}
+
+StatType FrameStats::GetType(uint32_t id) {
+    return id < GetStatCount() ? statTypes[id].load() : StatType::kCounter;
+}
+
+FrameStats::Summary FrameStats::GetSummary(uint32_t id) {
+    Summary summary;
+    if (id >= GetStatCount() || sampleCounts[id] == 0) {
+        return summary;
+    }
+    uint32_t sampleCount = sampleCounts[id];
+    summary.sampleCount = sampleCount;
+    summary.last = history[id][LastIndex()];
+
+    // 新しいものからsampleCount個を取り出す
+    std::array<float, kWindowSize> samples;
+    double sum = 0.0;
+    for (uint32_t i = 0; i < sampleCount; ++i) {
+        samples[i] = history[id][(historyIndex + kWindowSize - 1 - i) % kWindowSize];
+        sum += samples[i];
+    }
+    auto begin = samples.begin();
+    auto end = samples.begin() + sampleCount;
+    auto [minIt, maxIt] = std::minmax_element(begin, end);
+    summary.min = *minIt;
+    summary.max = *maxIt;
+    summary.average = sum / static_cast<double>(sampleCount);
+    auto p95 = begin + (sampleCount - 1) * 95 / 100;
+    std::nth_element(begin, p95, end);
+    summary.p95 = *p95;
+    // p99はp95より後ろにあるので残りの範囲だけ並べればよい
+    auto p99 = begin + (sampleCount - 1) * 99 / 100;
+    std::nth_element(p95, p99, end);
+    summary.p99 = *p99;
+    return summary;
+}
+
+bool FrameStats::DumpCSV(const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file) {
+        return false;
+    }
+    file << "name,type,min,avg,p95,p99,max,last,samples\n";
+    uint32_t count = GetStatCount();
+    for (uint32_t i = 0; i < count; ++i) {
+        Summary summary = GetSummary(i);
+        file << statNames[i].load() << ',' << (statTypes[i] == StatType::kCounter ? "counter" : "gauge") << ','
+             << summary.min << ',' << summary.average << ',' << summary.p95 << ',' << summary.p99 << ','
+             << summary.max << ',' << summary.last << ',' << summary.sampleCount << '\n';
+    }
+    return true;
+}
+
+bool FrameStats::DumpHistoryCSV(const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file) {
+        return false;
+    }
+    uint32_t count = GetStatCount();
+    uint32_t frameCount = 0;
+    file << "frame";
+    for (uint32_t i = 0; i < count; ++i) {
+        file << ',' << statNames[i].load();
+        frameCount = (std::max)(frameCount, sampleCounts[i]);
+    }
+    file << '\n';
+
+    // 古いフレームから順に書く（途中で登録された統計値はそれ以前を空欄にする）
+    for (uint32_t frame = 0; frame < frameCount; ++frame) {
+        uint32_t age = frameCount - 1 - frame;
+        uint32_t index = (historyIndex + kWindowSize - 1 - age) % kWindowSize;
+        file << frame;
+        for (uint32_t i = 0; i < count; ++i) {
+            file << ',';
+            if (age < sampleCounts[i]) {
+                file << history[i][index];
+            }
+        }
+        file << '\n';
+    }
+    return true;
+}
+
+void FrameStats::ImGui() {
+#ifdef _DEBUG
+    if (ImGui::CollapsingHeader("カウンタ")) {
+        ImGui::Checkbox("画面に表示", &isShowOverlay);
+        ImGui::SameLine();
+        if (ImGui::Button("CSV出力")) {
+            DumpCSV("frame_stats.csv");
+            DumpHistoryCSV("frame_stats_history.csv");
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("リセット")) {
+            Reset();
+        }
+        ImGui::Text("直近 %u フレーム", kWindowSize);
+
+        ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+        if (ImGui::BeginTable("FrameStatsTable", 8, flags)) {
+            ImGui::TableSetupColumn("表示");
+            ImGui::TableSetupColumn("名前");
+            ImGui::TableSetupColumn("現在");
+            ImGui::TableSetupColumn("最小");
+            ImGui::TableSetupColumn("平均");
+            ImGui::TableSetupColumn("p95");
+            ImGui::TableSetupColumn("p99");
+            ImGui::TableSetupColumn("最大");
+            ImGui::TableHeadersRow();
+
+            uint32_t count = GetStatCount();
+            for (uint32_t i = 0; i < count; ++i) {
+                Summary summary = GetSummary(i);
+                ImGui::PushID(static_cast<int>(i));
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Checkbox("##overlay", &isShowInOverlay[i]);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(statNames[i].load());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", summary.last);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", summary.min);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", summary.average);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", summary.p95);
+                ImGui::TableNextColumn();
+                // 平均から大きく外れるフレームがあるものは目立たせる
+                if (summary.p99 > summary.average * 2.0 && summary.p99 > 0.0) {
+                    ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%.1f", summary.p99);
+                } else {
+                    ImGui::Text("%.1f", summary.p99);
+                }
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", summary.max);
+                ImGui::PopID();
+            }
+            ImGui::EndTable();
+        }
+    }
+#endif // _DEBUG
+}
+
+void FrameStats::ImGuiOverlay() {
+#ifdef _DEBUG
+    if (!isShowOverlay) {
+        return;
+    }
+    // メインビューポートの右上に固定する
+    const ImGuiViewport *viewport = ImGui::GetMainViewport();
+    ImVec2 position(viewport->WorkPos.x + viewport->WorkSize.x - 10.0f, viewport->WorkPos.y + 10.0f);
+    ImGui::SetNextWindowPos(position, ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowViewport(viewport->ID);
+    ImGui::SetNextWindowBgAlpha(0.5f);
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+                             ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing |
+                             ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoInputs;
+    if (ImGui::Begin("FrameStatsOverlay", nullptr, flags)) {
+        uint32_t count = GetStatCount();
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!isShowInOverlay[i]) {
+                continue;
+            }
+            Summary summary = GetSummary(i);
+            ImGui::Text("%-20s %9.1f  p99 %9.1f", statNames[i].load(), summary.last, summary.p99);
+        }
+    }
+    ImGui::End();
+#endif // _DEBUG
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// 統計値の種類
+/// </summary>
+enum class StatType {
+    kCounter, // フレーム中に足し込み、フレームの終わりに0に戻す（描画コール数など）
+    kGauge,   // 最後に設定した値をそのまま使う（生存中のパーティクル数など）
+};
+
+/// <summary>
+/// フレームごとの統計値（カウンタ・ゲージ）の登録先
+/// 各処理がSTAT_COUNTER_ADD / STAT_GAUGE_SETで値を公開し、
+/// 直近kWindowSizeフレーム分の最小・平均・p95・p99・最大をImGuiやCSVで確認できる
+/// </summary>
+class FrameStats {
+  public:
+    // 登録できる統計値の数
+    static constexpr uint32_t kMaxStats = 64;
+    // 集計に使うフレーム数（60FPSで10秒）
+    static constexpr uint32_t kWindowSize = 600;
+    // 登録できなかったときの番号
+    static constexpr uint32_t kInvalidId = UINT32_MAX;
+
+    // 直近のフレームの集計
+    struct Summary {
+        double min = 0.0;
+        double average = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        double last = 0.0; // 直前のフレームの値
+        uint32_t sampleCount = 0;
+    };
+
+    /// <summary>
+    /// 統計値の登録（同じ名前なら同じ番号を返す。名前は文字列リテラルなど寿命の長いものを渡す）
+    /// </summary>
+    static uint32_t Register(const char *name, StatType type);
+
+    /// <summary>
+    /// カウンタに足し込む・ゲージを設定する（どのスレッドからでも呼べる）
+    /// </summary>
+    static void Add(uint32_t id, double value);
+    static void Set(uint32_t id, double value);
+
+    /// <summary>
+    /// フレームの終了（今の値を履歴に積み、カウンタを0に戻す。メインスレッドから呼ぶ）
+    /// </summary>
+    static void EndFrame();
+
+    /// <summary>
+    /// 履歴の破棄
+    /// </summary>
+    static void Reset();
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    static uint32_t GetStatCount();
+    static const char *GetName(uint32_t id);
+    static StatType GetType(uint32_t id);
+    static Summary GetSummary(uint32_t id);
+
+    /// <summary>
+    /// CSVへの書き出し
+    /// DumpCSVは統計値ごとの集計、DumpHistoryCSVはフレームごとの値（1列が1つの統計値）
+    /// </summary>
+    static bool DumpCSV(const std::string &filePath);
+    static bool DumpHistoryCSV(const std::string &filePath);
+
+    /// <summary>
+    /// 集計の表と、画面の隅に常に出す簡易表示
+    /// </summary>
+    static void ImGui();
+    static void ImGuiOverlay();
+};
+
+#define FRAME_STATS_CONCAT_INNER(a, b) a##b
+#define FRAME_STATS_CONCAT(a, b) FRAME_STATS_CONCAT_INNER(a, b)
+
+// STAT_COUNTER_ADD("DrawCalls", 1); のように使う（登録は最初の1回だけ）
+#define STAT_COUNTER_ADD(name, value)                                                                                   \
+    do {                                                                                                                \
+        static const uint32_t FRAME_STATS_CONCAT(statId_, __LINE__) = FrameStats::Register(name, StatType::kCounter);   \
+        FrameStats::Add(FRAME_STATS_CONCAT(statId_, __LINE__), static_cast<double>(value));                            \
+    } while (0)
+
+// STAT_GAUGE_SET("ActiveParticles", count); のように使う
+#define STAT_GAUGE_SET(name, value)                                                                                     \
+    do {                                                                                                                \
+        static const uint32_t FRAME_STATS_CONCAT(statId_, __LINE__) = FrameStats::Register(name, StatType::kGauge);     \
+        FrameStats::Set(FRAME_STATS_CONCAT(statId_, __LINE__), static_cast<double>(value));                            \
+    } while (0)
@@ -50,6 +50,7 @@ void Input::Init(HINSTANCE hInstance, HWND hWnd) {
 			joystick.type_ = PadType::XInput;
 			joystick.state_ = state;
 			joystick.statePre_ = state;
+			joystick.fixedStepStatePre_ = state;
 			joystick.deadZoneL_ = XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE;
 			joystick.deadZoneR_ = XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE;
 			joysticks_.push_back(joystick);
@@ -85,6 +86,20 @@ void Input::Update() {
 	}
 }
 
+void Input::BeginFixedStep() {
+	isInFixedStep_ = true;
+	mouse_->BeginFixedStep();
+}
+
+void Input::EndFixedStep() {
+	isInFixedStep_ = false;
+	fixedStepKeyPre_ = key_;
+	mouse_->EndFixedStep();
+	for (auto& joystick : joysticks_) {
+		joystick.fixedStepStatePre_ = joystick.state_;
+	}
+}
+
 //キーボード*************************************************************
 bool Input::PushKey(BYTE keyNumber)const {
 	return (key_[keyNumber] & 0x80);
@@ -92,7 +107,8 @@ bool Input::PushKey(BYTE keyNumber)const {
 
 
 bool Input::TriggerKey(BYTE keyNumber)const {
-	return (key_[keyNumber] & 0x80) && !(keyPre_[keyNumber] & 0x80);
+	const std::array<BYTE, 256>& keyPre = isInFixedStep_ ? fixedStepKeyPre_ : keyPre_;
+	return (key_[keyNumber] & 0x80) && !(keyPre[keyNumber] & 0x80);
 }
 
 
@@ -102,7 +118,8 @@ bool Input::ReleaseKey(BYTE keyNumber)const {
 
 
 bool Input::ReleaseMomentKey(BYTE keyNumber)const {
-	return !(key_[keyNumber] & 0x80) && (keyPre_[keyNumber] & 0x80);
+	const std::array<BYTE, 256>& keyPre = isInFixedStep_ ? fixedStepKeyPre_ : keyPre_;
+	return !(key_[keyNumber] & 0x80) && (keyPre[keyNumber] & 0x80);
 }
 
 //ゲームパッド*******************************************************************
@@ -137,18 +154,19 @@ template<typename T>bool Input::GetJoystickStatePrevious(int32_t stickNo, T& out
 		return false;
 	}
 	const Joystick& joystick = joysticks_[stickNo];
+	const State& statePre = isInFixedStep_ ? joystick.fixedStepStatePre_ : joystick.statePre_;
 	if (joystick.type_ == PadType::DirectInput) {
 		if constexpr (std::is_same<T, DIJOYSTATE2>::value) {
-			if (std::holds_alternative<T>(joystick.statePre_)) {
-				out = std::get<T>(joystick.statePre_);
+			if (std::holds_alternative<T>(statePre)) {
+				out = std::get<T>(statePre);
 				return true;
 			}
 		}
 	}
 	else if (joystick.type_ == PadType::XInput) {
 		if constexpr (std::is_same<T, XINPUT_STATE>::value) {
-			if (std::holds_alternative<T>(joystick.statePre_)) {
-				out = std::get<T>(joystick.statePre_);
+			if (std::holds_alternative<T>(statePre)) {
+				out = std::get<T>(statePre);
 				return true;
 			}
 		}
@@ -33,6 +33,8 @@ class Input {
         PadType type_;
         State state_;
         State statePre_;
+        // 固定ステップ用の前回の状態（前のステップの終了時のもの）
+        State fixedStepStatePre_;
     };
 
   private:
@@ -40,6 +42,9 @@ class Input {
     Microsoft::WRL::ComPtr<IDirectInputDevice8> keyboard_ = nullptr;
     std::array<BYTE, 256> key_;
     std::array<BYTE, 256> keyPre_;
+    // 固定ステップ用の前回のキー状態（前のステップの終了時のもの）
+    std::array<BYTE, 256> fixedStepKeyPre_{};
+    bool isInFixedStep_ = false;
     std::vector<Joystick> joysticks_;
     // マウス
     static std::unique_ptr<Mouse> mouse_;
@@ -50,6 +55,13 @@ class Input {
     void Init(HINSTANCE hInstance, HWND hwnd);
     void Update();
 
+    /// <summary>
+    /// 固定ステップの更新開始・終了
+    /// 固定ステップはフレームに0回や複数回走るので、その間のトリガー判定は前のステップの終了時と比べる
+    /// </summary>
+    void BeginFixedStep();
+    void EndFixedStep();
+
     /// <summary>
     /// 押し込んでいるか
     /// </summary>
@@ -88,7 +100,7 @@ class Input {
     bool GetJoystickState(int32_t stickNo, T &out) const;
 
     /// <summary>
-    /// 前回のジョイスティック状態を取得する
+    /// 前回のジョイスティック状態を取得する（固定ステップの更新中は前のステップの終了時の状態）
     /// </summary>
     /// <param name="stickNo">ジョイスティック番号</param>
     /// <param name="out">前回のジョイスティック状態</param>
@@ -125,7 +137,7 @@ class Input {
     static bool IsPressMouse(int32_t mouseNumber);
 
     /// <summary>
-    /// マウスのトリガーをチェック。押した瞬間だけtrueになる
+    /// マウスのトリガーをチェック。押した瞬間だけtrueになる（固定ステップの更新中は前のステップと比べる）
     /// </summary>
     /// <param name="buttonNumber">マウスボタン番号(0:左,1:右,2:中,3~7:拡張マウスボタン)</param>
     /// <returns>トリガーか</returns>
@@ -1,4 +1,5 @@
 #include"Mouse.h"
+#include <algorithm>
 #include <cmath>
 #include"myMath.h"
 #include<assert.h>
@@ -25,6 +26,15 @@ void Mouse::Update() {
     devMouse_->GetDeviceState(sizeof(mouse_), &mouse_);
 }
 
+void Mouse::BeginFixedStep() {
+    isInFixedStep_ = true;
+}
+
+void Mouse::EndFixedStep() {
+    isInFixedStep_ = false;
+    std::copy(std::begin(mouse_.rgbButtons), std::end(mouse_.rgbButtons), fixedStepButtonsPre_.begin());
+}
+
 //マウス****************************************************************
 
 bool Mouse::IsPressMouse(int32_t buttonNumber)const {
@@ -32,7 +42,8 @@ bool Mouse::IsPressMouse(int32_t buttonNumber)const {
 }
 
 bool Mouse::IsTriggerMouse(int32_t buttonNumber)const {
-    return (mouse_.rgbButtons[buttonNumber] & 0x80) && !(mousePre_.rgbButtons[buttonNumber] & 0x80);
+    BYTE buttonPre = isInFixedStep_ ? fixedStepButtonsPre_[buttonNumber] : mousePre_.rgbButtons[buttonNumber];
+    return (mouse_.rgbButtons[buttonNumber] & 0x80) && !(buttonPre & 0x80);
 }
 
 MouseMove Mouse::GetMouseMove() {
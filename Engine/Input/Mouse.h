@@ -1,6 +1,7 @@
 #pragma once
 #include "type/Vector2.h"
 #include <Camera/ViewProjection/ViewProjection.h>
+#include <array>
 #include <dinput.h>
 #include <variant>
 #include <wrl.h>
@@ -17,6 +18,9 @@ class Mouse {
     Microsoft::WRL::ComPtr<IDirectInputDevice8> devMouse_;
     DIMOUSESTATE2 mouse_;
     DIMOUSESTATE2 mousePre_;
+    // 固定ステップ用の前回のボタン状態（前のステップの終了時のもの）
+    std::array<BYTE, 8> fixedStepButtonsPre_{};
+    bool isInFixedStep_ = false;
     Vector2 mousePosition_;
     HWND hWnd_;
 
@@ -25,6 +29,12 @@ class Mouse {
     void Init(Microsoft::WRL::ComPtr<IDirectInput8> directInput, HWND hWnd);
     void Update();
 
+    /// <summary>
+    /// 固定ステップの更新開始・終了（Inputから呼ばれる）
+    /// </summary>
+    void BeginFixedStep();
+    void EndFixedStep();
+
     /// <summary>
     /// マウスの押下をチェック
     /// </summary>
@@ -0,0 +1,112 @@
+#pragma once
+#include "Simd/MathKernels.h"
+#include <cstdint>
+
+/// <summary>
+/// 4系列並列の xoshiro128+ による軽い乱数
+/// 4つの系列をまとめて1回で進めるので、SSE2では1命令列で4つの値が作れる
+/// 同じシードなら命令セットによらず同じ値の列になる（リプレイや計測の再現用）
+/// std::uniform_real_distributionと違い、値を取り出すたびにオブジェクトを作らない
+/// </summary>
+class FastRandom {
+  public:
+    explicit FastRandom(uint64_t seed = 0) { Seed(seed); }
+
+    /// <summary>
+    /// シードの設定（系列ごとにsplitmix64で状態を作る）
+    /// </summary>
+    void Seed(uint64_t seed) {
+        uint64_t x = seed;
+        for (int lane = 0; lane < kLaneCount; ++lane) {
+            for (int word = 0; word < 4; word += 2) {
+                uint64_t value = SplitMix64(x);
+                state_[word][lane] = static_cast<uint32_t>(value);
+                state_[word + 1][lane] = static_cast<uint32_t>(value >> 32);
+            }
+            // 状態がすべて0だと同じ値しか出なくなる
+            if ((state_[0][lane] | state_[1][lane] | state_[2][lane] | state_[3][lane]) == 0) {
+                state_[0][lane] = 1;
+            }
+        }
+        bufferIndex_ = kLaneCount;
+    }
+
+    /// <summary>
+    /// [0, 1) の値を4つまとめて作る
+    /// </summary>
+    void NextFloat4(float *out) {
+#if defined(MATH_SIMD_SSE)
+        __m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i *>(state_[0]));
+        __m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i *>(state_[1]));
+        __m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i *>(state_[2]));
+        __m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i *>(state_[3]));
+        __m128i result = _mm_add_epi32(s0, s3);
+        __m128i t = _mm_slli_epi32(s1, 9);
+        s2 = _mm_xor_si128(s2, s0);
+        s3 = _mm_xor_si128(s3, s1);
+        s1 = _mm_xor_si128(s1, s2);
+        s0 = _mm_xor_si128(s0, s3);
+        s2 = _mm_xor_si128(s2, t);
+        s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+        _mm_store_si128(reinterpret_cast<__m128i *>(state_[0]), s0);
+        _mm_store_si128(reinterpret_cast<__m128i *>(state_[1]), s1);
+        _mm_store_si128(reinterpret_cast<__m128i *>(state_[2]), s2);
+        _mm_store_si128(reinterpret_cast<__m128i *>(state_[3]), s3);
+        // 上位24bitをfloatの仮数にする
+        __m128 value = _mm_cvtepi32_ps(_mm_srli_epi32(result, 8));
+        _mm_storeu_ps(out, _mm_mul_ps(value, _mm_set1_ps(kToFloat)));
+#else
+        for (int lane = 0; lane < kLaneCount; ++lane) {
+            uint32_t result = state_[0][lane] + state_[3][lane];
+            uint32_t t = state_[1][lane] << 9;
+            state_[2][lane] ^= state_[0][lane];
+            state_[3][lane] ^= state_[1][lane];
+            state_[1][lane] ^= state_[2][lane];
+            state_[0][lane] ^= state_[3][lane];
+            state_[2][lane] ^= t;
+            state_[3][lane] = (state_[3][lane] << 11) | (state_[3][lane] >> 21);
+            out[lane] = static_cast<float>(result >> 8) * kToFloat;
+        }
+#endif
+    }
+
+    /// <summary>
+    /// [0, 1) の値を1つ（4つまとめて作ったものを順に返す）
+    /// </summary>
+    float NextFloat() {
+        if (bufferIndex_ >= kLaneCount) {
+            NextFloat4(buffer_);
+            bufferIndex_ = 0;
+        }
+        return buffer_[bufferIndex_++];
+    }
+
+    /// <summary>
+    /// float型のランダムな値を返す（minからmaxまで）
+    /// </summary>
+    float Range(float min, float max) { return min + (max - min) * NextFloat(); }
+
+    /// <summary>
+    /// int型のランダムな値を返す（minからmaxまで。maxも含む）
+    /// </summary>
+    int Range(int min, int max) {
+        int value = min + static_cast<int>(NextFloat() * static_cast<float>(max - min + 1));
+        return value > max ? max : value;
+    }
+
+  private:
+    static constexpr int kLaneCount = 4;
+    static constexpr float kToFloat = 1.0f / 16777216.0f;
+
+    static uint64_t SplitMix64(uint64_t &x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // [何番目の状態][系列]（系列方向に並べて4つまとめて読み書きする）
+    alignas(16) uint32_t state_[4][kLaneCount];
+    alignas(16) float buffer_[kLaneCount] = {};
+    int bufferIndex_ = kLaneCount;
+};
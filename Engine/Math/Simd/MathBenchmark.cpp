@@ -0,0 +1,194 @@
+#include "MathBenchmark.h"
+#include "MathKernels.h"
+#include "myMath.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+namespace {
+
+// 計測用の入力
+struct Sample {
+    float a[16];
+    float b[16];
+    float q0[4];
+    float q1[4];
+    float t;
+    Vector3 scale;
+    Vector3 rotate;
+    Vector3 translate;
+    Matrix4x4 affineA;
+    Matrix4x4 affineB;
+};
+
+// 入力を循環させる数（キャッシュに収まる程度）
+constexpr size_t kSamplePoolSize = 1024;
+
+// 最適化で計算が消されないよう結果を書き込む先
+volatile float benchmarkSink = 0.0f;
+
+std::vector<Sample> MakeSamples(size_t count, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> value(-2.0f, 2.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<Sample> samples(count);
+    for (auto &sample : samples) {
+        for (int i = 0; i < 16; ++i) {
+            sample.a[i] = value(random);
+            sample.b[i] = value(random);
+        }
+        // 逆行列が極端にならないよう対角成分を大きくする
+        for (int i = 0; i < 4; ++i) {
+            float &diagonal = sample.a[i * 5];
+            diagonal += diagonal >= 0.0f ? 4.0f : -4.0f;
+        }
+        for (int i = 0; i < 4; ++i) {
+            sample.q0[i] = value(random);
+            sample.q1[i] = value(random);
+        }
+        MathKernels::Scalar::QuaternionNormalize(sample.q0, sample.q0);
+        MathKernels::Scalar::QuaternionNormalize(sample.q1, sample.q1);
+        sample.t = unit(random);
+        sample.scale = {0.5f + unit(random), 0.5f + unit(random), 0.5f + unit(random)};
+        sample.rotate = {value(random), value(random), value(random)};
+        sample.translate = {value(random) * 10.0f, value(random) * 10.0f, value(random) * 10.0f};
+        sample.affineA = MakeAffineMatrix(sample.scale, sample.rotate, sample.translate);
+        sample.affineB = MakeAffineMatrix(sample.scale * 0.5f, sample.rotate * -1.0f, sample.translate * 0.5f);
+    }
+    return samples;
+}
+
+// 1回あたりの時間(ns)
+template <typename Function>
+double MeasureTime(const std::vector<Sample> &samples, uint32_t iterations, int outputCount, Function function) {
+    float output[16] = {};
+    float sink = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        function(samples[i % samples.size()], output);
+        sink += output[i % outputCount];
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    benchmarkSink = sink;
+
+    return elapsed.count() / iterations;
+}
+
+template <typename BaselineFunction, typename OptimizedFunction>
+MathBenchmarkResult Measure(const std::string &name, int outputCount, const std::vector<Sample> &timeSamples, uint32_t iterations,
+                            BaselineFunction baseline, OptimizedFunction optimized) {
+    MathBenchmarkResult result;
+    result.name = name;
+    result.baselineNs = MeasureTime(timeSamples, iterations, outputCount, baseline);
+    result.optimizedNs = MeasureTime(timeSamples, iterations, outputCount, optimized);
+    result.speedup = result.optimizedNs > 0.0 ? result.baselineNs / result.optimizedNs : 0.0;
+    return result;
+}
+
+} // namespace
+
+std::vector<MathBenchmarkResult> MathBenchmark::Run(uint32_t iterations) {
+    using namespace MathKernels;
+
+    std::vector<Sample> timeSamples = MakeSamples(kSamplePoolSize, 2);
+
+    std::vector<MathBenchmarkResult> results;
+    results.push_back(Measure("MultiplyMatrix", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::MultiplyMatrix(s.a, s.b, out); },
+                              [](const Sample &s, float *out) { MultiplyMatrix(s.a, s.b, out); }));
+    results.push_back(Measure("TransformPoint", 4, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::TransformPoint(s.b, s.a, out); },
+                              [](const Sample &s, float *out) { TransformPoint(s.b, s.a, out); }));
+    results.push_back(Measure("TransformVector", 4, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::TransformVector(s.b, s.a, out); },
+                              [](const Sample &s, float *out) { TransformVector(s.b, s.a, out); }));
+    results.push_back(Measure("TransformNormal", 3, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::TransformNormal(s.b, s.a, out); },
+                              [](const Sample &s, float *out) { TransformNormal(s.b, s.a, out); }));
+    results.push_back(Measure("Transpose", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::Transpose(s.a, out); },
+                              [](const Sample &s, float *out) { Transpose(s.a, out); }));
+    results.push_back(Measure("Inverse", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::Inverse(s.a, out); },
+                              [](const Sample &s, float *out) { Inverse(s.a, out); }));
+    results.push_back(Measure("QuaternionMultiply", 4, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::QuaternionMultiply(s.q0, s.q1, out); },
+                              [](const Sample &s, float *out) { QuaternionMultiply(s.q0, s.q1, out); }));
+    results.push_back(Measure("QuaternionSlerp", 4, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::QuaternionSlerp(s.q0, s.q1, s.t, out); },
+                              [](const Sample &s, float *out) { QuaternionSlerp(s.q0, s.q1, s.t, out); }));
+    results.push_back(Measure("QuaternionToMatrix", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::QuaternionToMatrix(s.q0, out, false); },
+                              [](const Sample &s, float *out) { QuaternionToMatrix(s.q0, out, false); }));
+    results.push_back(Measure("QuaternionToBoneMatrix", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) { Scalar::QuaternionToMatrix(s.q0, out, true); },
+                              [](const Sample &s, float *out) { QuaternionToMatrix(s.q0, out, true); }));
+
+    // アフィン行列：4x4行列積の連鎖 と 直接計算
+    results.push_back(Measure("MakeAffineMatrix(Euler)", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) {
+                                  Matrix4x4 rotateMatrix = MakeRotateXMatrix(s.rotate.x) * MakeRotateYMatrix(s.rotate.y) * MakeRotateZMatrix(s.rotate.z);
+                                  Matrix4x4 result = MakeScaleMatrix(s.scale) * rotateMatrix * MakeTranslateMatrix(s.translate);
+                                  std::memcpy(out, &result, sizeof(result));
+                              },
+                              [](const Sample &s, float *out) {
+                                  Matrix4x4 result = MakeAffineMatrix(s.scale, s.rotate, s.translate);
+                                  std::memcpy(out, &result, sizeof(result));
+                              }));
+    results.push_back(Measure("MakeAffineMatrix(Quaternion)", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) {
+                                  Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                                  Matrix4x4 result = MakeScaleMatrix(s.scale) * QuaternionToMatrix4x4(rotate) * MakeTranslateMatrix(s.translate);
+                                  std::memcpy(out, &result, sizeof(result));
+                              },
+                              [](const Sample &s, float *out) {
+                                  Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                                  Matrix4x4 result = MakeAffineMatrix(s.scale, rotate, s.translate);
+                                  std::memcpy(out, &result, sizeof(result));
+                              }));
+    results.push_back(Measure("MakeBoneMatrix", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) {
+                                  Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                                  Matrix4x4 result = MakeScaleMatrix(s.scale) * QuaternionToBoneMatrix(rotate) * MakeTranslateMatrix(s.translate);
+                                  std::memcpy(out, &result, sizeof(result));
+                              },
+                              [](const Sample &s, float *out) {
+                                  Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                                  Matrix4x4 result = MakeBoneMatrix(s.scale, rotate, s.translate);
+                                  std::memcpy(out, &result, sizeof(result));
+                              }));
+    results.push_back(Measure("MultiplyAffine", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) {
+                                  Matrix4x4 result = s.affineA * s.affineB;
+                                  std::memcpy(out, &result, sizeof(result));
+                              },
+                              [](const Sample &s, float *out) {
+                                  Matrix4x4 result = MultiplyAffine(s.affineA, s.affineB);
+                                  std::memcpy(out, &result, sizeof(result));
+                              }));
+    results.push_back(Measure("InverseAffine", 16, timeSamples, iterations,
+                              [](const Sample &s, float *out) {
+                                  Matrix4x4 result = Inverse(s.affineA);
+                                  std::memcpy(out, &result, sizeof(result));
+                              },
+                              [](const Sample &s, float *out) {
+                                  Matrix4x4 result = InverseAffine(s.affineA);
+                                  std::memcpy(out, &result, sizeof(result));
+                              }));
+    return results;
+}
+
+void MathBenchmark::WriteReportCSV(const std::vector<MathBenchmarkResult> &results, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "instruction_set," << MathKernels::GetInstructionSetName() << "\n";
+    file << "name,baseline_ns,optimized_ns,speedup\n";
+    for (const auto &result : results) {
+        file << result.name << "," << result.baselineNs << "," << result.optimizedNs << "," << result.speedup << "\n";
+    }
+}
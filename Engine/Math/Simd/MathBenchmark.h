@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 演算1種類分の計測結果
+/// </summary>
+struct MathBenchmarkResult {
+    std::string name;         // 演算名
+    double baselineNs = 0.0;  // 基準実装（スカラー版・行列積の連鎖）の1回あたりの時間(ns)
+    double optimizedNs = 0.0; // 最適化版（SIMD版・直接計算）の1回あたりの時間(ns)
+    double speedup = 0.0;     // baselineNs / optimizedNs
+};
+
+/// <summary>
+/// 行列・クォータニオン演算の速度比較
+/// SIMD版とスカラー版、アフィン行列の直接計算と4x4行列積の連鎖を比較する（結果の一致はmyMathTestで確かめる）
+/// </summary>
+class MathBenchmark {
+  public:
+    /// <summary>
+    /// すべての演算を計測する
+    /// </summary>
+    /// <param name="iterations">速度計測の繰り返し回数</param>
+    static std::vector<MathBenchmarkResult> Run(uint32_t iterations = 2000000);
+
+    /// <summary>
+    /// 結果をCSVに書き出す
+    /// </summary>
+    static void WriteReportCSV(const std::vector<MathBenchmarkResult> &results, const std::string &filePath);
+};
@@ -0,0 +1,698 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+// 使用する命令セットをコンパイル時に選択する
+// MATH_FORCE_SCALAR を定義するとスカラー版に固定される
+#if !defined(MATH_FORCE_SCALAR) && (defined(_M_X64) || defined(__SSE2__))
+#define MATH_SIMD_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX2__) || defined(__FMA__)
+#include <immintrin.h>
+#define MATH_SIMD_FMA 1
+#endif
+#elif !defined(MATH_FORCE_SCALAR) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#define MATH_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define MATH_SIMD_SCALAR 1
+#endif
+
+/// <summary>
+/// 行列・クォータニオン演算の内部実装
+/// 行列は行優先の float[16]（行ベクトル × 行列）、クォータニオンは (x, y, z, w) の float[4]
+/// 出力先は入力と同じアドレスでもよい
+/// </summary>
+namespace MathKernels {
+
+/// <summary>
+/// スカラー版（SIMDが使えない環境のフォールバック兼、一致確認の基準）
+/// </summary>
+namespace Scalar {
+
+inline void MultiplyMatrix(const float *a, const float *b, float *out) {
+    float result[16];
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            result[i * 4 + j] = a[i * 4 + 0] * b[0 * 4 + j] + a[i * 4 + 1] * b[1 * 4 + j] + a[i * 4 + 2] * b[2 * 4 + j] + a[i * 4 + 3] * b[3 * 4 + j];
+        }
+    }
+    for (int i = 0; i < 16; ++i) {
+        out[i] = result[i];
+    }
+}
+
+// アフィン行列同士の積（両方の4列目が (0, 0, 0, 1) であることが前提）
+inline void MultiplyAffine(const float *a, const float *b, float *out) {
+    float result[16];
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            result[i * 4 + j] = a[i * 4 + 0] * b[0 * 4 + j] + a[i * 4 + 1] * b[1 * 4 + j] + a[i * 4 + 2] * b[2 * 4 + j];
+        }
+    }
+    for (int j = 0; j < 4; ++j) {
+        result[12 + j] += b[12 + j];
+    }
+    for (int i = 0; i < 16; ++i) {
+        out[i] = result[i];
+    }
+}
+
+// 点の変換（w除算前の (x, y, z, w) を返す）
+inline void TransformPoint(const float *v, const float *m, float *out) {
+    float x = v[0], y = v[1], z = v[2];
+    out[0] = x * m[0] + y * m[4] + z * m[8] + m[12];
+    out[1] = x * m[1] + y * m[5] + z * m[9] + m[13];
+    out[2] = x * m[2] + y * m[6] + z * m[10] + m[14];
+    out[3] = x * m[3] + y * m[7] + z * m[11] + m[15];
+}
+
+// 4要素ベクトルの変換
+inline void TransformVector(const float *v, const float *m, float *out) {
+    float x = v[0], y = v[1], z = v[2], w = v[3];
+    out[0] = x * m[0] + y * m[4] + z * m[8] + w * m[12];
+    out[1] = x * m[1] + y * m[5] + z * m[9] + w * m[13];
+    out[2] = x * m[2] + y * m[6] + z * m[10] + w * m[14];
+    out[3] = x * m[3] + y * m[7] + z * m[11] + w * m[15];
+}
+
+// 方向ベクトルの変換（平行移動なし）
+inline void TransformNormal(const float *v, const float *m, float *out) {
+    float x = v[0], y = v[1], z = v[2];
+    out[0] = x * m[0] + y * m[4] + z * m[8];
+    out[1] = x * m[1] + y * m[5] + z * m[9];
+    out[2] = x * m[2] + y * m[6] + z * m[10];
+}
+
+inline void Transpose(const float *m, float *out) {
+    float result[16];
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            result[i * 4 + j] = m[j * 4 + i];
+        }
+    }
+    for (int i = 0; i < 16; ++i) {
+        out[i] = result[i];
+    }
+}
+
+// 2x2の小行列式を共有し、除算は行列式の逆数1回だけにした逆行列
+inline void Inverse(const float *m, float *out) {
+    float s0 = m[0] * m[5] - m[4] * m[1];
+    float s1 = m[0] * m[6] - m[4] * m[2];
+    float s2 = m[0] * m[7] - m[4] * m[3];
+    float s3 = m[1] * m[6] - m[5] * m[2];
+    float s4 = m[1] * m[7] - m[5] * m[3];
+    float s5 = m[2] * m[7] - m[6] * m[3];
+
+    float c5 = m[10] * m[15] - m[14] * m[11];
+    float c4 = m[9] * m[15] - m[13] * m[11];
+    float c3 = m[9] * m[14] - m[13] * m[10];
+    float c2 = m[8] * m[15] - m[12] * m[11];
+    float c1 = m[8] * m[14] - m[12] * m[10];
+    float c0 = m[8] * m[13] - m[12] * m[9];
+
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    float invDet = 1.0f / det;
+
+    float result[16];
+    result[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+    result[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+    result[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+    result[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+    result[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+    result[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+    result[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+    result[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+    result[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+    result[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+    result[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+    result[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+    result[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+    result[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+    result[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+    result[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+
+    for (int i = 0; i < 16; ++i) {
+        out[i] = result[i];
+    }
+}
+
+inline void QuaternionMultiply(const float *a, const float *b, float *out) {
+    float x = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+    float y = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+    float z = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+    float w = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+    out[0] = x;
+    out[1] = y;
+    out[2] = z;
+    out[3] = w;
+}
+
+// 長さが0に近い場合は単位クォータニオンにする
+inline void QuaternionNormalize(const float *q, float *out) {
+    float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if (length < 0.000001f) {
+        out[0] = 0.0f;
+        out[1] = 0.0f;
+        out[2] = 0.0f;
+        out[3] = 1.0f;
+        return;
+    }
+    out[0] = q[0] / length;
+    out[1] = q[1] / length;
+    out[2] = q[2] / length;
+    out[3] = q[3] / length;
+}
+
+// 補間係数の計算（短い経路を選ぶ、角度が小さい場合は線形補間）
+// 線形補間にした場合は true を返す
+inline bool SlerpFactors(const float *q0, const float *q1, float t, float &s0, float &s1) {
+    float dot = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+    float sign = 1.0f;
+    if (dot < 0.0f) {
+        sign = -1.0f;
+        dot = -dot;
+    }
+
+    const float threshold = 0.9995f;
+    if (dot > threshold) {
+        s0 = (1.0f - t) * sign;
+        s1 = t;
+        return true;
+    }
+
+    float theta0 = std::acos(dot);
+    float theta = theta0 * t;
+    float sinTheta = std::sin(theta);
+    float sinTheta0 = std::sin(theta0);
+
+    s0 = (std::cos(theta) - dot * sinTheta / sinTheta0) * sign;
+    s1 = sinTheta / sinTheta0;
+    return false;
+}
+
+inline void QuaternionSlerp(const float *q0, const float *q1, float t, float *out) {
+    float s0, s1;
+    bool isLinear = SlerpFactors(q0, q1, t, s0, s1);
+    float result[4];
+    for (int i = 0; i < 4; ++i) {
+        result[i] = s0 * q0[i] + s1 * q1[i];
+    }
+    if (isLinear) {
+        QuaternionNormalize(result, out);
+        return;
+    }
+    for (int i = 0; i < 4; ++i) {
+        out[i] = result[i];
+    }
+}
+
+// 正規化済みクォータニオンから回転行列を作成
+// isBone が true のときはボーン用（転置した並び）
+inline void QuaternionToMatrix(const float *q, float *out, bool isBone) {
+    float x = q[0], y = q[1], z = q[2], w = q[3];
+    float xx = x * x, yy = y * y, zz = z * z;
+    float xy = x * y, xz = x * z, yz = y * z;
+    float wx = w * x, wy = w * y, wz = w * z;
+
+    float sign = isBone ? 1.0f : -1.0f;
+    out[0] = 1.0f - 2.0f * (yy + zz);
+    out[1] = 2.0f * (xy + sign * wz);
+    out[2] = 2.0f * (xz - sign * wy);
+    out[3] = 0.0f;
+
+    out[4] = 2.0f * (xy - sign * wz);
+    out[5] = 1.0f - 2.0f * (xx + zz);
+    out[6] = 2.0f * (yz + sign * wx);
+    out[7] = 0.0f;
+
+    out[8] = 2.0f * (xz + sign * wy);
+    out[9] = 2.0f * (yz - sign * wx);
+    out[10] = 1.0f - 2.0f * (xx + yy);
+    out[11] = 0.0f;
+
+    out[12] = 0.0f;
+    out[13] = 0.0f;
+    out[14] = 0.0f;
+    out[15] = 1.0f;
+}
+
+// 視錐台とAABBの判定（planesは6枚の(xyz:内向きの法線, w:距離)、boxesは1個ずつ min.xyz, max.xyz）
+// 中心からの距離に、法線方向への箱の広がりを足しても負なら外側
+// visibleには見えるものに1、外側のものに0を書き込み、見える数を返す
+inline size_t CullAABBs(const float *planes, const float *boxes, size_t count, unsigned char *visible) {
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const float *box = boxes + i * 6;
+        float center[3], extent[3];
+        for (int axis = 0; axis < 3; ++axis) {
+            center[axis] = (box[axis] + box[axis + 3]) * 0.5f;
+            extent[axis] = (box[axis + 3] - box[axis]) * 0.5f;
+        }
+        bool isInside = true;
+        for (int p = 0; p < 6 && isInside; ++p) {
+            const float *plane = planes + p * 4;
+            float distance = plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3];
+            float radius = std::fabs(plane[0]) * extent[0] + std::fabs(plane[1]) * extent[1] + std::fabs(plane[2]) * extent[2];
+            isInside = distance + radius >= 0.0f;
+        }
+        visible[i] = isInside ? 1 : 0;
+        visibleCount += isInside ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+} // namespace Scalar
+
+#if defined(MATH_SIMD_SSE)
+
+///--------SSE / AVX2--------
+
+namespace Detail {
+
+// a * b + c
+inline __m128 MultiplyAdd(__m128 a, __m128 b, __m128 c) {
+#if defined(MATH_SIMD_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+template <int X, int Y, int Z, int W>
+inline __m128 Swizzle(__m128 v) {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+template <int X, int Y, int Z, int W>
+inline __m128 Shuffle(__m128 a, __m128 b) {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+// 行ベクトル × 行列
+inline __m128 TransformRow(const float *row, __m128 m0, __m128 m1, __m128 m2, __m128 m3) {
+    __m128 result = _mm_mul_ps(_mm_set1_ps(row[0]), m0);
+    result = MultiplyAdd(_mm_set1_ps(row[1]), m1, result);
+    result = MultiplyAdd(_mm_set1_ps(row[2]), m2, result);
+    return MultiplyAdd(_mm_set1_ps(row[3]), m3, result);
+}
+
+// 行ベクトルの3要素分だけ掛ける（4列目が0の行）
+inline __m128 TransformAffineRow(const float *row, __m128 m0, __m128 m1, __m128 m2) {
+    __m128 result = _mm_mul_ps(_mm_set1_ps(row[0]), m0);
+    result = MultiplyAdd(_mm_set1_ps(row[1]), m1, result);
+    return MultiplyAdd(_mm_set1_ps(row[2]), m2, result);
+}
+
+// 2x2行列 (a00, a01, a10, a11) の積 A * B
+inline __m128 Mat2Mul(__m128 a, __m128 b) {
+    return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+// 余因子行列との積 adj(A) * B
+inline __m128 Mat2AdjMul(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+// 余因子行列との積 A * adj(B)
+inline __m128 Mat2MulAdj(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+inline float Dot4(__m128 a, __m128 b) {
+    __m128 product = _mm_mul_ps(a, b);
+    __m128 sum = _mm_add_ps(product, Swizzle<2, 3, 0, 1>(product));
+    sum = _mm_add_ss(sum, Swizzle<1, 0, 3, 2>(sum));
+    return _mm_cvtss_f32(sum);
+}
+
+} // namespace Detail
+
+inline void MultiplyMatrix(const float *a, const float *b, float *out) {
+    __m128 b0 = _mm_loadu_ps(b + 0);
+    __m128 b1 = _mm_loadu_ps(b + 4);
+    __m128 b2 = _mm_loadu_ps(b + 8);
+    __m128 b3 = _mm_loadu_ps(b + 12);
+
+    __m128 r0 = Detail::TransformRow(a + 0, b0, b1, b2, b3);
+    __m128 r1 = Detail::TransformRow(a + 4, b0, b1, b2, b3);
+    __m128 r2 = Detail::TransformRow(a + 8, b0, b1, b2, b3);
+    __m128 r3 = Detail::TransformRow(a + 12, b0, b1, b2, b3);
+
+    _mm_storeu_ps(out + 0, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, r3);
+}
+
+inline void MultiplyAffine(const float *a, const float *b, float *out) {
+    using namespace Detail;
+
+    __m128 b0 = _mm_loadu_ps(b + 0);
+    __m128 b1 = _mm_loadu_ps(b + 4);
+    __m128 b2 = _mm_loadu_ps(b + 8);
+    __m128 b3 = _mm_loadu_ps(b + 12);
+
+    // aの4列目は (0, 0, 0, 1) なので b3 は平行移動の行にだけ足す
+    __m128 r0 = TransformAffineRow(a + 0, b0, b1, b2);
+    __m128 r1 = TransformAffineRow(a + 4, b0, b1, b2);
+    __m128 r2 = TransformAffineRow(a + 8, b0, b1, b2);
+    __m128 r3 = _mm_add_ps(TransformAffineRow(a + 12, b0, b1, b2), b3);
+
+    _mm_storeu_ps(out + 0, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, r3);
+}
+
+inline void TransformPoint(const float *v, const float *m, float *out) {
+    __m128 result = _mm_mul_ps(_mm_set1_ps(v[0]), _mm_loadu_ps(m + 0));
+    result = Detail::MultiplyAdd(_mm_set1_ps(v[1]), _mm_loadu_ps(m + 4), result);
+    result = Detail::MultiplyAdd(_mm_set1_ps(v[2]), _mm_loadu_ps(m + 8), result);
+    result = _mm_add_ps(result, _mm_loadu_ps(m + 12));
+    _mm_storeu_ps(out, result);
+}
+
+inline void TransformVector(const float *v, const float *m, float *out) {
+    _mm_storeu_ps(out, Detail::TransformRow(v, _mm_loadu_ps(m + 0), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)));
+}
+
+inline void TransformNormal(const float *v, const float *m, float *out) {
+    __m128 result = _mm_mul_ps(_mm_set1_ps(v[0]), _mm_loadu_ps(m + 0));
+    result = Detail::MultiplyAdd(_mm_set1_ps(v[1]), _mm_loadu_ps(m + 4), result);
+    result = Detail::MultiplyAdd(_mm_set1_ps(v[2]), _mm_loadu_ps(m + 8), result);
+    // 出力は3要素なので4要素目は書き込まない
+    alignas(16) float temp[4];
+    _mm_store_ps(temp, result);
+    out[0] = temp[0];
+    out[1] = temp[1];
+    out[2] = temp[2];
+}
+
+inline void Transpose(const float *m, float *out) {
+    __m128 r0 = _mm_loadu_ps(m + 0);
+    __m128 r1 = _mm_loadu_ps(m + 4);
+    __m128 r2 = _mm_loadu_ps(m + 8);
+    __m128 r3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(out + 0, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, r3);
+}
+
+// 2x2のブロックに分けて余因子を求める逆行列
+inline void Inverse(const float *m, float *out) {
+    using namespace Detail;
+
+    __m128 r0 = _mm_loadu_ps(m + 0);
+    __m128 r1 = _mm_loadu_ps(m + 4);
+    __m128 r2 = _mm_loadu_ps(m + 8);
+    __m128 r3 = _mm_loadu_ps(m + 12);
+
+    // M = | A B |
+    //     | C D |
+    __m128 a = _mm_movelh_ps(r0, r1);
+    __m128 b = _mm_movehl_ps(r1, r0);
+    __m128 c = _mm_movelh_ps(r2, r3);
+    __m128 d = _mm_movehl_ps(r3, r2);
+
+    // (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(_mm_mul_ps(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+                               _mm_mul_ps(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+    __m128 detA = Swizzle<0, 0, 0, 0>(detSub);
+    __m128 detB = Swizzle<1, 1, 1, 1>(detSub);
+    __m128 detC = Swizzle<2, 2, 2, 2>(detSub);
+    __m128 detD = Swizzle<3, 3, 3, 3>(detSub);
+
+    __m128 dc = Mat2AdjMul(d, c);
+    __m128 ab = Mat2AdjMul(a, b);
+
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    __m128 trace = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+    trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+    trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+    __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = _mm_mul_ps(x, invDet);
+    y = _mm_mul_ps(y, invDet);
+    z = _mm_mul_ps(z, invDet);
+    w = _mm_mul_ps(w, invDet);
+
+    // 余因子の並べ替えと格納をまとめて行う
+    _mm_storeu_ps(out + 0, Shuffle<3, 1, 3, 1>(x, y));
+    _mm_storeu_ps(out + 4, Shuffle<2, 0, 2, 0>(x, y));
+    _mm_storeu_ps(out + 8, Shuffle<3, 1, 3, 1>(z, w));
+    _mm_storeu_ps(out + 12, Shuffle<2, 0, 2, 0>(z, w));
+}
+
+inline void QuaternionMultiply(const float *a, const float *b, float *out) {
+    using namespace Detail;
+
+    __m128 qb = _mm_loadu_ps(b);
+    __m128 result = _mm_mul_ps(_mm_set1_ps(a[3]), qb);
+    result = MultiplyAdd(_mm_set1_ps(a[0]), _mm_mul_ps(Swizzle<3, 2, 1, 0>(qb), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f)), result);
+    result = MultiplyAdd(_mm_set1_ps(a[1]), _mm_mul_ps(Swizzle<2, 3, 0, 1>(qb), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f)), result);
+    result = MultiplyAdd(_mm_set1_ps(a[2]), _mm_mul_ps(Swizzle<1, 0, 3, 2>(qb), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f)), result);
+    _mm_storeu_ps(out, result);
+}
+
+inline void QuaternionNormalize(const float *q, float *out) {
+    __m128 v = _mm_loadu_ps(q);
+    float length = std::sqrt(Detail::Dot4(v, v));
+    if (length < 0.000001f) {
+        _mm_storeu_ps(out, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+        return;
+    }
+    _mm_storeu_ps(out, _mm_div_ps(v, _mm_set1_ps(length)));
+}
+
+inline void QuaternionSlerp(const float *q0, const float *q1, float t, float *out) {
+    float s0, s1;
+    bool isLinear = Scalar::SlerpFactors(q0, q1, t, s0, s1);
+    __m128 result = _mm_mul_ps(_mm_set1_ps(s0), _mm_loadu_ps(q0));
+    result = Detail::MultiplyAdd(_mm_set1_ps(s1), _mm_loadu_ps(q1), result);
+    _mm_storeu_ps(out, result);
+    if (isLinear) {
+        QuaternionNormalize(out, out);
+    }
+}
+
+inline void QuaternionToMatrix(const float *q, float *out, bool isBone) {
+    using namespace Detail;
+
+    const __m128 mask3 = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    __m128 v = _mm_loadu_ps(q);
+    __m128 v2 = _mm_add_ps(v, v);
+
+    // 対角成分 (1 - 2(yy + zz), 1 - 2(xx + zz), 1 - 2(xx + yy), 0)
+    __m128 square = _mm_mul_ps(v, v);
+    __m128 diagonal = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(2.0f), _mm_add_ps(Swizzle<1, 0, 0, 3>(square), Swizzle<2, 2, 1, 3>(square))));
+    diagonal = _mm_and_ps(diagonal, mask3);
+
+    // (2xy, 2xz, 2yz) と (2wz, 2wy, 2wx)
+    __m128 cross = _mm_mul_ps(Swizzle<0, 0, 1, 3>(v), Swizzle<1, 2, 2, 3>(v2));
+    __m128 wTerm = _mm_mul_ps(Swizzle<3, 3, 3, 3>(v), Swizzle<2, 1, 0, 3>(v2));
+    __m128 sum = _mm_and_ps(_mm_add_ps(cross, wTerm), mask3);
+    __m128 difference = _mm_and_ps(_mm_sub_ps(cross, wTerm), mask3);
+
+    // ボーン用は転置した並びなので和と差を入れ替える
+    __m128 upper = isBone ? sum : difference;
+    __m128 lower = isBone ? difference : sum;
+
+    // row0 = (d0, u0, l1, 0), row1 = (l0, d1, u2, 0), row2 = (u1, l2, d2, 0)
+    _mm_storeu_ps(out + 0, Shuffle<0, 2, 1, 3>(Shuffle<0, 0, 0, 0>(diagonal, upper), lower));
+    _mm_storeu_ps(out + 4, Shuffle<0, 2, 2, 3>(Shuffle<0, 0, 1, 1>(lower, diagonal), upper));
+    _mm_storeu_ps(out + 8, Shuffle<0, 2, 2, 3>(Shuffle<1, 1, 2, 2>(upper, lower), diagonal));
+    _mm_storeu_ps(out + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+// 平面を4枚ずつ縦に並べ替え、箱1個を8枚（残り2枚は常に内側になる平面）と同時に判定する
+inline size_t CullAABBs(const float *planes, const float *boxes, size_t count, unsigned char *visible) {
+    using namespace Detail;
+
+    // 平面7・8枚目は (0, 0, 0, 1)（常に距離1で内側）
+    const __m128 padding = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+    __m128 rows[2][4] = {
+        {_mm_loadu_ps(planes + 0), _mm_loadu_ps(planes + 4), _mm_loadu_ps(planes + 8), _mm_loadu_ps(planes + 12)},
+        {_mm_loadu_ps(planes + 16), _mm_loadu_ps(planes + 20), padding, padding},
+    };
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 planeX[2], planeY[2], planeZ[2], planeW[2];
+    __m128 absX[2], absY[2], absZ[2];
+    for (int group = 0; group < 2; ++group) {
+        _MM_TRANSPOSE4_PS(rows[group][0], rows[group][1], rows[group][2], rows[group][3]);
+        planeX[group] = rows[group][0];
+        planeY[group] = rows[group][1];
+        planeZ[group] = rows[group][2];
+        planeW[group] = rows[group][3];
+        absX[group] = _mm_and_ps(planeX[group], absMask);
+        absY[group] = _mm_and_ps(planeY[group], absMask);
+        absZ[group] = _mm_and_ps(planeZ[group], absMask);
+    }
+
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const float *box = boxes + i * 6;
+        __m128 centerX = _mm_set1_ps((box[0] + box[3]) * 0.5f);
+        __m128 centerY = _mm_set1_ps((box[1] + box[4]) * 0.5f);
+        __m128 centerZ = _mm_set1_ps((box[2] + box[5]) * 0.5f);
+        __m128 extentX = _mm_set1_ps((box[3] - box[0]) * 0.5f);
+        __m128 extentY = _mm_set1_ps((box[4] - box[1]) * 0.5f);
+        __m128 extentZ = _mm_set1_ps((box[5] - box[2]) * 0.5f);
+
+        __m128 outside = _mm_setzero_ps();
+        for (int group = 0; group < 2; ++group) {
+            __m128 distance = MultiplyAdd(planeX[group], centerX, planeW[group]);
+            distance = MultiplyAdd(planeY[group], centerY, distance);
+            distance = MultiplyAdd(planeZ[group], centerZ, distance);
+            distance = MultiplyAdd(absX[group], extentX, distance);
+            distance = MultiplyAdd(absY[group], extentY, distance);
+            distance = MultiplyAdd(absZ[group], extentZ, distance);
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+        }
+        bool isInside = _mm_movemask_ps(outside) == 0;
+        visible[i] = isInside ? 1 : 0;
+        visibleCount += isInside ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+inline const char *GetInstructionSetName() {
+#if defined(MATH_SIMD_FMA)
+    return "AVX2+FMA";
+#else
+    return "SSE2";
+#endif
+}
+
+#elif defined(MATH_SIMD_NEON)
+
+///--------NEON--------
+
+inline void MultiplyMatrix(const float *a, const float *b, float *out) {
+    float32x4_t b0 = vld1q_f32(b + 0);
+    float32x4_t b1 = vld1q_f32(b + 4);
+    float32x4_t b2 = vld1q_f32(b + 8);
+    float32x4_t b3 = vld1q_f32(b + 12);
+
+    float32x4_t rows[4];
+    for (int i = 0; i < 4; ++i) {
+        float32x4_t row = vld1q_f32(a + i * 4);
+        float32x4_t result = vmulq_laneq_f32(b0, row, 0);
+        result = vfmaq_laneq_f32(result, b1, row, 1);
+        result = vfmaq_laneq_f32(result, b2, row, 2);
+        rows[i] = vfmaq_laneq_f32(result, b3, row, 3);
+    }
+    for (int i = 0; i < 4; ++i) {
+        vst1q_f32(out + i * 4, rows[i]);
+    }
+}
+
+inline void MultiplyAffine(const float *a, const float *b, float *out) {
+    float32x4_t b0 = vld1q_f32(b + 0);
+    float32x4_t b1 = vld1q_f32(b + 4);
+    float32x4_t b2 = vld1q_f32(b + 8);
+    float32x4_t b3 = vld1q_f32(b + 12);
+
+    float32x4_t rows[4];
+    for (int i = 0; i < 4; ++i) {
+        float32x4_t row = vld1q_f32(a + i * 4);
+        float32x4_t result = vmulq_laneq_f32(b0, row, 0);
+        result = vfmaq_laneq_f32(result, b1, row, 1);
+        rows[i] = vfmaq_laneq_f32(result, b2, row, 2);
+    }
+    rows[3] = vaddq_f32(rows[3], b3);
+    for (int i = 0; i < 4; ++i) {
+        vst1q_f32(out + i * 4, rows[i]);
+    }
+}
+
+inline void TransformPoint(const float *v, const float *m, float *out) {
+    float32x4_t result = vmulq_n_f32(vld1q_f32(m + 0), v[0]);
+    result = vfmaq_n_f32(result, vld1q_f32(m + 4), v[1]);
+    result = vfmaq_n_f32(result, vld1q_f32(m + 8), v[2]);
+    vst1q_f32(out, vaddq_f32(result, vld1q_f32(m + 12)));
+}
+
+inline void TransformVector(const float *v, const float *m, float *out) {
+    float32x4_t result = vmulq_n_f32(vld1q_f32(m + 0), v[0]);
+    result = vfmaq_n_f32(result, vld1q_f32(m + 4), v[1]);
+    result = vfmaq_n_f32(result, vld1q_f32(m + 8), v[2]);
+    vst1q_f32(out, vfmaq_n_f32(result, vld1q_f32(m + 12), v[3]));
+}
+
+inline void TransformNormal(const float *v, const float *m, float *out) {
+    float32x4_t result = vmulq_n_f32(vld1q_f32(m + 0), v[0]);
+    result = vfmaq_n_f32(result, vld1q_f32(m + 4), v[1]);
+    result = vfmaq_n_f32(result, vld1q_f32(m + 8), v[2]);
+    out[0] = vgetq_lane_f32(result, 0);
+    out[1] = vgetq_lane_f32(result, 1);
+    out[2] = vgetq_lane_f32(result, 2);
+}
+
+inline void Transpose(const float *m, float *out) {
+    float32x4x4_t columns = vld4q_f32(m);
+    vst1q_f32(out + 0, columns.val[0]);
+    vst1q_f32(out + 4, columns.val[1]);
+    vst1q_f32(out + 8, columns.val[2]);
+    vst1q_f32(out + 12, columns.val[3]);
+}
+
+// シャッフルの多い演算はスカラー版を使う
+inline void Inverse(const float *m, float *out) { Scalar::Inverse(m, out); }
+inline void QuaternionMultiply(const float *a, const float *b, float *out) { Scalar::QuaternionMultiply(a, b, out); }
+inline void QuaternionNormalize(const float *q, float *out) { Scalar::QuaternionNormalize(q, out); }
+inline void QuaternionSlerp(const float *q0, const float *q1, float t, float *out) { Scalar::QuaternionSlerp(q0, q1, t, out); }
+inline void QuaternionToMatrix(const float *q, float *out, bool isBone) { Scalar::QuaternionToMatrix(q, out, isBone); }
+inline size_t CullAABBs(const float *planes, const float *boxes, size_t count, unsigned char *visible) { return Scalar::CullAABBs(planes, boxes, count, visible); }
+
+inline const char *GetInstructionSetName() { return "NEON"; }
+
+#else
+
+///--------スカラー--------
+
+using Scalar::CullAABBs;
+using Scalar::Inverse;
+using Scalar::MultiplyAffine;
+using Scalar::MultiplyMatrix;
+using Scalar::QuaternionMultiply;
+using Scalar::QuaternionNormalize;
+using Scalar::QuaternionSlerp;
+using Scalar::QuaternionToMatrix;
+using Scalar::TransformNormal;
+using Scalar::TransformPoint;
+using Scalar::TransformVector;
+using Scalar::Transpose;
+
+inline const char *GetInstructionSetName() { return "Scalar"; }
+
+#endif
+
+/// <summary>
+/// 複数の点をまとめて変換する（w除算あり）
+/// </summary>
+inline void TransformPoints(const float *points, size_t stride, size_t count, const float *m, float *out, size_t outStride) {
+    for (size_t i = 0; i < count; ++i) {
+        float result[4];
+        TransformPoint(points + i * stride, m, result);
+        float invW = 1.0f / result[3];
+        float *dst = out + i * outStride;
+        dst[0] = result[0] * invW;
+        dst[1] = result[1] * invW;
+        dst[2] = result[2] * invW;
+    }
+}
+
+} // namespace MathKernels
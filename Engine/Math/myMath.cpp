@@ -1,4 +1,5 @@
 #include"myMath.h"
+#include <algorithm>
 #include <numbers>
 #include <WinApp.h>
 
@@ -30,8 +31,8 @@ Matrix4x4 MakeTranslateMatrix(const Vector3& translate) { return { 1, 0, 0, 0, 0
 Matrix4x4 MakeScaleMatrix(const Vector3& scale) { return { scale.x, 0, 0, 0, 0, scale.y, 0, 0, 0, 0, scale.z, 0, 0, 0, 0, 1 }; }
 
 Matrix4x4 MakeOBBWorldMatrix(const OBB& obb, const Matrix4x4& rotateMatrix) {
-	Matrix4x4 translationMatrix = MakeTranslateMatrix(obb.scaleCenterRotated);
-	return rotateMatrix * translationMatrix;
+	// 回転行列 * 平行移動行列 は回転部分をそのまま使い、平行移動の行を差し替えるだけでよい
+	return MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, rotateMatrix, obb.scaleCenterRotated);
 }
 
 AABB ConvertOBBToAABB(const OBB& obb) {
@@ -49,25 +50,21 @@ float getProjection(const Vector3& axis, const OBB& obb) {
 }
 
 Vector3 Transformation(const Vector3& vector, const Matrix4x4& matrix) {
-	Vector3 result;
-	result.x = vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + vector.z * matrix.m[2][0] + 1.0f * matrix.m[3][0];
-	result.y = vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + vector.z * matrix.m[2][1] + 1.0f * matrix.m[3][1];
-	result.z = vector.x * matrix.m[0][2] + vector.y * matrix.m[1][2] + vector.z * matrix.m[2][2] + 1.0f * matrix.m[3][2];
-	float w = vector.x * matrix.m[0][3] + vector.y * matrix.m[1][3] + vector.z * matrix.m[2][3] + 1.0f * matrix.m[3][3];
+	float transformed[4];
+	MathKernels::TransformPoint(&vector.x, &matrix.m[0][0], transformed);
+	float w = transformed[3];
 	assert(w != 0.0f);
-	result.x /= w;
-	result.y /= w;
-	result.z /= w;
+	Vector3 result;
+	result.x = transformed[0] / w;
+	result.y = transformed[1] / w;
+	result.z = transformed[2] / w;
 	return result;
 }
 
 // Vector4をMatrix4x4で変換する関数
 Vector4 Transformation(const Vector4& vector, const Matrix4x4& matrix) {
 	Vector4 result;
-	result.x = vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + vector.z * matrix.m[2][0] + vector.w * matrix.m[3][0];
-	result.y = vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + vector.z * matrix.m[2][1] + vector.w * matrix.m[3][1];
-	result.z = vector.x * matrix.m[0][2] + vector.y * matrix.m[1][2] + vector.z * matrix.m[2][2] + vector.w * matrix.m[3][2];
-	result.w = vector.x * matrix.m[0][3] + vector.y * matrix.m[1][3] + vector.z * matrix.m[2][3] + vector.w * matrix.m[3][3];
+	MathKernels::TransformVector(&vector.x, &matrix.m[0][0], &result.x);
 
 	// wが0でないことを確認
 	assert(result.w != 0.0f);
@@ -83,94 +80,21 @@ Vector4 Transformation(const Vector4& vector, const Matrix4x4& matrix) {
 
 
 Vector3 TransformNormal(const Vector3& v, const Matrix4x4& m) {
-	Vector3 result{
-		v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0],
-		v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1],
-		v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2],
-	};
-
+	Vector3 result;
+	MathKernels::TransformNormal(&v.x, &m.m[0][0], &result.x);
 	return result;
 }
 
 Matrix4x4 Inverse(const Matrix4x4& m) {
-	float A =
-		m.m[0][0] * m.m[1][1] * m.m[2][2] * m.m[3][3] + m.m[0][0] * m.m[1][2] * m.m[2][3] * m.m[3][1] + m.m[0][0] * m.m[1][3] * m.m[2][1] * m.m[3][2] - m.m[0][0] * m.m[1][3] * m.m[2][2] * m.m[3][1] -
-		m.m[0][0] * m.m[1][2] * m.m[2][1] * m.m[3][3] - m.m[0][0] * m.m[1][1] * m.m[2][3] * m.m[3][2] - m.m[0][1] * m.m[1][0] * m.m[2][2] * m.m[3][3] - m.m[0][2] * m.m[1][0] * m.m[2][3] * m.m[3][1] -
-		m.m[0][3] * m.m[1][0] * m.m[2][1] * m.m[3][2] + m.m[0][3] * m.m[1][0] * m.m[2][2] * m.m[3][1] + m.m[0][2] * m.m[1][0] * m.m[2][1] * m.m[3][3] + m.m[0][1] * m.m[1][0] * m.m[2][3] * m.m[3][2] +
-		m.m[0][1] * m.m[1][2] * m.m[2][0] * m.m[3][3] + m.m[0][2] * m.m[1][3] * m.m[2][0] * m.m[3][1] + m.m[0][3] * m.m[1][1] * m.m[2][0] * m.m[3][2] - m.m[0][3] * m.m[1][2] * m.m[2][0] * m.m[3][1] -
-		m.m[0][2] * m.m[1][1] * m.m[2][0] * m.m[3][3] - m.m[0][1] * m.m[1][3] * m.m[2][0] * m.m[3][2] - m.m[0][1] * m.m[1][2] * m.m[2][3] * m.m[3][0] - m.m[0][2] * m.m[1][3] * m.m[2][1] * m.m[3][0] -
-		m.m[0][3] * m.m[1][1] * m.m[2][2] * m.m[3][0] + m.m[0][3] * m.m[1][2] * m.m[2][1] * m.m[3][0] + m.m[0][2] * m.m[1][1] * m.m[2][3] * m.m[3][0] + m.m[0][1] * m.m[1][3] * m.m[2][2] * m.m[3][0];
-
-	return {
-		(m.m[1][1] * m.m[2][2] * m.m[3][3] + m.m[1][2] * m.m[2][3] * m.m[3][1] + m.m[1][3] * m.m[2][1] * m.m[3][2] - m.m[1][3] * m.m[2][2] * m.m[3][1] - m.m[1][2] * m.m[2][1] * m.m[3][3] -
-		 m.m[1][1] * m.m[2][3] * m.m[3][2]) /
-			A,
-
-		(-m.m[0][1] * m.m[2][2] * m.m[3][3] - m.m[0][2] * m.m[2][3] * m.m[3][1] - m.m[0][3] * m.m[2][1] * m.m[3][2] + m.m[0][3] * m.m[2][2] * m.m[3][1] + m.m[0][2] * m.m[2][1] * m.m[3][3] +
-		 m.m[0][1] * m.m[2][3] * m.m[3][2]) /
-			A,
-
-		(m.m[0][1] * m.m[1][2] * m.m[3][3] + m.m[0][2] * m.m[1][3] * m.m[3][1] + m.m[0][3] * m.m[1][1] * m.m[3][2] - m.m[0][3] * m.m[1][2] * m.m[3][1] - m.m[0][2] * m.m[1][1] * m.m[3][3] -
-		 m.m[0][1] * m.m[1][3] * m.m[3][2]) /
-			A,
-
-		(-m.m[0][1] * m.m[1][2] * m.m[2][3] - m.m[0][2] * m.m[1][3] * m.m[2][1] - m.m[0][3] * m.m[1][1] * m.m[2][2] + m.m[0][3] * m.m[1][2] * m.m[2][1] + m.m[0][2] * m.m[1][1] * m.m[2][3] +
-		 m.m[0][1] * m.m[1][3] * m.m[2][2]) /
-			A,
-
-		(-m.m[1][0] * m.m[2][2] * m.m[3][3] - m.m[1][2] * m.m[2][3] * m.m[3][0] - m.m[1][3] * m.m[2][0] * m.m[3][2] + m.m[1][3] * m.m[2][2] * m.m[3][0] + m.m[1][2] * m.m[2][0] * m.m[3][3] +
-		 m.m[1][0] * m.m[2][3] * m.m[3][2]) /
-			A,
-
-		(m.m[0][0] * m.m[2][2] * m.m[3][3] + m.m[0][2] * m.m[2][3] * m.m[3][0] + m.m[0][3] * m.m[2][0] * m.m[3][2] - m.m[0][3] * m.m[2][2] * m.m[3][0] - m.m[0][2] * m.m[2][0] * m.m[3][3] -
-		 m.m[0][0] * m.m[2][3] * m.m[3][2]) /
-			A,
-
-		(-m.m[0][0] * m.m[1][2] * m.m[3][3] - m.m[0][2] * m.m[1][3] * m.m[3][0] - m.m[0][3] * m.m[1][0] * m.m[3][2] + m.m[0][3] * m.m[1][2] * m.m[3][0] + m.m[0][2] * m.m[1][0] * m.m[3][3] +
-		 m.m[0][0] * m.m[1][3] * m.m[3][2]) /
-			A,
-
-		(m.m[0][0] * m.m[1][2] * m.m[2][3] + m.m[0][2] * m.m[1][3] * m.m[2][0] + m.m[0][3] * m.m[1][0] * m.m[2][2] - m.m[0][3] * m.m[1][2] * m.m[2][0] - m.m[0][1] * m.m[1][0] * m.m[2][3] -
-		 m.m[0][0] * m.m[1][3] * m.m[2][2]) /
-			A,
-
-		(m.m[1][0] * m.m[2][1] * m.m[3][3] + m.m[1][1] * m.m[2][3] * m.m[3][0] + m.m[1][3] * m.m[2][0] * m.m[3][1] - m.m[1][3] * m.m[2][1] * m.m[3][0] - m.m[1][1] * m.m[2][0] * m.m[3][3] -
-		 m.m[1][0] * m.m[2][3] * m.m[3][1]) /
-			A,
-
-		(-m.m[0][0] * m.m[2][1] * m.m[3][3] - m.m[0][1] * m.m[2][3] * m.m[3][0] - m.m[0][3] * m.m[2][0] * m.m[3][1] + m.m[0][3] * m.m[2][1] * m.m[3][0] + m.m[0][1] * m.m[2][0] * m.m[3][3] +
-		 m.m[0][0] * m.m[2][3] * m.m[3][1]) /
-			A,
-
-		(m.m[0][0] * m.m[1][1] * m.m[3][3] + m.m[0][1] * m.m[1][3] * m.m[3][0] + m.m[0][3] * m.m[1][0] * m.m[3][1] - m.m[0][3] * m.m[1][1] * m.m[3][0] - m.m[0][1] * m.m[1][0] * m.m[3][3] -
-		 m.m[0][0] * m.m[1][3] * m.m[3][1]) /
-			A,
-
-		(-m.m[0][0] * m.m[1][1] * m.m[2][3] - m.m[0][1] * m.m[1][3] * m.m[2][0] - m.m[0][3] * m.m[1][0] * m.m[2][1] + m.m[0][3] * m.m[1][1] * m.m[2][0] + m.m[0][1] * m.m[1][0] * m.m[2][3] +
-		 m.m[0][0] * m.m[1][3] * m.m[2][1]) /
-			A,
-
-		(-m.m[1][0] * m.m[2][1] * m.m[3][2] - m.m[1][1] * m.m[2][2] * m.m[3][0] - m.m[1][2] * m.m[2][0] * m.m[3][1] + m.m[1][2] * m.m[2][1] * m.m[3][0] + m.m[1][1] * m.m[2][0] * m.m[3][2] +
-		 m.m[1][0] * m.m[2][2] * m.m[3][1]) /
-			A,
-
-		(m.m[0][0] * m.m[2][1] * m.m[3][2] + m.m[0][1] * m.m[2][2] * m.m[3][0] + m.m[0][2] * m.m[2][0] * m.m[3][1] - m.m[0][2] * m.m[2][1] * m.m[3][0] - m.m[0][1] * m.m[2][0] * m.m[3][2] -
-		 m.m[0][0] * m.m[2][2] * m.m[3][1]) /
-			A,
-
-		(-m.m[0][0] * m.m[1][1] * m.m[3][2] - m.m[0][1] * m.m[1][2] * m.m[3][0] - m.m[0][2] * m.m[1][0] * m.m[3][1] + m.m[0][2] * m.m[1][1] * m.m[3][0] + m.m[0][1] * m.m[1][0] * m.m[3][2] +
-		 m.m[0][0] * m.m[1][2] * m.m[3][1]) /
-			A,
-
-		(m.m[0][0] * m.m[1][1] * m.m[2][2] + m.m[0][1] * m.m[1][2] * m.m[2][0] + m.m[0][2] * m.m[1][0] * m.m[2][1] - m.m[0][2] * m.m[1][1] * m.m[2][0] - m.m[0][1] * m.m[1][0] * m.m[2][2] -
-		 m.m[0][0] * m.m[1][2] * m.m[2][1]) /
-			A
-
-	};
+	Matrix4x4 result;
+	MathKernels::Inverse(&m.m[0][0], &result.m[0][0]);
+	return result;
 }
 
 Matrix4x4 Transpose(const Matrix4x4& m) {
-	return { m.m[0][0], m.m[1][0], m.m[2][0], m.m[3][0], m.m[0][1], m.m[1][1], m.m[2][1], m.m[3][1], m.m[0][2], m.m[1][2], m.m[2][2], m.m[3][2], m.m[0][3], m.m[1][3], m.m[2][3], m.m[3][3] };
+	Matrix4x4 result;
+	MathKernels::Transpose(&m.m[0][0], &result.m[0][0]);
+	return result;
 }
 
 Matrix4x4 MakeIdentity4x4() { return { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }; }
@@ -181,17 +105,65 @@ Matrix4x4 MakeRotateYMatrix(float radian) { return { std::cosf(radian), 0, std::
 
 Matrix4x4 MakeRotateZMatrix(float radian) { return { std::cosf(radian), std::sinf(radian), 0, 0, std::sinf(-radian), std::cosf(radian), 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }; };
 
-Matrix4x4 MakeRotateXYZMatrix(const Vector3& radian) { return { (MakeRotateXMatrix(radian.x) * MakeRotateYMatrix(radian.y) * MakeRotateZMatrix(radian.z)) }; }
+Matrix4x4 MakeRotateXYZMatrix(const Vector3& radian) { return MakeAffineMatrix({ 1.0f, 1.0f, 1.0f }, radian, { 0.0f, 0.0f, 0.0f }); }
 
 Matrix4x4 MakeAffineMatrix(const Vector3& scale, const Vector3& rotate, const Vector3& translate) {
-	Matrix4x4 scaleMatrix = MakeScaleMatrix(scale);
-	Matrix4x4 rotateXMatrix = MakeRotateXMatrix(rotate.x);
-	Matrix4x4 rotateYMatrix = MakeRotateYMatrix(rotate.y);
-	Matrix4x4 rotateZMatrix = MakeRotateZMatrix(rotate.z);
-	Matrix4x4 translateMatrix = MakeTranslateMatrix(translate);
-	Matrix4x4 rotateMatrix = (rotateXMatrix * rotateYMatrix) * rotateZMatrix;
+	// S * (Rx * Ry * Rz) * T を展開した形
+	float sx = std::sinf(rotate.x), cx = std::cosf(rotate.x);
+	float sy = std::sinf(rotate.y), cy = std::cosf(rotate.y);
+	float sz = std::sinf(rotate.z), cz = std::cosf(rotate.z);
+
+	return {
+		scale.x * (cy * cz), scale.x * (cy * sz), scale.x * (-sy), 0.0f,
+		scale.y * (sx * sy * cz - cx * sz), scale.y * (sx * sy * sz + cx * cz), scale.y * (sx * cy), 0.0f,
+		scale.z * (cx * sy * cz + sx * sz), scale.z * (cx * sy * sz - sx * cz), scale.z * (cx * cy), 0.0f,
+		translate.x, translate.y, translate.z, 1.0f
+	};
+}
+
+Matrix4x4 MakeAffineMatrix(const Vector3& scale, const Matrix4x4& rotate, const Vector3& translate) {
+	return {
+		scale.x * rotate.m[0][0], scale.x * rotate.m[0][1], scale.x * rotate.m[0][2], 0.0f,
+		scale.y * rotate.m[1][0], scale.y * rotate.m[1][1], scale.y * rotate.m[1][2], 0.0f,
+		scale.z * rotate.m[2][0], scale.z * rotate.m[2][1], scale.z * rotate.m[2][2], 0.0f,
+		translate.x, translate.y, translate.z, 1.0f
+	};
+}
 
-	return { (scaleMatrix * rotateMatrix) * translateMatrix };
+Matrix4x4 MultiplyAffine(const Matrix4x4& a, const Matrix4x4& b) {
+	Matrix4x4 result;
+	MathKernels::MultiplyAffine(&a.m[0][0], &b.m[0][0], &result.m[0][0]);
+	return result;
+}
+
+Matrix4x4 InverseAffine(const Matrix4x4& m) {
+	// 3x3部分の余因子
+	float c00 = m.m[1][1] * m.m[2][2] - m.m[1][2] * m.m[2][1];
+	float c01 = m.m[1][2] * m.m[2][0] - m.m[1][0] * m.m[2][2];
+	float c02 = m.m[1][0] * m.m[2][1] - m.m[1][1] * m.m[2][0];
+	float invDet = 1.0f / (m.m[0][0] * c00 + m.m[0][1] * c01 + m.m[0][2] * c02);
+
+	Matrix4x4 result;
+	result.m[0][0] = c00 * invDet;
+	result.m[0][1] = (m.m[0][2] * m.m[2][1] - m.m[0][1] * m.m[2][2]) * invDet;
+	result.m[0][2] = (m.m[0][1] * m.m[1][2] - m.m[0][2] * m.m[1][1]) * invDet;
+	result.m[0][3] = 0.0f;
+	result.m[1][0] = c01 * invDet;
+	result.m[1][1] = (m.m[0][0] * m.m[2][2] - m.m[0][2] * m.m[2][0]) * invDet;
+	result.m[1][2] = (m.m[0][2] * m.m[1][0] - m.m[0][0] * m.m[1][2]) * invDet;
+	result.m[1][3] = 0.0f;
+	result.m[2][0] = c02 * invDet;
+	result.m[2][1] = (m.m[0][1] * m.m[2][0] - m.m[0][0] * m.m[2][1]) * invDet;
+	result.m[2][2] = (m.m[0][0] * m.m[1][1] - m.m[0][1] * m.m[1][0]) * invDet;
+	result.m[2][3] = 0.0f;
+
+	// 平行移動は -t * (3x3の逆行列)
+	float tx = m.m[3][0], ty = m.m[3][1], tz = m.m[3][2];
+	result.m[3][0] = -(tx * result.m[0][0] + ty * result.m[1][0] + tz * result.m[2][0]);
+	result.m[3][1] = -(tx * result.m[0][1] + ty * result.m[1][1] + tz * result.m[2][1]);
+	result.m[3][2] = -(tx * result.m[0][2] + ty * result.m[1][2] + tz * result.m[2][2]);
+	result.m[3][3] = 1.0f;
+	return result;
 }
 
 float cotf(float theta) { return 1.0f / std::tanf(theta); }
@@ -287,88 +259,26 @@ Vector3 QuaternionToAxis(const Quaternion &q) {
 }
 
 Matrix4x4 MakeAffineMatrix(const Vector3 &scale, const Quaternion &rotate, const Vector3 &translate) {
-    return MakeScaleMatrix(scale) * QuaternionToMatrix4x4(rotate) * MakeTranslateMatrix(translate);
+    return MakeAffineMatrix(scale, QuaternionToMatrix4x4(rotate), translate);
 }
 
 Matrix4x4 MakeBoneMatrix(const Vector3 &scale, const Quaternion &rotate, const Vector3 &translate) {
-    return MakeScaleMatrix(scale) * QuaternionToBoneMatrix(rotate) * MakeTranslateMatrix(translate);
+    return MakeAffineMatrix(scale, QuaternionToBoneMatrix(rotate), translate);
 }
 
 Matrix4x4 QuaternionToBoneMatrix(const Quaternion &q) {
+    // 左手座標系用の回転行列
     Matrix4x4 mat;
-
-    // クォータニオンの各成分の積を計算
-    float xx = q.x * q.x;
-    float yy = q.y * q.y;
-    float zz = q.z * q.z;
-    float xy = q.x * q.y;
-    float xz = q.x * q.z;
-    float yz = q.y * q.z;
-    float wx = q.w * q.x;
-    float wy = q.w * q.y;
-    float wz = q.w * q.z;
-
-    // 左手座標系用の回転行列を設定
-    mat.m[0][0] = 1.0f - 2.0f * (yy + zz);
-    mat.m[0][1] = 2.0f * (xy + wz);
-    mat.m[0][2] = 2.0f * (xz - wy);
-    mat.m[0][3] = 0.0f;
-
-    mat.m[1][0] = 2.0f * (xy - wz);
-    mat.m[1][1] = 1.0f - 2.0f * (xx + zz);
-    mat.m[1][2] = 2.0f * (yz + wx);
-    mat.m[1][3] = 0.0f;
-
-    mat.m[2][0] = 2.0f * (xz + wy);
-    mat.m[2][1] = 2.0f * (yz - wx);
-    mat.m[2][2] = 1.0f - 2.0f * (xx + yy);
-    mat.m[2][3] = 0.0f;
-
-    mat.m[3][0] = 0.0f;
-    mat.m[3][1] = 0.0f;
-    mat.m[3][2] = 0.0f;
-    mat.m[3][3] = 1.0f;
-
+    MathKernels::QuaternionToMatrix(&q.x, &mat.m[0][0], true);
     return mat;
 }
 
 Matrix4x4 QuaternionToMatrix4x4(const Quaternion &q) {
-      // 正規化されたクォータニオンを使用
+    // 正規化されたクォータニオンを使用
     Quaternion norm = q.Normalize();
 
-    float xx = norm.x * norm.x;
-    float yy = norm.y * norm.y;
-    float zz = norm.z * norm.z;
-    float xy = norm.x * norm.y;
-    float xz = norm.x * norm.z;
-    float yz = norm.y * norm.z;
-    float wx = norm.w * norm.x;
-    float wy = norm.w * norm.y;
-    float wz = norm.w * norm.z;
-
     Matrix4x4 mat;
-
-    // 正しい回転行列の計算
-    mat.m[0][0] = 1.0f - 2.0f * (yy + zz);
-    mat.m[0][1] = 2.0f * (xy - wz);
-    mat.m[0][2] = 2.0f * (xz + wy);
-    mat.m[0][3] = 0.0f;
-
-    mat.m[1][0] = 2.0f * (xy + wz);
-    mat.m[1][1] = 1.0f - 2.0f * (xx + zz);
-    mat.m[1][2] = 2.0f * (yz - wx);
-    mat.m[1][3] = 0.0f;
-
-    mat.m[2][0] = 2.0f * (xz - wy);
-    mat.m[2][1] = 2.0f * (yz + wx);
-    mat.m[2][2] = 1.0f - 2.0f * (xx + yy);
-    mat.m[2][3] = 0.0f;
-
-    mat.m[3][0] = 0.0f;
-    mat.m[3][1] = 0.0f;
-    mat.m[3][2] = 0.0f;
-    mat.m[3][3] = 1.0f;
-
+    MathKernels::QuaternionToMatrix(&norm.x, &mat.m[0][0], false);
     return mat;
 }
 
@@ -403,4 +313,78 @@ Matrix4x4 MakeRotateMatrix(const Vector3 &right, const Vector3 &up, const Vector
     result.m[3][3] = 1.0f;
 
     return result;
-}
\ No newline at end of file
+}
+
+Frustum MakeFrustum(const Matrix4x4 &viewProjection) {
+    // 行ベクトル × 行列 なので、クリップ座標の各成分は列との内積になる
+    auto column = [&viewProjection](int j) {
+        return Vector4(viewProjection.m[0][j], viewProjection.m[1][j], viewProjection.m[2][j], viewProjection.m[3][j]);
+    };
+    Vector4 x = column(0);
+    Vector4 y = column(1);
+    Vector4 z = column(2);
+    Vector4 w = column(3);
+
+    Frustum frustum;
+    frustum.planes[0] = w + x; // 左   -w <= x
+    frustum.planes[1] = w - x; // 右    x <= w
+    frustum.planes[2] = w + y; // 下   -w <= y
+    frustum.planes[3] = w - y; // 上    y <= w
+    frustum.planes[4] = z;     // 近    0 <= z
+    frustum.planes[5] = w - z; // 遠    z <= w
+    for (Vector4 &plane : frustum.planes) {
+        float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        if (length > 0.0f) {
+            plane = Vector4(plane.x / length, plane.y / length, plane.z / length, plane.w / length);
+        }
+    }
+    return frustum;
+}
+
+bool IsInFrustum(const Frustum &frustum, const AABB &aabb) {
+    for (const Vector4 &plane : frustum.planes) {
+        // 法線の向きに一番遠い頂点が外側なら、箱全体が外側
+        float x = plane.x >= 0.0f ? aabb.max.x : aabb.min.x;
+        float y = plane.y >= 0.0f ? aabb.max.y : aabb.min.y;
+        float z = plane.z >= 0.0f ? aabb.max.z : aabb.min.z;
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t CullAABBs(const Frustum &frustum, const AABB *aabbs, size_t count, uint8_t *visible) {
+    static_assert(sizeof(AABB) == sizeof(float) * 6, "AABB must be tightly packed min.xyz, max.xyz");
+    static_assert(sizeof(Frustum) == sizeof(float) * 24, "Frustum must be 6 packed planes");
+    return MathKernels::CullAABBs(&frustum.planes[0].x, &aabbs[0].min.x, count, visible);
+}
+
+AABB TransformAABB(const AABB &aabb, const Matrix4x4 &matrix) {
+    // 平行移動から始めて、行列の各成分ごとに小さい方・大きい方を足していく
+    AABB result;
+    result.min = {matrix.m[3][0], matrix.m[3][1], matrix.m[3][2]};
+    result.max = result.min;
+    const float localMin[3] = {aabb.min.x, aabb.min.y, aabb.min.z};
+    const float localMax[3] = {aabb.max.x, aabb.max.y, aabb.max.z};
+    float *resultMin = &result.min.x;
+    float *resultMax = &result.max.x;
+    for (int row = 0; row < 3; ++row) {
+        for (int column = 0; column < 3; ++column) {
+            float a = matrix.m[row][column] * localMin[row];
+            float b = matrix.m[row][column] * localMax[row];
+            resultMin[column] += (std::min)(a, b);
+            resultMax[column] += (std::max)(a, b);
+        }
+    }
+    return result;
+}
+
+bool IsInFrustum(const Frustum &frustum, const Sphere &sphere) {
+    for (const Vector4 &plane : frustum.planes) {
+        if (plane.x * sphere.center.x + plane.y * sphere.center.y + plane.z * sphere.center.z + plane.w < -sphere.radius) {
+            return false;
+        }
+    }
+    return true;
+}
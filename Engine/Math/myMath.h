@@ -1,6 +1,7 @@
 #pragma once
 #include "assert.h"
 #include "cmath"
+#include <cstdint>
 #include "type/Matrix4x4.h"
 #include "type/Vector4.h"
 #include <Camera/ViewProjection/ViewProjection.h>
@@ -22,6 +23,10 @@ struct OBB {
     Vector3 size;               // サイズ
     Vector3 orientations[3];    // 各軸の方向ベクトル
 };
+// 視錐台（6枚の平面。xyzが内向きの法線、wが距離で、dot(法線, 点) + w >= 0 なら内側）
+struct Frustum {
+    Vector4 planes[6]; // 左・右・下・上・近・遠
+};
 
 class ViewProjection;
 
@@ -69,8 +74,18 @@ Matrix4x4 MakeRotateZMatrix(float radian);
 // X,Y,Z軸回転行列を合成した行列
 Matrix4x4 MakeRotateXYZMatrix(const Vector3 &radian);
 
+// 拡大縮小・回転(オイラー角 XYZ)・平行移動を合成したアフィン行列（行列積を使わず直接求める）
 Matrix4x4 MakeAffineMatrix(const Vector3 &scale, const Vector3 &rotate, const Vector3 &translate);
 
+// 拡大縮小・回転行列・平行移動を合成したアフィン行列（rotateは3x3部分のみ使用）
+Matrix4x4 MakeAffineMatrix(const Vector3 &scale, const Matrix4x4 &rotate, const Vector3 &translate);
+
+// アフィン行列同士の積（4列目の (0, 0, 0, 1) を計算しない）
+Matrix4x4 MultiplyAffine(const Matrix4x4 &a, const Matrix4x4 &b);
+
+// アフィン行列の逆行列（3x3部分の逆行列と平行移動の逆変換）
+Matrix4x4 InverseAffine(const Matrix4x4 &m);
+
 // tanθの逆数
 float cotf(float theta);
 
@@ -83,6 +98,19 @@ Matrix4x4 MakeOrthographicMatrix(float left, float top, float right, float botto
 // ビューポート変換行列
 Matrix4x4 MakeViewPortMatrix(float left, float top, float width, float height, float minDepth, float maxDepth);
 
+// ビュー行列 * プロジェクション行列 から視錐台を作る（深度は0～1）
+Frustum MakeFrustum(const Matrix4x4 &viewProjection);
+
+// 視錐台と重なるか（完全に外側の平面が1枚でもあればfalse。角の近くは重なると判定することがある）
+bool IsInFrustum(const Frustum &frustum, const AABB &aabb);
+bool IsInFrustum(const Frustum &frustum, const Sphere &sphere);
+
+// 複数のAABBをまとめて判定する（visible[i]に見えるなら1、外側なら0。戻り値は見える数）
+size_t CullAABBs(const Frustum &frustum, const AABB *aabbs, size_t count, uint8_t *visible);
+
+// ローカルのAABBを行列で変換し、それを囲むAABBを作る
+AABB TransformAABB(const AABB &aabb, const Matrix4x4 &matrix);
+
 // クォータニオンから回転軸(Vector3)を計算する関数
 
 float LerpShortAngle(float a, float b, float t);
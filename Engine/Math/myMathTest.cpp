@@ -0,0 +1,236 @@
+#include "Simd/MathKernels.h"
+#include "Test/Test.h"
+#include "myMath.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace {
+
+bool IsNear(float a, float b, float epsilon = 1e-3f) { return std::abs(a - b) < epsilon; }
+
+bool IsNearMatrix(const Matrix4x4 &a, const Matrix4x4 &b, float epsilon = 1e-3f) {
+    for (int row = 0; row < 4; ++row) {
+        for (int column = 0; column < 4; ++column) {
+            if (!IsNear(a.m[row][column], b.m[row][column], epsilon)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+float Dot(const Quaternion &a, const Quaternion &b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+Matrix4x4 MakeRandomAffine(std::mt19937 &random) {
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    return MakeAffineMatrix(Vector3{scale(random), scale(random), scale(random)}, Vector3{angle(random), angle(random), angle(random)},
+                            Vector3{position(random), position(random), position(random)});
+}
+
+// SIMD版とスカラー版の比較に使う入力
+struct KernelSample {
+    float a[16];
+    float b[16];
+    float q0[4];
+    float q1[4];
+    float t;
+    Vector3 scale;
+    Vector3 rotate;
+    Vector3 translate;
+};
+
+std::vector<KernelSample> MakeKernelSamples(size_t count, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> value(-2.0f, 2.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<KernelSample> samples(count);
+    for (KernelSample &sample : samples) {
+        for (int i = 0; i < 16; ++i) {
+            sample.a[i] = value(random);
+            sample.b[i] = value(random);
+        }
+        // 逆行列が極端にならないよう対角成分を大きくする
+        for (int i = 0; i < 4; ++i) {
+            float &diagonal = sample.a[i * 5];
+            diagonal += diagonal >= 0.0f ? 4.0f : -4.0f;
+        }
+        for (int i = 0; i < 4; ++i) {
+            sample.q0[i] = value(random);
+            sample.q1[i] = value(random);
+        }
+        MathKernels::Scalar::QuaternionNormalize(sample.q0, sample.q0);
+        MathKernels::Scalar::QuaternionNormalize(sample.q1, sample.q1);
+        sample.t = unit(random);
+        sample.scale = {0.5f + unit(random), 0.5f + unit(random), 0.5f + unit(random)};
+        sample.rotate = {value(random), value(random), value(random)};
+        sample.translate = {value(random) * 10.0f, value(random) * 10.0f, value(random) * 10.0f};
+    }
+    return samples;
+}
+
+// 出力の最大絶対値を基準にした誤差(ULP)
+float MeasureUlp(const float *actual, const float *expected, int count) {
+    float scale = 0.0f;
+    float error = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        scale = (std::max)(scale, std::fabs(expected[i]));
+        error = (std::max)(error, std::fabs(actual[i] - expected[i]));
+    }
+    if (error == 0.0f) {
+        return 0.0f;
+    }
+    return error / ((std::max)(scale, 1e-30f) * 1.1920929e-7f);
+}
+
+// すべての入力での基準実装との最大誤差(ULP)
+template <typename BaselineFunction, typename OptimizedFunction>
+float MaxUlp(const std::vector<KernelSample> &samples, int outputCount, BaselineFunction baseline, OptimizedFunction optimized) {
+    float maxUlp = 0.0f;
+    for (const KernelSample &sample : samples) {
+        float expected[16] = {};
+        float actual[16] = {};
+        baseline(sample, expected);
+        optimized(sample, actual);
+        maxUlp = (std::max)(maxUlp, MeasureUlp(actual, expected, outputCount));
+    }
+    return maxUlp;
+}
+
+void CopyMatrix(const Matrix4x4 &matrix, float *out) { std::memcpy(out, &matrix, sizeof(matrix)); }
+
+} // namespace
+
+// SIMD版の演算がスカラー版と数ULP以内で一致する
+// （FMAを使う場合は丸めが1回減るので数ULPの差が出る。逆行列は計算方法が異なるため許容を広くとる）
+TEST(SimdKernelsMatchScalar) {
+    using namespace MathKernels;
+    const std::vector<KernelSample> samples = MakeKernelSamples(20000, 1);
+
+    CHECK(MaxUlp(samples, 16, [](const KernelSample &s, float *out) { Scalar::MultiplyMatrix(s.a, s.b, out); },
+                 [](const KernelSample &s, float *out) { MultiplyMatrix(s.a, s.b, out); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 4, [](const KernelSample &s, float *out) { Scalar::TransformPoint(s.b, s.a, out); },
+                 [](const KernelSample &s, float *out) { TransformPoint(s.b, s.a, out); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 4, [](const KernelSample &s, float *out) { Scalar::TransformVector(s.b, s.a, out); },
+                 [](const KernelSample &s, float *out) { TransformVector(s.b, s.a, out); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 3, [](const KernelSample &s, float *out) { Scalar::TransformNormal(s.b, s.a, out); },
+                 [](const KernelSample &s, float *out) { TransformNormal(s.b, s.a, out); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 16, [](const KernelSample &s, float *out) { Scalar::Transpose(s.a, out); },
+                 [](const KernelSample &s, float *out) { Transpose(s.a, out); }) == 0.0f);
+    CHECK(MaxUlp(samples, 16, [](const KernelSample &s, float *out) { Scalar::Inverse(s.a, out); },
+                 [](const KernelSample &s, float *out) { Inverse(s.a, out); }) <= 32.0f);
+    CHECK(MaxUlp(samples, 4, [](const KernelSample &s, float *out) { Scalar::QuaternionMultiply(s.q0, s.q1, out); },
+                 [](const KernelSample &s, float *out) { QuaternionMultiply(s.q0, s.q1, out); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 4, [](const KernelSample &s, float *out) { Scalar::QuaternionSlerp(s.q0, s.q1, s.t, out); },
+                 [](const KernelSample &s, float *out) { QuaternionSlerp(s.q0, s.q1, s.t, out); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 16, [](const KernelSample &s, float *out) { Scalar::QuaternionToMatrix(s.q0, out, false); },
+                 [](const KernelSample &s, float *out) { QuaternionToMatrix(s.q0, out, false); }) <= 4.0f);
+    CHECK(MaxUlp(samples, 16, [](const KernelSample &s, float *out) { Scalar::QuaternionToMatrix(s.q0, out, true); },
+                 [](const KernelSample &s, float *out) { QuaternionToMatrix(s.q0, out, true); }) <= 4.0f);
+}
+
+// アフィン行列の直接計算が、4x4行列積の連鎖と数ULP以内で一致する
+TEST(AffineShortcutsMatchMatrixChain) {
+    const std::vector<KernelSample> samples = MakeKernelSamples(20000, 2);
+
+    CHECK(MaxUlp(samples, 16,
+                 [](const KernelSample &s, float *out) {
+                     Matrix4x4 rotateMatrix = MakeRotateXMatrix(s.rotate.x) * MakeRotateYMatrix(s.rotate.y) * MakeRotateZMatrix(s.rotate.z);
+                     CopyMatrix(MakeScaleMatrix(s.scale) * rotateMatrix * MakeTranslateMatrix(s.translate), out);
+                 },
+                 [](const KernelSample &s, float *out) { CopyMatrix(MakeAffineMatrix(s.scale, s.rotate, s.translate), out); }) <= 8.0f);
+    CHECK(MaxUlp(samples, 16,
+                 [](const KernelSample &s, float *out) {
+                     Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                     CopyMatrix(MakeScaleMatrix(s.scale) * QuaternionToMatrix4x4(rotate) * MakeTranslateMatrix(s.translate), out);
+                 },
+                 [](const KernelSample &s, float *out) {
+                     Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                     CopyMatrix(MakeAffineMatrix(s.scale, rotate, s.translate), out);
+                 }) <= 8.0f);
+    CHECK(MaxUlp(samples, 16,
+                 [](const KernelSample &s, float *out) {
+                     Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                     CopyMatrix(MakeScaleMatrix(s.scale) * QuaternionToBoneMatrix(rotate) * MakeTranslateMatrix(s.translate), out);
+                 },
+                 [](const KernelSample &s, float *out) {
+                     Quaternion rotate(s.q0[0], s.q0[1], s.q0[2], s.q0[3]);
+                     CopyMatrix(MakeBoneMatrix(s.scale, rotate, s.translate), out);
+                 }) <= 8.0f);
+    CHECK(MaxUlp(samples, 16,
+                 [](const KernelSample &s, float *out) {
+                     Matrix4x4 a = MakeAffineMatrix(s.scale, s.rotate, s.translate);
+                     Matrix4x4 b = MakeAffineMatrix(s.scale * 0.5f, s.rotate * -1.0f, s.translate * 0.5f);
+                     CopyMatrix(a * b, out);
+                 },
+                 [](const KernelSample &s, float *out) {
+                     Matrix4x4 a = MakeAffineMatrix(s.scale, s.rotate, s.translate);
+                     Matrix4x4 b = MakeAffineMatrix(s.scale * 0.5f, s.rotate * -1.0f, s.translate * 0.5f);
+                     CopyMatrix(MultiplyAffine(a, b), out);
+                 }) <= 8.0f);
+    CHECK(MaxUlp(samples, 16,
+                 [](const KernelSample &s, float *out) { CopyMatrix(Inverse(MakeAffineMatrix(s.scale, s.rotate, s.translate)), out); },
+                 [](const KernelSample &s, float *out) { CopyMatrix(InverseAffine(MakeAffineMatrix(s.scale, s.rotate, s.translate)), out); }) <= 32.0f);
+}
+
+// アフィン行列用の掛け算・逆行列が、一般の行列の計算と一致する
+TEST(AffineMatchesGeneralMatrix) {
+    std::mt19937 random(1);
+    for (int i = 0; i < 256; ++i) {
+        Matrix4x4 a = MakeRandomAffine(random);
+        Matrix4x4 b = MakeRandomAffine(random);
+        CHECK(IsNearMatrix(MultiplyAffine(a, b), a * b));
+        CHECK(IsNearMatrix(InverseAffine(a), Inverse(a)));
+        CHECK(IsNearMatrix(MultiplyAffine(a, InverseAffine(a)), MakeIdentity4x4()));
+    }
+}
+
+// 球面線形補間は端で元の回転になり、途中でも長さが1のまま
+TEST(SlerpEndpointsAndNorm) {
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+    for (int i = 0; i < 256; ++i) {
+        Quaternion from = Quaternion::FromEulerAngles({angle(random), angle(random), angle(random)});
+        Quaternion to = Quaternion::FromEulerAngles({angle(random), angle(random), angle(random)});
+        // 端は同じ回転（近い方を回るために符号が逆になってもよい）
+        Quaternion start = Slerp(from, to, 0.0f);
+        CHECK(IsNear(std::abs(Dot(start, from)), 1.0f));
+        Quaternion end = Slerp(from, to, 1.0f);
+        CHECK(IsNear(std::abs(Dot(end, to)), 1.0f));
+        Quaternion middle = Slerp(from, to, 0.37f);
+        CHECK(IsNear(middle.x * middle.x + middle.y * middle.y + middle.z * middle.z + middle.w * middle.w, 1.0f));
+    }
+}
+
+// まとめての視錐台カリングと、1個ずつの判定が一致する
+TEST(CullAABBsMatchesIsInFrustum) {
+    constexpr uint32_t kCount = 10000;
+    std::mt19937 random(4);
+    std::uniform_real_distribution<float> halfSize(0.5f, 3.0f);
+    std::vector<AABB> worldBounds(kCount);
+    for (uint32_t i = 0; i < kCount; ++i) {
+        Vector3 extent = {halfSize(random), halfSize(random), halfSize(random)};
+        Matrix4x4 world = MakeRandomAffine(random);
+        world.m[3][0] *= 3.0f;
+        world.m[3][1] *= 3.0f;
+        world.m[3][2] *= 3.0f;
+        worldBounds[i] = TransformAABB(AABB{-extent, extent}, world);
+    }
+    Matrix4x4 view = Inverse(MakeAffineMatrix(Vector3{1.0f, 1.0f, 1.0f}, Vector3{0.3f, 0.8f, 0.0f}, Vector3{0.0f, 5.0f, -30.0f}));
+    Frustum frustum = MakeFrustum(view * MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 100.0f));
+
+    std::vector<uint8_t> visible(kCount);
+    size_t visibleCount = CullAABBs(frustum, worldBounds.data(), kCount, visible.data());
+    size_t expectedCount = 0;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        bool isInside = IsInFrustum(frustum, worldBounds[i]);
+        CHECK((visible[i] != 0) == isInside);
+        expectedCount += isInside ? 1 : 0;
+    }
+    CHECK(visibleCount == expectedCount);
+    CHECK(visibleCount > 0 && visibleCount < kCount);
+}
@@ -1,4 +1,4 @@
-#include "Random.h"
+#include "random.h"
 
 // 乱数生成器を初期化する関数
 std::mt19937& Random::GetEngine() {
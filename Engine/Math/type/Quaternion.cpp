@@ -148,11 +148,9 @@ Quaternion Quaternion::Conjugate() const {
 }
 
 Quaternion Quaternion::Normalize() const {
-    float length = std::sqrt(x * x + y * y + z * z + w * w);
-    if (length < 0.000001f) {
-        return IdentityQuaternion();
-    }
-    return Quaternion(x / length, y / length, z / length, w / length);
+    Quaternion result;
+    MathKernels::QuaternionNormalize(&x, &result.x);
+    return result;
 }
 
 Quaternion Quaternion::FromLookRotation(const Vector3 &direction, const Vector3 &up) {
@@ -212,11 +210,9 @@ Quaternion Quaternion::FromLookRotation(const Vector3 &direction, const Vector3
 }
 
 Quaternion Quaternion::operator*(const Quaternion &q) const {
-    return Quaternion(
-        w * q.x + x * q.w + y * q.z - z * q.y,
-        w * q.y - x * q.z + y * q.w + z * q.x,
-        w * q.z + x * q.y - y * q.x + z * q.w,
-        w * q.w - x * q.x - y * q.y - z * q.z);
+    Quaternion result;
+    MathKernels::QuaternionMultiply(&x, &q.x, &result.x);
+    return result;
 }
 
 Quaternion Quaternion::operator+(const Quaternion &other) const {
@@ -286,43 +282,10 @@ Quaternion Quaternion::Inverse() const {
 }
 
 Quaternion Quaternion::Slerp(const Quaternion &q1, const Quaternion &q2, float t) {
-    Quaternion q0 = q1;
-    Quaternion q1_copy = q2;
-
-    float dot = q0.Dot(q1_copy);
-
-    // 短い回転経路を選択
-    if (dot < 0.0f) {
-        q0 = Quaternion(-q0.x, -q0.y, -q0.z, -q0.w);
-        dot = -dot;
-    }
-
-    const float threshold = 0.9995f;
-    if (dot > threshold) {
-        // 線形補間
-        Quaternion result = Quaternion(
-            q0.x + t * (q1_copy.x - q0.x),
-            q0.y + t * (q1_copy.y - q0.y),
-            q0.z + t * (q1_copy.z - q0.z),
-            q0.w + t * (q1_copy.w - q0.w));
-        return result.Normalize();
-    }
-
-    // 球面線形補間
-    float theta_0 = std::acos(std::abs(dot));
-    float theta = theta_0 * t;
-
-    float sin_theta = std::sin(theta);
-    float sin_theta_0 = std::sin(theta_0);
-
-    float s0 = std::cos(theta) - dot * sin_theta / sin_theta_0;
-    float s1 = sin_theta / sin_theta_0;
-
-    return Quaternion(
-        s0 * q0.x + s1 * q1_copy.x,
-        s0 * q0.y + s1 * q1_copy.y,
-        s0 * q0.z + s1 * q1_copy.z,
-        s0 * q0.w + s1 * q1_copy.w);
+    // 短い回転経路を選択し、角度が小さい場合は線形補間
+    Quaternion result;
+    MathKernels::QuaternionSlerp(&q1.x, &q2.x, t, &result.x);
+    return result;
 }
 
 Vector3 Quaternion::GetAxis() const {
@@ -1,4 +1,5 @@
 #include "PostEffectRenderer.h"
+#include "Engine/Frame/FrameStats.h"
 
 void PostEffectRenderer::Initialize(DirectXCommon *dxCommon, SrvManager *srvManager, PipeLineManager *psoManager) {
     dxCommon_ = dxCommon;
@@ -80,6 +81,7 @@ void PostEffectRenderer::DrawToFinalResult() {
 
     // 描画
     dxCommon_->GetCommandList()->DrawInstanced(3, 1, 0, 0);
+    STAT_COUNTER_ADD("DrawCalls", 1);
 
     // バリア遷移
     dxCommon_->BarrierTransition(renderBuffer_.GetFinalResultResource().Get(),
@@ -100,6 +102,7 @@ void PostEffectRenderer::CopyFinalResultToBackBuffer() {
 
     // 描画
     dxCommon_->GetCommandList()->DrawInstanced(3, 1, 0, 0);
+    STAT_COUNTER_ADD("DrawCalls", 1);
 }
 
 void PostEffectRenderer::DrawSingleEffect(ShaderMode mode, bool isFirstInput, int inputPingPongIndex, int outputRtvIndex,
@@ -156,6 +159,7 @@ void PostEffectRenderer::DrawSingleEffect(ShaderMode mode, bool isFirstInput, in
 
     // 描画
     dxCommon_->GetCommandList()->DrawInstanced(3, 1, 0, 0);
+    STAT_COUNTER_ADD("DrawCalls", 1);
 
     // バリア遷移
     if (outputRtvIndex == -2) {
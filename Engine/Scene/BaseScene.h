@@ -7,10 +7,9 @@
 #include "Particle/ParticleCommon.h"
 #include "Particle/ParticleEditor.h"
 #include "Particle/ParticleEmitter.h"
-#include "SpriteCommon.h"
 #include "Camera/ViewProjection/ViewProjection.h"
 #include "Transform/WorldTransform.h"
-#include "line/DrawLine3D.h"
+#include "Line/DrawLine3D.h"
 #include"Object/Base/BaseObjectManager.h"
 #include"Sprite.h"
 #include"Object/Base/BaseObject.h"
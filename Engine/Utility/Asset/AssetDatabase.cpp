@@ -0,0 +1,458 @@
+#include "AssetDatabase.h"
+#include <algorithm>
+#include <cctype>
+#include <externals/nlohmann/json.hpp>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <unordered_set>
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+AssetDatabase *AssetDatabase::instance = nullptr;
+
+namespace {
+
+const uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+const uint64_t kFnvPrime = 1099511628211ull;
+
+uint64_t HashBytes(const void *data, size_t size, uint64_t hash = kFnvOffsetBasis) {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+// 行頭のキーワードに続く値を取り出す（"mtllib xxx.mtl" など）
+bool ReadKeywordValue(const std::string &line, const std::string &keyword, std::string &value) {
+    std::istringstream stream(line);
+    std::string identifier;
+    stream >> identifier;
+    if (identifier != keyword) {
+        return false;
+    }
+    std::getline(stream >> std::ws, value);
+    // 末尾の空白・改行を除去
+    while (!value.empty() && (value.back() == '\r' || value.back() == ' ' || value.back() == '\t')) {
+        value.pop_back();
+    }
+    return !value.empty();
+}
+
+} // namespace
+
+AssetDatabase *AssetDatabase::GetInstance() {
+    if (instance == nullptr) {
+        instance = new AssetDatabase();
+    }
+    return instance;
+}
+
+void AssetDatabase::Initialize(const std::string &rootPath, const std::string &cachePath) {
+    rootPath_ = rootPath;
+    cachePath_ = cachePath;
+
+    // 前回の結果を読み込んでから、変わったファイルだけ未計算に戻す
+    LoadCache();
+    Scan();
+}
+
+void AssetDatabase::Finalize() {
+    SaveCache();
+
+    delete instance;
+    instance = nullptr;
+}
+
+void AssetDatabase::Scan() {
+    if (!fs::exists(rootPath_) || !fs::is_directory(rootPath_)) {
+        return;
+    }
+
+    // ディレクトリの走査はロックせずに行う
+    std::unordered_map<AssetID, AssetEntry> scanned;
+    for (const auto &file : fs::recursive_directory_iterator(rootPath_)) {
+        if (!file.is_regular_file()) {
+            continue;
+        }
+
+        AssetEntry entry;
+        entry.path = fs::relative(file.path(), rootPath_).generic_string();
+        entry.id = MakeAssetID(entry.path);
+        entry.type = DetectType(NormalizePath(entry.path));
+        entry.fileSize = static_cast<uint64_t>(file.file_size());
+        entry.lastWriteTime = static_cast<int64_t>(file.last_write_time().time_since_epoch().count());
+        scanned.emplace(entry.id, std::move(entry));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &[id, entry] : scanned) {
+        // サイズと更新時刻が同じなら前回の結果を再利用（変わったものは参照されたときに計算する）
+        auto previous = entries_.find(id);
+        if (previous != entries_.end() &&
+            previous->second.fileSize == entry.fileSize &&
+            previous->second.lastWriteTime == entry.lastWriteTime) {
+            entry.contentHash = previous->second.contentHash;
+            entry.dependencies = std::move(previous->second.dependencies);
+        }
+    }
+
+    // 削除されたファイルは自然に消える
+    entries_ = std::move(scanned);
+}
+
+std::string AssetDatabase::NormalizePath(const std::string &path) {
+    std::string result = path;
+
+    // 区切り文字を統一して小文字化
+    std::replace(result.begin(), result.end(), '\\', '/');
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    // 連続した区切り文字をまとめる
+    result.erase(std::unique(result.begin(), result.end(), [](char a, char b) { return a == '/' && b == '/'; }), result.end());
+
+    // 先頭の "./" と "resources/" を除去
+    while (result.rfind("./", 0) == 0) {
+        result.erase(0, 2);
+    }
+    if (result.rfind("resources/", 0) == 0) {
+        result.erase(0, std::string("resources/").size());
+    }
+    return result;
+}
+
+AssetID AssetDatabase::MakeAssetID(const std::string &path) {
+    std::string normalized = NormalizePath(path);
+    return HashBytes(normalized.data(), normalized.size());
+}
+
+std::optional<AssetEntry> AssetDatabase::Find(AssetID id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    EnsureHashed(it->second);
+    return it->second;
+}
+
+std::unordered_map<AssetID, AssetEntry> AssetDatabase::GetEntries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_;
+}
+
+std::string AssetDatabase::GetFullPath(AssetID id) const {
+    // パスの解決だけならファイルを読む必要はない
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return "";
+    }
+    return rootPath_ + "/" + it->second.path;
+}
+
+std::string AssetDatabase::ResolvePath(const std::string &path) const {
+    std::string fullPath = GetFullPath(MakeAssetID(path));
+    if (fullPath.empty()) {
+        return path;
+    }
+    return fullPath;
+}
+
+void AssetDatabase::EnsureHashed(AssetEntry &entry) const {
+    if (entry.contentHash != 0) {
+        return;
+    }
+    entry.contentHash = HashFile(fs::path(rootPath_) / entry.path);
+    ExtractDependencies(entry);
+}
+
+std::vector<AssetID> AssetDatabase::GetDependencies(AssetID id, bool recursive) const {
+    std::optional<AssetEntry> entry = Find(id);
+    if (!entry) {
+        return {};
+    }
+    if (!recursive) {
+        return entry->dependencies;
+    }
+
+    std::vector<AssetID> result;
+    std::unordered_set<AssetID> visited = {id};
+    std::vector<AssetID> stack(entry->dependencies.rbegin(), entry->dependencies.rend());
+    while (!stack.empty()) {
+        AssetID current = stack.back();
+        stack.pop_back();
+        if (!visited.insert(current).second) {
+            continue;
+        }
+        result.push_back(current);
+        if (std::optional<AssetEntry> child = Find(current)) {
+            stack.insert(stack.end(), child->dependencies.rbegin(), child->dependencies.rend());
+        }
+    }
+    return result;
+}
+
+uint64_t AssetDatabase::GetCombinedHash(AssetID id) const {
+    std::optional<AssetEntry> entry = Find(id);
+    if (!entry) {
+        return 0;
+    }
+
+    uint64_t hash = HashBytes(&entry->contentHash, sizeof(entry->contentHash));
+    for (AssetID dependency : GetDependencies(id, true)) {
+        std::optional<AssetEntry> child = Find(dependency);
+        // 存在しない依存先はIDだけ混ぜる（後から追加されたら変化する）
+        uint64_t childHash = child ? child->contentHash : dependency;
+        hash = HashBytes(&childHash, sizeof(childHash), hash);
+    }
+    return hash;
+}
+
+bool AssetDatabase::NeedsCook(AssetID id) const {
+    uint64_t cookedHash = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = cookedHashes_.find(id);
+        if (it == cookedHashes_.end()) {
+            return true;
+        }
+        cookedHash = it->second;
+    }
+    // GetCombinedHashは中でロックするのでロックの外で呼ぶ
+    return cookedHash != GetCombinedHash(id);
+}
+
+void AssetDatabase::MarkCooked(AssetID id) {
+    uint64_t hash = GetCombinedHash(id);
+    std::lock_guard<std::mutex> lock(mutex_);
+    cookedHashes_[id] = hash;
+}
+
+void AssetDatabase::SaveCache() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    json root;
+    json assets = json::array();
+    for (const auto &[id, entry] : entries_) {
+        json item;
+        item["path"] = entry.path;
+        item["hash"] = entry.contentHash;
+        item["size"] = entry.fileSize;
+        item["time"] = entry.lastWriteTime;
+        item["dependencies"] = entry.dependencies;
+        assets.push_back(item);
+    }
+    root["assets"] = assets;
+
+    json cooked = json::object();
+    for (const auto &[id, hash] : cookedHashes_) {
+        cooked[std::to_string(id)] = hash;
+    }
+    root["cooked"] = cooked;
+
+    // キャッシュはアセットのルートの外に置く（resources/ を汚さない）
+    std::error_code ec;
+    fs::path parent = fs::path(cachePath_).parent_path();
+    if (!parent.empty()) {
+        fs::create_directories(parent, ec);
+    }
+
+    std::ofstream file(cachePath_);
+    if (file.is_open()) {
+        file << root.dump();
+    }
+}
+
+void AssetDatabase::LoadCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    cookedHashes_.clear();
+
+    std::ifstream file(cachePath_);
+    if (!file.is_open()) {
+        return;
+    }
+
+    json root;
+    try {
+        file >> root;
+    } catch (const json::exception &) {
+        // 壊れたキャッシュは無視して全件再計算
+        return;
+    }
+
+    if (root.contains("assets") && root["assets"].is_array()) {
+        for (const auto &item : root["assets"]) {
+            AssetEntry entry;
+            entry.path = item.value("path", "");
+            if (entry.path.empty()) {
+                continue;
+            }
+            entry.id = MakeAssetID(entry.path);
+            entry.type = DetectType(NormalizePath(entry.path));
+            entry.contentHash = item.value("hash", uint64_t(0));
+            entry.fileSize = item.value("size", uint64_t(0));
+            entry.lastWriteTime = item.value("time", int64_t(0));
+            if (item.contains("dependencies")) {
+                entry.dependencies = item["dependencies"].get<std::vector<AssetID>>();
+            }
+            entries_.emplace(entry.id, std::move(entry));
+        }
+    }
+
+    if (root.contains("cooked") && root["cooked"].is_object()) {
+        for (const auto &[key, value] : root["cooked"].items()) {
+            cookedHashes_[std::stoull(key)] = value.get<uint64_t>();
+        }
+    }
+}
+
+void AssetDatabase::ExtractDependencies(AssetEntry &entry) const {
+    entry.dependencies.clear();
+
+    const std::string normalized = NormalizePath(entry.path);
+    const std::string fullPath = rootPath_ + "/" + entry.path;
+    const std::string directory = fs::path(entry.path).parent_path().generic_string();
+
+    auto addDependency = [&entry](const std::string &path) {
+        AssetID id = MakeAssetID(path);
+        if (std::find(entry.dependencies.begin(), entry.dependencies.end(), id) == entry.dependencies.end()) {
+            entry.dependencies.push_back(id);
+        }
+    };
+
+    const std::string extension = fs::path(normalized).extension().string();
+
+    if (extension == ".obj" || extension == ".mtl") {
+        std::ifstream file(fullPath);
+        std::string line;
+        std::string value;
+        while (std::getline(file, line)) {
+            if (ReadKeywordValue(line, "mtllib", value)) {
+                // .mtlは.objと同じディレクトリ
+                addDependency(directory + "/" + value);
+            } else if (ReadKeywordValue(line, "map_Kd", value)) {
+                // テクスチャは resources/images/ 基準（Material::LoadTexture と同じ）
+                addDependency("images/" + value);
+            }
+        }
+        return;
+    }
+
+    if (extension != ".gltf" && extension != ".json") {
+        return;
+    }
+
+    std::ifstream file(fullPath);
+    json data;
+    try {
+        file >> data;
+    } catch (const json::exception &) {
+        return;
+    }
+    if (!data.is_object()) {
+        return;
+    }
+
+    if (extension == ".gltf") {
+        // 外部バッファ(.bin)はgltfと同じディレクトリ
+        if (data.contains("buffers") && data["buffers"].is_array()) {
+            for (const auto &buffer : data["buffers"]) {
+                if (buffer.contains("uri") && buffer["uri"].is_string()) {
+                    std::string uri = buffer["uri"];
+                    if (uri.rfind("data:", 0) != 0) {
+                        addDependency(directory + "/" + uri);
+                    }
+                }
+            }
+        }
+        if (data.contains("images") && data["images"].is_array()) {
+            for (const auto &image : data["images"]) {
+                if (image.contains("uri") && image["uri"].is_string()) {
+                    std::string uri = image["uri"];
+                    if (uri.rfind("data:", 0) != 0) {
+                        addDependency("images/" + uri);
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    // パーティクルエミッター → パーティクルグループ
+    if (normalized.rfind("jsons/particle/", 0) == 0) {
+        if (data.contains("GroupNames") && data["GroupNames"].is_array()) {
+            for (const auto &groupName : data["GroupNames"]) {
+                if (groupName.is_string()) {
+                    addDependency("jsons/ParticleGroup/" + groupName.get<std::string>() + ".json");
+                }
+            }
+        }
+        return;
+    }
+
+    // パーティクルグループ → モデル・テクスチャ
+    if (normalized.rfind("jsons/particlegroup/", 0) == 0) {
+        std::string modelPath = data.value("modelfilePath", "");
+        if (!modelPath.empty()) {
+            addDependency("models/" + modelPath);
+        }
+        std::string texturePath = data.value("textrueName", "");
+        if (!texturePath.empty()) {
+            addDependency("images/" + texturePath);
+        }
+    }
+}
+
+AssetType AssetDatabase::DetectType(const std::string &normalizedPath) {
+    const std::string extension = fs::path(normalizedPath).extension().string();
+
+    if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".dds") {
+        return AssetType::kTexture;
+    }
+    if (extension == ".obj" || extension == ".gltf" || extension == ".glb") {
+        return AssetType::kModel;
+    }
+    if (extension == ".mtl") {
+        return AssetType::kMaterial;
+    }
+    if (extension == ".bin") {
+        // glTFの外部バッファ（モデルの依存先）
+        return AssetType::kModelBuffer;
+    }
+    if (extension == ".json") {
+        return AssetType::kJson;
+    }
+    if (extension == ".hlsl" || extension == ".hlsli") {
+        return AssetType::kShader;
+    }
+    if (extension == ".ttf" || extension == ".otf") {
+        return AssetType::kFont;
+    }
+    if (extension == ".wav" || extension == ".ogg" || extension == ".mp3" || extension == ".flac") {
+        return AssetType::kAudio;
+    }
+    return AssetType::kUnknown;
+}
+
+uint64_t AssetDatabase::HashFile(const fs::path &filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return 0;
+    }
+
+    uint64_t hash = kFnvOffsetBasis;
+    std::vector<char> buffer(64 * 1024);
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        std::streamsize readSize = file.gcount();
+        if (readSize <= 0) {
+            break;
+        }
+        hash = HashBytes(buffer.data(), static_cast<size_t>(readSize), hash);
+    }
+    return hash;
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// アセットID（resources/ からの正規化パスのハッシュ）
+using AssetID = uint64_t;
+
+/// <summary>
+/// アセットの種類
+/// </summary>
+enum class AssetType {
+    kUnknown,
+    kTexture,
+    kModel,
+    kMaterial,
+    kModelBuffer, // glTFの外部バッファ(.bin)
+    kAnimation,
+    kJson,
+    kShader,
+    kFont,
+    kAudio,
+};
+
+/// <summary>
+/// アセット1件分の情報
+/// </summary>
+struct AssetEntry {
+    AssetID id = 0;                    // アセットID
+    std::string path;                  // resources/ からの正規化済み相対パス
+    AssetType type = AssetType::kUnknown;
+    uint64_t contentHash = 0;          // ファイル内容のハッシュ（0なら未計算）
+    uint64_t fileSize = 0;             // ファイルサイズ
+    int64_t lastWriteTime = 0;         // 最終更新時刻
+    std::vector<AssetID> dependencies; // 依存しているアセット
+};
+
+/// <summary>
+/// resources/ 以下のアセットを一元管理するデータベース
+/// </summary>
+class AssetDatabase {
+  private:
+    static AssetDatabase *instance;
+
+    AssetDatabase() = default;
+    ~AssetDatabase() = default;
+    AssetDatabase(AssetDatabase &) = delete;
+    AssetDatabase &operator=(AssetDatabase &) = delete;
+
+  public:
+    /// <summary>
+    /// シングルトンインスタンスの取得
+    /// </summary>
+    static AssetDatabase *GetInstance();
+
+    /// <summary>
+    /// 初期化（キャッシュを読み込んでからスキャンする）
+    /// </summary>
+    /// <param name="rootPath">アセットのルートディレクトリ</param>
+    /// <param name="cachePath">キャッシュファイルの保存先（アセットのルートの外に置く）</param>
+    void Initialize(const std::string &rootPath = "resources", const std::string &cachePath = "cache/AssetDatabase.cache");
+
+    /// <summary>
+    /// 終了（キャッシュを保存する）
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// ルート以下を走査してデータベースを更新
+    /// ここではサイズと更新時刻だけを見て、変わったファイルのハッシュは初めて参照したときに計算する
+    /// </summary>
+    void Scan();
+
+    /// <summary>
+    /// パスの正規化（区切り文字の統一、小文字化、先頭の"resources/"除去）
+    /// </summary>
+    static std::string NormalizePath(const std::string &path);
+
+    /// <summary>
+    /// パスからアセットIDを作成
+    /// </summary>
+    static AssetID MakeAssetID(const std::string &path);
+
+    /// <summary>
+    /// アセットの検索（内容ハッシュと依存関係が未計算ならここで計算する）
+    /// Scanで差し替えられても使えるようにコピーを返す
+    /// </summary>
+    std::optional<AssetEntry> Find(AssetID id) const;
+    std::optional<AssetEntry> Find(const std::string &path) const { return Find(MakeAssetID(path)); }
+
+    /// <summary>
+    /// 実ファイルのパスを取得
+    /// </summary>
+    std::string GetFullPath(AssetID id) const;
+
+    /// <summary>
+    /// ローダー用のパス解決（登録済みなら実ファイルのパス、未登録なら渡されたパスをそのまま返す）
+    /// </summary>
+    std::string ResolvePath(const std::string &path) const;
+
+    /// <summary>
+    /// 依存アセットを取得
+    /// </summary>
+    /// <param name="recursive">依存先の依存も含めるか</param>
+    std::vector<AssetID> GetDependencies(AssetID id, bool recursive = false) const;
+
+    /// <summary>
+    /// 自身と依存先すべての内容を合成したハッシュ
+    /// </summary>
+    uint64_t GetCombinedHash(AssetID id) const;
+
+    /// <summary>
+    /// 前回の加工(クック)以降にソースが変更されたか
+    /// </summary>
+    bool NeedsCook(AssetID id) const;
+
+    /// <summary>
+    /// 加工済みとして現在のハッシュを記録
+    /// </summary>
+    void MarkCooked(AssetID id);
+
+    /// <summary>
+    /// キャッシュファイルの保存
+    /// </summary>
+    void SaveCache() const;
+
+    /// <summary>
+    /// 登録済みの全アセット（その時点のコピー）
+    /// </summary>
+    std::unordered_map<AssetID, AssetEntry> GetEntries() const;
+
+  private:
+    /// <summary>
+    /// キャッシュファイルの読み込み
+    /// </summary>
+    void LoadCache();
+
+    /// <summary>
+    /// 内容ハッシュと依存関係が未計算なら計算する（mutex_をロックしてから呼ぶ）
+    /// </summary>
+    void EnsureHashed(AssetEntry &entry) const;
+
+    /// <summary>
+    /// ファイル内容から依存関係を抽出
+    /// </summary>
+    void ExtractDependencies(AssetEntry &entry) const;
+
+    static AssetType DetectType(const std::string &normalizedPath);
+    static uint64_t HashFile(const std::filesystem::path &filePath);
+
+  private:
+    std::string rootPath_ = "resources";
+    std::string cachePath_ = "cache/AssetDatabase.cache";
+
+    // ハッシュを参照時に計算して書き込むのでmutable（登録済みのエントリの追加・削除はScanだけ）
+    mutable std::unordered_map<AssetID, AssetEntry> entries_;
+    // 加工時のハッシュ
+    std::unordered_map<AssetID, uint64_t> cookedHashes_;
+    // entries_ と cookedHashes_ を守る（ScanとFindが別スレッドから呼ばれてもよい）
+    mutable std::mutex mutex_;
+};
@@ -0,0 +1,137 @@
+#include "Asset/AssetDatabase.h"
+#include "Test/Test.h"
+#include <algorithm>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const fs::path kRoot = "AssetDatabaseTestData";
+const std::string kResources = (kRoot / "resources").generic_string();
+const std::string kCache = (kRoot / "cache/AssetDatabase.cache").generic_string();
+
+void WriteFile(const fs::path &filePath, const std::string &text) {
+    fs::create_directories(filePath.parent_path());
+    std::ofstream file(filePath);
+    file << text;
+}
+
+// 更新時刻を確実に変える（ファイルシステムの時刻の細かさに依存しない）
+void TouchLater(const fs::path &filePath) {
+    fs::last_write_time(filePath, fs::last_write_time(filePath) + std::chrono::seconds(2));
+}
+
+// ハッシュを計算させずに現在の内容ハッシュを見る
+uint64_t PeekContentHash(AssetID id) {
+    std::unordered_map<AssetID, AssetEntry> entries = AssetDatabase::GetInstance()->GetEntries();
+    auto it = entries.find(id);
+    return it == entries.end() ? 0 : it->second.contentHash;
+}
+
+} // namespace
+
+// アセットIDは正規化したパスのFNV-1aで、表記ゆれがあっても同じになる
+TEST(StablePathIDs) {
+    CHECK(AssetDatabase::MakeAssetID("") == 14695981039346656037ull);
+    CHECK(AssetDatabase::MakeAssetID("a") == 0xaf63dc4c8601ec8cull);
+    CHECK(AssetDatabase::MakeAssetID("resources/A") == AssetDatabase::MakeAssetID("a"));
+    CHECK(AssetDatabase::MakeAssetID(".\\Resources\\Models//Cube.OBJ") == AssetDatabase::MakeAssetID("models/cube.obj"));
+    CHECK(AssetDatabase::MakeAssetID("models/cube.obj") != AssetDatabase::MakeAssetID("models/cube.mtl"));
+}
+
+// 拡張子から種類を判定する
+TEST(DetectsTypes) {
+    fs::remove_all(kRoot);
+    WriteFile(kRoot / "resources/sounds/bgm.flac", "fLaC");
+    WriteFile(kRoot / "resources/sounds/se.wav", "RIFF");
+    WriteFile(kRoot / "resources/images/a.png", "png");
+
+    AssetDatabase::GetInstance()->Initialize(kResources, kCache);
+    CHECK(AssetDatabase::GetInstance()->Find("sounds/bgm.flac")->type == AssetType::kAudio);
+    CHECK(AssetDatabase::GetInstance()->Find("sounds/se.wav")->type == AssetType::kAudio);
+    CHECK(AssetDatabase::GetInstance()->Find("images/a.png")->type == AssetType::kTexture);
+    CHECK(!AssetDatabase::GetInstance()->Find("images/missing.png"));
+
+    AssetDatabase::GetInstance()->Finalize();
+    fs::remove_all(kRoot);
+}
+
+// 内容ハッシュは初めて参照したときに計算し、更新時刻が変わったファイルだけ計算し直す
+TEST(LazyContentHash) {
+    fs::remove_all(kRoot);
+    WriteFile(kRoot / "resources/jsons/changed.json", "{}");
+    WriteFile(kRoot / "resources/jsons/kept.json", "[]");
+    const AssetID changed = AssetDatabase::MakeAssetID("jsons/changed.json");
+    const AssetID kept = AssetDatabase::MakeAssetID("jsons/kept.json");
+
+    AssetDatabase *assetDatabase = AssetDatabase::GetInstance();
+    assetDatabase->Initialize(kResources, kCache);
+    CHECK(PeekContentHash(changed) == 0);
+    CHECK(PeekContentHash(kept) == 0);
+
+    const uint64_t before = assetDatabase->Find(changed)->contentHash;
+    const uint64_t keptHash = assetDatabase->Find(kept)->contentHash;
+    CHECK(before != 0 && keptHash != 0);
+    CHECK(PeekContentHash(changed) == before);
+
+    WriteFile(kRoot / "resources/jsons/changed.json", "{\"a\":1}");
+    TouchLater(kRoot / "resources/jsons/changed.json");
+    assetDatabase->Scan();
+    CHECK(PeekContentHash(changed) == 0);
+    CHECK(PeekContentHash(kept) == keptHash);
+
+    const uint64_t after = assetDatabase->Find(changed)->contentHash;
+    CHECK(after != 0 && after != before);
+
+    // キャッシュに保存した結果は次回の起動でも使われる
+    assetDatabase->Finalize();
+    AssetDatabase::GetInstance()->Initialize(kResources, kCache);
+    CHECK(PeekContentHash(changed) == after);
+    CHECK(PeekContentHash(kept) == keptHash);
+
+    AssetDatabase::GetInstance()->Finalize();
+    fs::remove_all(kRoot);
+}
+
+// 依存先（.obj → .mtl → テクスチャ）の変更が加工判定に伝わる
+TEST(DependenciesPropagateToCookHash) {
+    fs::remove_all(kRoot);
+    WriteFile(kRoot / "resources/models/cube/cube.obj", "mtllib cube.mtl\nv 0 0 0\n");
+    WriteFile(kRoot / "resources/models/cube/cube.mtl", "newmtl m\nmap_Kd cube.png\n");
+    WriteFile(kRoot / "resources/images/cube.png", "red");
+    WriteFile(kRoot / "resources/images/other.png", "blue");
+    const AssetID obj = AssetDatabase::MakeAssetID("models/cube/cube.obj");
+    const AssetID mtl = AssetDatabase::MakeAssetID("models/cube/cube.mtl");
+    const AssetID texture = AssetDatabase::MakeAssetID("images/cube.png");
+
+    AssetDatabase *assetDatabase = AssetDatabase::GetInstance();
+    assetDatabase->Initialize(kResources, kCache);
+
+    std::vector<AssetID> direct = assetDatabase->GetDependencies(obj);
+    CHECK(direct.size() == 1 && direct[0] == mtl);
+    std::vector<AssetID> all = assetDatabase->GetDependencies(obj, true);
+    CHECK(all.size() == 2);
+    CHECK(std::find(all.begin(), all.end(), texture) != all.end());
+
+    CHECK(assetDatabase->NeedsCook(obj));
+    assetDatabase->MarkCooked(obj);
+    CHECK(!assetDatabase->NeedsCook(obj));
+
+    // 依存していないファイルの変更では加工し直さない
+    WriteFile(kRoot / "resources/images/other.png", "green");
+    TouchLater(kRoot / "resources/images/other.png");
+    assetDatabase->Scan();
+    CHECK(!assetDatabase->NeedsCook(obj));
+
+    // 孫の依存先が変わると加工し直す
+    WriteFile(kRoot / "resources/images/cube.png", "blue");
+    TouchLater(kRoot / "resources/images/cube.png");
+    assetDatabase->Scan();
+    CHECK(assetDatabase->NeedsCook(obj));
+    assetDatabase->MarkCooked(obj);
+    CHECK(!assetDatabase->NeedsCook(obj));
+
+    assetDatabase->Finalize();
+    fs::remove_all(kRoot);
+}
@@ -0,0 +1,929 @@
+#include "EngineBenchmark.h"
+#include "Animation/Animator.h"
+#include "Animation/Bone.h"
+#include "Collider/CollisionManager.h"
+#include "Data/DataHandler.h"
+#include "Edit/LevelData.h"
+#include "Graphics/RenderQueue/RenderQueue.h"
+#include "Object/ModelInstancing.h"
+#include "Particle/ParticleSystem.h"
+#include "SpriteBatch.h"
+#include "Line/DrawLine3D.h"
+#include "externals/nlohmann/json.hpp"
+#include "myMath.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// ---- 結果のハッシュ（FNV-1a） ----
+constexpr uint64_t kHashBasis = 14695981039346656037ull;
+
+uint64_t HashValue(uint64_t hash, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        hash ^= (value >> (i * 8)) & 0xff;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t HashFloat(uint64_t hash, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return HashValue(hash, bits);
+}
+
+uint64_t HashVector3(uint64_t hash, const Vector3 &value) {
+    hash = HashFloat(hash, value.x);
+    hash = HashFloat(hash, value.y);
+    return HashFloat(hash, value.z);
+}
+
+/// <summary>
+/// setupの後にbodyを計測する。1回目は空回しとして捨てる
+/// bodyの返すハッシュは結果を使わせて最適化で消されないようにするためのもので、レポートにも出す
+/// </summary>
+template <typename Setup, typename Body>
+EngineBenchmarkResult Measure(const char *name, uint32_t operations, uint32_t repeats, Setup setup, Body body) {
+    EngineBenchmarkResult result;
+    result.name = name;
+    result.operations = operations;
+    result.repeats = repeats;
+
+    std::vector<double> timesUs;
+    timesUs.reserve(repeats);
+    for (uint32_t i = 0; i <= repeats; ++i) {
+        setup();
+        Clock::time_point begin = Clock::now();
+        uint64_t checksum = body();
+        Clock::time_point end = Clock::now();
+
+        if (i == 0) {
+            result.checksum = checksum;
+            continue;
+        }
+        timesUs.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+    }
+
+    std::sort(timesUs.begin(), timesUs.end());
+    result.medianUs = timesUs[(timesUs.size() - 1) / 2];
+    result.p95Us = timesUs[(timesUs.size() - 1) * 95 / 100];
+    result.minUs = timesUs.front();
+    result.nsPerOperation = operations > 0 ? result.medianUs * 1000.0 / operations : 0.0;
+    return result;
+}
+
+// ランダムな姿勢（回転はオイラー角）
+struct RandomTransform {
+    Vector3 scale;
+    Vector3 rotate;
+    Vector3 translate;
+};
+
+RandomTransform MakeRandomTransform(std::mt19937 &random) {
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    std::uniform_real_distribution<float> angle(-3.14f, 3.14f);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    return {
+        {scale(random), scale(random), scale(random)},
+        {angle(random), angle(random), angle(random)},
+        {position(random), position(random), position(random)},
+    };
+}
+
+// 回転行列の各行を軸にしたOBB
+OBB MakeOBB(const Vector3 &center, const Vector3 &halfSize, const Matrix4x4 &rotateMatrix) {
+    OBB obb;
+    obb.rotationCenter = center;
+    obb.scaleCenter = center;
+    obb.scaleCenterRotated = center;
+    obb.size = halfSize;
+    for (int i = 0; i < 3; ++i) {
+        obb.orientations[i] = {rotateMatrix.m[i][0], rotateMatrix.m[i][1], rotateMatrix.m[i][2]};
+    }
+    return obb;
+}
+
+// 二分木になるようにノードを作る（index番のノードの子は2*index+1, 2*index+2）
+Node MakeJointNode(uint32_t index, uint32_t jointCount, std::mt19937 &random) {
+    std::uniform_real_distribution<float> value(-0.5f, 0.5f);
+    Node node;
+    node.name = "joint_" + std::to_string(index);
+    node.transform.scale = {1.0f, 1.0f, 1.0f};
+    node.transform.rotate = Quaternion::FromEulerAngles({value(random), value(random), value(random)});
+    node.transform.translate = {value(random), 1.0f, value(random)};
+    node.localMatrix = MakeAffineMatrix(node.transform.scale, node.transform.rotate, node.transform.translate);
+    for (uint32_t child = index * 2 + 1; child <= index * 2 + 2 && child < jointCount; ++child) {
+        node.children.push_back(MakeJointNode(child, jointCount, random));
+    }
+    return node;
+}
+
+// 子も含めたオブジェクト数
+template <typename ObjectData>
+uint32_t CountObjects(const std::vector<ObjectData> &objects) {
+    uint32_t count = 0;
+    for (const ObjectData &object : objects) {
+        count += 1 + CountObjects(object.children);
+    }
+    return count;
+}
+
+// size x size マスの格子メッシュ。shuffleなら三角形の順番を混ぜる（並びの悪いインポート結果を想定）
+void MakeGridMesh(uint32_t size, bool shuffle, std::vector<VertexData> &vertices, std::vector<uint32_t> &indices) {
+    const uint32_t columns = size + 1;
+    vertices.assign(columns * columns, VertexData{});
+    for (uint32_t i = 0; i < vertices.size(); ++i) {
+        float x = static_cast<float>(i % columns);
+        float z = static_cast<float>(i / columns);
+        vertices[i].position = {x, 0.0f, z, 1.0f};
+        vertices[i].texcoord = {x / size, z / size};
+        vertices[i].normal = {0.0f, 1.0f, 0.0f};
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    triangles.reserve(size * size * 2);
+    for (uint32_t z = 0; z < size; ++z) {
+        for (uint32_t x = 0; x < size; ++x) {
+            uint32_t v = z * columns + x;
+            triangles.push_back({v, v + columns, v + 1});
+            triangles.push_back({v + 1, v + columns, v + columns + 1});
+        }
+    }
+    if (shuffle) {
+        std::mt19937 random(EngineBenchmark::kSeed);
+        std::shuffle(triangles.begin(), triangles.end(), random);
+    }
+
+    indices.clear();
+    indices.reserve(triangles.size() * 3);
+    for (const auto &triangle : triangles) {
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+}
+
+} // namespace
+
+std::vector<EngineBenchmarkResult> EngineBenchmark::Run(uint32_t repeats) {
+    repeats = (std::max)(repeats, 1u);
+    std::vector<EngineBenchmarkResult> results;
+    RunMath(results, repeats);
+    RunCollision(results, repeats);
+    RunParticle(results, repeats);
+    RunRender(results, repeats);
+    RunAnimation(results, repeats);
+    RunJson(results, repeats);
+    RunMesh(results, repeats);
+    return results;
+}
+
+void EngineBenchmark::RunMath(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    constexpr uint32_t kTransformCount = 1024;
+    constexpr uint32_t kOperations = 100000;
+
+    std::mt19937 random(kSeed);
+    std::vector<RandomTransform> transforms(kTransformCount);
+    std::vector<Quaternion> rotations(kTransformCount);
+    for (uint32_t i = 0; i < kTransformCount; ++i) {
+        transforms[i] = MakeRandomTransform(random);
+        rotations[i] = Quaternion::FromEulerAngles(transforms[i].rotate);
+    }
+
+    // 親子の合成と逆行列（ワールド変換と視点行列の計算に相当）
+    results.push_back(Measure("math/affine_compose_inverse", kOperations, repeats, [] {}, [&] {
+        uint64_t hash = kHashBasis;
+        Matrix4x4 parent = MakeIdentity4x4();
+        for (uint32_t i = 0; i < kOperations; ++i) {
+            const RandomTransform &transform = transforms[i % kTransformCount];
+            Matrix4x4 local = MakeAffineMatrix(transform.scale, rotations[i % kTransformCount], transform.translate);
+            Matrix4x4 world = MultiplyAffine(local, parent);
+            Matrix4x4 inverse = InverseAffine(world);
+            // 行列が発散しないよう、親は一定間隔で戻す
+            parent = (i % 8 == 7) ? MakeIdentity4x4() : world;
+            if (i % 1024 == 0) {
+                hash = HashFloat(hash, inverse.m[3][0]);
+                hash = HashFloat(hash, world.m[3][1]);
+            }
+        }
+        return hash;
+    }));
+
+    // クォータニオンの球面線形補間（アニメーションのブレンドに相当）
+    results.push_back(Measure("math/quaternion_slerp", kOperations, repeats, [] {}, [&] {
+        uint64_t hash = kHashBasis;
+        for (uint32_t i = 0; i < kOperations; ++i) {
+            const Quaternion &from = rotations[i % kTransformCount];
+            const Quaternion &to = rotations[(i * 7 + 1) % kTransformCount];
+            Quaternion blended = Slerp(from, to, static_cast<float>(i % 100) / 100.0f);
+            if (i % 1024 == 0) {
+                hash = HashFloat(hash, blended.w);
+            }
+        }
+        return hash;
+    }));
+}
+
+void EngineBenchmark::RunCollision(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    constexpr uint32_t kShapeCount = 1024;
+    constexpr uint32_t kOperations = 50000;
+
+    std::mt19937 random(kSeed);
+    std::uniform_real_distribution<float> halfSize(0.5f, 3.0f);
+    std::vector<Sphere> spheres(kShapeCount);
+    std::vector<AABB> aabbs(kShapeCount);
+    std::vector<OBB> obbs(kShapeCount);
+    std::vector<Matrix4x4> rotateMatrices(kShapeCount);
+    for (uint32_t i = 0; i < kShapeCount; ++i) {
+        RandomTransform transform = MakeRandomTransform(random);
+        Vector3 extent = {halfSize(random), halfSize(random), halfSize(random)};
+        spheres[i] = {transform.translate, extent.x};
+        aabbs[i] = {transform.translate - extent, transform.translate + extent};
+        rotateMatrices[i] = MakeRotateXYZMatrix(transform.rotate);
+        obbs[i] = MakeOBB(transform.translate, extent, rotateMatrices[i]);
+    }
+
+    CollisionManager collisionManager;
+
+    // 同じ組み合わせの順番で判定し、当たった数をハッシュにする
+    auto measurePairs = [&](const char *name, auto test) {
+        results.push_back(Measure(name, kOperations, repeats, [] {}, [&] {
+            uint64_t hitCount = 0;
+            for (uint32_t i = 0; i < kOperations; ++i) {
+                uint32_t a = i % kShapeCount;
+                uint32_t b = (i * 7919u + 1u) % kShapeCount;
+                hitCount += test(a, b) ? 1 : 0;
+            }
+            return HashValue(kHashBasis, hitCount);
+        }));
+    };
+    measurePairs("collision/sphere_sphere", [&](uint32_t a, uint32_t b) { return collisionManager.IsCollision(spheres[a], spheres[b]); });
+    measurePairs("collision/aabb_aabb", [&](uint32_t a, uint32_t b) { return collisionManager.IsCollision(aabbs[a], aabbs[b]); });
+    measurePairs("collision/aabb_sphere", [&](uint32_t a, uint32_t b) { return collisionManager.IsCollision(aabbs[a], spheres[b]); });
+    measurePairs("collision/obb_obb", [&](uint32_t a, uint32_t b) { return collisionManager.IsCollision(obbs[a], obbs[b]); });
+    measurePairs("collision/obb_sphere", [&](uint32_t a, uint32_t b) { return collisionManager.IsCollision(obbs[a], spheres[b], rotateMatrices[a]); });
+    measurePairs("collision/aabb_obb", [&](uint32_t a, uint32_t b) { return collisionManager.IsCollision(aabbs[a], obbs[b]); });
+
+    // 視錐台カリング（BaseObjectManager::Drawの判定に相当）。ローカルのAABBをワールドに移してからまとめて判定する
+    constexpr uint32_t kCullCount = 10000;
+    std::vector<AABB> localBounds(kCullCount);
+    std::vector<Matrix4x4> worldMatrices(kCullCount);
+    for (uint32_t i = 0; i < kCullCount; ++i) {
+        RandomTransform transform = MakeRandomTransform(random);
+        Vector3 extent = {halfSize(random), halfSize(random), halfSize(random)};
+        localBounds[i] = {-extent, extent};
+        worldMatrices[i] = MakeAffineMatrix(transform.scale, transform.rotate, transform.translate * 3.0f);
+    }
+    Matrix4x4 view = Inverse(MakeAffineMatrix(Vector3{1.0f, 1.0f, 1.0f}, Vector3{0.3f, 0.8f, 0.0f}, Vector3{0.0f, 5.0f, -30.0f}));
+    Frustum frustum = MakeFrustum(view * MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 100.0f));
+    std::vector<AABB> worldBounds(kCullCount);
+    std::vector<uint8_t> visible(kCullCount);
+    results.push_back(Measure("collision/frustum_cull_10000", kCullCount, repeats, [] {}, [&] {
+        for (uint32_t i = 0; i < kCullCount; ++i) {
+            worldBounds[i] = TransformAABB(localBounds[i], worldMatrices[i]);
+        }
+        size_t visibleCount = CullAABBs(frustum, worldBounds.data(), kCullCount, visible.data());
+        return HashValue(kHashBasis, visibleCount);
+    }));
+}
+
+void EngineBenchmark::RunParticle(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    constexpr uint32_t kParticleCount = 10000;
+    constexpr uint32_t kTrailParticleCount = 2000;
+    constexpr uint32_t kSteps = 120;
+    constexpr float kDeltaTime = 1.0f / 60.0f;
+
+    // 描画用のリソースは作らない（シミュレーションはパーティクルのリストしか触らない）
+    // シングルトンなので、前に残っていたものは捨ててから使う
+    ParticleSystem::GetInstance()->Finalize();
+    ParticleSystem &particleSystem = *ParticleSystem::GetInstance();
+    ParticleGroup particleGroup;
+    particleGroup.GetParticleGroupData().groupName = "benchmark";
+    ParticleSpawnerHandle spawner = particleSystem.RegisterSpawner(&particleGroup);
+
+    ParticleSetting setting;
+    setting.count = kParticleCount;
+    setting.lifeTimeMin = 1.0f;
+    setting.lifeTimeMax = 3.0f;
+    setting.gravity = 9.8f;
+    setting.alphaMin = 0.5f;
+    setting.alphaMax = 1.0f;
+    setting.scaleMin = 0.5f;
+    setting.scaleMax = 1.0f;
+    setting.translate = {0.0f, 0.0f, 0.0f};
+    setting.rotation = {0.0f, 0.0f, 0.0f};
+    setting.scale = {2.0f, 2.0f, 2.0f};
+    setting.velocityMin = {-1.0f, 0.0f, -1.0f};
+    setting.velocityMax = {1.0f, 3.0f, 1.0f};
+    setting.particleStartScale = {1.0f, 1.0f, 1.0f};
+    setting.particleEndScale = {0.0f, 0.0f, 0.0f};
+    setting.startAcce = {0.0f, 0.01f, 0.0f};
+    setting.endAcce = {0.0f, 0.0f, 0.0f};
+    setting.startRote = {0.0f, 0.0f, 0.0f};
+    setting.endRote = {0.0f, 3.14f, 0.0f};
+    setting.isRandomSize = true;
+
+    auto reset = [&](const ParticleSetting &newSetting) {
+        particleSystem.Clear();
+        particleSystem.SetSpawnerSetting(spawner, newSetting);
+        particleSystem.SetSpawnerSeed(spawner, kSeed);
+    };
+    // spawnerIdを指定したときはその発生元のものだけを見る
+    auto hashParticles = [](ParticleGroup &group, uint32_t spawnerId = UINT32_MAX) {
+        uint64_t count = 0;
+        Vector3 sum = {0.0f, 0.0f, 0.0f};
+        for (const Particle &particle : group.GetParticleGroupData().particles) {
+            if (spawnerId != UINT32_MAX && particle.spawnerId != spawnerId) {
+                continue;
+            }
+            sum += particle.transform.translation_;
+            ++count;
+        }
+        return HashVector3(HashValue(kHashBasis, count), sum);
+    };
+
+    results.push_back(Measure("particle/emit", kParticleCount, repeats, [&] { reset(setting); }, [&] {
+        particleSystem.Spawn(spawner);
+        return hashParticles(particleGroup);
+    }));
+
+    results.push_back(Measure("particle/simulate", kParticleCount * kSteps, repeats, [&] {
+        reset(setting);
+        particleSystem.Spawn(spawner);
+    }, [&] {
+        for (uint32_t step = 0; step < kSteps; ++step) {
+            particleSystem.Simulate(kDeltaTime);
+        }
+        return hashParticles(particleGroup);
+    }));
+
+    // 軌跡あり（パーティクルごとの枠に一定間隔で位置を記録する）
+    ParticleSetting trailSetting = setting;
+    trailSetting.count = kTrailParticleCount;
+    trailSetting.enableTrail = true;
+    trailSetting.trailSpawnInterval = 0.05f;
+    trailSetting.maxTrailParticles = 20;
+    trailSetting.trailLifeScale = 0.5f;
+    trailSetting.trailScaleMultiplier = {0.8f, 0.8f, 0.8f};
+    trailSetting.trailColorMultiplier = {1.0f, 1.0f, 1.0f, 0.7f};
+    results.push_back(Measure("particle/simulate_trail", kTrailParticleCount * kSteps, repeats, [&] {
+        reset(trailSetting);
+        particleSystem.Spawn(spawner);
+    }, [&] {
+        for (uint32_t step = 0; step < kSteps; ++step) {
+            particleSystem.Simulate(kDeltaTime);
+        }
+        return hashParticles(particleGroup);
+    }));
+
+    // 軌跡の帯の頂点作成（描画リソースがないのでCPU側の配列に書き込む）
+    const Vector3 trailCameraPosition = {0.0f, 5.0f, -20.0f};
+    results.push_back(Measure("particle/trail_ribbon_build", kTrailParticleCount, repeats, [&] {
+        reset(trailSetting);
+        particleSystem.Spawn(spawner);
+        for (uint32_t step = 0; step < 30; ++step) {
+            particleSystem.Simulate(kDeltaTime);
+        }
+    }, [&] {
+        particleSystem.BuildTrailVertices(trailCameraPosition, 1.0f);
+        uint32_t vertexCount = particleSystem.GetTrailVertexCount();
+        const ParticleTrailVertex *vertices = particleSystem.GetTrailVertices();
+        uint64_t hash = HashValue(kHashBasis, vertexCount);
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            hash = HashVector3(hash, {vertices[i].position.x, vertices[i].position.y, vertices[i].position.z});
+        }
+        return HashValue(hash, particleSystem.GetTrailIndexCount(spawner));
+    }));
+
+    // 1フレームでのまとまった発生（爆発など。ノードは予約しておいたプールから使う）
+    constexpr uint32_t kBurstCount = 5000;
+    ParticleSetting burstSetting = setting;
+    burstSetting.count = kBurstCount;
+    burstSetting.isRandomRotate = true;
+    burstSetting.isRandomColor = true;
+    particleSystem.ReserveParticles(spawner, kBurstCount);
+    results.push_back(Measure("particle/burst_5000", kBurstCount, repeats, [&] { reset(burstSetting); }, [&] {
+        particleSystem.Spawn(spawner);
+        return hashParticles(particleGroup);
+    }));
+
+    // 同じグループを使うエミッターを並べたときの更新（グループは1フレームに1回だけ進める）
+    constexpr uint32_t kEmitterCount = 64;
+    constexpr uint32_t kParticlesPerEmitter = 100;
+    ParticleSetting emitterSetting = setting;
+    emitterSetting.count = kParticlesPerEmitter;
+    // ほかのエミッターは違う設定にする
+    ParticleSetting otherSetting = emitterSetting;
+    otherSetting.gravity = 0.0f;
+    otherSetting.velocityMin = {-3.0f, -3.0f, -3.0f};
+    otherSetting.velocityMax = {3.0f, 3.0f, 3.0f};
+    otherSetting.translate = {10.0f, 0.0f, 0.0f};
+
+    // 同じグループにエミッターを並べる
+    std::vector<ParticleSpawnerHandle> spawners = {spawner};
+    for (uint32_t i = 1; i < kEmitterCount; ++i) {
+        spawners.push_back(particleSystem.RegisterSpawner(&particleGroup));
+    }
+    results.push_back(Measure("particle/emitter_count_independence", kEmitterCount * kParticlesPerEmitter * kSteps, repeats, [&] {
+        reset(emitterSetting);
+        particleSystem.Spawn(spawners[0]);
+        for (uint32_t i = 1; i < kEmitterCount; ++i) {
+            particleSystem.SetSpawnerSetting(spawners[i], otherSetting);
+            particleSystem.SetSpawnerSeed(spawners[i], kSeed + i);
+            particleSystem.Spawn(spawners[i]);
+        }
+    }, [&] {
+        for (uint32_t step = 0; step < kSteps; ++step) {
+            particleSystem.Simulate(kDeltaTime);
+        }
+        return hashParticles(particleGroup, spawners[0].spawnerId);
+    }));
+    particleSystem.Finalize();
+
+    // 予算と優先度・距離による間引き・画面外の判定
+    // 予算2000に対して、低(6割まで)・通常(8.5割まで)・高(すべて)の順に1000ずつ発生させる
+    constexpr uint32_t kBudget = 2000;
+    constexpr uint32_t kBudgetSpawnCount = 1000;
+    ParticleSystem &budgetSystem = *ParticleSystem::GetInstance();
+    ParticleGroup budgetGroup;
+    budgetGroup.GetParticleGroupData().groupName = "benchmark_budget";
+    budgetSystem.SetParticleBudget(kBudget);
+    budgetSystem.SetLodSetting(&budgetGroup, ParticleLodSetting{});
+    ParticleSpawnerHandle lowSpawner = budgetSystem.RegisterSpawner(&budgetGroup);
+    ParticleSpawnerHandle normalSpawner = budgetSystem.RegisterSpawner(&budgetGroup);
+    ParticleSpawnerHandle highSpawner = budgetSystem.RegisterSpawner(&budgetGroup);
+    ParticleSpawnerHandle farSpawner = budgetSystem.RegisterSpawner(&budgetGroup);
+    budgetSystem.SetSpawnerPriority(lowSpawner, ParticlePriority::kLow);
+    budgetSystem.SetSpawnerPriority(highSpawner, ParticlePriority::kHigh);
+    ParticleSetting nearSetting = setting;
+    nearSetting.count = kBudgetSpawnCount;
+    nearSetting.translate = {0.0f, 0.0f, 20.0f};
+    ParticleSetting farSetting = nearSetting;
+    farSetting.translate = {0.0f, 0.0f, 200.0f};
+    // 原点から+Z向きのカメラと、その逆向きのカメラ
+    Matrix4x4 projection = MakePerspectiveFovMatrix(0.45f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    Frustum frontFrustum = MakeFrustum(projection);
+    Frustum backFrustum = MakeFrustum(MakeRotateYMatrix(3.14159265f) * projection);
+    Vector3 cameraPosition = {0.0f, 0.0f, 0.0f};
+
+    results.push_back(Measure("particle/lod_budget", kBudgetSpawnCount * 5, repeats, [&] {
+        budgetSystem.Clear();
+        const ParticleSpawnerHandle handles[] = {lowSpawner, normalSpawner, highSpawner, farSpawner};
+        for (const ParticleSpawnerHandle &handle : handles) {
+            budgetSystem.SetSpawnerSetting(handle, handle.spawnerId == farSpawner.spawnerId ? farSetting : nearSetting);
+            budgetSystem.SetSpawnerSeed(handle, kSeed + handle.spawnerId);
+        }
+    }, [&] {
+        budgetSystem.UpdateLod(frontFrustum, cameraPosition);
+        budgetSystem.Spawn(farSpawner);
+        budgetSystem.Spawn(lowSpawner);
+        budgetSystem.Spawn(lowSpawner);
+        budgetSystem.Spawn(normalSpawner);
+        budgetSystem.Spawn(highSpawner);
+
+        // 範囲を求めてから、後ろ向き・前向きのカメラで画面外を判定し直す
+        budgetSystem.Simulate(kDeltaTime);
+        budgetSystem.UpdateLod(backFrustum, cameraPosition);
+        budgetSystem.UpdateLod(frontFrustum, cameraPosition);
+
+        uint64_t hash = kHashBasis;
+        hash = HashValue(hash, budgetSystem.GetActiveParticleCount(lowSpawner));
+        hash = HashValue(hash, budgetSystem.GetActiveParticleCount(normalSpawner));
+        hash = HashValue(hash, budgetSystem.GetActiveParticleCount(highSpawner));
+        return HashValue(hash, budgetSystem.IsSpawnerCulled(farSpawner) ? 1 : 0);
+    }));
+    budgetSystem.Finalize();
+
+    // アルファブレンド用の奥から手前への並べ替え（ビューのZは前のシナリオと同じ範囲にばらまく）
+    ParticleDepthSorter depthSorter;
+    FastRandom depthRandom(kSeed);
+    for (uint32_t sortCount : {10000u, 50000u}) {
+        std::vector<float> depths(sortCount);
+        for (float &depth : depths) {
+            depth = depthRandom.Range(0.1f, 200.0f);
+        }
+        const float minDepth = *std::min_element(depths.begin(), depths.end());
+        const float maxDepth = *std::max_element(depths.begin(), depths.end());
+
+        std::string name = "particle/depth_sort_" + std::to_string(sortCount);
+        results.push_back(Measure(name.c_str(), sortCount, repeats, [] {}, [&] {
+            const std::vector<uint32_t> &order = depthSorter.Sort(depths.data(), sortCount, minDepth, maxDepth);
+            // 計測を重くしないように間を空けてハッシュする
+            uint64_t hash = kHashBasis;
+            for (uint32_t i = 0; i < sortCount; i += 64) {
+                hash = HashValue(hash, order[i]);
+            }
+            return hash;
+        }));
+    }
+}
+
+void EngineBenchmark::RunRender(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    constexpr uint32_t kPacketCount = 10000;
+    constexpr uint32_t kMaterialCount = 64;
+
+    // 2割が半透明、1割がスキニングのオブジェクトを、シーンのオブジェクトの並び（状態がばらばら）で積む
+    std::mt19937 random(kSeed);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    std::uniform_int_distribution<uint32_t> material(0, kMaterialCount - 1);
+    std::uniform_real_distribution<float> depth(0.1f, 200.0f);
+    const BlendMode transparentBlends[] = {BlendMode::kNormal, BlendMode::kAdd, BlendMode::kScreen};
+    std::vector<uint64_t> keys(kPacketCount);
+    std::vector<float> depths(kPacketCount);
+    for (uint32_t i = 0; i < kPacketCount; ++i) {
+        bool isTransparent = percent(random) < 20;
+        bool isSkinning = !isTransparent && percent(random) < 10;
+        BlendMode blendMode = isTransparent ? transparentBlends[percent(random) % 3] : (isSkinning ? BlendMode::kNormal : BlendMode::kNone);
+        depths[i] = depth(random);
+        keys[i] = RenderQueue::MakeKey(isTransparent ? RenderQueue::Pass::kTransparent : RenderQueue::Pass::kOpaque,
+                                       isSkinning ? PipelineType::kSkinning : PipelineType::kStandard, blendMode, material(random), depths[i]);
+    }
+
+    RenderQueue renderQueue;
+    results.push_back(Measure("render/queue_sort_10000", kPacketCount, repeats, [] {}, [&] {
+        renderQueue.Clear();
+        for (uint32_t i = 0; i < kPacketCount; ++i) {
+            renderQueue.Add(keys[i], i);
+        }
+        renderQueue.Sort();
+        uint64_t hash = kHashBasis;
+        renderQueue.Execute([&](const RenderQueue::Packet &packet, uint32_t stateChanges) {
+            hash = HashValue(hash, (static_cast<uint64_t>(packet.payload) << 2) | stateChanges);
+        });
+        return hash;
+    }));
+
+    // 同じモデルの描画のまとめ。少数のモデルに偏った並び（木や岩を大量に置いたシーン）で、
+    // 行列の置き場に入りきらない分は個別の描画に回る
+    constexpr uint32_t kDrawCount = 10000;
+    constexpr uint32_t kModelCount = 200;
+    constexpr uint32_t kMinInstanceCount = 2;
+    std::uniform_real_distribution<float> skew(0.0f, 1.0f);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::vector<uint64_t> instanceKeys(kDrawCount);
+    std::vector<InstanceForGPU> sources(kDrawCount);
+    for (uint32_t i = 0; i < kDrawCount; ++i) {
+        float t = skew(random);
+        uint64_t modelId = static_cast<uint64_t>(t * t * t * kModelCount);
+        instanceKeys[i] = (modelId << 2) | (percent(random) < 10 ? 1u : 0u);
+        sources[i].World = MakeAffineMatrix(Vector3{1.0f, 1.0f, 1.0f}, Vector3{0.0f, 0.0f, 0.0f}, Vector3{position(random), position(random), position(random)});
+        sources[i].WVP = sources[i].World;
+        sources[i].WorldInverseTranspose = Transpose(Inverse(sources[i].World));
+        sources[i].color = {skew(random), skew(random), skew(random), 1.0f};
+    }
+
+    ModelInstanceBatcher batcher;
+    std::vector<InstanceForGPU> instances(ModelInstancing::kMaxInstances);
+    results.push_back(Measure("render/instance_batch_10000", kDrawCount, repeats, [] {}, [&] {
+        batcher.Clear();
+        for (uint32_t i = 0; i < kDrawCount; ++i) {
+            batcher.Add(instanceKeys[i], i);
+        }
+        batcher.Build(kMinInstanceCount, ModelInstancing::kMaxInstances);
+        // Object3d::FlushQueueと同じく、まとめた順に行列と色を詰める
+        const std::vector<uint32_t> &drawIndices = batcher.GetInstanceDrawIndices();
+        for (size_t i = 0; i < drawIndices.size(); ++i) {
+            instances[i] = sources[drawIndices[i]];
+        }
+        uint64_t hash = HashValue(kHashBasis, batcher.GetGroups().size());
+        for (const ModelInstanceBatcher::Group &group : batcher.GetGroups()) {
+            hash = HashValue(hash, (group.key << 32) ^ (static_cast<uint64_t>(group.firstInstance) << 16) ^ group.instanceCount);
+        }
+        return HashValue(hash, batcher.GetSingleDrawIndices().size());
+    }));
+
+    // スプライトのまとめ。UIや文字のようにほとんどが1枚のアトラスから切り出したもので、
+    // 一部だけ別のテクスチャや加算のものが混ざり、レイヤーに分かれている並び
+    constexpr uint32_t kSpriteCount = 10000;
+    constexpr uint32_t kAtlasTextureIndex = 1;
+    constexpr int32_t kLayerCount = 4;
+    const float screenWidth = static_cast<float>(WinApp::kClientWidth);
+    const float screenHeight = static_cast<float>(WinApp::kClientHeight);
+    const Matrix4x4 spriteProjection = MakeOrthographicMatrix(0.0f, 0.0f, screenWidth, screenHeight, 0.0f, 100.0f);
+    std::uniform_real_distribution<float> spriteX(0.0f, screenWidth);
+    std::uniform_real_distribution<float> spriteY(0.0f, screenHeight);
+    std::uniform_real_distribution<float> spriteSize(8.0f, 32.0f);
+    std::uniform_real_distribution<float> spriteRotation(-3.14f, 3.14f);
+    std::uniform_int_distribution<uint32_t> atlasCell(0, 15);
+    std::vector<SpriteQuad> quads(kSpriteCount);
+    for (uint32_t i = 0; i < kSpriteCount; ++i) {
+        SpriteQuad &quad = quads[i];
+        quad.position = {spriteX(random), spriteY(random)};
+        quad.size = {spriteSize(random), spriteSize(random)};
+        quad.anchorPoint = {0.5f, 0.5f};
+        quad.rotation = percent(random) < 20 ? spriteRotation(random) : 0.0f;
+        quad.depth = percent(random) < 5 ? 10000.0f : 0.0f;
+        float cell = static_cast<float>(atlasCell(random));
+        quad.uvLeftTop = {cell / 16.0f, 0.0f};
+        quad.uvRightBottom = {(cell + 1.0f) / 16.0f, 1.0f};
+        quad.color = {skew(random), skew(random), skew(random), 1.0f};
+        quad.isFlipX = percent(random) < 10;
+        quad.isFlipY = percent(random) < 10;
+        uint32_t kind = percent(random);
+        quad.textureIndex = kind < 90 ? kAtlasTextureIndex : kAtlasTextureIndex + 1 + kind % 2;
+        quad.blendMode = percent(random) < 10 ? BlendMode::kAdd : BlendMode::kNormal;
+        quad.layer = static_cast<int32_t>(percent(random)) % kLayerCount;
+    }
+
+    SpriteBatcher spriteBatcher;
+    results.push_back(Measure("render/sprite_batch_10000", kSpriteCount, repeats, [] {}, [&] {
+        spriteBatcher.Clear();
+        for (const SpriteQuad &quad : quads) {
+            spriteBatcher.Add(quad);
+        }
+        spriteBatcher.Build(spriteProjection);
+        uint64_t hash = HashValue(kHashBasis, spriteBatcher.GetBatches().size());
+        for (const SpriteBatcher::Batch &batch : spriteBatcher.GetBatches()) {
+            hash = HashValue(hash, (static_cast<uint64_t>(batch.textureIndex) << 48) ^ (static_cast<uint64_t>(batch.blendMode) << 40) ^
+                                       (static_cast<uint64_t>(batch.firstQuad) << 20) ^ batch.quadCount);
+        }
+        for (uint32_t quadIndex : spriteBatcher.GetQuadOrder()) {
+            hash = HashValue(hash, quadIndex);
+        }
+        return hash;
+    }));
+
+    // 当たり判定のデバッグ表示。球と箱のコライダーを並べ、キャッシュした図形を行列で変換して線を積む
+    constexpr uint32_t kShapeCount = 10000;
+    constexpr int kSphereDivisions = 10;
+    constexpr uint32_t kRecordThreadCount = 4;
+    std::uniform_real_distribution<float> shapeSize(0.1f, 3.0f);
+    std::vector<Vector3> shapeCenters(kShapeCount);
+    std::vector<Vector3> shapeSizes(kShapeCount);
+    std::vector<bool> isSphereShape(kShapeCount);
+    for (uint32_t i = 0; i < kShapeCount; ++i) {
+        shapeCenters[i] = {position(random), position(random), position(random)};
+        shapeSizes[i] = {shapeSize(random), shapeSize(random), shapeSize(random)};
+        isSphereShape[i] = percent(random) < 40;
+    }
+    auto recordShapes = [&](DrawLine3D &drawLine, uint32_t begin, uint32_t end, const Vector4 &color) {
+        for (uint32_t i = begin; i < end; ++i) {
+            if (isSphereShape[i]) {
+                drawLine.DrawSphere(shapeCenters[i], color, shapeSizes[i].x, kSphereDivisions);
+            } else {
+                drawLine.DrawAABB(shapeCenters[i] - shapeSizes[i] * 0.5f, shapeCenters[i] + shapeSizes[i] * 0.5f, color);
+            }
+        }
+    };
+
+    DrawLine3D drawLine;
+    const Vector4 lineColor = {1.0f, 1.0f, 0.0f, 1.0f};
+    std::vector<DrawLine3D::VertexPosColor> lineVertices;
+    results.push_back(Measure("render/line_shapes_10000", kShapeCount, repeats, [&] { drawLine.Reset(); }, [&] {
+        recordShapes(drawLine, 0, kShapeCount, lineColor);
+        uint32_t lineCount = drawLine.GetLineCount();
+        lineVertices.resize(static_cast<size_t>(lineCount) * DrawLine3D::kVertexCountLine);
+        // Drawと同じくページごとに詰める
+        for (uint32_t firstLine = 0; firstLine < lineCount; firstLine += DrawLine3D::kLinesPerPage) {
+            uint32_t pageLineCount = (std::min)(DrawLine3D::kLinesPerPage, lineCount - firstLine);
+            drawLine.CopyLines(firstLine, pageLineCount, &lineVertices[static_cast<size_t>(firstLine) * DrawLine3D::kVertexCountLine]);
+        }
+        uint64_t hash = HashValue(kHashBasis, lineCount);
+        for (size_t i = 0; i < lineVertices.size(); i += 997) {
+            hash = HashVector3(hash, lineVertices[i].pos);
+        }
+        return hash;
+    }));
+
+    // 同じ図形を複数のスレッドから分けて積む（記録はスレッドごとなので、待ち合わせの分だけ遅くなる）
+    results.push_back(Measure("render/line_shapes_10000_4threads", kShapeCount, repeats, [&] { drawLine.Reset(); }, [&] {
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < kRecordThreadCount; ++t) {
+            threads.emplace_back([&, t] {
+                recordShapes(drawLine, kShapeCount * t / kRecordThreadCount, kShapeCount * (t + 1) / kRecordThreadCount, lineColor);
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        return HashValue(kHashBasis, drawLine.GetLineCount());
+    }));
+}
+
+void EngineBenchmark::RunAnimation(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    constexpr uint32_t kJointCount = 64;
+    constexpr uint32_t kKeyframeCount = 120;
+    constexpr float kKeyframeRate = 30.0f;
+    constexpr uint32_t kSampleCount = 100;
+    constexpr uint32_t kFrames = 240;
+
+    std::mt19937 random(kSeed);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+    // 全ジョイントにキーフレームを持つアニメーション
+    Animation animation;
+    animation.duration = static_cast<float>(kKeyframeCount - 1) / kKeyframeRate;
+    for (uint32_t joint = 0; joint < kJointCount; ++joint) {
+        NodeAnimation &nodeAnimation = animation.nodeAnimations["joint_" + std::to_string(joint)];
+        for (uint32_t key = 0; key < kKeyframeCount; ++key) {
+            float time = static_cast<float>(key) / kKeyframeRate;
+            nodeAnimation.translate.push_back({{value(random), 1.0f + value(random) * 0.1f, value(random)}, time});
+            nodeAnimation.rotate.push_back({Quaternion::FromEulerAngles({value(random), value(random), value(random)}), time});
+            nodeAnimation.scale.push_back({{1.0f, 1.0f, 1.0f}, time});
+        }
+    }
+    std::uniform_real_distribution<float> sampleTime(0.0f, animation.duration);
+    std::vector<float> sampleTimes(kSampleCount);
+    for (float &time : sampleTimes) {
+        time = sampleTime(random);
+    }
+
+    // キーフレームの検索と補間
+    results.push_back(Measure("animation/sample_keyframes", kSampleCount * kJointCount * 3, repeats, [] {}, [&] {
+        uint64_t hash = kHashBasis;
+        for (float time : sampleTimes) {
+            Vector3 sum = {0.0f, 0.0f, 0.0f};
+            for (const auto &[name, nodeAnimation] : animation.nodeAnimations) {
+                sum += Animator::CalculateValue(nodeAnimation.translate, time);
+                sum += Animator::CalculateValue(nodeAnimation.scale, time);
+                sum.x += Animator::CalculateValue(nodeAnimation.rotate, time).w;
+            }
+            hash = HashVector3(hash, sum);
+        }
+        return hash;
+    }));
+
+    // アニメーションの適用とスケルトンの行列計算
+    ModelData modelData;
+    modelData.rootNode = MakeJointNode(0, kJointCount, random);
+    Bone bone;
+    bone.Initialize(modelData);
+    const std::string lastJointName = "joint_" + std::to_string(kJointCount - 1);
+    results.push_back(Measure("animation/skeleton_update", kFrames * kJointCount, repeats, [] {}, [&] {
+        uint64_t hash = kHashBasis;
+        for (uint32_t frame = 0; frame < kFrames; ++frame) {
+            float time = std::fmod(static_cast<float>(frame) / 60.0f, animation.duration);
+            bone.Update(animation, time);
+            if (std::optional<Matrix4x4> matrix = bone.GetJointSkeletonSpaceMatrix(lastJointName)) {
+                hash = HashVector3(hash, {matrix->m[3][0], matrix->m[3][1], matrix->m[3][2]});
+            }
+        }
+        return hash;
+    }));
+}
+
+void EngineBenchmark::RunJson(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    using json = nlohmann::json;
+    constexpr uint32_t kRootObjectCount = 1000;
+    constexpr uint32_t kChildCount = 2;
+    constexpr uint32_t kDataKeyCount = 500;
+
+    std::mt19937 random(kSeed);
+    std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+    auto randomArray = [&] { return json::array({value(random), value(random), value(random)}); };
+
+    // ---- レベルデータ（Blenderから書き出す形式） ----
+    auto makeObject = [&](const std::string &name) {
+        json object;
+        object["type"] = "MESH";
+        object["name"] = name;
+        object["transform"] = {{"translation", randomArray()}, {"rotation", randomArray()}, {"scaling", json::array({1.0f, 1.0f, 1.0f})}};
+        object["collider"] = {{"type", "BOX"}, {"center", randomArray()}, {"size", json::array({2.0f, 2.0f, 2.0f})}};
+        return object;
+    };
+    json level;
+    level["name"] = "benchmark";
+    level["objects"] = json::array();
+    for (uint32_t i = 0; i < kRootObjectCount; ++i) {
+        json object = makeObject("object_" + std::to_string(i));
+        object["children"] = json::array();
+        for (uint32_t child = 0; child < kChildCount; ++child) {
+            object["children"].push_back(makeObject("object_" + std::to_string(i) + "_" + std::to_string(child)));
+        }
+        level["objects"].push_back(object);
+    }
+    const std::string levelPath = "engine_benchmark_level.json";
+    {
+        std::ofstream file(levelPath);
+        file << level.dump(4);
+    }
+
+    LevelData levelData;
+    const uint32_t expectedObjectCount = kRootObjectCount * (1 + kChildCount);
+    results.push_back(Measure("json/level_parse", expectedObjectCount, repeats, [] {}, [&] {
+        levelData.LoadFromJson(levelPath);
+        const std::vector<LevelData::ObjectData> &objects = levelData.GetObjectsData();
+        uint64_t hash = HashValue(kHashBasis, CountObjects(objects));
+        for (const LevelData::ObjectData &object : objects) {
+            hash = HashVector3(hash, object.transform.translation);
+        }
+        return hash;
+    }));
+    std::filesystem::remove(levelPath);
+
+    // ---- 調整データ（DataHandler） ----
+    DataHandler dataHandler("Benchmark", "engine_benchmark");
+    const std::string dataPath = dataHandler.GetFilePath();
+    std::vector<std::string> keys(kDataKeyCount);
+    {
+        json data;
+        for (uint32_t i = 0; i < kDataKeyCount; ++i) {
+            keys[i] = "value_" + std::to_string(i);
+            data[keys[i]] = {{"x", value(random)}, {"y", value(random)}, {"z", value(random)}};
+        }
+        std::ofstream file(dataPath);
+        file << data.dump(4);
+    }
+    // 読み直し（ホットリロードと同じ経路）と、キャッシュからの取り出し
+    results.push_back(Measure("json/data_handler_reload_load", kDataKeyCount, repeats, [] {}, [&] {
+        DataHandler::ReloadDocument(dataPath);
+        Vector3 sum = {0.0f, 0.0f, 0.0f};
+        for (const std::string &key : keys) {
+            sum += dataHandler.Load<Vector3>(key, {0.0f, 0.0f, 0.0f});
+        }
+        return HashVector3(kHashBasis, sum);
+    }));
+    std::error_code ec;
+    std::filesystem::remove(dataPath, ec);
+    // 他に何も置いていなければ作ったフォルダも消す
+    std::filesystem::remove(std::filesystem::path(dataPath).parent_path(), ec);
+}
+
+void EngineBenchmark::RunMesh(std::vector<EngineBenchmarkResult> &results, uint32_t repeats) {
+    constexpr uint32_t kGridSize = 128;
+
+    std::vector<VertexData> sourceVertices;
+    std::vector<uint32_t> sourceIndices;
+    MakeGridMesh(kGridSize, true, sourceVertices, sourceIndices);
+
+    // 重複頂点の結合・頂点キャッシュ最適化・頂点フェッチ最適化をまとめて行う（インポート時の処理）
+    std::vector<VertexData> vertices;
+    std::vector<uint32_t> indices;
+    results.push_back(Measure("mesh/optimize_grid_128", kGridSize * kGridSize * 2, repeats, [&] {
+        vertices = sourceVertices;
+        indices = sourceIndices;
+    }, [&] {
+        MeshOptimizeReport report = MeshOptimizer::Optimize(vertices, indices);
+        uint64_t hash = HashValue(kHashBasis, report.vertexCountAfter);
+        hash = HashFloat(hash, report.acmrAfter);
+        return HashValue(hash, indices[indices.size() / 2]);
+    }));
+}
+
+std::vector<MeshOptimizeReport> EngineBenchmark::ReportMesh() {
+    std::vector<MeshOptimizeReport> reports;
+    for (bool shuffle : {false, true}) {
+        std::vector<VertexData> vertices;
+        std::vector<uint32_t> indices;
+        MakeGridMesh(128, shuffle, vertices, indices);
+        reports.push_back(MeshOptimizer::Optimize(vertices, indices, nullptr, true, shuffle ? "grid_128_shuffled" : "grid_128"));
+    }
+    return reports;
+}
+
+void EngineBenchmark::WriteReportCSV(const std::vector<EngineBenchmarkResult> &results, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "name,operations,repeats,median_us,p95_us,min_us,ns_per_op,checksum\n";
+    for (const auto &result : results) {
+        char checksum[32];
+        std::snprintf(checksum, sizeof(checksum), "%016llx", static_cast<unsigned long long>(result.checksum));
+        file << result.name << "," << result.operations << "," << result.repeats << "," << result.medianUs << ","
+             << result.p95Us << "," << result.minUs << "," << result.nsPerOperation << "," << checksum << "\n";
+    }
+}
+
+void EngineBenchmark::WriteReportJSON(const std::vector<EngineBenchmarkResult> &results, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    nlohmann::json report;
+    report["suite"] = "engine";
+    report["seed"] = kSeed;
+#ifdef _DEBUG
+    report["build"] = "Debug";
+#else
+    report["build"] = "Release";
+#endif // _DEBUG
+    report["results"] = nlohmann::json::array();
+    for (const auto &result : results) {
+        char checksum[32];
+        std::snprintf(checksum, sizeof(checksum), "%016llx", static_cast<unsigned long long>(result.checksum));
+        report["results"].push_back({
+            {"name", result.name},
+            {"operations", result.operations},
+            {"repeats", result.repeats},
+            {"median_us", result.medianUs},
+            {"p95_us", result.p95Us},
+            {"min_us", result.minUs},
+            {"ns_per_op", result.nsPerOperation},
+            // 64bitの整数はJSONの数値では精度が落ちる読み手があるので文字列にする
+            {"checksum", checksum},
+        });
+    }
+    file << report.dump(4) << "\n";
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "Model/MeshOptimizer/MeshOptimizer.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// シナリオ1つ分の計測結果
+/// </summary>
+struct EngineBenchmarkResult {
+    std::string name;            // シナリオ名（"collision/obb_obb" のように 処理/内容）
+    uint32_t operations = 0;     // 1回の計測で行う処理の数
+    uint32_t repeats = 0;        // 計測回数
+    double medianUs = 0.0;       // 1回の計測時間の中央値(us)
+    double p95Us = 0.0;          // 1回の計測時間の95パーセンタイル(us)
+    double minUs = 0.0;          // 1回の計測時間の最小値(us)
+    double nsPerOperation = 0.0; // 中央値を処理の数で割ったもの(ns)
+    uint64_t checksum = 0;       // 計算結果のハッシュ（同じシードなら毎回同じになる）
+};
+
+/// <summary>
+/// ウィンドウやD3D12デバイスを作らずに、CPU側のエンジン処理を固定シードのシナリオで計測する
+/// （算術・当たり判定・パーティクルの更新・描画の並べ替えとまとめ・アニメーションのサンプリング・JSONの読み込み・メッシュの最適化）
+/// 計測だけを行い、結果の正しさはモジュールごとのテスト（〇〇Test.cpp）で確かめる
+/// </summary>
+class EngineBenchmark {
+  public:
+    // 乱数のシード（変えると過去の結果と比べられなくなる）
+    static constexpr uint32_t kSeed = 20240601u;
+
+    /// <summary>
+    /// すべてのシナリオを計測する
+    /// </summary>
+    /// <param name="repeats">シナリオごとの計測回数（別に1回の空回しを行う）</param>
+    static std::vector<EngineBenchmarkResult> Run(uint32_t repeats = 15);
+
+    /// <summary>
+    /// 結果をCSV・JSONに書き出す（JSONは日々の結果を並べて比較する用）
+    /// </summary>
+    static void WriteReportCSV(const std::vector<EngineBenchmarkResult> &results, const std::string &filePath);
+    static void WriteReportJSON(const std::vector<EngineBenchmarkResult> &results, const std::string &filePath);
+
+    /// <summary>
+    /// 計測に使う格子メッシュのメッシュ最適化レポート（モデルの読み込みにはassimpが要るので、ゲーム本体の--mesh-reportとは別）
+    /// </summary>
+    static std::vector<MeshOptimizeReport> ReportMesh();
+
+  private:
+    static void RunMath(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+    static void RunCollision(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+    static void RunParticle(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+    static void RunRender(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+    static void RunAnimation(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+    static void RunJson(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+    static void RunMesh(std::vector<EngineBenchmarkResult> &results, uint32_t repeats);
+};
@@ -0,0 +1,53 @@
+#include "EngineBenchmark.h"
+#include "FramePacingBenchmark.h"
+#include "Job/JobSystem.h"
+#include "Job/JobSystemBenchmark.h"
+#include "Simd/MathBenchmark.h"
+#include "Transform/TransformBenchmark.h"
+#include <cstdio>
+
+// 計測だけを行う実行ファイル（CMakeでビルドする。ゲーム本体には含めない）
+int main() {
+    std::vector<EngineBenchmarkResult> results = EngineBenchmark::Run();
+    for (const EngineBenchmarkResult &result : results) {
+        std::printf("%-40s %12.1f us  %10.2f ns/op\n", result.name.c_str(), result.medianUs, result.nsPerOperation);
+    }
+    EngineBenchmark::WriteReportCSV(results, "engine_benchmark_report.csv");
+    EngineBenchmark::WriteReportJSON(results, "engine_benchmark_report.json");
+
+    std::vector<MeshOptimizeReport> meshReports = EngineBenchmark::ReportMesh();
+    for (const MeshOptimizeReport &report : meshReports) {
+        std::printf("mesh_report/%-28s %6u -> %6u vertices  ACMR %.3f -> %.3f\n", report.name.c_str(), report.vertexCountBefore,
+                    report.vertexCountAfter, report.acmrBefore, report.acmrAfter);
+    }
+    MeshOptimizer::WriteReportCSV(meshReports, "mesh_optimize_report.csv");
+
+    // モジュールごとの比較（基準実装と最適化版など）は各モジュールのレポートに書き出す
+    std::vector<MathBenchmarkResult> mathResults = MathBenchmark::Run();
+    for (const MathBenchmarkResult &result : mathResults) {
+        std::printf("math_kernel/%-28s %10.2f ns -> %8.2f ns  x%.2f\n", result.name.c_str(), result.baselineNs, result.optimizedNs, result.speedup);
+    }
+    MathBenchmark::WriteReportCSV(mathResults, "math_benchmark_report.csv");
+
+    // 全体を動かすときは部分木ごとに並列で計算するので、ジョブシステムを動かしておく
+    JobSystem::GetInstance()->Initialize();
+    std::vector<TransformBenchmarkResult> transformResults = TransformBenchmark::Run();
+    for (const TransformBenchmarkResult &result : transformResults) {
+        std::printf("transform/%-30s %10.1f us -> %8.1f us  x%.2f\n", result.name.c_str(), result.baselineUs, result.optimizedUs, result.speedup);
+    }
+    TransformBenchmark::WriteReportCSV(transformResults, "transform_benchmark_report.csv");
+
+    std::vector<JobSystemBenchmarkResult> jobResults = JobSystemBenchmark::Run();
+    for (const JobSystemBenchmarkResult &result : jobResults) {
+        std::printf("job/%-36s %12.2f ms  %10.2f ns/job\n", result.name.c_str(), result.totalMs, result.perJobNs);
+    }
+    JobSystemBenchmark::WriteReportCSV(jobResults, "job_benchmark_report.csv");
+    JobSystem::GetInstance()->Finalize();
+
+    std::vector<FramePacingBenchmarkResult> pacingResults = FramePacingBenchmark::Run();
+    for (const FramePacingBenchmarkResult &result : pacingResults) {
+        std::printf("pacing/%-33s p50 %8.1f us  p99 %8.1f us  cpu %5.1f%%\n", result.name.c_str(), result.p50ErrorUs, result.p99ErrorUs, result.waitCpuPercent);
+    }
+    FramePacingBenchmark::WriteReportCSV(pacingResults, "pacing_benchmark_report.csv");
+    return 0;
+}
@@ -1,7 +1,8 @@
 #define NOMINMAX
 #include "Collider.h"
 #include "CollisionManager.h"
-#include <line/DrawLine3D.h>
+#include <Data/JsonHotReloader.h>
+#include <Line/DrawLine3D.h>
 
 int Collider::counter = -1; // 初期値を-1に変更
 
@@ -10,6 +11,9 @@ Collider::Collider() {
 
 Collider::~Collider() {
     CollisionManager::RemoveCollider(this);
+    if (JsonHotReloader *hotReloader = JsonHotReloader::TryGetInstance()) {
+        hotReloader->Unwatch(this);
+    }
     counter--; // カウンターをデクリメント
 }
 
@@ -117,156 +121,39 @@ void Collider::DebugDraw(const ViewProjection &viewProjection) {
 }
 
 void Collider::DrawSphere(const ViewProjection &viewProjection) {
-    const uint32_t kSubdivision = 10;                                        // 分割数
-    const float kLonEvery = 2.0f * std::numbers::pi_v<float> / kSubdivision; // 経度分割1つ分の角度
-    const float kLatEvery = std::numbers::pi_v<float> / kSubdivision;        // 緯度分割1つ分の角度
-
-    // 緯度の方向に分割　-π/2 ～ π/2
-    for (uint32_t latIndex = 0; latIndex < kSubdivision; ++latIndex) {
-        float lat = -std::numbers::pi_v<float> / 2.0f + kLatEvery * latIndex; // 現在の緯度
-
-        // 経度の方向に分割 0 ～ 2π
-        for (uint32_t lonIndex = 0; lonIndex < kSubdivision; ++lonIndex) {
-            float lon = lonIndex * kLonEvery; // 現在の経度
-
-            // 現在の点を求める
-            Vector3 start = {
-                sphere_.center.x + sphere_.radius * std::cosf(lat) * std::cosf(lon),
-                sphere_.center.y + sphere_.radius * std::sinf(lat),
-                sphere_.center.z + sphere_.radius * std::cosf(lat) * std::sinf(lon)};
-
-            // 次の点を求める（経度方向）
-            Vector3 end1 = {
-                sphere_.center.x + sphere_.radius * std::cosf(lat) * std::cosf(lon + kLonEvery),
-                sphere_.center.y + sphere_.radius * std::sinf(lat),
-                sphere_.center.z + sphere_.radius * std::cosf(lat) * std::sinf(lon + kLonEvery),
-            };
-
-            // 次の点を求める（緯度方向）
-            Vector3 end2 = {
-                sphere_.center.x + sphere_.radius * std::cosf(lat + kLatEvery) * std::cosf(lon),
-                sphere_.center.y + sphere_.radius * std::sinf(lat + kLatEvery),
-                sphere_.center.z + sphere_.radius * std::cosf(lat + kLatEvery) * std::sinf(lon),
-            };
-
-            // 線を描画（経度方向）
-            DrawLine3D::GetInstance()->SetPoints(start, end1, color_);
-            // 線を描画（緯度方向）
-            DrawLine3D::GetInstance()->SetPoints(start, end2, color_);
-        }
-    }
+    const int kSubdivision = 10; // 分割数
+    // 単位球の線を使い回して、中心と半径で変換する
+    DrawLine3D::GetInstance()->DrawSphere(sphere_.center, color_, sphere_.radius, kSubdivision);
 }
 
 void Collider::DrawAABB(const ViewProjection &viewProjection) {
-    // AABBの頂点リスト
-    std::array<Vector3, 8> vertices = {
-        aabb_.min,
-        {aabb_.max.x, aabb_.min.y, aabb_.min.z},
-        {aabb_.min.x, aabb_.max.y, aabb_.min.z},
-        {aabb_.max.x, aabb_.max.y, aabb_.min.z},
-        {aabb_.min.x, aabb_.min.y, aabb_.max.z},
-        {aabb_.max.x, aabb_.min.y, aabb_.max.z},
-        {aabb_.min.x, aabb_.max.y, aabb_.max.z},
-        {aabb_.max.x, aabb_.max.y, aabb_.max.z}};
-
-    // エッジ接続リスト
-    const std::array<std::pair<int, int>, 12> edges = {
-        std::make_pair(0, 1), std::make_pair(1, 3), std::make_pair(3, 2), std::make_pair(2, 0), // 前面
-        std::make_pair(4, 5), std::make_pair(5, 7), std::make_pair(7, 6), std::make_pair(6, 4), // 背面
-        std::make_pair(0, 4), std::make_pair(1, 5), std::make_pair(2, 6), std::make_pair(3, 7)  // 側面
-    };
-
-    // 線を描画
-    for (const auto &edge : edges) {
-        DrawLine3D::GetInstance()->SetPoints(vertices[edge.first], vertices[edge.second], color_);
-    }
+    DrawLine3D::GetInstance()->DrawAABB(aabb_.min, aabb_.max, color_);
 }
 
 void Collider::DrawOBB(const ViewProjection &viewProjection) {
-    // OBBの8つの頂点を計算
-    std::array<Vector3, 8> vertices;
-    Vector3 halfSize = obb_.size; // サイズの半分を計算
-
-    // OBBの8頂点を計算するループ
-    for (int i = 0; i < 8; i++) {
-        // 各頂点のローカル座標を計算
-        Vector3 localPosition = Vector3(
-            (i & 1) ? halfSize.x : -halfSize.x,
-            (i & 2) ? halfSize.y : -halfSize.y,
-            (i & 4) ? halfSize.z : -halfSize.z);
-
-        // scaleCenter を基準にスケール変換
-        Vector3 scaledPosition = localPosition + (obb_.scaleCenter - obb_.rotationCenter);
-
-        // 回転中心を基準に回転を適用
-        Vector3 rotatedPosition =
-            obb_.orientations[0] * scaledPosition.x +
-            obb_.orientations[1] * scaledPosition.y +
-            obb_.orientations[2] * scaledPosition.z;
-
-        // ワールド座標へ変換
-        vertices[i] = obb_.rotationCenter + rotatedPosition;
-    }
+    // 大きさ1の立方体を、各頂点 rotationCenter + 回転(±size + scaleCenter - rotationCenter) に移す行列
+    Vector3 offset = obb_.scaleCenter - obb_.rotationCenter;
+    Vector3 translate = obb_.rotationCenter + obb_.orientations[0] * offset.x + obb_.orientations[1] * offset.y + obb_.orientations[2] * offset.z;
+    Vector3 axisX = obb_.orientations[0] * (obb_.size.x * 2.0f);
+    Vector3 axisY = obb_.orientations[1] * (obb_.size.y * 2.0f);
+    Vector3 axisZ = obb_.orientations[2] * (obb_.size.z * 2.0f);
+    Matrix4x4 worldMatrix = {axisX.x, axisX.y, axisX.z, 0.0f,
+                             axisY.x, axisY.y, axisY.z, 0.0f,
+                             axisZ.x, axisZ.y, axisZ.z, 0.0f,
+                             translate.x, translate.y, translate.z, 1.0f};
 
     // scaleCenterに球を描画
     DrawSphereAtCenter(viewProjection, obb_.scaleCenterRotated, 0.1f); // 半径0.1fで球を描画
 
-    // エッジ接続リスト
-    const std::array<std::pair<int, int>, 12> edges = {
-        std::make_pair(0, 1), std::make_pair(1, 3), std::make_pair(3, 2), std::make_pair(2, 0), // 前面
-        std::make_pair(4, 5), std::make_pair(5, 7), std::make_pair(7, 6), std::make_pair(6, 4), // 背面
-        std::make_pair(0, 4), std::make_pair(1, 5), std::make_pair(2, 6), std::make_pair(3, 7)  // 側面
-    };
-
-    // 線を描画
-    for (const auto &edge : edges) {
-        DrawLine3D::GetInstance()->SetPoints(vertices[edge.first], vertices[edge.second], color_);
-    }
+    DrawLine3D::GetInstance()->DrawBox(worldMatrix, color_);
 
     DrawRotationCenter(viewProjection);
 }
 
 // 球を描画する関数
 void Collider::DrawSphereAtCenter(const ViewProjection &viewProjection, const Vector3 &center, float radius) {
-    const int slices = 16; // 球の横方向の分割数
-    const int stacks = 8;  // 球の縦方向の分割数
-
-    for (int i = 0; i < slices; i++) {
-        float theta1 = (i * 2.0f * std::numbers::pi_v<float>) / slices;
-        float theta2 = ((i + 1) * 2.0f * std::numbers::pi_v<float>) / slices;
-
-        for (int j = 0; j < stacks; j++) {
-            float phi1 = (j * std::numbers::pi_v<float>) / stacks;
-            float phi2 = ((j + 1) * std::numbers::pi_v<float>) / stacks;
-
-            // 球の4つの頂点を計算
-            Vector3 p1 = Vector3(
-                center.x + radius * sin(phi1) * cos(theta1),
-                center.y + radius * cos(phi1),
-                center.z + radius * sin(phi1) * sin(theta1));
-
-            Vector3 p2 = Vector3(
-                center.x + radius * sin(phi1) * cos(theta2),
-                center.y + radius * cos(phi1),
-                center.z + radius * sin(phi1) * sin(theta2));
-
-            Vector3 p3 = Vector3(
-                center.x + radius * sin(phi2) * cos(theta1),
-                center.y + radius * cos(phi2),
-                center.z + radius * sin(phi2) * sin(theta1));
-
-            Vector3 p4 = Vector3(
-                center.x + radius * sin(phi2) * cos(theta2),
-                center.y + radius * cos(phi2),
-                center.z + radius * sin(phi2) * sin(theta2));
-
-            // 4つの三角形で球の断片を描画
-            DrawLine3D::GetInstance()->SetPoints(p1, p2);
-            DrawLine3D::GetInstance()->SetPoints(p2, p4);
-            DrawLine3D::GetInstance()->SetPoints(p4, p3);
-            DrawLine3D::GetInstance()->SetPoints(p3, p1);
-        }
-    }
+    const int kSubdivision = 16; // 球の分割数
+    DrawLine3D::GetInstance()->DrawSphere(center, {1.0f, 1.0f, 1.0f, 1.0f}, radius, kSubdivision);
 }
 
 void Collider::OffsetImgui() {
@@ -455,38 +342,8 @@ void Collider::DrawRotationCenter(const ViewProjection &viewProjection) {
     // 回転中心を表す球の半径
     float rotationCenterRadius = 0.1f;
 
-    // 球を構成する点を描画
-    const uint32_t kSubdivision = 10; // 分割数
-    const float kLonEvery = 2.0f * std::numbers::pi_v<float> / kSubdivision;
-    const float kLatEvery = std::numbers::pi_v<float> / kSubdivision;
-
-    for (uint32_t latIndex = 0; latIndex < kSubdivision; ++latIndex) {
-        float lat = -std::numbers::pi_v<float> / 2.0f + kLatEvery * latIndex;
-
-        for (uint32_t lonIndex = 0; lonIndex < kSubdivision; ++lonIndex) {
-            float lon = lonIndex * kLonEvery;
-
-            Vector3 start = {
-                obb_.rotationCenter.x + rotationCenterRadius * std::cosf(lat) * std::cosf(lon),
-                obb_.rotationCenter.y + rotationCenterRadius * std::sinf(lat),
-                obb_.rotationCenter.z + rotationCenterRadius * std::cosf(lat) * std::sinf(lon)};
-
-            Vector3 end1 = {
-                obb_.rotationCenter.x + rotationCenterRadius * std::cosf(lat) * std::cosf(lon + kLonEvery),
-                obb_.rotationCenter.y + rotationCenterRadius * std::sinf(lat),
-                obb_.rotationCenter.z + rotationCenterRadius * std::cosf(lat) * std::sinf(lon + kLonEvery),
-            };
-
-            Vector3 end2 = {
-                obb_.rotationCenter.x + rotationCenterRadius * std::cosf(lat + kLatEvery) * std::cosf(lon),
-                obb_.rotationCenter.y + rotationCenterRadius * std::sinf(lat + kLatEvery),
-                obb_.rotationCenter.z + rotationCenterRadius * std::cosf(lat + kLatEvery) * std::sinf(lon),
-            };
-
-            DrawLine3D::GetInstance()->SetPoints(start, end1);
-            DrawLine3D::GetInstance()->SetPoints(start, end2);
-        }
-    }
+    const int kSubdivision = 10; // 分割数
+    DrawLine3D::GetInstance()->DrawSphere(obb_.rotationCenter, {1.0f, 1.0f, 1.0f, 1.0f}, rotationCenterRadius, kSubdivision);
 }
 
 
@@ -530,4 +387,6 @@ void Collider::LoadFromJson() {
     AABBOffset_.max = ColliderDatas_->Load<Vector3>("max", {0.0f, 0.0f, 0.0f});
     OBBOffset_.scaleCenter = ColliderDatas_->Load<Vector3>("scaleCenter", {0.0f, 0.0f, 0.0f});
     OBBOffset_.size = ColliderDatas_->Load<Vector3>("size", {1.0f, 1.0f, 1.0f});
+
+    JsonHotReloader::GetInstance()->Watch(ColliderDatas_->GetFilePath(), this, [this]() { LoadFromJson(); });
 }
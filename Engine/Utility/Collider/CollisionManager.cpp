@@ -1,5 +1,8 @@
 #define NOMINMAX
 #include "CollisionManager.h"
+#include "Debug/Profiler/Profiler.h"
+#include "Engine/Frame/FrameStats.h"
+#include "Memory/FrameAllocator.h"
 #include "Object/Object3dCommon.h"
 #include "myMath.h"
 
@@ -51,6 +54,7 @@ void CollisionManager::Draw(const ViewProjection &viewProjection) {
 }
 
 void CollisionManager::Update() {
+    PROFILE_FUNCTION();
     UpdateWorldTransform();
     CheckAllCollisions();
 }
@@ -114,7 +118,8 @@ void CollisionManager::CheckCollisionPair(Collider *colliderA, Collider *collide
     colliderA->SetIsColliding(isCollidingNow);
     colliderB->SetIsColliding(isCollidingNow);
 
-    bool wasColliding = collisionStates[key];
+    // 衝突中のペアだけを保持する（全ペアを登録すると組み合わせの数だけmapが膨らむ）
+    bool wasColliding = collisionStates.contains(key);
 
     // 衝突状態の変化に応じたコールバックの呼び出し
     if (isCollidingNow) {
@@ -139,35 +144,33 @@ void CollisionManager::CheckCollisionPair(Collider *colliderA, Collider *collide
     }
 
     // 衝突状態の更新
-    collisionStates[key] = isCollidingNow;
+    if (isCollidingNow && !wasColliding) {
+        collisionStates.emplace(key, true);
+    } else if (!isCollidingNow && wasColliding) {
+        collisionStates.erase(key);
+    }
 }
 
 void CollisionManager::CheckAllCollisions() {
-    // 全てのコライダーペアを総当たり
-    for (auto itrA = colliders_.begin(); itrA != colliders_.end(); ++itrA) {
-        Collider *colliderA = itrA->second;
-
-        // Aが衝突無効ならスキップ
-        if (!colliderA->IsCollisionEnabled()) {
-            continue;
+    // 衝突が有効なものだけを連続した配列に集める（mapのノードを総当たりで辿らない）
+    FrameVector<Collider *> enabledColliders;
+    enabledColliders.reserve(colliders_.size());
+    for (auto &[name, collider] : colliders_) {
+        if (collider->IsCollisionEnabled()) {
+            enabledColliders.push_back(collider);
         }
+    }
 
-        // itrBはitrAの次の要素から
-        auto itrB = itrA;
-        ++itrB;
-
-        for (; itrB != colliders_.end(); ++itrB) {
-            Collider *colliderB = itrB->second;
-
-            // Bが衝突無効ならスキップ
-            if (!colliderB->IsCollisionEnabled()) {
-                continue;
-            }
-
-            // 当たり判定実行
-            CheckCollisionPair(colliderA, colliderB);
+    uint32_t pairCount = 0;
+    // 全てのコライダーペアを総当たり（BはAの次の要素から）
+    for (size_t a = 0; a < enabledColliders.size(); ++a) {
+        for (size_t b = a + 1; b < enabledColliders.size(); ++b) {
+            // 当たり判定実行（コールバックで無効化されたものはCheckCollisionPairで飛ばす）
+            CheckCollisionPair(enabledColliders[a], enabledColliders[b]);
+            ++pairCount;
         }
     }
+    STAT_COUNTER_ADD("ColliderPairs", pairCount);
 }
 
 void CollisionManager::AddCollider(Collider *collider) {
@@ -240,8 +243,8 @@ bool CollisionManager::IsCollision(const OBB &obb, const Sphere &sphere, const M
     // OBBのWorldMatrixを作成
     Matrix4x4 obbWorldMatrix = MakeOBBWorldMatrix(obb, rotateMatrix);
 
-    // OBBのWorldMatrixの逆行列を取得
-    Matrix4x4 obbWorldMatrixInverse = Inverse(obbWorldMatrix);
+    // OBBのWorldMatrixの逆行列を取得（回転と平行移動のみなのでアフィン逆行列でよい）
+    Matrix4x4 obbWorldMatrixInverse = InverseAffine(obbWorldMatrix);
 
     // Sphereの中心点をOBBのローカル空間に変換
     Vector3 centerInOBBLocalSpace = Transformation(sphere.center, obbWorldMatrixInverse);
@@ -21,6 +21,8 @@ class CollisionManager {
     static std::unordered_map<std::string, Collider *> colliders_;
     std::unordered_map<std::pair<Collider *, Collider *>, bool, pair_hash> collisionStates;
     bool isCollidingNow = false;
+    // 固定ステップで判定するか（Frameの固定ステップが有効なときだけ効く）
+    bool isUseFixedTimeStep_ = false;
 
   public:
     /// <summary>
@@ -68,7 +70,15 @@ class CollisionManager {
     /// </summary>
     static void AddCollider(Collider *collider);
 
-  private:
+    /// <summary>
+    /// 固定ステップで判定するか
+    /// </summary>
+    void SetUseFixedTimeStep(bool isUseFixedTimeStep) { isUseFixedTimeStep_ = isUseFixedTimeStep; }
+    bool IsUseFixedTimeStep() const { return isUseFixedTimeStep_; }
+
+    /// <summary>
+    /// 形状ごとの判定（コライダーを登録せずに使える）
+    /// </summary>
     bool IsCollision(const AABB &aabb1, const AABB &aabb2);
     bool IsCollision(const OBB &obb1, const OBB &obb2);
     bool IsCollision(const AABB &aabb, const Sphere &sphere);
@@ -76,6 +86,7 @@ class CollisionManager {
     bool IsCollision(const Sphere &s1, const Sphere &s2);
     bool IsCollision(const AABB &aabb, const OBB &obb);
 
+  private:
     // 軸に対するOBBの投影範囲を計算する関数
     void projectOBB(const OBB &obb, const Vector3 &axis, float &min, float &max);
     void projectAABB(const Vector3 &axis, const AABB &aabb, float &outMin, float &outMax);
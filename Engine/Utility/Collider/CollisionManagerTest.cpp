@@ -0,0 +1,85 @@
+#include "Collider/CollisionManager.h"
+#include "Data/JsonHotReloader.h"
+#include "Test/Test.h"
+#include <random>
+
+namespace {
+
+// 回転行列の各行を軸にしたOBB
+OBB MakeOBB(const Vector3 &center, const Vector3 &size, const Matrix4x4 &rotateMatrix) {
+    OBB obb;
+    obb.rotationCenter = center;
+    obb.scaleCenter = center;
+    obb.scaleCenterRotated = center;
+    obb.size = size;
+    for (int i = 0; i < 3; ++i) {
+        obb.orientations[i] = {rotateMatrix.m[i][0], rotateMatrix.m[i][1], rotateMatrix.m[i][2]};
+    }
+    return obb;
+}
+
+// 中心だけを返すコライダー
+class TestCollider : public Collider {
+  public:
+    Vector3 GetCenterPosition() override { return {0.0f, 0.0f, 0.0f}; }
+    Quaternion GetCenterRotation() override { return Quaternion::IdentityQuaternion(); }
+};
+
+} // namespace
+
+// 近いものは当たり、大きさの和より離れたものは当たらない
+TEST(ShapePairsHitAndMiss) {
+    CollisionManager collisionManager;
+    const Vector3 one = {1.0f, 1.0f, 1.0f};
+    const Matrix4x4 identity = MakeIdentity4x4();
+    const Matrix4x4 rotate = MakeRotateXYZMatrix({0.3f, 0.7f, 0.785f});
+    const Vector3 near = {0.5f, 0.25f, 0.0f};
+    const Vector3 far = {10.0f, 0.0f, 0.0f};
+
+    CHECK(collisionManager.IsCollision(Sphere{{0.0f, 0.0f, 0.0f}, 1.0f}, Sphere{near, 1.0f}));
+    CHECK(!collisionManager.IsCollision(Sphere{{0.0f, 0.0f, 0.0f}, 1.0f}, Sphere{far, 1.0f}));
+
+    CHECK(collisionManager.IsCollision(AABB{-one, one}, AABB{near - one, near + one}));
+    CHECK(!collisionManager.IsCollision(AABB{-one, one}, AABB{far - one, far + one}));
+
+    CHECK(collisionManager.IsCollision(AABB{-one, one}, Sphere{near, 1.0f}));
+    CHECK(!collisionManager.IsCollision(AABB{-one, one}, Sphere{far, 1.0f}));
+
+    CHECK(collisionManager.IsCollision(MakeOBB({0.0f, 0.0f, 0.0f}, one, identity), MakeOBB(near, one, rotate)));
+    CHECK(!collisionManager.IsCollision(MakeOBB({0.0f, 0.0f, 0.0f}, one, identity), MakeOBB(far, one, rotate)));
+
+    CHECK(collisionManager.IsCollision(MakeOBB({0.0f, 0.0f, 0.0f}, one, rotate), Sphere{near, 1.0f}, rotate));
+    CHECK(!collisionManager.IsCollision(MakeOBB({0.0f, 0.0f, 0.0f}, one, rotate), Sphere{far, 1.0f}, rotate));
+
+    CHECK(collisionManager.IsCollision(AABB{-one, one}, MakeOBB(near, one, rotate)));
+    CHECK(!collisionManager.IsCollision(AABB{-one, one}, MakeOBB(far, one, rotate)));
+}
+
+// 回転していないOBBの判定は、同じ範囲のAABBの判定と一致する
+TEST(AxisAlignedOBBMatchesAABB) {
+    CollisionManager collisionManager;
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> position(-4.0f, 4.0f);
+    std::uniform_real_distribution<float> halfSize(0.5f, 2.0f);
+    const Matrix4x4 identity = MakeIdentity4x4();
+    for (int i = 0; i < 1000; ++i) {
+        Vector3 centerA = {position(random), position(random), position(random)};
+        Vector3 centerB = {position(random), position(random), position(random)};
+        Vector3 extentA = {halfSize(random), halfSize(random), halfSize(random)};
+        Vector3 extentB = {halfSize(random), halfSize(random), halfSize(random)};
+        AABB a = {centerA - extentA, centerA + extentA};
+        AABB b = {centerB - extentB, centerB + extentB};
+        bool expected = collisionManager.IsCollision(a, b);
+        CHECK(collisionManager.IsCollision(MakeOBB(centerA, extentA, identity), MakeOBB(centerB, extentB, identity)) == expected);
+        CHECK(collisionManager.IsCollision(a, MakeOBB(centerB, extentB, identity)) == expected);
+    }
+}
+
+// 終了処理の後にコライダーを破棄しても、ホットリロードのインスタンスを作り直さない
+TEST(ColliderOutlivesHotReloader) {
+    JsonHotReloader::GetInstance();
+    Collider *collider = new TestCollider();
+    JsonHotReloader::GetInstance()->Finalize();
+    delete collider;
+    CHECK(JsonHotReloader::TryGetInstance() == nullptr);
+}
@@ -1,14 +1,139 @@
 #include "DataHandler.h"
 
+std::unordered_map<AssetID, DataHandler::Document> DataHandler::documents_;
+std::mutex DataHandler::documentsMutex_;
+
+namespace {
+
+// ファイルを読み込んでパースする（失敗したらfalse）
+bool ParseFile(const std::string &filePath, json &out) {
+    std::ifstream inFile(filePath);
+    if (!inFile.is_open()) {
+        return false;
+    }
+    json j = json::parse(inFile, nullptr, false);
+    if (j.is_discarded()) {
+        std::cerr << "JSON Parse Error: " << filePath << std::endl;
+        return false;
+    }
+    out = std::move(j);
+    return true;
+}
+
+} // namespace
+
 DataHandler::DataHandler(const std::string &folder, const std::string &file) {
     folderPath = basePath + "/" + folder;
     fileName = file + ".json";
     fs::create_directories(folderPath); // フォルダを作成
 }
 
+DataHandler::Document &DataHandler::GetOrCreateDocument(const std::string &filePath) {
+    auto [it, inserted] = documents_.try_emplace(AssetDatabase::MakeAssetID(filePath));
+    if (inserted) {
+        // アセットデータベースに登録済みなら実ファイルのパスを使う
+        it->second.filePath = AssetDatabase::GetInstance()->ResolvePath(filePath);
+    }
+    return it->second;
+}
+
+const json *DataHandler::FindDocument(const std::string &filePath) {
+    Document &document = GetOrCreateDocument(filePath);
+    std::error_code ec;
+    fs::file_time_type writeTime = fs::last_write_time(document.filePath, ec);
+    if (ec) {
+        // ファイルがない場合（保存途中で一時的に消えているときは前の内容を使う）
+        return document.data.is_null() ? nullptr : &document.data;
+    }
+
+    // 読み込み済みで更新されていなければキャッシュを使う
+    if (!document.data.is_null() && document.writeTime == writeTime) {
+        return &document.data;
+    }
+
+    // 外部で編集されていたら読み直す（パースに失敗したら以前の内容を残す）
+    bool isReload = !document.data.is_null();
+    document.writeTime = writeTime;
+    json j;
+    if (ParseFile(document.filePath, j)) {
+        document.data = std::move(j);
+    } else if (document.data.is_null()) {
+        document.data = json::object();
+    }
+    if (isReload) {
+        ++document.revision;
+    }
+    return &document.data;
+}
+
+json &DataHandler::GetDocumentForWrite(const std::string &filePath) {
+    Document &document = GetOrCreateDocument(filePath);
+    if (FindDocument(filePath) == nullptr) {
+        document.data = json::object();
+    }
+    return document.data;
+}
+
+void DataHandler::WriteDocument(const std::string &filePath) {
+    Document &document = GetOrCreateDocument(filePath);
+
+    std::ofstream outFile(document.filePath);
+    outFile << document.data.dump(4); // インデント付きで保存
+    outFile.close();
+
+    // 自分で書き込んだ変更をホットリロードで拾わないように更新時刻を記録
+    std::error_code ec;
+    fs::file_time_type writeTime = fs::last_write_time(document.filePath, ec);
+    if (!ec) {
+        document.writeTime = writeTime;
+    }
+}
+
+bool DataHandler::ReloadDocument(const std::string &filePath) {
+    std::lock_guard<std::mutex> lock(documentsMutex_);
+    Document &document = GetOrCreateDocument(filePath);
+    std::error_code ec;
+    fs::file_time_type writeTime = fs::last_write_time(document.filePath, ec);
+    if (ec) {
+        return false;
+    }
+
+    // 失敗しても同じ更新時刻で何度も読み直さないように時刻は記録する
+    document.writeTime = writeTime;
+
+    json j;
+    if (!ParseFile(document.filePath, j)) {
+        if (document.data.is_null()) {
+            document.data = json::object();
+        }
+        return false;
+    }
+    document.data = std::move(j);
+    ++document.revision;
+    return true;
+}
+
+bool DataHandler::GetCachedWriteTime(const std::string &filePath, fs::file_time_type &writeTime) {
+    std::lock_guard<std::mutex> lock(documentsMutex_);
+    auto it = documents_.find(AssetDatabase::MakeAssetID(filePath));
+    if (it == documents_.end() || it->second.data.is_null()) {
+        return false;
+    }
+    writeTime = it->second.writeTime;
+    return true;
+}
+
+uint32_t DataHandler::GetRevision(const std::string &filePath) {
+    std::lock_guard<std::mutex> lock(documentsMutex_);
+    auto it = documents_.find(AssetDatabase::MakeAssetID(filePath));
+    if (it == documents_.end()) {
+        return 0;
+    }
+    return it->second.revision;
+}
+
 // 明示的なテンプレートインスタンス化
 template void DataHandler::Save<int>(const std::string &, const int &);
-template void DataHandler::Save<int32_t>(const std::string &, const int32_t &);
 template void DataHandler::Save<float>(const std::string &, const float &);
 template void DataHandler::Save<std::string>(const std::string &, const std::string &);
 template void DataHandler::Save<Vector2>(const std::string &, const Vector2 &);
@@ -18,7 +143,6 @@ template void DataHandler::Save<Quaternion>(const std::string &, const Quaternio
 template void DataHandler::Save<PrimitiveType>(const std::string &, const PrimitiveType &);
 
 template int DataHandler::Load<int>(const std::string &, const int &);
-template int32_t DataHandler::Load<int32_t>(const std::string &, const int32_t &);
 template float DataHandler::Load<float>(const std::string &, const float &);
 template std::string DataHandler::Load<std::string>(const std::string &, const std::string &);
 template Vector2 DataHandler::Load<Vector2>(const std::string &, const Vector2 &);
@@ -7,8 +7,11 @@
 #include <fstream>
 #include"iostream"
 #include <memory>
+#include <mutex>
 #include <cstdint>
+#include <unordered_map>
 #include <Primitive/PrimitiveModel.h>
+#include <Asset/AssetDatabase.h>
 
 using json = nlohmann::json;
 namespace fs = std::filesystem;
@@ -30,6 +33,49 @@ class DataHandler {
     // JSONデータをロード
     template <typename T>
     T Load(const std::string &key, const T &defaultValue);
+
+    // ファイルパスを取得
+    std::string GetFilePath() const { return folderPath + "/" + fileName; }
+
+    /// <summary>
+    /// ディスクから読み直してキャッシュを更新（パースに失敗した場合は以前の内容を残す）
+    /// </summary>
+    static bool ReloadDocument(const std::string &filePath);
+
+    /// <summary>
+    /// キャッシュ中のドキュメントを読み込んだ時点の更新時刻を取得
+    /// </summary>
+    /// <returns>キャッシュされていなければfalse</returns>
+    static bool GetCachedWriteTime(const std::string &filePath, fs::file_time_type &writeTime);
+
+    /// <summary>
+    /// ディスク上の変更を読み直した回数（自分で保存した分は数えない）
+    /// </summary>
+    static uint32_t GetRevision(const std::string &filePath);
+
+  private:
+    // ファイル1つ分のキャッシュ
+    struct Document {
+        std::string filePath;         // 実ファイルのパス
+        json data;
+        fs::file_time_type writeTime; // 読み込み(書き込み)時点の更新時刻
+        uint32_t revision = 0;        // ディスク上の変更を読み直した回数
+    };
+
+    // キャッシュからドキュメントを取得（未読み込みか、ディスク上で更新されていれば読み直す。ファイルがなければnullptr）
+    static const json *FindDocument(const std::string &filePath);
+    // 書き込み用にドキュメントを取得（なければ空で作る）
+    static json &GetDocumentForWrite(const std::string &filePath);
+    // キャッシュの内容をディスクへ書き出す
+    static void WriteDocument(const std::string &filePath);
+
+    // 未登録ならディスクのパスを解決してドキュメントを作る
+    static Document &GetOrCreateDocument(const std::string &filePath);
+
+    // アセットIDごとのJSONドキュメントキャッシュ
+    static std::unordered_map<AssetID, Document> documents_;
+    // ジョブからの読み込みもあるので、キャッシュへのアクセスは公開関数の入口でロックする
+    static std::mutex documentsMutex_;
 };
 
 // JSON変換の定義 (Vector2)
@@ -89,39 +135,27 @@ inline void from_json(const json &j, PrimitiveType &type) {
 // Save (テンプレート関数はここに書く)
 template <typename T>
 void DataHandler::Save(const std::string &key, const T &value) {
-    std::string filePath = folderPath + "/" + fileName;
-    json j;
-
-    std::ifstream inFile(filePath);
-    if (inFile.is_open()) {
-        inFile >> j;
-        inFile.close();
-    }
+    std::string filePath = GetFilePath();
+    std::lock_guard<std::mutex> lock(documentsMutex_);
+    json &j = GetDocumentForWrite(filePath);
 
     j[key] = value; // 変数名をキーにして保存
 
-    std::ofstream outFile(filePath);
-    outFile << j.dump(4); // インデント付きで保存
-    outFile.close();
+    WriteDocument(filePath);
 }
 
 // Load (テンプレート関数はここに書く)
 template <typename T>
 T DataHandler::Load(const std::string &key, const T &defaultValue) {
-    std::string filePath = folderPath + "/" + fileName;
-    json j;
-
-    std::ifstream inFile(filePath);
-    if (inFile.is_open()) {
-        inFile >> j;
-        inFile.close();
-    } else {
+    std::lock_guard<std::mutex> lock(documentsMutex_);
+    const json *j = FindDocument(GetFilePath());
+    if (!j) {
         return defaultValue; // ファイルがない場合
     }
 
-    if (j.contains(key)) {
+    if (j->contains(key)) {
         try {
-            return j[key].get<T>(); // from_json が自動適用
+            return (*j)[key].get<T>(); // from_json が自動適用
         } catch (const json::exception &e) {
             std::cerr << "JSON Load Error: " << e.what() << " (Key: " << key << ")" << std::endl;
         }
@@ -0,0 +1,77 @@
+#include "Data/DataHandler.h"
+#include "Test/Test.h"
+#include <chrono>
+
+namespace {
+
+void WriteFile(const std::string &filePath, const std::string &text) {
+    std::ofstream file(filePath);
+    file << text;
+}
+
+// キャッシュした更新時刻と確実に違う時刻にする（ファイルシステムの時刻の細かさに依存しない）
+void TouchLater(const std::string &filePath) {
+    fs::last_write_time(filePath, fs::last_write_time(filePath) + std::chrono::seconds(2));
+}
+
+// テストで作ったファイルとフォルダを消す
+void RemoveFile(const std::string &filePath) {
+    std::error_code ec;
+    fs::remove(filePath, ec);
+    fs::remove(fs::path(filePath).parent_path(), ec);
+}
+
+} // namespace
+
+// 保存した値はキャッシュからも、別のハンドラーからも同じ値で読める
+TEST(SaveLoadRoundTrip) {
+    DataHandler writer("DataHandlerTest", "round_trip");
+    writer.Save<float>("speed", 2.5f);
+    writer.Save<Vector3>("position", {1.0f, 2.0f, 3.0f});
+    writer.Save<std::string>("name", "player");
+
+    DataHandler reader("DataHandlerTest", "round_trip");
+    CHECK(reader.Load<float>("speed", 0.0f) == 2.5f);
+    Vector3 position = reader.Load<Vector3>("position", {0.0f, 0.0f, 0.0f});
+    CHECK(position.x == 1.0f && position.y == 2.0f && position.z == 3.0f);
+    CHECK(reader.Load<std::string>("name", "") == "player");
+    // ないキーと、型の違うキーは既定値
+    CHECK(reader.Load<int>("missing", 7) == 7);
+    CHECK(reader.Load<Vector3>("speed", {9.0f, 9.0f, 9.0f}).x == 9.0f);
+
+    // 自分で書き込んだ分は更新として数えない
+    CHECK(DataHandler::GetRevision(writer.GetFilePath()) == 0);
+    RemoveFile(writer.GetFilePath());
+}
+
+// 外部で編集されたら読み直し、壊れた内容なら前の値を残す
+TEST(ReloadsExternalEdits) {
+    DataHandler dataHandler("DataHandlerTest", "external_edit");
+    const std::string filePath = dataHandler.GetFilePath();
+    WriteFile(filePath, R"({"value": 1})");
+    CHECK(dataHandler.Load<int>("value", 0) == 1);
+    uint32_t revision = DataHandler::GetRevision(filePath);
+
+    WriteFile(filePath, R"({"value": 2})");
+    TouchLater(filePath);
+    CHECK(dataHandler.Load<int>("value", 0) == 2);
+    CHECK(DataHandler::GetRevision(filePath) == revision + 1);
+
+    // ホットリロードと同じ経路
+    WriteFile(filePath, R"({"value": 3})");
+    TouchLater(filePath);
+    CHECK(DataHandler::ReloadDocument(filePath));
+    CHECK(dataHandler.Load<int>("value", 0) == 3);
+    CHECK(DataHandler::GetRevision(filePath) == revision + 2);
+
+    WriteFile(filePath, R"({"value": )");
+    TouchLater(filePath);
+    CHECK(!DataHandler::ReloadDocument(filePath));
+    CHECK(dataHandler.Load<int>("value", 0) == 3);
+    CHECK(DataHandler::GetRevision(filePath) == revision + 2);
+
+    // ファイルが消えても前の内容を使う
+    RemoveFile(filePath);
+    CHECK(dataHandler.Load<int>("value", 0) == 3);
+    CHECK(!DataHandler::ReloadDocument(filePath));
+}
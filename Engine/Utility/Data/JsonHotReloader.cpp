@@ -0,0 +1,186 @@
+#include "JsonHotReloader.h"
+#include "Data/DataHandler.h"
+#include "Debug/Log/Logger.h"
+#ifdef _WIN32
+#include "Windows.h"
+#endif
+
+namespace fs = std::filesystem;
+
+JsonHotReloader *JsonHotReloader::instance = nullptr;
+
+JsonHotReloader *JsonHotReloader::GetInstance() {
+    if (instance == nullptr) {
+        instance = new JsonHotReloader();
+    }
+    return instance;
+}
+
+void JsonHotReloader::Initialize(const std::string &rootPath) {
+    rootPath_ = rootPath;
+    pollTimer_ = 0.0f;
+
+#ifdef _WIN32
+    // サブディレクトリを含めて書き込み・ファイル名の変更を監視
+    HANDLE handle = FindFirstChangeNotificationA(rootPath_.c_str(), TRUE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    if (handle != INVALID_HANDLE_VALUE) {
+        changeHandle_ = handle;
+    } else {
+        Logger::Log("JsonHotReloader: change notification unavailable, falling back to polling\n");
+    }
+#endif
+}
+
+void JsonHotReloader::Finalize() {
+#ifdef _WIN32
+    if (changeHandle_) {
+        FindCloseChangeNotification(static_cast<HANDLE>(changeHandle_));
+        changeHandle_ = nullptr;
+    }
+#endif
+    delete instance;
+    instance = nullptr;
+}
+
+void JsonHotReloader::Watch(const std::string &filePath, const void *owner, Callback callback) {
+    auto [it, inserted] = files_.try_emplace(filePath);
+    WatchedFile &file = it->second;
+    if (inserted) {
+        file.revision = DataHandler::GetRevision(filePath);
+    }
+    for (Listener &listener : file.listeners) {
+        if (listener.owner == owner) {
+            listener.callback = std::move(callback);
+            return;
+        }
+    }
+    file.listeners.push_back({owner, std::move(callback)});
+}
+
+void JsonHotReloader::Unwatch(const void *owner) {
+    for (auto it = files_.begin(); it != files_.end();) {
+        std::vector<Listener> &listeners = it->second.listeners;
+        std::erase_if(listeners, [owner](const Listener &listener) { return listener.owner == owner; });
+        if (listeners.empty()) {
+            if (it->second.isPending) {
+                --pendingCount_;
+            }
+            it = files_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void JsonHotReloader::Update(float deltaTime) {
+    if (!isEnabled_ || files_.empty()) {
+        return;
+    }
+
+    pollTimer_ += deltaTime;
+
+    // 変更通知・安定待ち・(通知が使えない場合の)一定間隔のいずれかで調べる
+    bool isNotified = ConsumeChangeNotification();
+    bool isPollTime = !changeHandle_ && pollTimer_ >= kPollInterval;
+    if (!isNotified && pendingCount_ == 0 && !isPollTime) {
+        return;
+    }
+
+    float elapsedTime = pollTimer_;
+    pollTimer_ = 0.0f;
+    PollFiles(elapsedTime);
+}
+
+bool JsonHotReloader::ConsumeChangeNotification() {
+#ifdef _WIN32
+    if (!changeHandle_) {
+        return false;
+    }
+    HANDLE handle = static_cast<HANDLE>(changeHandle_);
+    if (WaitForSingleObject(handle, 0) != WAIT_OBJECT_0) {
+        return false;
+    }
+    // 次の通知を待つ
+    if (!FindNextChangeNotification(handle)) {
+        FindCloseChangeNotification(handle);
+        changeHandle_ = nullptr;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void JsonHotReloader::PollFiles(float elapsedTime) {
+    std::vector<std::string> reloadPaths;
+    std::vector<std::string> notifyPaths;
+
+    for (auto &[filePath, file] : files_) {
+        std::error_code ec;
+        fs::file_time_type writeTime = fs::last_write_time(filePath, ec);
+        if (ec) {
+            continue; // 保存途中などで一時的に存在しない
+        }
+
+        // キャッシュと同じなら変更なし（DataHandler経由の保存もここで弾かれる）
+        fs::file_time_type cachedTime;
+        if (DataHandler::GetCachedWriteTime(filePath, cachedTime) && cachedTime == writeTime) {
+            if (file.isPending) {
+                file.isPending = false;
+                --pendingCount_;
+            }
+            // 別の読み込みが先に外部の変更を読み直していたら通知だけする
+            uint32_t revision = DataHandler::GetRevision(filePath);
+            if (revision != file.revision) {
+                file.revision = revision;
+                notifyPaths.push_back(filePath);
+            }
+            continue;
+        }
+
+        // 新しい変更を検出したら安定待ちを始める
+        if (!file.isPending || file.pendingTime != writeTime) {
+            if (!file.isPending) {
+                ++pendingCount_;
+            }
+            file.isPending = true;
+            file.pendingTime = writeTime;
+            file.stableTime = 0.0f;
+            continue;
+        }
+
+        // 連続保存中は読み直さない
+        file.stableTime += elapsedTime;
+        if (file.stableTime < kDebounceTime) {
+            continue;
+        }
+
+        file.isPending = false;
+        --pendingCount_;
+        reloadPaths.push_back(filePath);
+    }
+
+    for (const std::string &filePath : reloadPaths) {
+        if (!DataHandler::ReloadDocument(filePath)) {
+            Logger::Log("JsonHotReloader: failed to reload " + filePath + "\n");
+            continue;
+        }
+        Logger::Log("JsonHotReloader: reloaded " + filePath + "\n");
+        notifyPaths.push_back(filePath);
+    }
+
+    for (const std::string &filePath : notifyPaths) {
+        // コールバック内で登録・解除されても壊れないようにコピーしてから通知
+        auto it = files_.find(filePath);
+        if (it == files_.end()) {
+            continue;
+        }
+        it->second.revision = DataHandler::GetRevision(filePath);
+        std::vector<Listener> listeners = it->second.listeners;
+        for (const Listener &listener : listeners) {
+            if (listener.callback) {
+                listener.callback();
+            }
+        }
+    }
+}
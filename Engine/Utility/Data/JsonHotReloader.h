@@ -0,0 +1,103 @@
+#pragma once
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// DataHandler経由のJSONファイルを監視し、変更されたファイルだけを読み直して登録先に通知する
+/// </summary>
+class JsonHotReloader {
+  private:
+    static JsonHotReloader *instance;
+
+    JsonHotReloader() = default;
+    ~JsonHotReloader() = default;
+    JsonHotReloader(JsonHotReloader &) = delete;
+    JsonHotReloader &operator=(JsonHotReloader &) = delete;
+
+  public:
+    using Callback = std::function<void()>;
+
+    /// <summary>
+    /// シングルトンインスタンスの取得
+    /// </summary>
+    static JsonHotReloader *GetInstance();
+
+    /// <summary>
+    /// インスタンスがあれば取得（Finalize後はnullptr。デストラクタからの登録解除用）
+    /// </summary>
+    static JsonHotReloader *TryGetInstance() { return instance; }
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    /// <param name="rootPath">監視するディレクトリ</param>
+    void Initialize(const std::string &rootPath = "resources/jsons");
+
+    /// <summary>
+    /// 終了
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 更新（変更の検出と通知）
+    /// </summary>
+    void Update(float deltaTime);
+
+    /// <summary>
+    /// ファイルの監視を登録（同じ所有者・ファイルの組み合わせは上書き）
+    /// </summary>
+    /// <param name="filePath">DataHandler::GetFilePath() のパス</param>
+    /// <param name="owner">登録解除に使う所有者</param>
+    /// <param name="callback">読み直し後に呼ばれる関数</param>
+    void Watch(const std::string &filePath, const void *owner, Callback callback);
+
+    /// <summary>
+    /// 所有者の監視をすべて解除
+    /// </summary>
+    void Unwatch(const void *owner);
+
+    void SetEnabled(bool isEnabled) { isEnabled_ = isEnabled; }
+    bool IsEnabled() const { return isEnabled_; }
+
+  private:
+    struct Listener {
+        const void *owner = nullptr;
+        Callback callback;
+    };
+
+    // 監視中のファイル1つ分の状態
+    struct WatchedFile {
+        std::vector<Listener> listeners;
+        bool isPending = false;                      // 変更を検出して安定待ち中か
+        std::filesystem::file_time_type pendingTime; // 検出した更新時刻
+        float stableTime = 0.0f;                     // 更新時刻が変わらなかった時間
+        uint32_t revision = 0;                       // 最後に通知したときのDataHandlerの読み直し回数
+    };
+
+    /// <summary>
+    /// OSの変更通知を受け取ったか（使えない環境では常にfalse）
+    /// </summary>
+    bool ConsumeChangeNotification();
+
+    /// <summary>
+    /// 監視中ファイルの更新時刻を調べ、安定したものを読み直す
+    /// </summary>
+    void PollFiles(float elapsedTime);
+
+  private:
+    // 変更検出後、この時間だけ更新時刻が変わらなければ読み直す
+    static constexpr float kDebounceTime = 0.3f;
+    // OSの変更通知が使えない場合のポーリング間隔
+    static constexpr float kPollInterval = 0.5f;
+
+    std::string rootPath_;
+    std::unordered_map<std::string, WatchedFile> files_;
+
+    void *changeHandle_ = nullptr; // ディレクトリ変更通知のハンドル
+    float pollTimer_ = 0.0f;
+    size_t pendingCount_ = 0;
+    bool isEnabled_ = true;
+};
@@ -1,13 +1,16 @@
 #include "ImGuiManager.h"
 #ifdef _DEBUG
-#include "Engine/OffScreen/OffScreen.h"
+#include "Engine/Offscreen/OffScreen.h"
 #include "ImGuizmo.h"
 #include "ImGuizmoManager.h"
 #include "Object/Base/BaseObject.h"
 #include "Scene/SceneManager.h"
 #include "imgui.h"
 #include "imgui_impl_win32.h"
+#include <Debug/Profiler/Profiler.h>
 #include <Engine/Frame/Frame.h>
+#include <Engine/Frame/FrameStats.h>
+#include <Memory/AllocationTracker.h>
 #include <externals/icon/IconsFontAwesome5.h>
 #include <imgui_impl_dx12.h>
 
@@ -281,6 +284,7 @@ void ImGuiManager::ShowMainMenu() {
                 ImGui::MenuItem(ICON_FA_CUBE " オブジェクトビュー", nullptr, &showObjectView_);
                 ImGui::MenuItem(ICON_FA_STAR " パーティクルビュー", nullptr, &showParticleView_);
                 ImGui::MenuItem(ICON_FA_DATABASE " FPSビュー", nullptr, &showFPSView_);
+                ImGui::MenuItem(ICON_FA_STOPWATCH " プロファイラ", nullptr, &showProfilerView_);
                 ImGui::MenuItem(ICON_FA_STAR_OF_DAVID " オフスクリーンビュー", nullptr, &showOfScreenView_);
                 ImGui::MenuItem(ICON_FA_LIGHTBULB " ライトビュー", nullptr, &showLightView_);
                 ImGui::EndMenu();
@@ -504,8 +508,36 @@ void ImGuiManager::ShowFPSWindow() {
 
     DisplayFPS();
 
+    // 固定ステップの切り替え
+    bool isFixedTimeStep = Frame::IsFixedTimeStep();
+    if (ImGui::Checkbox("固定ステップ", &isFixedTimeStep)) {
+        Frame::SetFixedTimeStep(isFixedTimeStep, Frame::FixedDeltaTime(), Frame::GetMaxFixedSteps());
+    }
+    if (isFixedTimeStep) {
+        ImGui::Text("ステップ数: %d  補間率: %.2f", Frame::GetFixedStepCount(), Frame::GetInterpolationAlpha());
+    }
+
     ParticleEditor::GetInstance()->SceneParticleCount();
 
+    AllocationTracker::ImGui();
+
+    FrameStats::ImGui();
+
+    DirectXCommon::GetInstance()->GetFramePacer()->ImGui();
+
+    ImGui::End();
+}
+
+void ImGuiManager::ShowProfilerWindow() {
+    if (!showProfilerView_)
+        return; // 表示しない場合は早期リターン
+
+    ImGuiWindowFlags flags = ImGuiWindowFlags_None;
+
+    ImGui::Begin("プロファイラ", &showProfilerView_, flags);
+
+    Profiler::ImGui();
+
     ImGui::End();
 }
 
@@ -656,6 +688,8 @@ void ImGuiManager::ShowMainUI(OffScreen *offscreen) {
     ShowParticleSettingWindow();
     // FPSを描画
     ShowFPSWindow();
+    // プロファイラを描画
+    ShowProfilerWindow();
     // オフスクリーンウィンドウを描画
     ShowOffScreenSettingWindow(offscreen);
     // ライトウィンドウを描画
@@ -663,6 +697,9 @@ void ImGuiManager::ShowMainUI(OffScreen *offscreen) {
 
     ShowHelpWindow();
     baseObjectManager_->UpdateImGui();
+
+    // 統計値の簡易表示（メインUIを隠していても出す）
+    FrameStats::ImGuiOverlay();
 }
 
 bool &ImGuiManager::GetIsShowMainUI() {
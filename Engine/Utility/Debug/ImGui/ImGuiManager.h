@@ -123,6 +123,8 @@ class ImGuiManager {
 
     void ShowFPSWindow();
 
+    void ShowProfilerWindow();
+
     void ShowOffScreenSettingWindow(OffScreen *offscreen);
 
     void ShowLightSettingWindow();
@@ -176,6 +178,7 @@ class ImGuiManager {
     bool showObjectView_ = true;
     bool showParticleView_ = true;
     bool showFPSView_ = true;
+    bool showProfilerView_ = false;
     bool showOfScreenView_ = true;
     bool showLightView_ = true;
     bool isEditorMode_ = true; // エディターモードフラグ
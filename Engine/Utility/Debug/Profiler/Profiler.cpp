@@ -0,0 +1,344 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#ifdef _DEBUG
+#include "imgui.h"
+#endif // _DEBUG
+
+namespace {
+
+// 記録した区間
+struct ZoneEvent {
+    const char *name = nullptr;
+    uint64_t beginNs = 0;
+    uint64_t endNs = 0;
+    uint32_t depth = 0;
+    uint32_t threadIndex = 0;
+};
+
+// スレッドごとのリングバッファ
+// 書き込みは持ち主のスレッドだけ、読み出しはNewFrameを呼ぶメインスレッドだけなのでロックはいらない
+struct ThreadBuffer {
+    std::array<ZoneEvent, Profiler::kRingCapacity> events;
+    std::atomic<uint64_t> writeIndex = 0;
+    uint64_t readIndex = 0;
+    uint32_t threadIndex = 0;
+    uint32_t depth = 0;
+    std::string name;
+};
+
+const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+std::mutex bufferMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+thread_local ThreadBuffer *currentBuffer = nullptr;
+
+// 直前のフレームの区間（メインスレッドだけが触る）
+std::vector<ZoneEvent> lastFrameEvents;
+uint64_t frameBeginNs = 0;
+uint64_t lastFrameBeginNs = 0;
+uint64_t lastFrameEndNs = 0;
+bool isPaused = false;
+
+// キャプチャ中の区間
+std::vector<ZoneEvent> captureEvents;
+bool isCapturing = false;
+
+ThreadBuffer *GetThreadBuffer() {
+    if (currentBuffer == nullptr) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        buffer->threadIndex = static_cast<uint32_t>(buffers.size());
+        buffer->name = "Thread " + std::to_string(buffer->threadIndex);
+        currentBuffer = buffer.get();
+        buffers.push_back(std::move(buffer));
+    }
+    return currentBuffer;
+}
+
+// JSONの文字列に書けるようにする
+void WriteJsonString(std::ofstream &file, const char *text) {
+    file << '"';
+    for (const char *c = text; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            file << '\\' << *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            file << ' ';
+        } else {
+            file << *c;
+        }
+    }
+    file << '"';
+}
+
+} // namespace
+
+uint64_t Profiler::NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+}
+
+void Profiler::Record(const char *name, uint64_t beginNs, uint64_t endNs, uint32_t depth) {
+    ThreadBuffer *buffer = GetThreadBuffer();
+    uint64_t index = buffer->writeIndex.load(std::memory_order_relaxed);
+    ZoneEvent &event = buffer->events[index % kRingCapacity];
+    event.name = name;
+    event.beginNs = beginNs;
+    event.endNs = endNs;
+    event.depth = depth;
+    event.threadIndex = buffer->threadIndex;
+    // 書き終えてから位置を進める
+    buffer->writeIndex.store(index + 1, std::memory_order_release);
+    buffer->depth = depth;
+}
+
+uint32_t Profiler::PushDepth() {
+    return GetThreadBuffer()->depth++;
+}
+
+void Profiler::SetThreadName(const std::string &name) {
+#ifdef ENABLE_PROFILER
+    ThreadBuffer *buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    buffer->name = name;
+#else
+    (void)name;
+#endif // ENABLE_PROFILER
+}
+
+void Profiler::NewFrame() {
+    uint64_t nowNs = NowNs();
+    if (!isPaused) {
+        lastFrameEvents.clear();
+        lastFrameBeginNs = frameBeginNs;
+        lastFrameEndNs = nowNs;
+    }
+    frameBeginNs = nowNs;
+
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    for (auto &buffer : buffers) {
+        uint64_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+        uint64_t readIndex = buffer->readIndex;
+        // 回収が間に合わず上書きされた分は捨てる
+        if (writeIndex - readIndex > kRingCapacity) {
+            readIndex = writeIndex - kRingCapacity;
+        }
+        size_t firstNew = lastFrameEvents.size();
+        size_t firstCapture = captureEvents.size();
+        for (uint64_t i = readIndex; i < writeIndex; ++i) {
+            const ZoneEvent &event = buffer->events[i % kRingCapacity];
+            if (!isPaused) {
+                lastFrameEvents.push_back(event);
+            }
+            if (isCapturing && captureEvents.size() < kMaxCaptureEvents) {
+                captureEvents.push_back(event);
+            }
+        }
+        // 読んでいる間に書き込み側が一周して上書きした分は捨てる
+        uint64_t overwritten = buffer->writeIndex.load(std::memory_order_acquire);
+        if (overwritten - readIndex > kRingCapacity) {
+            size_t lost = static_cast<size_t>((std::min)(overwritten - readIndex - kRingCapacity, writeIndex - readIndex));
+            if (!isPaused) {
+                lastFrameEvents.erase(lastFrameEvents.begin() + firstNew, lastFrameEvents.begin() + (std::min)(firstNew + lost, lastFrameEvents.size()));
+            }
+            if (isCapturing) {
+                captureEvents.erase(captureEvents.begin() + firstCapture, captureEvents.begin() + (std::min)(firstCapture + lost, captureEvents.size()));
+            }
+        }
+        buffer->readIndex = writeIndex;
+    }
+}
+
+void Profiler::StartCapture() {
+    captureEvents.clear();
+    isCapturing = true;
+}
+
+bool Profiler::StopCapture(const std::string &filePath) {
+    isCapturing = false;
+
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // chrome://tracing や Perfetto で開ける形式（時刻はμs）
+    file << "{\"traceEvents\":[\n";
+    bool isFirst = true;
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        for (auto &buffer : buffers) {
+            file << (isFirst ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                 << ",\"args\":{\"name\":";
+            WriteJsonString(file, buffer->name.c_str());
+            file << "}}";
+            isFirst = false;
+        }
+    }
+    char number[64];
+    for (const ZoneEvent &event : captureEvents) {
+        file << (isFirst ? "" : ",\n") << "{\"name\":";
+        WriteJsonString(file, event.name);
+        std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(event.beginNs) / 1000.0);
+        file << ",\"ph\":\"X\",\"ts\":" << number;
+        std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(event.endNs - event.beginNs) / 1000.0);
+        file << ",\"dur\":" << number << ",\"pid\":1,\"tid\":" << event.threadIndex << "}";
+        isFirst = false;
+    }
+    file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    captureEvents.clear();
+    captureEvents.shrink_to_fit();
+    return true;
+}
+
+bool Profiler::IsCapturing() {
+    return isCapturing;
+}
+
+void Profiler::ImGui() {
+#ifdef _DEBUG
+    double frameMs = static_cast<double>(lastFrameEndNs - lastFrameBeginNs) / 1.0e6;
+    ImGui::Checkbox("一時停止", &isPaused);
+    ImGui::SameLine();
+    if (!isCapturing) {
+        if (ImGui::Button("キャプチャ開始")) {
+            StartCapture();
+        }
+    } else {
+        if (ImGui::Button("キャプチャ終了して保存")) {
+            StopCapture("profile_trace.json");
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu 区間", captureEvents.size());
+    }
+    ImGui::Text("フレーム: %.3f ms", frameMs);
+
+#ifndef ENABLE_PROFILER
+    ImGui::TextDisabled("ENABLE_PROFILERが定義されていないため計測していません");
+#endif // ENABLE_PROFILER
+
+    if (lastFrameEndNs <= lastFrameBeginNs) {
+        return;
+    }
+
+    // スレッドごとの最大の深さ（表示する段数）
+    std::vector<uint32_t> laneDepths;
+    for (const ZoneEvent &event : lastFrameEvents) {
+        if (laneDepths.size() <= event.threadIndex) {
+            laneDepths.resize(event.threadIndex + 1, 0);
+        }
+        laneDepths[event.threadIndex] = (std::max)(laneDepths[event.threadIndex], event.depth + 1);
+    }
+
+    // フレームグラフ（横軸が時間、縦が入れ子の深さ）
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const float laneGap = ImGui::GetTextLineHeight() + 2.0f;
+    float graphHeight = 0.0f;
+    for (uint32_t depth : laneDepths) {
+        if (depth > 0) {
+            graphHeight += laneGap + rowHeight * static_cast<float>(depth);
+        }
+    }
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    float width = (std::max)(ImGui::GetContentRegionAvail().x, 100.0f);
+    ImGui::InvisibleButton("FlameGraph", ImVec2(width, (std::max)(graphHeight, 1.0f)));
+    ImDrawList *drawList = ImGui::GetWindowDrawList();
+    double scale = static_cast<double>(width) / static_cast<double>(lastFrameEndNs - lastFrameBeginNs);
+
+    std::vector<float> laneTops(laneDepths.size(), 0.0f);
+    float y = origin.y;
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        for (size_t lane = 0; lane < laneDepths.size(); ++lane) {
+            if (laneDepths[lane] == 0) {
+                continue;
+            }
+            drawList->AddText(ImVec2(origin.x, y), IM_COL32(200, 200, 200, 255), buffers[lane]->name.c_str());
+            laneTops[lane] = y + laneGap;
+            y += laneGap + rowHeight * static_cast<float>(laneDepths[lane]);
+        }
+    }
+
+    const ZoneEvent *hovered = nullptr;
+    ImVec2 mouse = ImGui::GetIO().MousePos;
+    for (const ZoneEvent &event : lastFrameEvents) {
+        uint64_t begin = (std::max)(event.beginNs, lastFrameBeginNs);
+        uint64_t end = (std::min)(event.endNs, lastFrameEndNs);
+        if (end <= begin) {
+            continue;
+        }
+        float x0 = origin.x + static_cast<float>(static_cast<double>(begin - lastFrameBeginNs) * scale);
+        float x1 = origin.x + static_cast<float>(static_cast<double>(end - lastFrameBeginNs) * scale);
+        x1 = (std::max)(x1, x0 + 1.0f);
+        float y0 = laneTops[event.threadIndex] + rowHeight * static_cast<float>(event.depth);
+        float y1 = y0 + rowHeight - 1.0f;
+
+        // 名前ごとに色を固定する
+        uint32_t hash = 2166136261u;
+        for (const char *c = event.name; *c != '\0'; ++c) {
+            hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+        }
+        ImU32 color = IM_COL32(90 + (hash & 0x7F), 90 + ((hash >> 8) & 0x7F), 90 + ((hash >> 16) & 0x7F), 255);
+        drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), color);
+
+        // 入りきるときだけ名前を描く
+        ImVec2 textSize = ImGui::CalcTextSize(event.name);
+        if (textSize.x + 4.0f < x1 - x0) {
+            drawList->AddText(ImVec2(x0 + 2.0f, y0 + 2.0f), IM_COL32(0, 0, 0, 255), event.name);
+        }
+        if (mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1) {
+            hovered = &event;
+        }
+    }
+    if (hovered && ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("%s\n%.3f ms", hovered->name, static_cast<double>(hovered->endNs - hovered->beginNs) / 1.0e6);
+    }
+
+    // 区間ごとの合計時間
+    if (ImGui::CollapsingHeader("区間ごとの合計")) {
+        struct ZoneTotal {
+            const char *name;
+            uint64_t totalNs;
+            uint32_t count;
+        };
+        std::vector<ZoneTotal> totals;
+        for (const ZoneEvent &event : lastFrameEvents) {
+            auto found = std::find_if(totals.begin(), totals.end(), [&](const ZoneTotal &total) {
+                return total.name == event.name || std::strcmp(total.name, event.name) == 0;
+            });
+            if (found == totals.end()) {
+                totals.push_back({event.name, event.endNs - event.beginNs, 1});
+            } else {
+                found->totalNs += event.endNs - event.beginNs;
+                ++found->count;
+            }
+        }
+        std::sort(totals.begin(), totals.end(), [](const ZoneTotal &a, const ZoneTotal &b) { return a.totalNs > b.totalNs; });
+
+        if (ImGui::BeginTable("ProfilerTable", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("区間");
+            ImGui::TableSetupColumn("ms");
+            ImGui::TableSetupColumn("回数");
+            ImGui::TableHeadersRow();
+            for (const ZoneTotal &total : totals) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(total.name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", static_cast<double>(total.totalNs) / 1.0e6);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", total.count);
+            }
+            ImGui::EndTable();
+        }
+    }
+#endif // _DEBUG
+}
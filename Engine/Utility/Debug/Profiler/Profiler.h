@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// デバッグビルドでは常に有効。リリースビルドで計測したいときはプリプロセッサ定義にENABLE_PROFILERを追加する
+#if defined(_DEBUG) && !defined(ENABLE_PROFILER)
+#define ENABLE_PROFILER
+#endif
+
+/// <summary>
+/// 区間計測のCPUプロファイラ
+/// PROFILE_SCOPEで囲んだ区間の開始・終了時刻(ns)をスレッドごとのリングバッファに記録し、
+/// フレームの区切りでまとめてImGuiのフレームグラフやChromeのトレース(JSON)に出力する
+/// </summary>
+class Profiler {
+  public:
+    // スレッドごとに保持する区間の数
+    static constexpr uint32_t kRingCapacity = 8192;
+    // キャプチャで保持する区間の上限
+    static constexpr size_t kMaxCaptureEvents = 2 * 1024 * 1024;
+
+    /// <summary>
+    /// 現在時刻(ns、プロファイラ起動時からの経過)
+    /// </summary>
+    static uint64_t NowNs();
+
+    /// <summary>
+    /// 呼び出したスレッドの入れ子の深さを1つ進める（戻り値は進める前の深さ）
+    /// </summary>
+    static uint32_t PushDepth();
+
+    /// <summary>
+    /// 区間の記録（ProfileScopeから呼ばれる。入れ子の深さもdepthに戻す）
+    /// </summary>
+    static void Record(const char *name, uint64_t beginNs, uint64_t endNs, uint32_t depth);
+
+    /// <summary>
+    /// 呼び出したスレッドの名前を設定する（トレースやフレームグラフに表示される）
+    /// </summary>
+    static void SetThreadName(const std::string &name);
+
+    /// <summary>
+    /// フレームの区切り（メインスレッドから呼ぶ）
+    /// 全スレッドの記録を回収して直前のフレームの区間として保持する
+    /// </summary>
+    static void NewFrame();
+
+    /// <summary>
+    /// キャプチャの開始・終了（終了時にChromeのトレース形式で書き出す）
+    /// </summary>
+    static void StartCapture();
+    static bool StopCapture(const std::string &filePath);
+    static bool IsCapturing();
+
+    /// <summary>
+    /// フレームグラフと区間ごとの合計時間の表示
+    /// </summary>
+    static void ImGui();
+};
+
+#ifdef ENABLE_PROFILER
+
+/// <summary>
+/// 範囲の開始から終了までを1つの区間として記録する
+/// </summary>
+class ProfileScope {
+  public:
+    explicit ProfileScope(const char *name) : name_(name), depth_(Profiler::PushDepth()), beginNs_(Profiler::NowNs()) {}
+    ~ProfileScope() { Profiler::Record(name_, beginNs_, Profiler::NowNs(), depth_); }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+  private:
+    const char *name_;
+    uint32_t depth_;
+    uint64_t beginNs_;
+};
+
+#define PROFILE_SCOPE_CONCAT_INNER(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_INNER(a, b)
+
+// PROFILE_SCOPE("Collision"); のように使う（名前は文字列リテラルなど寿命の長いものを渡す）
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_SCOPE_CONCAT(profileScope_, __LINE__)(name)
+// 関数全体を関数名で計測する
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+
+#else
+
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+
+#endif // ENABLE_PROFILER
@@ -31,11 +31,8 @@ class LevelData {
     /// </summary>
     void Clear();
 
-  private:
-    using json = nlohmann::json;
-
     /// ===================================================
-    /// private structs
+    /// public structs
     /// ===================================================
 
     struct Transform {
@@ -59,6 +56,14 @@ class LevelData {
         bool hasCollider = false;
     };
 
+    /// <summary>
+    /// 読み込んだオブジェクトのデータ（子はchildrenに入る）
+    /// </summary>
+    const std::vector<ObjectData> &GetObjectsData() const { return objectsData_; }
+
+  private:
+    using json = nlohmann::json;
+
     /// ===================================================
     /// private methods
     /// ===================================================
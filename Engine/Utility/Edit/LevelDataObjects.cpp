@@ -0,0 +1,96 @@
+#include "LevelData.h"
+
+// 読み込んだデータからのオブジェクトの生成（モデルや描画に依存するので、JSONの読み込みとは翻訳単位を分けておく）
+
+void LevelData::CreateObjects() {
+    BaseObjectManager *manager = BaseObjectManager::GetInstance();
+
+    for (const auto &objectData : objectsData_) {
+        // カメラとライトは飛ばす
+        if (objectData.type == "CAMERA" || objectData.type == "LIGHT") {
+            continue;
+        }
+
+        if (objectData.type == "MESH") {
+            auto baseObject = CreateBaseObject(objectData);
+            if (baseObject) {
+                createdObjects_[objectData.name] = baseObject.get();
+
+                // BaseObjectManagerに追加
+                manager->AddObject(std::move(baseObject));
+            }
+        }
+    }
+
+    // 親子関係を設定
+    for (const auto &objectData : objectsData_) {
+        if (objectData.type == "MESH" && !objectData.children.empty()) {
+            auto parentIt = createdObjects_.find(objectData.name);
+            if (parentIt != createdObjects_.end()) {
+                SetupParentChild(parentIt->second, objectData.children);
+            }
+        }
+    }
+}
+
+void LevelData::Clear() {
+    objectsData_.clear();
+    createdObjects_.clear();
+
+    BaseObjectManager::GetInstance()->RemoveAllObjects();
+}
+
+std::unique_ptr<BaseObject> LevelData::CreateBaseObject(const ObjectData &objectData) {
+    auto baseObject = std::make_unique<BaseObject>();
+    // 初期化
+    baseObject->Init(objectData.name);
+
+    // モデルファイルのパスを生成
+    std::string modelPath = "LevelData/" + objectData.name + ".obj";
+
+    // モデルを作成
+    baseObject->CreateModel(modelPath);
+
+    // トランスフォームを設定
+    baseObject->GetLocalPosition() = objectData.transform.translation;
+    baseObject->GetLocalRotation() = Quaternion::FromEulerAngles(objectData.transform.rotation);
+    baseObject->GetLocalScale() = objectData.transform.scaling;
+
+    // コライダーを追加（OBBを使用）
+    if (objectData.hasCollider) {
+        baseObject->AddCollider();
+        baseObject->SetOBBSize(objectData.collider.size + Vector3(objectData.transform.scaling.x - 1.0f, objectData.transform.scaling.y - 1.0f, objectData.transform.scaling.z - 1.0f));
+        baseObject->SetOBBCenter(objectData.collider.center);
+        // コライダータイプをOBBに設定
+        baseObject->SetCollisionType(Collider::CollisionType::OBB);
+    }
+
+    return baseObject;
+}
+
+void LevelData::SetupParentChild(BaseObject *parent, const std::vector<ObjectData> &children) {
+    for (const auto &childData : children) {
+        if (childData.type == "MESH") {
+            // 子オブジェクトを作成
+            auto childObject = CreateBaseObject(childData);
+            if (childObject) {
+                // 親子関係を設定
+                childObject->SetParent(parent);
+
+                // 作成したオブジェクトを記録
+                createdObjects_[childData.name] = childObject.get();
+
+                // BaseObjectManagerに追加
+                BaseObjectManager::GetInstance()->AddObject(std::move(childObject));
+
+                // 再帰的に孫オブジェクトも処理
+                if (!childData.children.empty()) {
+                    auto childIt = createdObjects_.find(childData.name);
+                    if (childIt != createdObjects_.end()) {
+                        SetupParentChild(childIt->second, childData.children);
+                    }
+                }
+            }
+        }
+    }
+}
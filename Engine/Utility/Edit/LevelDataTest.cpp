@@ -0,0 +1,94 @@
+#include "Edit/LevelData.h"
+#include "Test/Test.h"
+#include <cmath>
+#include <filesystem>
+
+namespace {
+
+using json = nlohmann::json;
+
+bool IsNear(const Vector3 &a, const Vector3 &b) { return std::abs(a.x - b.x) < 1e-4f && std::abs(a.y - b.y) < 1e-4f && std::abs(a.z - b.z) < 1e-4f; }
+
+json MakeObject(const std::string &name) {
+    json object;
+    object["type"] = "MESH";
+    object["name"] = name;
+    object["transform"] = {{"translation", {1.0f, 2.0f, 3.0f}}, {"rotation", {90.0f, 0.0f, 180.0f}}, {"scaling", {1.0f, 2.0f, 3.0f}}};
+    return object;
+}
+
+void WriteLevel(const std::string &filePath, const json &level) {
+    std::ofstream file(filePath);
+    file << level.dump(4);
+}
+
+} // namespace
+
+// Blenderの座標系（Z上）からエンジンの座標系（Y上）に入れ替えて読み込む
+TEST(ParsesTransformAndCollider) {
+    json object = MakeObject("box");
+    object["collider"] = {{"type", "BOX"}, {"center", {0.5f, 1.5f, 2.5f}}, {"size", {2.0f, 4.0f, 6.0f}}};
+    json level = {{"name", "test"}, {"objects", json::array({object, MakeObject("no_collider")})}};
+    const std::string filePath = "level_data_test.json";
+    WriteLevel(filePath, level);
+
+    LevelData levelData;
+    levelData.LoadFromJson(filePath);
+    std::filesystem::remove(filePath);
+
+    const std::vector<LevelData::ObjectData> &objects = levelData.GetObjectsData();
+    CHECK(objects.size() == 2);
+    if (objects.size() != 2) {
+        return;
+    }
+    const LevelData::ObjectData &box = objects[0];
+    CHECK(box.type == "MESH" && box.name == "box");
+    CHECK(IsNear(box.transform.translation, {1.0f, 3.0f, 2.0f}));
+    CHECK(IsNear(box.transform.scaling, {1.0f, 3.0f, 2.0f}));
+    const float pi = 3.14159265359f;
+    CHECK(IsNear(box.transform.rotation, {-pi / 2.0f, pi, 0.0f}));
+    CHECK(box.hasCollider && box.collider.type == "BOX");
+    CHECK(IsNear(box.collider.center, {0.5f, 2.5f, 1.5f}));
+    // 大きさは半分にして持つ
+    CHECK(IsNear(box.collider.size, {1.0f, 3.0f, 2.0f}));
+    CHECK(!objects[1].hasCollider);
+}
+
+// 子は再帰的に読み込み、読み直すと前のデータは残らない
+TEST(ParsesChildrenAndReloads) {
+    constexpr uint32_t kRootCount = 100;
+    constexpr uint32_t kChildCount = 2;
+    json level;
+    level["objects"] = json::array();
+    for (uint32_t i = 0; i < kRootCount; ++i) {
+        json object = MakeObject("object_" + std::to_string(i));
+        object["children"] = json::array();
+        for (uint32_t child = 0; child < kChildCount; ++child) {
+            json childObject = MakeObject("object_" + std::to_string(i) + "_" + std::to_string(child));
+            childObject["children"] = json::array({MakeObject("leaf")});
+            object["children"].push_back(childObject);
+        }
+        level["objects"].push_back(object);
+    }
+    const std::string filePath = "level_data_children_test.json";
+    WriteLevel(filePath, level);
+
+    LevelData levelData;
+    for (int load = 0; load < 2; ++load) {
+        levelData.LoadFromJson(filePath);
+        const std::vector<LevelData::ObjectData> &objects = levelData.GetObjectsData();
+        CHECK(objects.size() == kRootCount);
+        for (uint32_t i = 0; i < objects.size(); ++i) {
+            CHECK(objects[i].name == "object_" + std::to_string(i));
+            CHECK(objects[i].children.size() == kChildCount);
+            for (const LevelData::ObjectData &child : objects[i].children) {
+                CHECK(child.children.size() == 1 && child.children[0].name == "leaf");
+            }
+        }
+    }
+    std::filesystem::remove(filePath);
+
+    // 開けないファイルは空のまま
+    levelData.LoadFromJson("level_data_missing_test.json");
+    CHECK(levelData.GetObjectsData().empty());
+}
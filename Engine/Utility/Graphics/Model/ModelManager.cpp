@@ -1,4 +1,5 @@
 #include "ModelManager.h"
+#include "Debug/Profiler/Profiler.h"
 #include <fstream>
 #include <functional>
 #include <sstream>
@@ -13,34 +14,25 @@ ModelManager *ModelManager::GetInstance() {
 }
 
 void ModelManager::LoadModel(const std::string &filePath) {
+    PROFILE_FUNCTION();
 
-    // .gltfファイルの場合、内容に基づくハッシュを生成しない（毎回新しいモデルを作成）
-    if (filePath.substr(filePath.find_last_of(".") + 1) == "gltf") {
-        // 新しいユニークな識別子を生成する（例えば、インデックスなど）
-        static int modelIndex = 0;
-        std::string uniqueKey = filePath + "_" + std::to_string(modelIndex++);
+    // resources/models/ 基準のパスをアセットIDにする
+    AssetID assetID = AssetDatabase::MakeAssetID("models/" + filePath);
 
-        // モデルの生成とファイル読み込み、初期化
-        std::unique_ptr<Model> model = std::make_unique<Model>();
-        model->Initialize(modelCommon);
-        model->CreateModel("resources/models/", filePath);
-        model->SetSrv(srvManager);
-
-        // モデルをmapコンテナに格納する
-        models.insert(std::make_pair(uniqueKey, std::move(model)));
-        return;
-    }
-
-    // .gltf以外のファイルは元のパスで検索（重複チェック）
-    if (models.contains(filePath)) {
+    // .gltfファイルの場合は毎回新しいモデルを作成（アニメーションの状態をモデルごとに持つため）
+    // .gltf以外のファイルは読み込み済みなら使い回す
+    bool isGltf = filePath.substr(filePath.find_last_of(".") + 1) == "gltf";
+    if (!isGltf && models.contains(assetID)) {
         return;
     }
 
+    // モデルの生成とファイル読み込み、初期化
     std::unique_ptr<Model> model = std::make_unique<Model>();
     model->Initialize(modelCommon);
     model->CreateModel("resources/models/", filePath);
     model->SetSrv(srvManager);
-    models.insert(std::make_pair(filePath, std::move(model)));
+
+    models[assetID].push_back(std::move(model));
 }
 
 std::string ModelManager::CreatePrimitiveModel(PrimitiveType type, std::string texPath) {
@@ -52,36 +44,19 @@ std::string ModelManager::CreatePrimitiveModel(PrimitiveType type, std::string t
     static int modelIndex = 0;
     std::string uniqueKey = "PrimitiveModel_" + std::to_string(modelIndex++);
     // モデルをmapコンテナに格納する
-    models.insert(std::make_pair(uniqueKey, std::move(model)));
+    models[AssetDatabase::MakeAssetID(uniqueKey)].push_back(std::move(model));
     return uniqueKey;
 }
 
 Model *ModelManager::FindModel(const std::string &filePath) {
-    // .gltfファイルの場合はファイルパスにユニークな識別子を使って検索
-    if (filePath.substr(filePath.find_last_of(".") + 1) == "gltf") {
-        // 同じファイルパスで複数のモデルがある可能性があるので、それを確認
-        std::vector<Model *> matchedModels;
-
-        // キーがファイルパスを含むモデルをすべて収集
-        for (const auto &[key, model] : models) {
-            if (key.find(filePath) != std::string::npos) {
-                matchedModels.push_back(model.get());
-            }
-        }
-
-        // 一致するモデルがあれば、必要に応じて最も新しいモデルなどを選んで返す
-        if (!matchedModels.empty()) {
-            // 例えば、最も新しい（インデックスが最大）ものを返す
-            return matchedModels.back();
-        }
-    } else {
-        // .gltf以外のファイルはファイルパスそのもので検索
-        if (models.contains(filePath)) {
-            return models.at(filePath).get();
-        }
+    // プリミティブは識別子そのもの、それ以外は resources/models/ 基準のパスで検索
+    AssetID assetID = AssetDatabase::MakeAssetID(filePath.rfind("PrimitiveModel_", 0) == 0 ? filePath : "models/" + filePath);
+    auto it = models.find(assetID);
+    if (it == models.end() || it->second.empty()) {
+        return nullptr;
     }
-
-    return nullptr;
+    // .gltfで複数ある場合は最後に読み込んだものを返す
+    return it->second.back().get();
 }
 
 void ModelManager::Initialize(SrvManager *srvManager) {
@@ -2,6 +2,8 @@
 #include "map"
 #include "string"
 #include "memory"
+#include "vector"
+#include <Asset/AssetDatabase.h>
 #include <Graphics/Srv/SrvManager.h>
 #include <Model/Model.h>
 
@@ -54,7 +56,8 @@ public:
         std::string CreatePrimitiveModel(PrimitiveType type, std::string texPath);
 
 public:
-	std::unordered_map<std::string, std::unique_ptr<Model>> models;
+	// アセットIDごとのモデル（.gltfは読み込むたびに別のモデルを作るので複数持つ）
+	std::unordered_map<AssetID, std::vector<std::unique_ptr<Model>>> models;
 private:
 	ModelCommon* modelCommon = nullptr;
 	SrvManager* srvManager = nullptr;
@@ -205,6 +205,7 @@ void PipeLineManager::CreateAllPipelines() {
     // 各種パイプラインの作成
     CreateStandardPipelines();
     CreateParticlePipelines();
+    CreateParticleTrailPipelines();
     CreateSpritePipelines();
     CreateRenderPipelines();
     CreateSkinningPipelines();
@@ -224,19 +225,26 @@ void PipeLineManager::CreateStandardPipelines() {
         auto pipeline = CreateGraphicsPipeLine(rootSignature, blendMode);
         pipelines_[MakePipelineKey(PipelineType::kStandard, blendMode, ShaderMode::kNone)] = pipeline;
     }
+
+    // インスタンス描画用（行列と色をStructuredBufferから読む）
+    auto instancedRootSignature = CreateRootSignature(true);
+    rootSignatures_[MakeRootSignatureKey(PipelineType::kStandardInstanced, ShaderMode::kNone)] = instancedRootSignature;
+    for (int i = 0; i <= static_cast<int>(BlendMode::kScreen); i++) {
+        BlendMode blendMode = static_cast<BlendMode>(i);
+        auto pipeline = CreateGraphicsPipeLine(instancedRootSignature, blendMode, L"./resources/shaders/Object/Object3dInstanced.VS.hlsl");
+        pipelines_[MakePipelineKey(PipelineType::kStandardInstanced, blendMode, ShaderMode::kNone)] = pipeline;
+    }
 }
 
 // スプライトパイプラインの作成
 void PipeLineManager::CreateSpritePipelines() {
-    // ルートシグネチャを作成し、マップに格納
-    auto rootSignature = CreateSpriteRootSignature();
-    rootSignatures_[MakeRootSignatureKey(PipelineType::kSprite, ShaderMode::kNone)] = rootSignature;
-
-    // 各ブレンドモード用のパイプラインを作成し、マップに格納
+    // スプライトはすべてSpriteBatchでまとめて描く（座標変換と色は頂点に入れてあるので、テクスチャだけを設定する）
+    auto batchRootSignature = CreateCommonRootSignature(false);
+    rootSignatures_[MakeRootSignatureKey(PipelineType::kSpriteBatch, ShaderMode::kNone)] = batchRootSignature;
     for (int i = 0; i <= static_cast<int>(BlendMode::kScreen); i++) {
         BlendMode blendMode = static_cast<BlendMode>(i);
-        auto pipeline = CreateSpriteGraphicsPipeLine(rootSignature, blendMode);
-        pipelines_[MakePipelineKey(PipelineType::kSprite, blendMode, ShaderMode::kNone)] = pipeline;
+        auto pipeline = CreateSpriteGraphicsPipeLine(batchRootSignature, blendMode);
+        pipelines_[MakePipelineKey(PipelineType::kSpriteBatch, blendMode, ShaderMode::kNone)] = pipeline;
     }
 }
 
@@ -256,7 +264,7 @@ void PipeLineManager::CreateRenderPipelines() {
     }
 }
 
-Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateRootSignature() {
+Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateRootSignature(bool isInstanced) {
     Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature;
     HRESULT hr;
     // RootSignature作成
@@ -283,8 +291,17 @@ Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateRootSignature
     skyBoxDescriptorRange[0].RegisterSpace = 0;
     skyBoxDescriptorRange[0].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
+    // インスタンスの行列と色 t0（VertexShader）
+    D3D12_DESCRIPTOR_RANGE instanceDescriptorRange[1] = {};
+    instanceDescriptorRange[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+    instanceDescriptorRange[0].NumDescriptors = 1;
+    instanceDescriptorRange[0].BaseShaderRegister = 0; // t0
+    instanceDescriptorRange[0].RegisterSpace = 0;
+    instanceDescriptorRange[0].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
+
     // RootParameter作成。複数設定できるので配列。
-    D3D12_ROOT_PARAMETER rootParameters[8] = {};
+    // インスタンス描画では1番を行列のテーブルにして、8番に先頭のインスタンス番号を置く
+    D3D12_ROOT_PARAMETER rootParameters[9] = {};
     rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;                   // CBVを使う
     rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;                // VertexShaderで使う
     rootParameters[0].Descriptor.ShaderRegister = 0;                                   // レジスタ番号0とバインド
@@ -308,11 +325,22 @@ Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateRootSignature
     rootParameters[6].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;                // PixelShaderで使う
     rootParameters[6].Descriptor.ShaderRegister = 4;                                   // レジスタ番号1とバインド
     descriptionRootSignature.pParameters = rootParameters;                             // ルートパラメータ配列へのポインタ
-    descriptionRootSignature.NumParameters = _countof(rootParameters);                 // 配列の長さ
+    descriptionRootSignature.NumParameters = _countof(rootParameters) - 1;             // 配列の長さ
     rootParameters[7].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
     rootParameters[7].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
     rootParameters[7].DescriptorTable.pDescriptorRanges = skyBoxDescriptorRange;
     rootParameters[7].DescriptorTable.NumDescriptorRanges = _countof(skyBoxDescriptorRange);
+    if (isInstanced) {
+        rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+        rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+        rootParameters[1].DescriptorTable.pDescriptorRanges = instanceDescriptorRange;
+        rootParameters[1].DescriptorTable.NumDescriptorRanges = _countof(instanceDescriptorRange);
+        rootParameters[8].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+        rootParameters[8].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+        rootParameters[8].Constants.ShaderRegister = 0; // b0
+        rootParameters[8].Constants.Num32BitValues = 1;
+        descriptionRootSignature.NumParameters = _countof(rootParameters);
+    }
 
     // Smplerの設定
     D3D12_STATIC_SAMPLER_DESC staticSamplers[1] = {};
@@ -342,7 +370,7 @@ Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateRootSignature
 }
 
 Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateGraphicsPipeLine(
-    Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode) {
+    Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode, const wchar_t *vertexShaderPath) {
     Microsoft::WRL::ComPtr<ID3D12PipelineState> graphicsPipelineState;
     HRESULT hr;
 
@@ -415,7 +443,7 @@ Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateGraphicsPipeL
     // 三角形の中を塗りつぶす
     rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
     // Shaderをコンパイルする
-    IDxcBlob *vertexShaderBlob = dxCommon_->CompileShader(L"./resources/shaders/Object/Object3d.VS.hlsl", L"vs_6_0");
+    IDxcBlob *vertexShaderBlob = dxCommon_->CompileShader(vertexShaderPath, L"vs_6_0");
     assert(vertexShaderBlob != nullptr);
 
     IDxcBlob *pixelShaderBlob = dxCommon_->CompileShader(L"./resources/shaders/Object/Object3d.PS.hlsl", L"ps_6_0");
@@ -660,10 +688,23 @@ Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateParticleGraph
     return graphicsPipelineState;
 }
 
-Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateSpriteRootSignature() {
-    Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature;
+void PipeLineManager::CreateParticleTrailPipelines() {
+    // ルートシグネチャを作成し、マップに格納
+    auto rootSignature = CreateParticleTrailRootSignature();
+    rootSignatures_[MakeRootSignatureKey(PipelineType::kParticleTrail, ShaderMode::kNone)] = rootSignature;
+
+    // パーティクルと同じブレンドモードで描くので、各ブレンドモード用のパイプラインを作成し、マップに格納
+    for (int i = 0; i <= static_cast<int>(BlendMode::kScreen); i++) {
+        BlendMode blendMode = static_cast<BlendMode>(i);
+        auto pipeline = CreateParticleTrailGraphicsPipeLine(rootSignature, blendMode);
+        pipelines_[MakePipelineKey(PipelineType::kParticleTrail, blendMode, ShaderMode::kNone)] = pipeline;
+    }
+}
 
+Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateParticleTrailRootSignature() {
+    Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature;
     HRESULT hr;
+
     // RootSignature作成
     D3D12_ROOT_SIGNATURE_DESC descriptionRootSignature{};
     descriptionRootSignature.Flags =
@@ -678,24 +719,28 @@ Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateSpriteRootSig
 
     // RootParameter作成。複数設定できるので配列。
     D3D12_ROOT_PARAMETER rootParameters[3] = {};
-    rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;                   // CBVを使う
-    rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;                // PixelShaderで使う
-    rootParameters[0].Descriptor.ShaderRegister = 0;                                   // レジスタ番号0とバインド
-    rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;                   // CBVをつかう
-    rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;               // VertexShaderで使う
-    rootParameters[1].Descriptor.ShaderRegister = 0;                                   // レジスタ番号0とバインド
+    rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;    // CBVを使う
+    rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL; // PixelShaderで使う
+    rootParameters[0].Descriptor.ShaderRegister = 0;                    // レジスタ番号0とバインド
+
+    // 頂点はワールド座標なので、インスタンスのデータの代わりにカメラの行列を渡す
+    rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;     // CBVを使う
+    rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX; // VertexShaderで使う
+    rootParameters[1].Descriptor.ShaderRegister = 0;                     // レジスタ番号0とバインド
+
     rootParameters[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;      // DescriptorTableを使う
     rootParameters[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;                // PixelShaderで使う
     rootParameters[2].DescriptorTable.pDescriptorRanges = descriptorRange;             // Tableの中身の配列を指定
     rootParameters[2].DescriptorTable.NumDescriptorRanges = _countof(descriptorRange); // Tableで利用する数
-    descriptionRootSignature.pParameters = rootParameters;                             // ルートパラメータ配列へのポインタ
-    descriptionRootSignature.NumParameters = _countof(rootParameters);                 // 配列の長さ
+
+    descriptionRootSignature.pParameters = rootParameters;             // ルートパラメータ配列へのポインタ
+    descriptionRootSignature.NumParameters = _countof(rootParameters); // 配列の長さ
 
     // Smplerの設定
     D3D12_STATIC_SAMPLER_DESC staticSamplers[1] = {};
     staticSamplers[0].Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;   // バイリニアフィルタ
     staticSamplers[0].AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP; // 0～1の範囲外をリピート
-    staticSamplers[0].AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+    staticSamplers[0].AddressV = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
     staticSamplers[0].AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
     staticSamplers[0].ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;     // 比較しない
     staticSamplers[0].MaxLOD = D3D12_FLOAT32_MAX;                       // ありったけのMipmapを使う
@@ -712,18 +757,137 @@ Microsoft::WRL::ComPtr<ID3D12RootSignature> PipeLineManager::CreateSpriteRootSig
         Logger::Log(reinterpret_cast<char *>(errorBlob->GetBufferPointer()));
         assert(false);
     }
+    // パイナリを元に生成
     hr = dxCommon_->GetDevice()->CreateRootSignature(0, signatureBlob->GetBufferPointer(),
                                                      signatureBlob->GetBufferSize(), IID_PPV_ARGS(&rootSignature));
     assert(SUCCEEDED(hr));
     return rootSignature;
 }
 
-Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateSpriteGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode) {
+Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateParticleTrailGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode) {
     Microsoft::WRL::ComPtr<ID3D12PipelineState> graphicsPipelineState;
     HRESULT hr;
 
     // InputLayout
-    D3D12_INPUT_ELEMENT_DESC inputElementDescs[2] = {};
+    D3D12_INPUT_ELEMENT_DESC inputElementDescs[3] = {};
+    inputElementDescs[0].SemanticName = "POSITION";
+    inputElementDescs[0].SemanticIndex = 0;
+    inputElementDescs[0].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    inputElementDescs[0].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+    inputElementDescs[1].SemanticName = "TEXCOORD";
+    inputElementDescs[1].SemanticIndex = 0;
+    inputElementDescs[1].Format = DXGI_FORMAT_R32G32_FLOAT;
+    inputElementDescs[1].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+    inputElementDescs[2].SemanticName = "COLOR";
+    inputElementDescs[2].SemanticIndex = 0;
+    inputElementDescs[2].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    inputElementDescs[2].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+    D3D12_INPUT_LAYOUT_DESC inputLayoutDesc{};
+    inputLayoutDesc.pInputElementDescs = inputElementDescs;
+    inputLayoutDesc.NumElements = _countof(inputElementDescs);
+
+    // BlendStageの設定
+    D3D12_BLEND_DESC blendDesc{};
+    // すべての色要素を書き込む
+    blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+    blendDesc.RenderTarget[0].BlendEnable = TRUE;
+    // BlendMode = Add
+    switch (blendMode) {
+    case BlendMode::kNone:
+        // ブレンドを無効化する
+        blendDesc.RenderTarget[0].BlendEnable = FALSE;
+        break;
+    case BlendMode::kNormal:
+        blendDesc.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+        blendDesc.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
+        blendDesc.RenderTarget[0].DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
+        break;
+    case BlendMode::kAdd:
+        blendDesc.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+        blendDesc.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
+        blendDesc.RenderTarget[0].DestBlend = D3D12_BLEND_ONE;
+        break;
+    case BlendMode::kSubtract:
+        blendDesc.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+        blendDesc.RenderTarget[0].BlendOp = D3D12_BLEND_OP_REV_SUBTRACT;
+        blendDesc.RenderTarget[0].DestBlend = D3D12_BLEND_ONE;
+        break;
+    case BlendMode::kMultiply:
+        blendDesc.RenderTarget[0].SrcBlend = D3D12_BLEND_ZERO;
+        blendDesc.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
+        blendDesc.RenderTarget[0].DestBlend = D3D12_BLEND_INV_SRC_COLOR;
+        break;
+    case BlendMode::kScreen:
+        blendDesc.RenderTarget[0].SrcBlend = D3D12_BLEND_INV_DEST_COLOR;
+        blendDesc.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
+        blendDesc.RenderTarget[0].DestBlend = D3D12_BLEND_ONE;
+        break;
+    default:
+        break;
+    }
+
+    blendDesc.RenderTarget[0].SrcBlendAlpha = D3D12_BLEND_ZERO;
+    blendDesc.RenderTarget[0].BlendOpAlpha = D3D12_BLEND_OP_ADD;
+    blendDesc.RenderTarget[0].DestBlendAlpha = D3D12_BLEND_ONE;
+
+    // ResiterzerStateの設定
+    D3D12_RASTERIZER_DESC rasterizerDesc{};
+    // 裏面（時計回り）を表示しない
+    rasterizerDesc.CullMode = D3D12_CULL_MODE_NONE;
+    // 三角形の中を塗りつぶす
+    rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
+    // Shaderをコンパイルする
+    IDxcBlob *vertexShaderBlob = dxCommon_->CompileShader(L"./Resources/shaders/Particle/ParticleTrail.VS.hlsl", L"vs_6_0");
+    assert(vertexShaderBlob != nullptr);
+
+    IDxcBlob *pixelShaderBlob = dxCommon_->CompileShader(L"./Resources/shaders/Particle/Particle.PS.hlsl", L"ps_6_0");
+    assert(pixelShaderBlob != nullptr);
+
+    ///=========DepthStencilStateの設定==========
+    D3D12_DEPTH_STENCIL_DESC depthStencilDesc{};
+    // Depthの機能を有効化する
+    depthStencilDesc.DepthEnable = true;
+    // 書き込みします
+    depthStencilDesc.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ZERO;
+    // 比較関数はLessEqual。つまり、近ければ描画される
+    depthStencilDesc.DepthFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL;
+    ///==========================================
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC graphicsPipelineStateDesc{};
+    graphicsPipelineStateDesc.pRootSignature = rootSignature.Get(); // RootSignature
+    graphicsPipelineStateDesc.InputLayout = inputLayoutDesc;        // InputLayout
+    graphicsPipelineStateDesc.VS = {vertexShaderBlob->GetBufferPointer(),
+                                    vertexShaderBlob->GetBufferSize()}; // vertexShader
+    graphicsPipelineStateDesc.PS = {pixelShaderBlob->GetBufferPointer(),
+                                    pixelShaderBlob->GetBufferSize()}; // PixelShader
+    graphicsPipelineStateDesc.BlendState = blendDesc;                  // BlendState
+    graphicsPipelineStateDesc.RasterizerState = rasterizerDesc;        // RasterizerState
+    // 書き込むRTVの情報
+    graphicsPipelineStateDesc.NumRenderTargets = 1;
+    graphicsPipelineStateDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+    // DepthStencilの設定
+    graphicsPipelineStateDesc.DepthStencilState = depthStencilDesc;
+    graphicsPipelineStateDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+    // 利用するトロポジ（形状）のタイプ、三角形
+    graphicsPipelineStateDesc.PrimitiveTopologyType =
+        D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+    // どのように画面に色を打ち込むかの設定（気にしなくていい）
+    graphicsPipelineStateDesc.SampleDesc.Count = 1;
+    graphicsPipelineStateDesc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
+    // 実際に生成
+    hr = dxCommon_->GetDevice()->CreateGraphicsPipelineState(&graphicsPipelineStateDesc,
+                                                             IID_PPV_ARGS(&graphicsPipelineState));
+    assert(SUCCEEDED(hr));
+
+    return graphicsPipelineState;
+}
+
+Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateSpriteGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode) {
+    Microsoft::WRL::ComPtr<ID3D12PipelineState> graphicsPipelineState;
+    HRESULT hr;
+
+    // InputLayout（頂点ごとに色を持つ）
+    D3D12_INPUT_ELEMENT_DESC inputElementDescs[3] = {};
     inputElementDescs[0].SemanticName = "POSITION";
     inputElementDescs[0].SemanticIndex = 0;
     inputElementDescs[0].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
@@ -732,6 +896,10 @@ Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateSpriteGraphic
     inputElementDescs[1].SemanticIndex = 0;
     inputElementDescs[1].Format = DXGI_FORMAT_R32G32_FLOAT;
     inputElementDescs[1].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+    inputElementDescs[2].SemanticName = "COLOR";
+    inputElementDescs[2].SemanticIndex = 0;
+    inputElementDescs[2].Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    inputElementDescs[2].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
     D3D12_INPUT_LAYOUT_DESC inputLayoutDesc{};
     inputLayoutDesc.pInputElementDescs = inputElementDescs;
     inputLayoutDesc.NumElements = _countof(inputElementDescs);
@@ -787,10 +955,10 @@ Microsoft::WRL::ComPtr<ID3D12PipelineState> PipeLineManager::CreateSpriteGraphic
     // 三角形の中を塗りつぶす
     rasterizerDesc.FillMode = D3D12_FILL_MODE_SOLID;
     // Shaderをコンパイルする
-    IDxcBlob *vertexShaderBlob = dxCommon_->CompileShader(L"./resources/shaders/Sprite/Sprite.VS.hlsl", L"vs_6_0");
+    IDxcBlob *vertexShaderBlob = dxCommon_->CompileShader(L"./resources/shaders/Sprite/SpriteBatch.VS.hlsl", L"vs_6_0");
     assert(vertexShaderBlob != nullptr);
 
-    IDxcBlob *pixelShaderBlob = dxCommon_->CompileShader(L"./resources/shaders/Sprite/Sprite.PS.hlsl", L"ps_6_0");
+    IDxcBlob *pixelShaderBlob = dxCommon_->CompileShader(L"./resources/shaders/Sprite/SpriteBatch.PS.hlsl", L"ps_6_0");
     assert(pixelShaderBlob != nullptr);
 
     ///=========DepthStencilStateの設定==========
@@ -39,11 +39,13 @@ enum class ShaderMode {
 enum class PipelineType {
     kStandard,
     kParticle,
-    kSprite,
     kRender,
     kSkinning,
     kLine3d,
-    kSkybox
+    kSkybox,
+    kParticleTrail,
+    kStandardInstanced,
+    kSpriteBatch,
 };
 
 class PipeLineManager {
@@ -90,17 +92,22 @@ class PipeLineManager {
 
     // 標準パイプライン関連
     void CreateStandardPipelines();
-    Microsoft::WRL::ComPtr<ID3D12RootSignature> CreateRootSignature();
-    Microsoft::WRL::ComPtr<ID3D12PipelineState> CreateGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode);
+    Microsoft::WRL::ComPtr<ID3D12RootSignature> CreateRootSignature(bool isInstanced = false);
+    Microsoft::WRL::ComPtr<ID3D12PipelineState> CreateGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode,
+                                                                       const wchar_t *vertexShaderPath = L"./resources/shaders/Object/Object3d.VS.hlsl");
 
     // パーティクル関連
     void CreateParticlePipelines();
     Microsoft::WRL::ComPtr<ID3D12RootSignature> CreateParticleRootSignature();
     Microsoft::WRL::ComPtr<ID3D12PipelineState> CreateParticleGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode);
 
+    // パーティクルの軌跡関連
+    void CreateParticleTrailPipelines();
+    Microsoft::WRL::ComPtr<ID3D12RootSignature> CreateParticleTrailRootSignature();
+    Microsoft::WRL::ComPtr<ID3D12PipelineState> CreateParticleTrailGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode);
+
     // スプライト関連
     void CreateSpritePipelines();
-    Microsoft::WRL::ComPtr<ID3D12RootSignature> CreateSpriteRootSignature();
     Microsoft::WRL::ComPtr<ID3D12PipelineState> CreateSpriteGraphicsPipeLine(Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature, BlendMode blendMode);
 
     // レンダー関連
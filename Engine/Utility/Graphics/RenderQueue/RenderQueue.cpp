@@ -0,0 +1,138 @@
+#include "RenderQueue.h"
+#include <array>
+#include <cstring>
+
+namespace {
+
+// キーの並び（上位から）
+// 不透明: pass(4) | pipeline(4) | blend(4) | material(20) | depth(32, 手前ほど小さい)
+// 半透明: pass(4) | depth(32, 奥ほど小さい) | pipeline(4) | blend(4) | material(20)
+constexpr uint32_t kPassShift = 60;
+constexpr uint32_t kOpaquePipelineShift = 56;
+constexpr uint32_t kOpaqueBlendShift = 52;
+constexpr uint32_t kOpaqueMaterialShift = 32;
+constexpr uint32_t kTransparentDepthShift = 28;
+constexpr uint32_t kTransparentPipelineShift = 24;
+constexpr uint32_t kTransparentBlendShift = 20;
+constexpr uint64_t kFieldMask4 = 0xf;
+
+// 0以上のfloatはビット列の大小と値の大小が一致する
+uint32_t DepthToBits(float viewDepth) {
+    float depth = viewDepth > 0.0f ? viewDepth : 0.0f;
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+    return bits;
+}
+
+} // namespace
+
+uint64_t RenderQueue::MakeKey(Pass pass, PipelineType pipeline, BlendMode blendMode, uint32_t materialId, float viewDepth) {
+    const uint64_t passBits = static_cast<uint64_t>(pass) & kFieldMask4;
+    const uint64_t pipelineBits = static_cast<uint64_t>(pipeline) & kFieldMask4;
+    const uint64_t blendBits = static_cast<uint64_t>(blendMode) & kFieldMask4;
+    const uint64_t materialBits = materialId & kMaxMaterialId;
+    const uint64_t depthBits = DepthToBits(viewDepth);
+
+    if (pass == Pass::kTransparent) {
+        return (passBits << kPassShift) | ((~depthBits & 0xffffffffull) << kTransparentDepthShift) |
+               (pipelineBits << kTransparentPipelineShift) | (blendBits << kTransparentBlendShift) | materialBits;
+    }
+    return (passBits << kPassShift) | (pipelineBits << kOpaquePipelineShift) | (blendBits << kOpaqueBlendShift) |
+           (materialBits << kOpaqueMaterialShift) | depthBits;
+}
+
+RenderQueue::Pass RenderQueue::GetPass(uint64_t key) {
+    return static_cast<Pass>((key >> kPassShift) & kFieldMask4);
+}
+
+PipelineType RenderQueue::GetPipeline(uint64_t key) {
+    uint32_t shift = GetPass(key) == Pass::kTransparent ? kTransparentPipelineShift : kOpaquePipelineShift;
+    return static_cast<PipelineType>((key >> shift) & kFieldMask4);
+}
+
+BlendMode RenderQueue::GetBlendMode(uint64_t key) {
+    uint32_t shift = GetPass(key) == Pass::kTransparent ? kTransparentBlendShift : kOpaqueBlendShift;
+    return static_cast<BlendMode>((key >> shift) & kFieldMask4);
+}
+
+uint32_t RenderQueue::GetMaterialId(uint64_t key) {
+    uint32_t shift = GetPass(key) == Pass::kTransparent ? 0 : kOpaqueMaterialShift;
+    return static_cast<uint32_t>((key >> shift) & kMaxMaterialId);
+}
+
+uint32_t RenderQueue::GetPipelineState(uint64_t key) {
+    return (static_cast<uint32_t>(GetPipeline(key)) << 4) | static_cast<uint32_t>(GetBlendMode(key));
+}
+
+uint32_t RenderQueue::GetStateChanges(const Packet *previous, const Packet &packet) {
+    uint32_t stateChanges = 0;
+    if (!previous || GetPipelineState(packet.key) != GetPipelineState(previous->key)) {
+        stateChanges |= kPipelineChanged;
+    }
+    // パイプラインを張り直したときはマテリアルも張り直す
+    if (stateChanges != 0 || GetMaterialId(packet.key) != GetMaterialId(previous->key)) {
+        stateChanges |= kMaterialChanged;
+    }
+    return stateChanges;
+}
+
+void RenderQueue::Clear() {
+    packets_.clear();
+}
+
+void RenderQueue::Add(uint64_t key, uint32_t payload) {
+    packets_.push_back({key, payload});
+}
+
+void RenderQueue::Sort() {
+    // 並べ替えで減った分を見られるように、積んだ順での切り替え数を数えておく
+    stats_.unsortedPipelineChanges = 0;
+    stats_.unsortedMaterialChanges = 0;
+    for (size_t i = 0; i < packets_.size(); ++i) {
+        uint32_t stateChanges = GetStateChanges(i == 0 ? nullptr : &packets_[i - 1], packets_[i]);
+        stats_.unsortedPipelineChanges += (stateChanges & kPipelineChanged) ? 1 : 0;
+        stats_.unsortedMaterialChanges += (stateChanges & kMaterialChanged) ? 1 : 0;
+    }
+
+    const size_t count = packets_.size();
+    scratchPackets_.resize(count);
+    std::array<uint32_t, kBucketCount> histogram;
+    for (uint32_t shift = 0; shift < 64; shift += kRadixBits) {
+        histogram.fill(0);
+        for (const Packet &packet : packets_) {
+            ++histogram[(packet.key >> shift) & (kBucketCount - 1)];
+        }
+        // 全部が同じ桁なら並びは変わらないので飛ばす（パスやパイプラインの桁はほとんどこれになる）
+        if (count == 0 || histogram[(packets_[0].key >> shift) & (kBucketCount - 1)] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t &bucket : histogram) {
+            uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+        for (const Packet &packet : packets_) {
+            scratchPackets_[histogram[(packet.key >> shift) & (kBucketCount - 1)]++] = packet;
+        }
+        packets_.swap(scratchPackets_);
+    }
+}
+
+void RenderQueue::Execute(const std::function<void(const Packet &packet, uint32_t stateChanges)> &function) {
+    stats_.packetCount = static_cast<uint32_t>(packets_.size());
+    stats_.pipelineChanges = 0;
+    stats_.materialChanges = 0;
+
+    for (size_t i = 0; i < packets_.size(); ++i) {
+        const Packet &packet = packets_[i];
+        uint32_t stateChanges = GetStateChanges(i == 0 ? nullptr : &packets_[i - 1], packet);
+        stats_.pipelineChanges += (stateChanges & kPipelineChanged) ? 1 : 0;
+        stats_.materialChanges += (stateChanges & kMaterialChanged) ? 1 : 0;
+        function(packet, stateChanges);
+    }
+    // 積んだ順のまま描いた場合との差
+    stats_.savedStateChanges = static_cast<int32_t>(stats_.unsortedPipelineChanges + stats_.unsortedMaterialChanges) -
+                               static_cast<int32_t>(stats_.pipelineChanges + stats_.materialChanges);
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "Graphics/PipeLine/PipeLineManager.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/// <summary>
+/// 描画パケットを64bitのソートキーで並べ替えてから描画する
+/// 不透明は 状態（パイプライン・ブレンド・マテリアル）→手前から の順、
+/// 半透明は 奥から→状態 の順に並べ、同じ状態が続くところは切り替えを省けるようにする
+/// キーの作成・並べ替え・切り替えの数え上げはGPUを使わないので、そのまま計測・確認できる
+/// </summary>
+class RenderQueue {
+  public:
+    // 描画の段階（小さいほど先に描く）
+    enum class Pass : uint32_t {
+        kOpaque,
+        kTransparent,
+    };
+
+    // 直前のパケットから変わった状態（Executeに渡す）
+    enum StateChange : uint32_t {
+        kPipelineChanged = 1u << 0, // パイプライン・ブレンドモード（ルートシグネチャも張り直す）
+        kMaterialChanged = 1u << 1, // マテリアル・テクスチャ
+    };
+
+    // 描画パケット（payloadは呼び出し側の描画データの番号）
+    struct Packet {
+        uint64_t key;
+        uint32_t payload;
+    };
+
+    // 直前のExecuteの集計
+    struct Stats {
+        uint32_t packetCount = 0;
+        uint32_t pipelineChanges = 0;         // 並べ替え後のパイプラインの切り替え数
+        uint32_t materialChanges = 0;         // 並べ替え後のマテリアルの切り替え数
+        uint32_t unsortedPipelineChanges = 0; // 積んだ順のまま描いた場合のパイプラインの切り替え数
+        uint32_t unsortedMaterialChanges = 0; // 積んだ順のまま描いた場合のマテリアルの切り替え数
+        int32_t savedStateChanges = 0;        // 並べ替えで減った切り替えの数（積んだ順との差。増えたときは負）
+    };
+
+    // マテリアルの番号に使えるビット数
+    static constexpr uint32_t kMaterialBits = 20;
+    static constexpr uint32_t kMaxMaterialId = (1u << kMaterialBits) - 1;
+
+    /// <summary>
+    /// ソートキーの作成
+    /// </summary>
+    /// <param name="viewDepth">ビュー空間のZ（負の値は0として扱う）</param>
+    /// <param name="materialId">kMaxMaterialIdを超える分は切り捨てる</param>
+    static uint64_t MakeKey(Pass pass, PipelineType pipeline, BlendMode blendMode, uint32_t materialId, float viewDepth);
+
+    /// <summary>
+    /// キーからの取り出し
+    /// </summary>
+    static Pass GetPass(uint64_t key);
+    static PipelineType GetPipeline(uint64_t key);
+    static BlendMode GetBlendMode(uint64_t key);
+    static uint32_t GetMaterialId(uint64_t key);
+
+    /// <summary>
+    /// パケットを空にする（確保したメモリは残す）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// パケットを積む
+    /// </summary>
+    void Add(uint64_t key, uint32_t payload);
+
+    /// <summary>
+    /// キーの昇順に並べ替える（8bitずつの基数ソート。同じキーは積んだ順のまま）
+    /// </summary>
+    void Sort();
+
+    /// <summary>
+    /// 並べた順にパケットを渡す。stateChangesはStateChangeの組み合わせで、先頭は全部立つ
+    /// </summary>
+    void Execute(const std::function<void(const Packet &packet, uint32_t stateChanges)> &function);
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    const std::vector<Packet> &GetPackets() const { return packets_; }
+    const Stats &GetStats() const { return stats_; }
+
+  private:
+    static constexpr uint32_t kRadixBits = 8;
+    static constexpr uint32_t kBucketCount = 1u << kRadixBits;
+
+    // パイプラインとブレンドモードをまとめた値（切り替えの判定用）
+    static uint32_t GetPipelineState(uint64_t key);
+
+    // 直前のパケットから変わった状態（先頭はpreviousをnullptrにする）
+    static uint32_t GetStateChanges(const Packet *previous, const Packet &packet);
+
+    std::vector<Packet> packets_;
+    std::vector<Packet> scratchPackets_;
+    Stats stats_;
+};
@@ -0,0 +1,128 @@
+#include "Graphics/RenderQueue/RenderQueue.h"
+#include "Test/Test.h"
+#include <random>
+
+namespace {
+
+// シーンのオブジェクトの並び（状態がばらばら）で積んだキー。2割が半透明、1割がスキニング
+struct Scene {
+    std::vector<uint64_t> keys;
+    std::vector<float> depths;
+};
+
+Scene MakeScene(uint32_t packetCount, uint32_t materialCount) {
+    std::mt19937 random(20240601u);
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+    std::uniform_int_distribution<uint32_t> material(0, materialCount - 1);
+    std::uniform_real_distribution<float> depth(0.1f, 200.0f);
+    const BlendMode transparentBlends[] = {BlendMode::kNormal, BlendMode::kAdd, BlendMode::kScreen};
+    Scene scene;
+    scene.keys.resize(packetCount);
+    scene.depths.resize(packetCount);
+    for (uint32_t i = 0; i < packetCount; ++i) {
+        bool isTransparent = percent(random) < 20;
+        bool isSkinning = !isTransparent && percent(random) < 10;
+        BlendMode blendMode = isTransparent ? transparentBlends[percent(random) % 3] : (isSkinning ? BlendMode::kNormal : BlendMode::kNone);
+        scene.depths[i] = depth(random);
+        scene.keys[i] = RenderQueue::MakeKey(isTransparent ? RenderQueue::Pass::kTransparent : RenderQueue::Pass::kOpaque,
+                                             isSkinning ? PipelineType::kSkinning : PipelineType::kStandard, blendMode, material(random), scene.depths[i]);
+    }
+    return scene;
+}
+
+bool IsSameState(uint64_t a, uint64_t b) {
+    return RenderQueue::GetPass(a) == RenderQueue::GetPass(b) && RenderQueue::GetPipeline(a) == RenderQueue::GetPipeline(b) &&
+           RenderQueue::GetBlendMode(a) == RenderQueue::GetBlendMode(b) && RenderQueue::GetMaterialId(a) == RenderQueue::GetMaterialId(b);
+}
+
+} // namespace
+
+// キーに入れた値がそのまま取り出せる
+TEST(KeyRoundTrip) {
+    uint64_t key = RenderQueue::MakeKey(RenderQueue::Pass::kTransparent, PipelineType::kSkinning, BlendMode::kAdd, 1234, 10.0f);
+    CHECK(RenderQueue::GetPass(key) == RenderQueue::Pass::kTransparent);
+    CHECK(RenderQueue::GetPipeline(key) == PipelineType::kSkinning);
+    CHECK(RenderQueue::GetBlendMode(key) == BlendMode::kAdd);
+    CHECK(RenderQueue::GetMaterialId(key) == 1234);
+    // 範囲を超えたマテリアルの番号は切り捨てる
+    uint64_t clamped = RenderQueue::MakeKey(RenderQueue::Pass::kOpaque, PipelineType::kStandard, BlendMode::kNone, RenderQueue::kMaxMaterialId + 5, 1.0f);
+    CHECK(RenderQueue::GetMaterialId(clamped) <= RenderQueue::kMaxMaterialId);
+}
+
+// 不透明→半透明の順、状態ごとにまとまり、不透明は手前から・半透明は奥から、同じキーは積んだ順になる
+TEST(SortOrder) {
+    constexpr uint32_t kPacketCount = 10000;
+    Scene scene = MakeScene(kPacketCount, 64);
+    RenderQueue renderQueue;
+    for (uint32_t i = 0; i < kPacketCount; ++i) {
+        renderQueue.Add(scene.keys[i], i);
+    }
+    renderQueue.Sort();
+
+    const std::vector<RenderQueue::Packet> &packets = renderQueue.GetPackets();
+    CHECK(packets.size() == kPacketCount);
+    for (uint32_t i = 1; i < packets.size(); ++i) {
+        const RenderQueue::Packet &previous = packets[i - 1];
+        const RenderQueue::Packet &current = packets[i];
+        CHECK(previous.key < current.key || (previous.key == current.key && previous.payload < current.payload));
+        if (RenderQueue::GetPass(current.key) == RenderQueue::Pass::kOpaque && IsSameState(previous.key, current.key)) {
+            CHECK(scene.depths[previous.payload] <= scene.depths[current.payload]);
+        } else if (RenderQueue::GetPass(previous.key) == RenderQueue::Pass::kTransparent &&
+                   RenderQueue::GetPass(current.key) == RenderQueue::Pass::kTransparent) {
+            CHECK(scene.depths[previous.payload] >= scene.depths[current.payload]);
+        }
+    }
+}
+
+// 切り替えのフラグは直前のパケットとの差で、積んだ順のままより切り替えが減る
+TEST(ExecuteStateChanges) {
+    constexpr uint32_t kPacketCount = 10000;
+    Scene scene = MakeScene(kPacketCount, 64);
+    RenderQueue renderQueue;
+    for (uint32_t i = 0; i < kPacketCount; ++i) {
+        renderQueue.Add(scene.keys[i], i);
+    }
+
+    // 積んだ順のまま描いた場合の切り替え数
+    uint32_t unsortedStateChanges = 0;
+    for (uint32_t i = 0; i < kPacketCount; ++i) {
+        bool isPipelineChanged = i == 0 || RenderQueue::GetPipeline(scene.keys[i - 1]) != RenderQueue::GetPipeline(scene.keys[i]) ||
+                                 RenderQueue::GetBlendMode(scene.keys[i - 1]) != RenderQueue::GetBlendMode(scene.keys[i]);
+        bool isMaterialChanged = isPipelineChanged || RenderQueue::GetMaterialId(scene.keys[i - 1]) != RenderQueue::GetMaterialId(scene.keys[i]);
+        unsortedStateChanges += (isPipelineChanged ? 1 : 0) + (isMaterialChanged ? 1 : 0);
+    }
+
+    renderQueue.Sort();
+
+    uint32_t executedCount = 0;
+    uint32_t pipelineChanges = 0;
+    uint32_t materialChanges = 0;
+    uint64_t previousKey = 0;
+    renderQueue.Execute([&](const RenderQueue::Packet &packet, uint32_t stateChanges) {
+        if (executedCount == 0) {
+            CHECK(stateChanges == (RenderQueue::kPipelineChanged | RenderQueue::kMaterialChanged));
+        } else {
+            bool isPipelineChanged = RenderQueue::GetPipeline(previousKey) != RenderQueue::GetPipeline(packet.key) ||
+                                     RenderQueue::GetBlendMode(previousKey) != RenderQueue::GetBlendMode(packet.key);
+            // パイプラインを張り直したときはマテリアルも張り直す
+            bool isMaterialChanged = isPipelineChanged || RenderQueue::GetMaterialId(previousKey) != RenderQueue::GetMaterialId(packet.key);
+            CHECK(((stateChanges & RenderQueue::kPipelineChanged) != 0) == isPipelineChanged);
+            CHECK(((stateChanges & RenderQueue::kMaterialChanged) != 0) == isMaterialChanged);
+        }
+        pipelineChanges += (stateChanges & RenderQueue::kPipelineChanged) ? 1 : 0;
+        materialChanges += (stateChanges & RenderQueue::kMaterialChanged) ? 1 : 0;
+        previousKey = packet.key;
+        ++executedCount;
+    });
+
+    const RenderQueue::Stats &stats = renderQueue.GetStats();
+    CHECK(executedCount == kPacketCount);
+    CHECK(stats.packetCount == kPacketCount);
+    CHECK(stats.pipelineChanges == pipelineChanges);
+    CHECK(stats.materialChanges == materialChanges);
+    CHECK(stats.pipelineChanges < stats.unsortedPipelineChanges);
+    CHECK(stats.unsortedPipelineChanges + stats.unsortedMaterialChanges == unsortedStateChanges);
+    // 省けた数は積んだ順との差で、パケットの数からは決まらない
+    CHECK(stats.savedStateChanges == static_cast<int32_t>(unsortedStateChanges - pipelineChanges - materialChanges));
+    CHECK(stats.savedStateChanges > 0);
+}
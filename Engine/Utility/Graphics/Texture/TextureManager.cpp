@@ -1,5 +1,7 @@
 #include "TextureManager.h"
 #include "DirectXCommon.h"
+#include "Debug/Profiler/Profiler.h"
+#include <Asset/AssetDatabase.h>
 #include <String/StringUtility.h>
 
 TextureManager *TextureManager::instance = nullptr;
@@ -8,14 +10,22 @@ TextureManager *TextureManager::instance = nullptr;
 uint32_t TextureManager::kSRVIndexTop = 1;
 
 void TextureManager::LoadTexture(const std::string &filePath) {
+    PROFILE_FUNCTION();
     // ファイル名を取り出して、resources/images/を付ける
     std::string newFilePath = "resources/images/" + filePath;
+    AssetID assetID = AssetDatabase::MakeAssetID(newFilePath);
 
     // 読み込み済みテクスチャを検索
-    if (textureDatas.contains(newFilePath)) {
+    if (textureDatas.contains(assetID)) {
         return;
     }
 
+    // アセットデータベースに登録済みなら実ファイルのパスを使う
+    std::string resolvedPath = AssetDatabase::GetInstance()->GetFullPath(assetID);
+    if (!resolvedPath.empty()) {
+        newFilePath = resolvedPath;
+    }
+
     // テクスチャ枚数上限をチェック
     assert(srvManager_->CanAllocate());
 
@@ -47,7 +57,7 @@ void TextureManager::LoadTexture(const std::string &filePath) {
     }
 
     // テクスチャデータを追加して書き込む
-    TextureData &textureData = textureDatas[newFilePath];
+    TextureData &textureData = textureDatas[assetID];
 
     textureData.metadata = imageToUse->GetMetadata();
     textureData.resource = dxCommon_->CreateTextureResource(textureData.metadata);
@@ -86,11 +96,11 @@ void TextureManager::Finalize() {
 }
 
 uint32_t TextureManager::GetTextureIndexByFilePath(const std::string &filePath) {
-    // ファイル名を取り出して、resources/images/を付ける
-    std::string newFilePath = "resources/images/" + filePath;
+    // resources/images/ 基準のパスからIDを作成
+    AssetID assetID = AssetDatabase::MakeAssetID("images/" + filePath);
 
     // unordered_mapを使って直接インデックスを取得
-    auto it = textureDatas.find(newFilePath);
+    auto it = textureDatas.find(assetID);
     if (it != textureDatas.end()) {
         return it->second.srvIndex;
     }
@@ -101,18 +111,20 @@ uint32_t TextureManager::GetTextureIndexByFilePath(const std::string &filePath)
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE TextureManager::GetSrvHandleGPU(const std::string &filePath) {
+    // フルパス(resources/images/...)でもIDは同じになる
+    AssetID assetID = AssetDatabase::MakeAssetID(filePath);
     // 指定されたファイルパスが存在するかチェック
-    assert(textureDatas.find(filePath) != textureDatas.end());
+    assert(textureDatas.find(assetID) != textureDatas.end());
 
-    TextureData &textureData = textureDatas[filePath];
+    TextureData &textureData = textureDatas[assetID];
     return textureData.srvHandleGPU;
 }
 
 const DirectX::TexMetadata &TextureManager::GetMetaData(const std::string &filePath) {
-    std::string fullPath = ("resources/images/" + filePath);
+    AssetID assetID = AssetDatabase::MakeAssetID("images/" + filePath);
     // 指定されたファイルパスが存在するかチェック
-    assert(textureDatas.find(fullPath) != textureDatas.end());
+    assert(textureDatas.find(assetID) != textureDatas.end());
 
-    TextureData &textureData = textureDatas[fullPath];
+    TextureData &textureData = textureDatas[assetID];
     return textureData.metadata;
 }
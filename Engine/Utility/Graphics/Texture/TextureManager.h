@@ -5,6 +5,7 @@
 #include "string"
 #include "unordered_map"
 #include "wrl.h"
+#include <Asset/AssetDatabase.h>
 #include <Graphics/Srv/SrvManager.h>
 class TextureManager {
   private:
@@ -74,7 +75,7 @@ class TextureManager {
         D3D12_CPU_DESCRIPTOR_HANDLE srvHandleCPU; // SRV作成時に必要なCPUハンドル
         D3D12_GPU_DESCRIPTOR_HANDLE srvHandleGPU; // 描画コマンドに必要なGPUハンドル
     };
-    std::unordered_map<std::string, TextureData> textureDatas; // テクスチャデータ
+    std::unordered_map<AssetID, TextureData> textureDatas; // テクスチャデータ（キーはアセットID）
 
     DirectXCommon *dxCommon_ = nullptr;
     SrvManager *srvManager_ = nullptr;
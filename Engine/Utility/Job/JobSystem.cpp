@@ -0,0 +1,280 @@
+#include "JobSystem.h"
+#include "Debug/Profiler/Profiler.h"
+#include <algorithm>
+#include <cassert>
+
+JobSystem *JobSystem::instance = nullptr;
+
+namespace {
+// ワーカー外のスレッド
+constexpr uint32_t kNoQueue = UINT32_MAX;
+// 実行中のスレッドが持つキューの番号
+thread_local uint32_t currentQueueIndex = kNoQueue;
+} // namespace
+
+JobSystem *JobSystem::GetInstance() {
+    if (instance == nullptr) {
+        instance = new JobSystem();
+    }
+    return instance;
+}
+
+void JobSystem::Initialize(uint32_t workerCount) {
+    if (isRunning_) {
+        return;
+    }
+
+    // メインスレッドの分を除いたコア数
+    if (workerCount == 0) {
+        uint32_t hardwareCount = std::thread::hardware_concurrency();
+        workerCount = hardwareCount > 1 ? hardwareCount - 1 : 1;
+    }
+
+    mainThreadId_ = std::this_thread::get_id();
+    currentQueueIndex = 0;
+
+    for (uint32_t i = 0; i < workerCount + 1; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    isRunning_ = true;
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&JobSystem::WorkerMain, this, i + 1);
+    }
+}
+
+void JobSystem::Finalize() {
+    isRunning_ = false;
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    sleepCondition_.notify_all();
+    for (auto &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    // 積まれたまま残っているジョブはここで実行する（待っているカウンタが0にならないまま破棄されないように）
+    currentQueueIndex = 0;
+    for (;;) {
+        if (ExecuteOne()) {
+            continue;
+        }
+        bool hasMainThreadJobs;
+        {
+            std::lock_guard<std::mutex> lock(mainThreadMutex_);
+            hasMainThreadJobs = !mainThreadJobs_.empty();
+        }
+        if (!hasMainThreadJobs) {
+            break;
+        }
+        ExecuteMainThreadJobs();
+    }
+    assert(queuedJobCount_.load() == 0);
+    currentQueueIndex = kNoQueue;
+
+    delete instance;
+    instance = nullptr;
+}
+
+void JobSystem::Run(JobFunction function, JobCounter *counter, JobAffinity affinity) {
+    // 初期化前（ヘッドレスのツールなど）はその場で実行する
+    if (!isRunning_) {
+        function();
+        return;
+    }
+
+    if (counter) {
+        counter->pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+    Submit({std::move(function), counter}, affinity);
+}
+
+void JobSystem::RunAfter(JobCounter *dependency, JobFunction function, JobCounter *counter, JobAffinity affinity) {
+    if (!isRunning_ || dependency == nullptr) {
+        Run(std::move(function), counter, affinity);
+        return;
+    }
+
+    // 先にカウンタを進めておき、依存の完了前でもWaitで待てるようにする
+    if (counter) {
+        counter->pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(dependency->mutex_);
+        if (!dependency->IsDone()) {
+            dependency->continuations_.push_back({std::move(function), counter, affinity});
+            return;
+        }
+    }
+    Submit({std::move(function), counter}, affinity);
+}
+
+void JobSystem::Wait(JobCounter *counter) {
+    while (!counter->IsDone()) {
+        // 待っている間も他のジョブを進める（ジョブの中から待ってもデッドロックしない）
+        if (!ExecuteOne()) {
+            std::this_thread::yield();
+        }
+    }
+    // 完了処理がカウンタを触り終えるのを待つ（この後カウンタを破棄してよい）
+    std::lock_guard<std::mutex> lock(counter->mutex_);
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const RangeFunction &function) {
+    if (count == 0) {
+        return;
+    }
+    grainSize = (std::max)(grainSize, 1u);
+
+    // 分割するほどの量がなければその場で実行する
+    if (!isRunning_ || count <= grainSize) {
+        function(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    for (uint32_t begin = 0; begin < count; begin += grainSize) {
+        uint32_t end = (std::min)(begin + grainSize, count);
+        Run([&function, begin, end]() { function(begin, end); }, &counter);
+    }
+    Wait(&counter);
+}
+
+void JobSystem::ExecuteMainThreadJobs() {
+    std::deque<Job> jobs;
+    {
+        std::lock_guard<std::mutex> lock(mainThreadMutex_);
+        jobs.swap(mainThreadJobs_);
+    }
+    // 実行中に積まれたものは次の呼び出しで実行する
+    for (Job &job : jobs) {
+        Execute(job);
+    }
+}
+
+void JobSystem::Submit(Job job, JobAffinity affinity) {
+    if (affinity == JobAffinity::kMainThread) {
+        std::lock_guard<std::mutex> lock(mainThreadMutex_);
+        mainThreadJobs_.push_back(std::move(job));
+        return;
+    }
+
+    // ワーカーなら自分のキューへ、それ以外のスレッドからは順番に振り分ける
+    uint32_t queueIndex = currentQueueIndex;
+    if (queueIndex >= queues_.size()) {
+        queueIndex = nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+    // 取り出す側より先に数えておく（積んだ直後に盗まれても0を下回らない）
+    queuedJobCount_.fetch_add(1);
+    {
+        WorkerQueue &queue = *queues_[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    // 寝ているワーカーがいるときだけ起こす
+    if (sleepingCount_.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+        }
+        sleepCondition_.notify_one();
+    }
+}
+
+bool JobSystem::TryPop(uint32_t queueIndex, Job &job) {
+    const uint32_t queueCount = static_cast<uint32_t>(queues_.size());
+
+    // 自分のキューは後ろから（直前に積んだものがキャッシュに残っている）
+    if (queueIndex < queueCount) {
+        WorkerQueue &queue = *queues_[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            queuedJobCount_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // 他のキューからは前から盗む
+    uint32_t start = queueIndex < queueCount ? queueIndex + 1 : 0;
+    for (uint32_t i = 0; i < queueCount; ++i) {
+        uint32_t victim = (start + i) % queueCount;
+        if (victim == queueIndex) {
+            continue;
+        }
+        WorkerQueue &queue = *queues_[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            queuedJobCount_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JobSystem::ExecuteOne() {
+    Job job;
+
+    // メインスレッド指定のジョブはメインスレッドだけが取る
+    if (IsMainThread()) {
+        std::unique_lock<std::mutex> lock(mainThreadMutex_);
+        if (!mainThreadJobs_.empty()) {
+            job = std::move(mainThreadJobs_.front());
+            mainThreadJobs_.pop_front();
+            lock.unlock();
+            Execute(job);
+            return true;
+        }
+    }
+
+    if (queuedJobCount_.load(std::memory_order_relaxed) == 0 || !TryPop(currentQueueIndex, job)) {
+        return false;
+    }
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job &job) {
+    PROFILE_SCOPE("Job");
+    job.function();
+    if (job.counter) {
+        Complete(job.counter);
+    }
+}
+
+void JobSystem::Complete(JobCounter *counter) {
+    std::vector<JobCounter::Continuation> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex_);
+        if (counter->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuations.swap(counter->continuations_);
+        }
+    }
+    // ここから先はカウンタを触らない（待っていた側が破棄している可能性がある）
+    for (auto &continuation : continuations) {
+        Submit({std::move(continuation.function), continuation.counter}, continuation.affinity);
+    }
+}
+
+void JobSystem::WorkerMain(uint32_t queueIndex) {
+    currentQueueIndex = queueIndex;
+    Profiler::SetThreadName("Worker " + std::to_string(queueIndex));
+
+    while (isRunning_) {
+        if (ExecuteOne()) {
+            continue;
+        }
+
+        // 積まれるまで寝る
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleepingCount_.fetch_add(1);
+        sleepCondition_.wait(lock, [this]() { return queuedJobCount_.load() > 0 || !isRunning_; });
+        sleepingCount_.fetch_sub(1);
+    }
+}
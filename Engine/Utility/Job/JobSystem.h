@@ -0,0 +1,177 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// ジョブを実行するスレッドの指定
+/// </summary>
+enum class JobAffinity {
+    kAny,        // どのワーカーで実行してもよい
+    kMainThread, // メインスレッドでのみ実行する（D3D12のコマンドリストやImGuiを触るもの）
+};
+
+/// <summary>
+/// ジョブの完了待ちに使うカウンタ
+/// 登録したジョブがすべて終わると0になる。破棄する前にJobSystem::Waitで待つこと
+/// </summary>
+class JobCounter {
+  public:
+    JobCounter() = default;
+    JobCounter(const JobCounter &) = delete;
+    JobCounter &operator=(const JobCounter &) = delete;
+
+    /// <summary>
+    /// 登録したジョブがすべて終わったか
+    /// </summary>
+    bool IsDone() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+  private:
+    friend class JobSystem;
+
+    struct Continuation {
+        std::function<void()> function;
+        JobCounter *counter;
+        JobAffinity affinity;
+    };
+
+    std::atomic<uint32_t> pending_ = 0;
+    // このカウンタの完了を待っているジョブ
+    std::mutex mutex_;
+    std::vector<Continuation> continuations_;
+};
+
+/// <summary>
+/// ワークスティーリング方式のジョブシステム
+/// ワーカーごとに両端キューを持ち、自分のキューは後ろから、空になったら他のキューの前から取る
+/// </summary>
+class JobSystem {
+  private:
+    static JobSystem *instance;
+
+    JobSystem() = default;
+    ~JobSystem() = default;
+    JobSystem(JobSystem &) = delete;
+    JobSystem &operator=(JobSystem &) = delete;
+
+  public:
+    using JobFunction = std::function<void()>;
+    using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+    /// <summary>
+    /// シングルトンインスタンスの取得
+    /// </summary>
+    static JobSystem *GetInstance();
+
+    /// <summary>
+    /// 初期化（呼び出したスレッドをメインスレッドとする）
+    /// </summary>
+    /// <param name="workerCount">ワーカースレッド数（0ならコア数-1）</param>
+    void Initialize(uint32_t workerCount = 0);
+
+    /// <summary>
+    /// 終了（ワーカースレッドを止め、残っているジョブは呼び出したスレッドで実行する）
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// ジョブの登録（初期化前はその場で実行する）
+    /// </summary>
+    /// <param name="function">ジョブ</param>
+    /// <param name="counter">完了待ち用のカウンタ（nullptr可）</param>
+    /// <param name="affinity">実行するスレッド</param>
+    void Run(JobFunction function, JobCounter *counter = nullptr, JobAffinity affinity = JobAffinity::kAny);
+
+    /// <summary>
+    /// dependencyのジョブがすべて終わってから実行するジョブの登録
+    /// </summary>
+    void RunAfter(JobCounter *dependency, JobFunction function, JobCounter *counter = nullptr,
+                  JobAffinity affinity = JobAffinity::kAny);
+
+    /// <summary>
+    /// カウンタが0になるまで待つ（待っている間は他のジョブを実行する）
+    /// </summary>
+    void Wait(JobCounter *counter);
+
+    /// <summary>
+    /// [0, count) をgrainSize個ずつに分けて並列に実行し、終わるまで待つ
+    /// </summary>
+    void ParallelFor(uint32_t count, uint32_t grainSize, const RangeFunction &function);
+
+    /// <summary>
+    /// メインスレッド指定のジョブを実行する（メインスレッドから毎フレーム呼ぶ）
+    /// </summary>
+    void ExecuteMainThreadJobs();
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+    bool IsInitialized() const { return isRunning_; }
+    bool IsMainThread() const { return std::this_thread::get_id() == mainThreadId_; }
+
+  private:
+    struct Job {
+        JobFunction function;
+        JobCounter *counter = nullptr;
+    };
+
+    // ワーカー1つ分のキュー
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    /// <summary>
+    /// キューに積む
+    /// </summary>
+    void Submit(Job job, JobAffinity affinity);
+
+    /// <summary>
+    /// 自分のキューから、なければ他のキューから盗んでくる
+    /// </summary>
+    bool TryPop(uint32_t queueIndex, Job &job);
+
+    /// <summary>
+    /// 1つ実行する（実行するものがなければfalse）
+    /// </summary>
+    bool ExecuteOne();
+
+    /// <summary>
+    /// 実行してカウンタを進める
+    /// </summary>
+    void Execute(Job &job);
+
+    /// <summary>
+    /// カウンタを1つ減らし、0になったら待っていたジョブを登録する
+    /// </summary>
+    void Complete(JobCounter *counter);
+
+    void WorkerMain(uint32_t queueIndex);
+
+  private:
+    // キュー（0番はメインスレッド、1番以降がワーカースレッド）
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::thread::id mainThreadId_;
+
+    // メインスレッド指定のジョブ
+    std::mutex mainThreadMutex_;
+    std::deque<Job> mainThreadJobs_;
+
+    // 待機中のワーカーを起こす
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCondition_;
+    std::atomic<uint32_t> queuedJobCount_ = 0;
+    std::atomic<uint32_t> sleepingCount_ = 0;
+    // ワーカー外のスレッドから積むときの振り分け先
+    std::atomic<uint32_t> nextQueue_ = 0;
+
+    std::atomic<bool> isRunning_ = false;
+};
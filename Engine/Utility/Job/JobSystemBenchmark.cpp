@@ -0,0 +1,177 @@
+#include "JobSystemBenchmark.h"
+#include "JobSystem.h"
+#include <chrono>
+#include <fstream>
+#include <memory>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 同時に登録するワーカー外のスレッド数
+constexpr uint32_t kProducerCount = 4;
+// 1スレッドあたりの登録数
+constexpr uint32_t kJobsPerProducer = 25000;
+
+// 計測を終えて結果をまとめる
+JobSystemBenchmarkResult MakeResult(const std::string &name, uint32_t jobs, Clock::time_point begin) {
+    JobSystemBenchmarkResult result;
+    result.name = name;
+    result.jobs = jobs;
+    result.totalMs = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+    result.perJobNs = jobs > 0 ? result.totalMs * 1.0e6 / jobs : 0.0;
+    return result;
+}
+
+// 複数のスレッドから同時に登録する
+JobSystemBenchmarkResult MeasureContention(JobSystem *jobSystem) {
+    const uint32_t jobCount = kProducerCount * kJobsPerProducer;
+    std::unique_ptr<std::atomic<uint32_t>[]> hits(new std::atomic<uint32_t>[jobCount]);
+    for (uint32_t i = 0; i < jobCount; ++i) {
+        hits[i] = 0;
+    }
+
+    auto begin = Clock::now();
+    JobCounter counter;
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducerCount; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < kJobsPerProducer; ++i) {
+                uint32_t index = p * kJobsPerProducer + i;
+                jobSystem->Run([&hits, index]() { hits[index].fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    jobSystem->Wait(&counter);
+    return MakeResult("contention_external_submit", jobCount, begin);
+}
+
+// ジョブの中からジョブを登録し、同じカウンタですべて待つ
+JobSystemBenchmarkResult MeasureNested(JobSystem *jobSystem) {
+    constexpr uint32_t kParentCount = 1000;
+    constexpr uint32_t kChildCount = 100;
+    std::atomic<uint32_t> executed = 0;
+
+    auto begin = Clock::now();
+    JobCounter counter;
+    for (uint32_t i = 0; i < kParentCount; ++i) {
+        jobSystem->Run(
+            [&]() {
+                for (uint32_t j = 0; j < kChildCount; ++j) {
+                    jobSystem->Run([&]() { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+                }
+                executed.fetch_add(1, std::memory_order_relaxed);
+            },
+            &counter);
+    }
+    jobSystem->Wait(&counter);
+
+    const uint32_t jobCount = kParentCount * (kChildCount + 1);
+    return MakeResult("nested_spawn", jobCount, begin);
+}
+
+// 前の段がすべて終わってから次の段を実行する
+JobSystemBenchmarkResult MeasureDependency(JobSystem *jobSystem) {
+    constexpr uint32_t kStageCount = 8;
+    constexpr uint32_t kJobsPerStage = 256;
+    std::vector<std::unique_ptr<JobCounter>> counters;
+    std::atomic<uint32_t> finished[kStageCount] = {};
+
+    auto begin = Clock::now();
+    for (uint32_t stage = 0; stage < kStageCount; ++stage) {
+        JobCounter *dependency = stage > 0 ? counters.back().get() : nullptr;
+        counters.push_back(std::make_unique<JobCounter>());
+        for (uint32_t i = 0; i < kJobsPerStage; ++i) {
+            jobSystem->RunAfter(
+                dependency,
+                [&, stage]() { finished[stage].fetch_add(1); },
+                counters.back().get());
+        }
+    }
+    // 途中の段もすべて待ってから破棄する
+    for (auto &counter : counters) {
+        jobSystem->Wait(counter.get());
+    }
+    return MakeResult("dependency_chain", kStageCount * kJobsPerStage, begin);
+}
+
+// 分割の粒度ごとのParallelFor
+JobSystemBenchmarkResult MeasureParallelFor(JobSystem *jobSystem, uint32_t grainSize) {
+    constexpr uint32_t kCount = 1 << 20;
+    std::vector<uint32_t> values(kCount, 0);
+
+    auto begin = Clock::now();
+    jobSystem->ParallelFor(kCount, grainSize, [&values](uint32_t rangeBegin, uint32_t rangeEnd) {
+        for (uint32_t i = rangeBegin; i < rangeEnd; ++i) {
+            values[i] += i;
+        }
+    });
+    const uint32_t jobCount = (kCount + grainSize - 1) / grainSize;
+    return MakeResult("parallel_for_grain_" + std::to_string(grainSize), jobCount, begin);
+}
+
+// ワーカーからメインスレッド指定のジョブを登録する
+JobSystemBenchmarkResult MeasureMainThreadAffinity(JobSystem *jobSystem) {
+    constexpr uint32_t kJobCount = 100;
+    std::atomic<uint32_t> executed = 0;
+
+    auto begin = Clock::now();
+    JobCounter counter;
+    jobSystem->Run(
+        [&]() {
+            for (uint32_t i = 0; i < kJobCount; ++i) {
+                jobSystem->Run([&]() { executed.fetch_add(1); }, &counter, JobAffinity::kMainThread);
+            }
+        },
+        &counter);
+    // メインスレッドで待つと、待っている間にメインスレッド指定のジョブが実行される
+    jobSystem->Wait(&counter);
+
+    return MakeResult("main_thread_affinity", kJobCount + 1, begin);
+}
+
+// 空のジョブを登録して待つまでの1つあたりの時間
+JobSystemBenchmarkResult MeasureOverhead(JobSystem *jobSystem) {
+    constexpr uint32_t kJobCount = 200000;
+
+    auto begin = Clock::now();
+    JobCounter counter;
+    for (uint32_t i = 0; i < kJobCount; ++i) {
+        jobSystem->Run([]() {}, &counter);
+    }
+    jobSystem->Wait(&counter);
+    return MakeResult("overhead_empty_job", kJobCount, begin);
+}
+
+} // namespace
+
+std::vector<JobSystemBenchmarkResult> JobSystemBenchmark::Run() {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+
+    std::vector<JobSystemBenchmarkResult> results;
+    results.push_back(MeasureContention(jobSystem));
+    results.push_back(MeasureNested(jobSystem));
+    results.push_back(MeasureDependency(jobSystem));
+    results.push_back(MeasureParallelFor(jobSystem, 1));
+    results.push_back(MeasureParallelFor(jobSystem, 64));
+    results.push_back(MeasureParallelFor(jobSystem, 16384));
+    results.push_back(MeasureMainThreadAffinity(jobSystem));
+    results.push_back(MeasureOverhead(jobSystem));
+    return results;
+}
+
+void JobSystemBenchmark::WriteReportCSV(const std::vector<JobSystemBenchmarkResult> &results, const std::string &filePath) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        return;
+    }
+
+    file << "worker_count," << JobSystem::GetInstance()->GetWorkerCount() << "\n";
+    file << "name,jobs,total_ms,per_job_ns\n";
+    for (const auto &result : results) {
+        file << result.name << "," << result.jobs << "," << result.totalMs << "," << result.perJobNs << "\n";
+    }
+}
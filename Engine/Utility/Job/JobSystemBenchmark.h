@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 計測1項目分の結果
+/// </summary>
+struct JobSystemBenchmarkResult {
+    std::string name;       // 項目名
+    uint32_t jobs = 0;      // 実行したジョブ数
+    double totalMs = 0.0;   // 全体の時間(ms)
+    double perJobNs = 0.0;  // ジョブ1つあたりの時間(ns)
+};
+
+/// <summary>
+/// ジョブシステムのスケジューリングのオーバーヘッド計測
+/// 複数スレッドからの同時登録・入れ子の登録・依存関係・ParallelFor・メインスレッド指定を計測する（動作の確認はJobSystemTest）
+/// </summary>
+class JobSystemBenchmark {
+  public:
+    /// <summary>
+    /// すべての項目を計測する（JobSystemは初期化済みであること）
+    /// </summary>
+    static std::vector<JobSystemBenchmarkResult> Run();
+
+    /// <summary>
+    /// 結果をCSVに書き出す
+    /// </summary>
+    static void WriteReportCSV(const std::vector<JobSystemBenchmarkResult> &results, const std::string &filePath);
+};
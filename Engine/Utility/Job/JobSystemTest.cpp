@@ -0,0 +1,211 @@
+#include "Job/JobSystem.h"
+#include "Test/Test.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// 外部のスレッドからも積みながら、入れ子のジョブと依存つきのジョブがすべて1回ずつ実行される
+TEST(RunsEveryJobOnce) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(3);
+
+    constexpr uint32_t kRounds = 200;
+    constexpr uint32_t kJobsPerRound = 64;
+    std::atomic<uint32_t> executedCount = 0;
+    for (uint32_t round = 0; round < kRounds; ++round) {
+        JobCounter counter;
+        JobCounter afterCounter;
+        // ワーカー外のスレッドから積む
+        std::thread producer([&]() {
+            for (uint32_t i = 0; i < kJobsPerRound; ++i) {
+                jobSystem->Run([&]() { executedCount.fetch_add(1); }, &counter);
+            }
+        });
+        for (uint32_t i = 0; i < kJobsPerRound; ++i) {
+            jobSystem->Run(
+                [&]() {
+                    // ジョブの中から積む（ワーカー自身のキューに入る）
+                    jobSystem->Run([&]() { executedCount.fetch_add(1); }, &counter);
+                    executedCount.fetch_add(1);
+                },
+                &counter);
+        }
+        producer.join();
+        jobSystem->RunAfter(&counter, [&]() { executedCount.fetch_add(1); }, &afterCounter);
+        jobSystem->Wait(&counter);
+        jobSystem->Wait(&afterCounter);
+    }
+    CHECK(executedCount.load() == kRounds * (kJobsPerRound * 3 + 1));
+
+    jobSystem->Finalize();
+}
+
+// 終了時に積まれたまま残っているジョブも実行され、カウンタが0になる
+TEST(FinalizeDrainsQueues) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(2);
+
+    constexpr uint32_t kJobCount = 1000;
+    std::atomic<uint32_t> executedCount = 0;
+    JobCounter counter;
+    JobCounter mainThreadCounter;
+    for (uint32_t i = 0; i < kJobCount; ++i) {
+        jobSystem->Run([&]() { executedCount.fetch_add(1); }, &counter);
+    }
+    // メインスレッド指定のジョブは毎フレームの呼び出しがなくても終了時に実行される
+    jobSystem->Run([&]() { executedCount.fetch_add(1); }, &mainThreadCounter, JobAffinity::kMainThread);
+    jobSystem->RunAfter(&counter, [&]() { executedCount.fetch_add(1); }, &mainThreadCounter, JobAffinity::kMainThread);
+
+    jobSystem->Finalize();
+    CHECK(executedCount.load() == kJobCount + 2);
+    CHECK(counter.IsDone());
+    CHECK(mainThreadCounter.IsDone());
+}
+
+// 初期化前はその場で実行する
+TEST(RunsInlineWithoutWorkers) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    uint32_t executedCount = 0;
+    JobCounter counter;
+    jobSystem->Run([&]() { ++executedCount; }, &counter);
+    CHECK(executedCount == 1);
+    CHECK(counter.IsDone());
+
+    uint32_t sum = 0;
+    jobSystem->ParallelFor(100, 7, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            sum += i;
+        }
+    });
+    CHECK(sum == 4950);
+    jobSystem->Finalize();
+}
+
+// 複数のスレッドから同時に積んでも、どのジョブもちょうど1回ずつ実行される
+TEST(ContentionRunsEachJobExactlyOnce) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(3);
+
+    constexpr uint32_t kProducerCount = 4;
+    constexpr uint32_t kJobsPerProducer = 10000;
+    constexpr uint32_t kJobCount = kProducerCount * kJobsPerProducer;
+    std::unique_ptr<std::atomic<uint32_t>[]> hits(new std::atomic<uint32_t>[kJobCount]);
+    for (uint32_t i = 0; i < kJobCount; ++i) {
+        hits[i] = 0;
+    }
+
+    JobCounter counter;
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducerCount; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < kJobsPerProducer; ++i) {
+                uint32_t index = p * kJobsPerProducer + i;
+                jobSystem->Run([&hits, index]() { hits[index].fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+        });
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+    jobSystem->Wait(&counter);
+
+    bool isExactlyOnce = true;
+    for (uint32_t i = 0; i < kJobCount; ++i) {
+        isExactlyOnce = isExactlyOnce && hits[i].load() == 1;
+    }
+    CHECK(isExactlyOnce);
+
+    jobSystem->Finalize();
+}
+
+// 依存先の段がすべて終わってから次の段が実行される
+TEST(DependencyChainRunsInOrder) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(3);
+
+    constexpr uint32_t kStageCount = 8;
+    constexpr uint32_t kJobsPerStage = 256;
+    std::vector<std::unique_ptr<JobCounter>> counters;
+    std::atomic<uint32_t> finished[kStageCount] = {};
+    std::atomic<bool> isOrderBroken = false;
+    for (uint32_t stage = 0; stage < kStageCount; ++stage) {
+        JobCounter *dependency = stage > 0 ? counters.back().get() : nullptr;
+        counters.push_back(std::make_unique<JobCounter>());
+        for (uint32_t i = 0; i < kJobsPerStage; ++i) {
+            jobSystem->RunAfter(
+                dependency,
+                [&, stage]() {
+                    if (stage > 0 && finished[stage - 1].load() != kJobsPerStage) {
+                        isOrderBroken = true;
+                    }
+                    finished[stage].fetch_add(1);
+                },
+                counters.back().get());
+        }
+    }
+    // 途中の段もすべて待ってから破棄する
+    for (auto &counter : counters) {
+        jobSystem->Wait(counter.get());
+    }
+
+    CHECK(!isOrderBroken);
+    bool isAllFinished = true;
+    for (uint32_t stage = 0; stage < kStageCount; ++stage) {
+        isAllFinished = isAllFinished && finished[stage].load() == kJobsPerStage;
+    }
+    CHECK(isAllFinished);
+
+    jobSystem->Finalize();
+}
+
+// 分割の粒度を変えても全要素をちょうど1回ずつ処理する
+TEST(ParallelForCoversEveryIndexOnce) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(3);
+
+    constexpr uint32_t kCount = 1 << 16;
+    for (uint32_t grainSize : {1u, 64u, 1000u, kCount * 2}) {
+        std::vector<uint32_t> values(kCount, 0);
+        jobSystem->ParallelFor(kCount, grainSize, [&values](uint32_t rangeBegin, uint32_t rangeEnd) {
+            for (uint32_t i = rangeBegin; i < rangeEnd; ++i) {
+                values[i] += i;
+            }
+        });
+        bool isExactlyOnce = true;
+        for (uint32_t i = 0; i < kCount; ++i) {
+            isExactlyOnce = isExactlyOnce && values[i] == i;
+        }
+        CHECK(isExactlyOnce);
+    }
+
+    jobSystem->Finalize();
+}
+
+// メインスレッド指定のジョブはワーカーから積まれてもメインスレッドで実行される
+TEST(MainThreadAffinity) {
+    JobSystem *jobSystem = JobSystem::GetInstance();
+    jobSystem->Initialize(3);
+
+    constexpr uint32_t kJobCount = 100;
+    std::atomic<uint32_t> onMainThread = 0;
+    JobCounter counter;
+    jobSystem->Run(
+        [&]() {
+            for (uint32_t i = 0; i < kJobCount; ++i) {
+                jobSystem->Run(
+                    [&]() {
+                        if (jobSystem->IsMainThread()) {
+                            onMainThread.fetch_add(1);
+                        }
+                    },
+                    &counter, JobAffinity::kMainThread);
+            }
+        },
+        &counter);
+    // メインスレッドで待つと、待っている間にメインスレッド指定のジョブが実行される
+    jobSystem->Wait(&counter);
+    CHECK(onMainThread.load() == kJobCount);
+
+    jobSystem->Finalize();
+}
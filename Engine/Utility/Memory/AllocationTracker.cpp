@@ -0,0 +1,161 @@
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <mutex>
+#include <new>
+#ifdef _DEBUG
+#include "imgui.h"
+#endif // _DEBUG
+
+std::array<AllocationTracker::CategoryStats, AllocationTracker::kMaxCategories> AllocationTracker::lastFrameStats_;
+uint32_t AllocationTracker::lastFrameTotalCount_ = 0;
+
+namespace {
+// operator newから触るので、すべて定数初期化できるものだけで持つ（静的初期化の順番に依存しない）
+std::atomic<const char *> categoryNames[AllocationTracker::kMaxCategories] = {};
+std::atomic<uint32_t> categoryCount = 0;
+std::atomic<uint32_t> allocationCounts[AllocationTracker::kMaxCategories] = {};
+std::atomic<uint64_t> allocationBytes[AllocationTracker::kMaxCategories] = {};
+std::mutex registerMutex;
+
+thread_local uint32_t currentCategory = 0;
+} // namespace
+
+uint32_t AllocationTracker::RegisterCategory(const char *name) {
+    std::lock_guard<std::mutex> lock(registerMutex);
+
+    // 0番は未分類
+    if (categoryCount == 0) {
+        categoryNames[0] = "未分類";
+        categoryCount = 1;
+    }
+
+    uint32_t count = categoryCount;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (std::strcmp(categoryNames[i], name) == 0) {
+            return i;
+        }
+    }
+    // 上限を超えたら未分類に数える
+    if (count >= kMaxCategories) {
+        return 0;
+    }
+    categoryNames[count] = name;
+    categoryCount = count + 1;
+    return count;
+}
+
+void AllocationTracker::RecordAllocation(size_t size) {
+    uint32_t category = currentCategory;
+    allocationCounts[category].fetch_add(1, std::memory_order_relaxed);
+    allocationBytes[category].fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationTracker::EndFrame() {
+    uint32_t count = GetCategoryCount();
+    lastFrameTotalCount_ = 0;
+    for (uint32_t i = 0; i < kMaxCategories; ++i) {
+        CategoryStats &stats = lastFrameStats_[i];
+        stats.name = i < count ? categoryNames[i].load() : nullptr;
+        stats.count = allocationCounts[i].exchange(0, std::memory_order_relaxed);
+        stats.bytes = allocationBytes[i].exchange(0, std::memory_order_relaxed);
+        lastFrameTotalCount_ += stats.count;
+    }
+}
+
+uint32_t AllocationTracker::GetCategoryCount() {
+    return categoryCount;
+}
+
+uint32_t AllocationTracker::GetCurrentCategory() {
+    return currentCategory;
+}
+
+void AllocationTracker::SetCurrentCategory(uint32_t category) {
+    currentCategory = category;
+}
+
+void AllocationTracker::ImGui() {
+#ifdef _DEBUG
+    if (ImGui::CollapsingHeader("ヒープ確保")) {
+        ImGui::Text("合計: %u 回/フレーム", lastFrameTotalCount_);
+        if (ImGui::BeginTable("AllocationTable", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("処理");
+            ImGui::TableSetupColumn("回数");
+            ImGui::TableSetupColumn("KB");
+            ImGui::TableHeadersRow();
+            for (const CategoryStats &stats : lastFrameStats_) {
+                if (stats.name == nullptr) {
+                    continue;
+                }
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(stats.name);
+                ImGui::TableNextColumn();
+                // 確保があったものは目立たせる
+                if (stats.count > 0) {
+                    ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%u", stats.count);
+                } else {
+                    ImGui::Text("0");
+                }
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<float>(stats.bytes) / 1024.0f);
+            }
+            ImGui::EndTable();
+        }
+    }
+#endif // _DEBUG
+}
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+
+/// ===================================================
+/// グローバルなoperator newの置き換え
+/// （配列版・nothrow版・サイズ付きdeleteは標準でこれらを呼ぶ）
+/// ===================================================
+
+void *operator new(size_t size) {
+    AllocationTracker::RecordAllocation(size);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void *block = std::malloc(size)) {
+            return block;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void *block) noexcept {
+    std::free(block);
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+    AllocationTracker::RecordAllocation(size);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void *block = _aligned_malloc(size, static_cast<size_t>(alignment))) {
+            return block;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void *block, std::align_val_t) noexcept {
+    _aligned_free(block);
+}
+
+#endif // ENABLE_ALLOCATION_TRACKING
@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// デバッグビルドではグローバルなoperator newを置き換えてヒープ確保を数える
+#ifdef _DEBUG
+#define ENABLE_ALLOCATION_TRACKING
+#endif // _DEBUG
+
+/// <summary>
+/// フレームごと・処理ごとのヒープ確保の集計
+/// AllocationScopeで囲んだ範囲で行われたoperator newを、そのスレッドの現在のカテゴリに数える
+/// </summary>
+class AllocationTracker {
+  public:
+    // 登録できるカテゴリ数（0番は「未分類」）
+    static constexpr uint32_t kMaxCategories = 32;
+
+    // カテゴリ1つ分の集計
+    struct CategoryStats {
+        const char *name = nullptr;
+        uint32_t count = 0; // 確保回数
+        uint64_t bytes = 0; // 確保量
+    };
+
+    /// <summary>
+    /// カテゴリの登録（同じ名前なら同じ番号を返す。名前は文字列リテラルなど寿命の長いものを渡す）
+    /// </summary>
+    static uint32_t RegisterCategory(const char *name);
+
+    /// <summary>
+    /// 確保の記録（operator newから呼ばれる）
+    /// </summary>
+    static void RecordAllocation(size_t size);
+
+    /// <summary>
+    /// フレームの終了（集計を確定して次のフレームの集計を始める）
+    /// </summary>
+    static void EndFrame();
+
+    /// <summary>
+    /// 直前のフレームの集計
+    /// </summary>
+    static const std::array<CategoryStats, kMaxCategories> &GetLastFrameStats() { return lastFrameStats_; }
+    static uint32_t GetCategoryCount();
+    static uint32_t GetLastFrameTotalCount() { return lastFrameTotalCount_; }
+
+    /// <summary>
+    /// 集計の表示
+    /// </summary>
+    static void ImGui();
+
+    /// <summary>
+    /// 現在のスレッドのカテゴリ
+    /// </summary>
+    static uint32_t GetCurrentCategory();
+    static void SetCurrentCategory(uint32_t category);
+
+  private:
+    static std::array<CategoryStats, kMaxCategories> lastFrameStats_;
+    static uint32_t lastFrameTotalCount_;
+};
+
+/// <summary>
+/// 範囲内のヒープ確保を指定したカテゴリに数える
+/// </summary>
+class AllocationScope {
+  public:
+    explicit AllocationScope(uint32_t category) : previous_(AllocationTracker::GetCurrentCategory()) {
+        AllocationTracker::SetCurrentCategory(category);
+    }
+    ~AllocationScope() { AllocationTracker::SetCurrentCategory(previous_); }
+
+    AllocationScope(const AllocationScope &) = delete;
+    AllocationScope &operator=(const AllocationScope &) = delete;
+
+  private:
+    uint32_t previous_;
+};
+
+#define ALLOCATION_SCOPE_CONCAT_INNER(a, b) a##b
+#define ALLOCATION_SCOPE_CONCAT(a, b) ALLOCATION_SCOPE_CONCAT_INNER(a, b)
+
+// ALLOCATION_SCOPE("Particle"); のように使う（カテゴリの登録は最初の1回だけ）
+#define ALLOCATION_SCOPE(name)                                                                                        \
+    static const uint32_t ALLOCATION_SCOPE_CONCAT(allocationCategory_, __LINE__) = AllocationTracker::RegisterCategory(name); \
+    AllocationScope ALLOCATION_SCOPE_CONCAT(allocationScope_, __LINE__)(ALLOCATION_SCOPE_CONCAT(allocationCategory_, __LINE__))
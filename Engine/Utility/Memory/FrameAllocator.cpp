@@ -0,0 +1,74 @@
+#include "FrameAllocator.h"
+#include <algorithm>
+#include <new>
+
+FrameAllocator *FrameAllocator::instance = nullptr;
+
+FrameAllocator *FrameAllocator::GetInstance() {
+    if (instance == nullptr) {
+        instance = new FrameAllocator();
+    }
+    return instance;
+}
+
+void FrameAllocator::Initialize(size_t capacity) {
+    capacity_ = capacity;
+    for (Arena &arena : arenas_) {
+        arena.buffer = std::make_unique<std::byte[]>(capacity);
+        arena.offset = 0;
+    }
+    current_ = 0;
+}
+
+void FrameAllocator::Finalize() {
+    for (Arena &arena : arenas_) {
+        Reset(arena);
+    }
+    delete instance;
+    instance = nullptr;
+}
+
+void FrameAllocator::BeginFrame() {
+    // 終わったフレームの使用量を記録
+    Arena &finished = arenas_[current_];
+    lastFrameUsedBytes_ = (std::min)(finished.offset.load(), capacity_);
+    lastFrameOverflowBytes_ = finished.overflowBytes;
+    peakUsedBytes_ = (std::max)(peakUsedBytes_, lastFrameUsedBytes_ + lastFrameOverflowBytes_);
+
+    // もう一方の面は2フレーム前のものなので空にして使う
+    uint32_t next = current_ ^ 1u;
+    Reset(arenas_[next]);
+    current_ = next;
+}
+
+void *FrameAllocator::Allocate(size_t size, size_t alignment) {
+    Arena &arena = arenas_[current_];
+
+    // 位置を進めてから揃えるので、ロックせずに複数スレッドから確保できる
+    if (arena.buffer) {
+        size_t reserved = size + alignment - 1;
+        size_t offset = arena.offset.fetch_add(reserved, std::memory_order_relaxed);
+        if (offset + reserved <= capacity_) {
+            uintptr_t address = reinterpret_cast<uintptr_t>(arena.buffer.get()) + offset;
+            address = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            return reinterpret_cast<void *>(address);
+        }
+    }
+
+    // 容量を超えた分はヒープから確保し、この面を空にするときに解放する
+    void *block = ::operator new(size, std::align_val_t(alignment));
+    std::lock_guard<std::mutex> lock(arena.overflowMutex);
+    arena.overflowBlocks.emplace_back(block, alignment);
+    arena.overflowBytes += size;
+    return block;
+}
+
+void FrameAllocator::Reset(Arena &arena) {
+    std::lock_guard<std::mutex> lock(arena.overflowMutex);
+    for (auto &[block, alignment] : arena.overflowBlocks) {
+        ::operator delete(block, std::align_val_t(alignment));
+    }
+    arena.overflowBlocks.clear();
+    arena.overflowBytes = 0;
+    arena.offset = 0;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// フレーム単位の線形アロケータ（2面のバッファを交互に使う）
+/// 確保は先頭から詰めるだけで、解放はFrame::Updateでまとめて行う。
+/// 確保したメモリは次のフレームの終わりまで有効（GPUへの転送待ちなど1フレーム跨ぐ用途にも使える）
+/// </summary>
+class FrameAllocator {
+  private:
+    static FrameAllocator *instance;
+
+    FrameAllocator() = default;
+    ~FrameAllocator() = default;
+    FrameAllocator(FrameAllocator &) = delete;
+    FrameAllocator &operator=(FrameAllocator &) = delete;
+
+  public:
+    // 1面あたりの容量（超えた分はヒープから確保するので、普段の使用量に合わせる）
+    static constexpr size_t kDefaultCapacity = 1024 * 1024;
+
+    /// <summary>
+    /// シングルトンインスタンスの取得
+    /// </summary>
+    static FrameAllocator *GetInstance();
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    /// <param name="capacity">1面あたりの容量(byte)</param>
+    void Initialize(size_t capacity = kDefaultCapacity);
+
+    /// <summary>
+    /// 終了
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// フレームの開始（2フレーム前に使った面を空にして切り替える）
+    /// </summary>
+    void BeginFrame();
+
+    /// <summary>
+    /// 確保（スレッドセーフ。容量を超えた分はヒープから確保し、面を空にするときに解放する）
+    /// </summary>
+    void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// <summary>
+    /// getter
+    /// </summary>
+    size_t GetCapacity() const { return capacity_; }
+    // 直前のフレームで使った量
+    size_t GetLastFrameUsedBytes() const { return lastFrameUsedBytes_; }
+    // 直前のフレームで容量を超えてヒープから確保した量
+    size_t GetLastFrameOverflowBytes() const { return lastFrameOverflowBytes_; }
+    // これまでの最大使用量
+    size_t GetPeakUsedBytes() const { return peakUsedBytes_; }
+
+  private:
+    // 1面分
+    struct Arena {
+        std::unique_ptr<std::byte[]> buffer;
+        std::atomic<size_t> offset = 0;
+        // 容量を超えたときにヒープから確保したもの
+        std::mutex overflowMutex;
+        std::vector<std::pair<void *, size_t>> overflowBlocks; // 確保したメモリと揃え
+        size_t overflowBytes = 0;
+    };
+
+    /// <summary>
+    /// 面を空にする
+    /// </summary>
+    void Reset(Arena &arena);
+
+  private:
+    Arena arenas_[2];
+    std::atomic<uint32_t> current_ = 0;
+    size_t capacity_ = 0;
+
+    size_t lastFrameUsedBytes_ = 0;
+    size_t lastFrameOverflowBytes_ = 0;
+    size_t peakUsedBytes_ = 0;
+};
+
+/// <summary>
+/// FrameAllocatorから確保するSTL用のアロケータ
+/// 解放は何もしないので、コンテナはフレームを跨いで保持しないこと
+/// </summary>
+template <typename T>
+class FrameArenaAllocator {
+  public:
+    using value_type = T;
+
+    FrameArenaAllocator() noexcept = default;
+    template <typename U>
+    FrameArenaAllocator(const FrameArenaAllocator<U> &) noexcept {}
+
+    T *allocate(size_t count) {
+        return static_cast<T *>(FrameAllocator::GetInstance()->Allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const FrameArenaAllocator<U> &) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const FrameArenaAllocator<U> &) const noexcept { return false; }
+};
+
+// フレーム内だけで使う一時コンテナ
+template <typename T>
+using FrameVector = std::vector<T, FrameArenaAllocator<T>>;
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameArenaAllocator<char>>;
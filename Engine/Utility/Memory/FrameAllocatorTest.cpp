@@ -0,0 +1,147 @@
+#include "Memory/FrameAllocator.h"
+#include "Test/Test.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+const size_t kCapacity = 1024;
+
+bool IsAligned(const void *pointer, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+} // namespace
+
+// 指定した揃えで確保され、同じフレーム内の確保同士は重ならない
+TEST(AllocatesAligned) {
+    FrameAllocator *frameAllocator = FrameAllocator::GetInstance();
+    frameAllocator->Initialize(kCapacity);
+
+    const size_t alignments[] = {1, 4, 16, 64, 256};
+    std::vector<std::pair<std::byte *, size_t>> blocks;
+    for (size_t alignment : alignments) {
+        void *block = frameAllocator->Allocate(3, alignment);
+        CHECK(IsAligned(block, alignment));
+        blocks.emplace_back(static_cast<std::byte *>(block), 3);
+    }
+    std::sort(blocks.begin(), blocks.end());
+    for (size_t i = 1; i < blocks.size(); ++i) {
+        CHECK(blocks[i - 1].first + blocks[i - 1].second <= blocks[i].first);
+    }
+
+    frameAllocator->BeginFrame();
+    CHECK(frameAllocator->GetLastFrameUsedBytes() > 0);
+    CHECK(frameAllocator->GetLastFrameOverflowBytes() == 0);
+
+    frameAllocator->Finalize();
+}
+
+// 容量を超えた分はヒープから確保し、その面を空にしたときに解放する
+TEST(OverflowsToHeapUntilReset) {
+    FrameAllocator *frameAllocator = FrameAllocator::GetInstance();
+    frameAllocator->Initialize(kCapacity);
+
+    void *block = frameAllocator->Allocate(kCapacity * 2, 64);
+    CHECK(IsAligned(block, 64));
+    std::memset(block, 0xAB, kCapacity * 2);
+
+    frameAllocator->BeginFrame();
+    CHECK(frameAllocator->GetLastFrameOverflowBytes() == kCapacity * 2);
+
+    // もう一方の面では溢れていない
+    frameAllocator->BeginFrame();
+    CHECK(frameAllocator->GetLastFrameOverflowBytes() == 0);
+
+    // 最初の面に戻ると溢れた分は解放済み
+    frameAllocator->BeginFrame();
+    CHECK(frameAllocator->GetLastFrameOverflowBytes() == 0);
+    CHECK(frameAllocator->GetPeakUsedBytes() >= kCapacity * 2);
+
+    frameAllocator->Finalize();
+}
+
+// 確保したメモリは次のフレームの終わりまで残り、その次のフレームで同じ場所を使い直す
+TEST(TwoFrameLifetime) {
+    FrameAllocator *frameAllocator = FrameAllocator::GetInstance();
+    frameAllocator->Initialize(kCapacity);
+
+    uint32_t *first = static_cast<uint32_t *>(frameAllocator->Allocate(sizeof(uint32_t) * 16, alignof(uint32_t)));
+    for (uint32_t i = 0; i < 16; ++i) {
+        first[i] = i * 7u;
+    }
+
+    // 次のフレームでは別の面から確保されるので、前のフレームのデータは壊れない
+    frameAllocator->BeginFrame();
+    uint32_t *second = static_cast<uint32_t *>(frameAllocator->Allocate(sizeof(uint32_t) * 16, alignof(uint32_t)));
+    std::memset(second, 0xFF, sizeof(uint32_t) * 16);
+    CHECK(second != first);
+    bool isKept = true;
+    for (uint32_t i = 0; i < 16; ++i) {
+        isKept = isKept && first[i] == i * 7u;
+    }
+    CHECK(isKept);
+
+    // 2フレーム後には最初の面が空になり、先頭から使い直す
+    frameAllocator->BeginFrame();
+    uint32_t *third = static_cast<uint32_t *>(frameAllocator->Allocate(sizeof(uint32_t) * 16, alignof(uint32_t)));
+    CHECK(third == first);
+
+    frameAllocator->Finalize();
+}
+
+// 複数のスレッドから同時に確保しても重ならない
+TEST(ConcurrentAllocations) {
+    FrameAllocator *frameAllocator = FrameAllocator::GetInstance();
+    frameAllocator->Initialize(kCapacity * 64);
+
+    const int kThreadCount = 4;
+    const int kBlockCount = 256;
+    std::vector<std::vector<std::byte *>> blocks(kThreadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&blocks, t, frameAllocator]() {
+            for (int i = 0; i < kBlockCount; ++i) {
+                std::byte *block = static_cast<std::byte *>(frameAllocator->Allocate(16, 16));
+                std::memset(block, t, 16);
+                blocks[t].push_back(block);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<std::byte *> all;
+    bool isIntact = true;
+    for (int t = 0; t < kThreadCount; ++t) {
+        for (std::byte *block : blocks[t]) {
+            isIntact = isIntact && block[0] == static_cast<std::byte>(t) && block[15] == static_cast<std::byte>(t);
+            all.push_back(block);
+        }
+    }
+    CHECK(isIntact);
+    std::sort(all.begin(), all.end());
+    CHECK(std::adjacent_find(all.begin(), all.end(), [](std::byte *a, std::byte *b) { return a + 16 > b; }) == all.end());
+
+    frameAllocator->Finalize();
+}
+
+// FrameVectorはフレームアロケータから確保する
+TEST(FrameVectorUsesArena) {
+    FrameAllocator *frameAllocator = FrameAllocator::GetInstance();
+    frameAllocator->Initialize(kCapacity);
+
+    FrameVector<int> values;
+    for (int i = 0; i < 32; ++i) {
+        values.push_back(i);
+    }
+    CHECK(values.size() == 32 && values[31] == 31);
+
+    frameAllocator->BeginFrame();
+    CHECK(frameAllocator->GetLastFrameUsedBytes() >= sizeof(int) * 32);
+    CHECK(frameAllocator->GetLastFrameOverflowBytes() == 0);
+
+    frameAllocator->Finalize();
+}
@@ -1,4 +1,5 @@
 #include "SceneManager.h"
+#include "Particle/ParticleSystem.h"
 #include <cassert>
 
 SceneManager *SceneManager::instance = nullptr;
@@ -103,6 +104,8 @@ void SceneManager::SceneChange() {
             scene_->Finalize();
             delete scene_;
             BaseObjectManager::GetInstance()->RemoveAllObjects();
+            // 旧シーンのエミッターが出したパーティクルを残さない
+            ParticleSystem::GetInstance()->Clear();
         }
         // シーンの切り替え
         scene_ = nextScene_;
@@ -1,6 +1,6 @@
 #include "SceneTransition.h"
 #include "Easing.h"
-#include "SpriteCommon.h"
+#include "SpriteBatch.h"
 #include "algorithm"
 #include "Engine/Frame/Frame.h"
 #include <vector>
@@ -50,12 +50,14 @@ void SceneTransition::Update() {
 }
 
 void SceneTransition::Draw() {
-    // 各スプライトを描画
+    // 各スプライトを描画（同じテクスチャなのでまとめて1回で描く）
+    SpriteBatch::GetInstance()->Begin();
     for (const auto &row : transition_) {
         for (const auto &sprite : row) {
             sprite->Draw();
         }
     }
+    SpriteBatch::GetInstance()->End();
 }
 
 void SceneTransition::Debug() {
@@ -0,0 +1,219 @@
+#include "DirectoryIndex.h"
+#include <algorithm>
+#include <cctype>
+
+namespace fs = std::filesystem;
+
+DirectoryIndex *DirectoryIndex::instance = nullptr;
+
+DirectoryIndex *DirectoryIndex::GetInstance() {
+    if (instance == nullptr) {
+        instance = new DirectoryIndex();
+    }
+    return instance;
+}
+
+void DirectoryIndex::Finalize() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isExit_ = true;
+    }
+    condition_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    delete instance;
+    instance = nullptr;
+}
+
+std::shared_ptr<const DirectoryListing> DirectoryIndex::GetListing(const fs::path &directory) {
+    std::string key = MakeKey(directory);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = directories_.find(key);
+    if (it != directories_.end()) {
+        return it->second.listing;
+    }
+
+    // 作成をバックグラウンドに依頼
+    if (std::find(requests_.begin(), requests_.end(), key) == requests_.end()) {
+        requests_.push_back(key);
+        StartWorker();
+        condition_.notify_one();
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const DirectoryListing> DirectoryIndex::GetListingSync(const fs::path &directory) {
+    std::string key = MakeKey(directory);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = directories_.find(key);
+        if (it != directories_.end()) {
+            return it->second.listing;
+        }
+    }
+
+    CachedDirectory built;
+    std::shared_ptr<DirectoryListing> listing = BuildListing(key, built);
+    built.listing = listing;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    directories_[key] = std::move(built);
+    // 以降の変更はワーカーが監視する
+    StartWorker();
+    return listing;
+}
+
+bool DirectoryIndex::FuzzyMatch(const std::string &lowerName, const std::string &lowerQuery) {
+    size_t nameIndex = 0;
+    for (char c : lowerQuery) {
+        if (c == ' ') {
+            continue;
+        }
+        nameIndex = lowerName.find(c, nameIndex);
+        if (nameIndex == std::string::npos) {
+            return false;
+        }
+        ++nameIndex;
+    }
+    return true;
+}
+
+std::string DirectoryIndex::ToLower(const std::string &text) {
+    std::string result = text;
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return result;
+}
+
+std::string DirectoryIndex::MakeKey(const fs::path &directory) {
+    std::string key = directory.lexically_normal().generic_string();
+    while (key.size() > 1 && key.back() == '/') {
+        key.pop_back();
+    }
+    return key;
+}
+
+std::shared_ptr<DirectoryListing> DirectoryIndex::BuildListing(const std::string &key, CachedDirectory &cached) {
+    auto listing = std::make_shared<DirectoryListing>();
+
+    // 存在しないディレクトリは空の一覧にして、存在するようになるまで作り直さない
+    std::error_code ec;
+    cached.writeTime = fs::last_write_time(key, ec);
+    cached.exists = !ec;
+
+    for (fs::directory_iterator it(key, ec), end; !ec && it != end; it.increment(ec)) {
+        DirectoryEntry entry;
+        entry.name = it->path().filename().string();
+        entry.lowerName = ToLower(entry.name);
+
+        std::error_code typeError;
+        if (it->is_directory(typeError)) {
+            listing->folders.push_back(std::move(entry));
+        } else {
+            entry.extension = ToLower(it->path().extension().string());
+            listing->files.push_back(std::move(entry));
+        }
+    }
+
+    // アルファベット順にソート
+    auto byName = [](const DirectoryEntry &a, const DirectoryEntry &b) { return a.name < b.name; };
+    std::sort(listing->folders.begin(), listing->folders.end(), byName);
+    std::sort(listing->files.begin(), listing->files.end(), byName);
+
+    listing->version = ++generation_;
+    return listing;
+}
+
+void DirectoryIndex::StartWorker() {
+    // mutex_ を取得した状態で呼ぶこと
+    if (!worker_.joinable() && !isExit_) {
+        worker_ = std::thread(&DirectoryIndex::WorkerMain, this);
+    }
+}
+
+void DirectoryIndex::WorkerMain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto nextPollTime = std::chrono::steady_clock::now() + kPollInterval;
+
+    while (!isExit_) {
+        condition_.wait_until(lock, nextPollTime, [this]() { return isExit_ || !requests_.empty(); });
+        if (isExit_) {
+            break;
+        }
+
+        // 依頼されたディレクトリと、一定間隔ごとに全ディレクトリの更新時刻を確認する
+        std::vector<PollTarget> targets;
+        for (std::string &key : requests_) {
+            targets.push_back({std::move(key), true, fs::file_time_type{}, false});
+        }
+        requests_.clear();
+
+        bool isPollTime = std::chrono::steady_clock::now() >= nextPollTime;
+        if (isPollTime) {
+            for (const auto &[key, cached] : directories_) {
+                targets.push_back({key, false, cached.writeTime, cached.exists});
+            }
+            nextPollTime = std::chrono::steady_clock::now() + kPollInterval;
+        }
+
+        lock.unlock();
+
+        std::vector<std::pair<std::string, CachedDirectory>> results;
+        for (const PollTarget &target : targets) {
+            if (!target.isRequested) {
+                std::error_code ec;
+                fs::file_time_type writeTime = fs::last_write_time(target.key, ec);
+                bool exists = !ec;
+                // 存在するかどうかが変わらず、存在するなら更新時刻も同じものは作り直さない
+                if (exists == target.exists && (!exists || writeTime == target.writeTime)) {
+                    continue;
+                }
+            }
+            CachedDirectory cached;
+            cached.listing = BuildListing(target.key, cached);
+            results.emplace_back(target.key, std::move(cached));
+        }
+
+        lock.lock();
+        for (auto &[key, cached] : results) {
+            directories_[key] = std::move(cached);
+        }
+    }
+}
+
+bool DirectoryQuery::Update(const fs::path &directory, const std::string &searchText) {
+    std::string directoryKey = directory.generic_string();
+    std::shared_ptr<const DirectoryListing> listing = DirectoryIndex::GetInstance()->GetListing(directory);
+
+    if (listing == listing_ && directoryKey == directory_ && searchText == searchText_) {
+        return false;
+    }
+    directory_ = directoryKey;
+    searchText_ = searchText;
+    listing_ = listing;
+
+    folders_.clear();
+    files_.clear();
+    fileCount_ = 0;
+    if (!listing_) {
+        return true;
+    }
+
+    std::string lowerQuery = DirectoryIndex::ToLower(searchText_);
+    for (const DirectoryEntry &folder : listing_->folders) {
+        if (DirectoryIndex::FuzzyMatch(folder.lowerName, lowerQuery)) {
+            folders_.push_back(&folder);
+        }
+    }
+    for (const DirectoryEntry &file : listing_->files) {
+        if (!extensions_.empty() && std::find(extensions_.begin(), extensions_.end(), file.extension) == extensions_.end()) {
+            continue;
+        }
+        ++fileCount_;
+        if (DirectoryIndex::FuzzyMatch(file.lowerName, lowerQuery)) {
+            files_.push_back(&file);
+        }
+    }
+    return true;
+}
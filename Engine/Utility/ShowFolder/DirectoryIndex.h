@@ -0,0 +1,145 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// ディレクトリ内の1項目
+/// </summary>
+struct DirectoryEntry {
+    std::string name;      // 表示用のファイル名
+    std::string lowerName; // 検索用の小文字ファイル名
+    std::string extension; // 小文字の拡張子（".png"など）
+};
+
+/// <summary>
+/// ディレクトリ1つ分の一覧（名前順にソート済み）
+/// </summary>
+struct DirectoryListing {
+    std::vector<DirectoryEntry> folders;
+    std::vector<DirectoryEntry> files;
+    uint64_t version = 0; // 作り直すたびに増える
+};
+
+/// <summary>
+/// アセットブラウザ用のディレクトリ一覧キャッシュ
+/// 一覧の作成と変更の検出はバックグラウンドスレッドで行う
+/// </summary>
+class DirectoryIndex {
+  private:
+    static DirectoryIndex *instance;
+
+    DirectoryIndex() = default;
+    ~DirectoryIndex() = default;
+    DirectoryIndex(DirectoryIndex &) = delete;
+    DirectoryIndex &operator=(DirectoryIndex &) = delete;
+
+  public:
+    /// <summary>
+    /// シングルトンインスタンスの取得
+    /// </summary>
+    static DirectoryIndex *GetInstance();
+
+    /// <summary>
+    /// 終了（スレッドを止める）
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 一覧の取得（未作成ならバックグラウンドで作成を依頼してnullptrを返す）
+    /// </summary>
+    std::shared_ptr<const DirectoryListing> GetListing(const std::filesystem::path &directory);
+
+    /// <summary>
+    /// 一覧の取得（未作成ならその場で作成する）
+    /// </summary>
+    std::shared_ptr<const DirectoryListing> GetListingSync(const std::filesystem::path &directory);
+
+    /// <summary>
+    /// いずれかの一覧が作り直されるたびに増える値（変更通知用）
+    /// </summary>
+    uint64_t GetGeneration() const { return generation_; }
+
+    /// <summary>
+    /// 小文字の名前に検索文字列の各文字が順番に含まれているか
+    /// </summary>
+    static bool FuzzyMatch(const std::string &lowerName, const std::string &lowerQuery);
+
+    static std::string ToLower(const std::string &text);
+
+  private:
+    // キャッシュ中のディレクトリ
+    struct CachedDirectory {
+        std::shared_ptr<const DirectoryListing> listing;
+        std::filesystem::file_time_type writeTime; // 一覧作成時のディレクトリ更新時刻
+        bool exists = false;                       // 一覧作成時にディレクトリが存在したか
+    };
+
+    // ワーカーが更新を確認するディレクトリ
+    struct PollTarget {
+        std::string key;
+        bool isRequested = false; // 一覧の作成を依頼されたか（falseなら変更があったときだけ作り直す）
+        std::filesystem::file_time_type writeTime;
+        bool exists = false;
+    };
+
+    static std::string MakeKey(const std::filesystem::path &directory);
+    std::shared_ptr<DirectoryListing> BuildListing(const std::string &key, CachedDirectory &cached);
+    void StartWorker();
+    void WorkerMain();
+
+  private:
+    // ディレクトリの変更を調べる間隔
+    static constexpr std::chrono::milliseconds kPollInterval{1000};
+
+    std::unordered_map<std::string, CachedDirectory> directories_;
+    std::vector<std::string> requests_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::thread worker_;
+    bool isExit_ = false;
+
+    std::atomic<uint64_t> generation_ = 0;
+};
+
+/// <summary>
+/// ブラウザ1つ分の検索結果
+/// ディレクトリ・検索文字列・一覧のいずれかが変わったときだけ作り直すので、毎フレームの描画は結果の件数分で済む
+/// </summary>
+class DirectoryQuery {
+  public:
+    explicit DirectoryQuery(std::vector<std::string> extensions) : extensions_(std::move(extensions)) {}
+
+    /// <summary>
+    /// 条件を更新
+    /// </summary>
+    /// <returns>結果が作り直されたか</returns>
+    bool Update(const std::filesystem::path &directory, const std::string &searchText);
+
+    const std::vector<const DirectoryEntry *> &GetFolders() const { return folders_; }
+    const std::vector<const DirectoryEntry *> &GetFiles() const { return files_; }
+    // 検索前の対象拡張子のファイル数
+    size_t GetFileCount() const { return fileCount_; }
+    // 一覧の作成待ちか
+    bool IsLoading() const { return !listing_; }
+
+  private:
+    std::vector<std::string> extensions_;
+
+    std::string directory_;
+    std::string searchText_;
+    std::shared_ptr<const DirectoryListing> listing_;
+
+    std::vector<const DirectoryEntry *> folders_;
+    std::vector<const DirectoryEntry *> files_;
+    size_t fileCount_ = 0;
+};
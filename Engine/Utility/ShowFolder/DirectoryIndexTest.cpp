@@ -0,0 +1,100 @@
+#include "ShowFolder/DirectoryIndex.h"
+#include "Test/Test.h"
+#include <algorithm>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const fs::path kRoot = "DirectoryIndexTestData";
+
+void WriteFile(const fs::path &filePath, const std::string &text) {
+    std::ofstream file(filePath);
+    file << text;
+}
+
+// キャッシュした更新時刻と確実に違う時刻にする（ファイルシステムの時刻の細かさに依存しない）
+void TouchLater(const fs::path &path) {
+    fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(2));
+}
+
+bool HasFile(const DirectoryListing &listing, const std::string &name) {
+    return std::any_of(listing.files.begin(), listing.files.end(), [&name](const DirectoryEntry &entry) { return entry.name == name; });
+}
+
+// ワーカーが一覧を作り直すまで待つ（監視の間隔は1秒）
+std::shared_ptr<const DirectoryListing> WaitForRebuild(const fs::path &directory, const std::shared_ptr<const DirectoryListing> &previous) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::shared_ptr<const DirectoryListing> listing = DirectoryIndex::GetInstance()->GetListing(directory);
+        if (listing && listing != previous) {
+            return listing;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    return previous;
+}
+
+} // namespace
+
+// 一覧は名前順で、フォルダとファイルに分かれ、拡張子は小文字になる
+TEST(BuildsSortedListing) {
+    fs::remove_all(kRoot);
+    fs::create_directories(kRoot / "sub");
+    WriteFile(kRoot / "b.PNG", "b");
+    WriteFile(kRoot / "a.json", "a");
+
+    std::shared_ptr<const DirectoryListing> listing = DirectoryIndex::GetInstance()->GetListingSync(kRoot);
+    CHECK(listing->folders.size() == 1 && listing->folders[0].name == "sub");
+    CHECK(listing->files.size() == 2);
+    CHECK(listing->files[0].name == "a.json" && listing->files[1].name == "b.PNG");
+    CHECK(listing->files[1].extension == ".png" && listing->files[1].lowerName == "b.png");
+
+    DirectoryIndex::GetInstance()->Finalize();
+    fs::remove_all(kRoot);
+}
+
+// 作成・削除があったディレクトリだけ作り直し、中身だけの変更や他のディレクトリの一覧はそのまま使う
+TEST(RescansOnlyChangedDirectories) {
+    fs::remove_all(kRoot);
+    const fs::path changed = kRoot / "changed";
+    const fs::path unchanged = kRoot / "unchanged";
+    fs::create_directories(changed);
+    fs::create_directories(unchanged);
+    WriteFile(changed / "keep.txt", "keep");
+    WriteFile(unchanged / "edit.txt", "before");
+
+    DirectoryIndex *directoryIndex = DirectoryIndex::GetInstance();
+    std::shared_ptr<const DirectoryListing> changedListing = directoryIndex->GetListingSync(changed);
+    std::shared_ptr<const DirectoryListing> unchangedListing = directoryIndex->GetListingSync(unchanged);
+
+    // 作成
+    WriteFile(unchanged / "edit.txt", "after");
+    WriteFile(changed / "added.txt", "added");
+    TouchLater(changed);
+    std::shared_ptr<const DirectoryListing> added = WaitForRebuild(changed, changedListing);
+    CHECK(added != changedListing);
+    CHECK(HasFile(*added, "added.txt") && HasFile(*added, "keep.txt"));
+    CHECK(added->version > changedListing->version);
+    // 中身を書き換えただけのディレクトリは作り直さない
+    CHECK(directoryIndex->GetListing(unchanged) == unchangedListing);
+
+    // 削除
+    fs::remove(changed / "added.txt");
+    TouchLater(changed);
+    std::shared_ptr<const DirectoryListing> removed = WaitForRebuild(changed, added);
+    CHECK(removed != added);
+    CHECK(!HasFile(*removed, "added.txt") && HasFile(*removed, "keep.txt"));
+    CHECK(directoryIndex->GetListing(unchanged) == unchangedListing);
+
+    directoryIndex->Finalize();
+    fs::remove_all(kRoot);
+}
+
+// 検索文字列の各文字が順番に含まれていれば一致する
+TEST(FuzzyMatch) {
+    CHECK(DirectoryIndex::FuzzyMatch("player_idle.png", "pidl"));
+    CHECK(DirectoryIndex::FuzzyMatch("player_idle.png", "p i"));
+    CHECK(!DirectoryIndex::FuzzyMatch("player_idle.png", "ldi"));
+}
@@ -1,5 +1,6 @@
 #ifdef _DEBUG
 #include "ShowFolder.h"
+#include "DirectoryIndex.h"
 #include <algorithm>
 #include <externals/icon/IconsFontAwesome5.h>
 #include <filesystem>
@@ -77,29 +78,19 @@ void ShowTextureFile(std::string &selectedTexturePath) {
 
     ImGui::Spacing();
 
-    // ディレクトリの読み取り
-    std::vector<std::string> foldersTex;
-    std::vector<std::string> texFiles;
-
-    try {
-        for (const auto &entry : std::filesystem::directory_iterator(currentDirTex)) {
-            if (entry.is_directory()) {
-                foldersTex.push_back(entry.path().filename().string());
-            } else if (entry.path().extension() == ".png" || entry.path().extension() == ".jpg") {
-                texFiles.push_back(entry.path().filename().string());
-            }
-        }
-
-        // アルファベット順にソート
-        std::sort(foldersTex.begin(), foldersTex.end());
-        std::sort(texFiles.begin(), texFiles.end());
-    } catch (std::exception &e) {
-        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "エラー: %s", e.what());
-    }
+    // ディレクトリ一覧はキャッシュから取得（条件が変わったときだけ絞り込みをやり直す）
+    static DirectoryQuery query({".png", ".jpg"});
+    query.Update(currentDirTex, filter.InputBuf);
+    const std::vector<const DirectoryEntry *> &foldersTex = query.GetFolders();
+    const std::vector<const DirectoryEntry *> &texFiles = query.GetFiles();
 
     // フォルダとファイルのコンテナ
     ImGui::BeginChild("FileBrowser", ImVec2(0, ImGui::GetContentRegionAvail().y - ImGui::GetFrameHeightWithSpacing()), true, ImGuiWindowFlags_AlwaysVerticalScrollbar);
 
+    if (query.IsLoading()) {
+        ImGui::TextDisabled("読み込み中...");
+    }
+
     // フォルダ表示セクション
     if (!foldersTex.empty()) {
         ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.3f, 0.3f, 0.7f, 0.5f));
@@ -110,32 +101,31 @@ void ShowTextureFile(std::string &selectedTexturePath) {
             ImGui::Indent(10.0f);
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(style.ItemSpacing.x, 8.0f));
 
-            for (auto &folder : foldersTex) {
-                if (filter.PassFilter(folder.c_str())) {
-                    // フォルダアイコンを表示
-                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.9f, 0.4f, 1.0f));
-                    ImGui::Text(ICON_FA_FOLDER); // FontAwesomeアイコンを使用（要設定）
-                    ImGui::PopStyleColor();
+            for (const DirectoryEntry *entry : foldersTex) {
+                const std::string &folder = entry->name;
+                // フォルダアイコンを表示
+                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.9f, 0.4f, 1.0f));
+                ImGui::Text(ICON_FA_FOLDER); // FontAwesomeアイコンを使用（要設定）
+                ImGui::PopStyleColor();
 
-                    ImGui::SameLine();
-                    if (ImGui::Selectable(folder.c_str(), selectedFolderTex == folder,
-                                          ImGuiSelectableFlags_AllowDoubleClick)) {
-                        if (ImGui::IsMouseDoubleClicked(0)) {
-                            selectedFolderTex = folder;
-                            currentDirTex = currentDirTex / folder; // フォルダ移動
-                            selectedFileTex = "";                   // 新しいフォルダを開いたらファイル選択をリセット
-                        }
+                ImGui::SameLine();
+                if (ImGui::Selectable(folder.c_str(), selectedFolderTex == folder,
+                                      ImGuiSelectableFlags_AllowDoubleClick)) {
+                    if (ImGui::IsMouseDoubleClicked(0)) {
+                        selectedFolderTex = folder;
+                        currentDirTex = currentDirTex / folder; // フォルダ移動
+                        selectedFileTex = "";                   // 新しいフォルダを開いたらファイル選択をリセット
                     }
+                }
 
-                    // ドラッグ＆ドロップまたはコンテキストメニューの処理
-                    if (ImGui::BeginPopupContextItem(folder.c_str())) {
-                        if (ImGui::MenuItem("開く")) {
-                            selectedFolderTex = folder;
-                            currentDirTex = currentDirTex / folder;
-                            selectedFileTex = "";
-                        }
-                        ImGui::EndPopup();
+                // ドラッグ＆ドロップまたはコンテキストメニューの処理
+                if (ImGui::BeginPopupContextItem(folder.c_str())) {
+                    if (ImGui::MenuItem("開く")) {
+                        selectedFolderTex = folder;
+                        currentDirTex = currentDirTex / folder;
+                        selectedFileTex = "";
                     }
+                    ImGui::EndPopup();
                 }
             }
 
@@ -165,34 +155,32 @@ void ShowTextureFile(std::string &selectedTexturePath) {
                 ImGui::NextColumn();
                 ImGui::Separator();
 
-                for (const auto &file : texFiles) {
-                    if (filter.PassFilter(file.c_str())) {
-                        std::filesystem::path filePath(file);
-                        std::string extension = filePath.extension().string();
-
-                        // ファイルアイコンを表示
-                        ImGui::PushStyleColor(ImGuiCol_Text,
-                                              extension == ".png" ? ImVec4(0.4f, 0.8f, 1.0f, 1.0f) : ImVec4(1.0f, 0.6f, 0.4f, 1.0f));
-                        ImGui::Text(ICON_FA_FILE_IMAGE); // FontAwesomeアイコンを使用（要設定）
-                        ImGui::PopStyleColor();
-
-                        ImGui::SameLine();
-                        bool isSelected = (file == selectedFileTex);
-                        if (ImGui::Selectable(file.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
-                            selectedFileTex = file;
-                            // `baseDirTex` からの相対パスを取得
-                            std::filesystem::path relativePath = (currentDirTex / file).lexically_relative(baseDirTex);
-                            // Windowsのバックスラッシュをスラッシュに変換
-                            std::string pathStr = relativePath.string();
-                            std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
-                            // 選択されたテクスチャパスを設定
-                            selectedTexturePath = pathStr;
-                        }
-
-                        ImGui::NextColumn();
-                        ImGui::Text("%s", extension.c_str());
-                        ImGui::NextColumn();
+                for (const DirectoryEntry *entry : texFiles) {
+                    const std::string &file = entry->name;
+                    const std::string &extension = entry->extension;
+
+                    // ファイルアイコンを表示
+                    ImGui::PushStyleColor(ImGuiCol_Text,
+                                          extension == ".png" ? ImVec4(0.4f, 0.8f, 1.0f, 1.0f) : ImVec4(1.0f, 0.6f, 0.4f, 1.0f));
+                    ImGui::Text(ICON_FA_FILE_IMAGE); // FontAwesomeアイコンを使用（要設定）
+                    ImGui::PopStyleColor();
+
+                    ImGui::SameLine();
+                    bool isSelected = (file == selectedFileTex);
+                    if (ImGui::Selectable(file.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
+                        selectedFileTex = file;
+                        // `baseDirTex` からの相対パスを取得
+                        std::filesystem::path relativePath = (currentDirTex / file).lexically_relative(baseDirTex);
+                        // Windowsのバックスラッシュをスラッシュに変換
+                        std::string pathStr = relativePath.string();
+                        std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
+                        // 選択されたテクスチャパスを設定
+                        selectedTexturePath = pathStr;
                     }
+
+                    ImGui::NextColumn();
+                    ImGui::Text("%s", extension.c_str());
+                    ImGui::NextColumn();
                 }
 
                 ImGui::Columns(1);
@@ -206,36 +194,35 @@ void ShowTextureFile(std::string &selectedTexturePath) {
 
                 ImGui::Columns(numColumns, "ファイルグリッド", false);
 
-                for (const auto &file : texFiles) {
-                    if (filter.PassFilter(file.c_str())) {
-                        bool isSelected = (file == selectedFileTex);
-                        ImGui::PushStyleColor(ImGuiCol_Button, isSelected ? ImVec4(0.5f, 0.5f, 0.7f, 0.7f) : ImVec4(0.3f, 0.3f, 0.3f, 0.0f));
-
-                        ImGui::PushID(file.c_str());
-                        if (ImGui::Button("", ImVec2(cellSize - 10, cellSize - 10))) {
-                            selectedFileTex = file;
-                            // `baseDirTex` からの相対パスを取得
-                            std::filesystem::path relativePath = (currentDirTex / file).lexically_relative(baseDirTex);
-                            // Windowsのバックスラッシュをスラッシュに変換
-                            std::string pathStr = relativePath.string();
-                            std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
-                            // 選択されたテクスチャパスを設定
-                            selectedTexturePath = pathStr;
-                        }
-                        ImGui::PopID();
-
-                        ImGui::PopStyleColor();
-
-                        // ファイル名を表示（短縮する必要がある場合）
-                        if (file.length() > 8) {
-                            std::string shortName = file.substr(0, 9) + "...";
-                            ImGui::TextWrapped("%s", shortName.c_str());
-                        } else {
-                            ImGui::TextWrapped("%s", file.c_str());
-                        }
-
-                        ImGui::NextColumn();
+                for (const DirectoryEntry *entry : texFiles) {
+                    const std::string &file = entry->name;
+                    bool isSelected = (file == selectedFileTex);
+                    ImGui::PushStyleColor(ImGuiCol_Button, isSelected ? ImVec4(0.5f, 0.5f, 0.7f, 0.7f) : ImVec4(0.3f, 0.3f, 0.3f, 0.0f));
+
+                    ImGui::PushID(file.c_str());
+                    if (ImGui::Button("", ImVec2(cellSize - 10, cellSize - 10))) {
+                        selectedFileTex = file;
+                        // `baseDirTex` からの相対パスを取得
+                        std::filesystem::path relativePath = (currentDirTex / file).lexically_relative(baseDirTex);
+                        // Windowsのバックスラッシュをスラッシュに変換
+                        std::string pathStr = relativePath.string();
+                        std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
+                        // 選択されたテクスチャパスを設定
+                        selectedTexturePath = pathStr;
                     }
+                    ImGui::PopID();
+
+                    ImGui::PopStyleColor();
+
+                    // ファイル名を表示（短縮する必要がある場合）
+                    if (file.length() > 8) {
+                        std::string shortName = file.substr(0, 9) + "...";
+                        ImGui::TextWrapped("%s", shortName.c_str());
+                    } else {
+                        ImGui::TextWrapped("%s", file.c_str());
+                    }
+
+                    ImGui::NextColumn();
                 }
 
                 ImGui::Columns(1);
@@ -252,7 +239,7 @@ void ShowTextureFile(std::string &selectedTexturePath) {
     // 下部ステータスバー
     ImGui::Separator();
     ImGui::Text("現在のパス: %s", currentDirTex.string().c_str());
-    ImGui::Text("ファイル数: %zu", texFiles.size());
+    ImGui::Text("ファイル数: %zu", query.GetFileCount());
 
     // スタイルを元に戻す
     style.ItemSpacing.y = origItemSpacing;
@@ -322,34 +309,19 @@ void ShowModelFile(std::string &selectedModelPath) {
 
     ImGui::Spacing();
 
-    // ディレクトリの読み取り
-    std::vector<std::string> foldersModel;
-    std::vector<std::string> modelFiles;
-
-    try {
-        for (const auto &entry : std::filesystem::directory_iterator(currentDirModel)) {
-            if (entry.is_directory()) {
-                foldersModel.push_back(entry.path().filename().string());
-            } else {
-                std::string ext = entry.path().extension().string();
-                // 一般的な3Dモデルファイル形式をサポート
-                if (ext == ".obj" || ext == ".fbx" || ext == ".gltf" || ext == ".glb" ||
-                    ext == ".dae" || ext == ".3ds" || ext == ".ply" || ext == ".x3d") {
-                    modelFiles.push_back(entry.path().filename().string());
-                }
-            }
-        }
-
-        // アルファベット順にソート
-        std::sort(foldersModel.begin(), foldersModel.end());
-        std::sort(modelFiles.begin(), modelFiles.end());
-    } catch (std::exception &e) {
-        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "エラー: %s", e.what());
-    }
+    // ディレクトリ一覧はキャッシュから取得（条件が変わったときだけ絞り込みをやり直す）
+    static DirectoryQuery query({".obj", ".fbx", ".gltf", ".glb", ".dae", ".3ds", ".ply", ".x3d"});
+    query.Update(currentDirModel, filter.InputBuf);
+    const std::vector<const DirectoryEntry *> &foldersModel = query.GetFolders();
+    const std::vector<const DirectoryEntry *> &modelFiles = query.GetFiles();
 
     // フォルダとファイルのコンテナ
     ImGui::BeginChild("FileBrowser", ImVec2(0, ImGui::GetContentRegionAvail().y - ImGui::GetFrameHeightWithSpacing()), true, ImGuiWindowFlags_AlwaysVerticalScrollbar);
 
+    if (query.IsLoading()) {
+        ImGui::TextDisabled("読み込み中...");
+    }
+
     // フォルダ表示セクション
     if (!foldersModel.empty()) {
         ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.3f, 0.3f, 0.7f, 0.5f));
@@ -360,32 +332,31 @@ void ShowModelFile(std::string &selectedModelPath) {
             ImGui::Indent(10.0f);
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(style.ItemSpacing.x, 8.0f));
 
-            for (auto &folder : foldersModel) {
-                if (filter.PassFilter(folder.c_str())) {
-                    // フォルダアイコンを表示
-                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.9f, 0.4f, 1.0f));
-                    ImGui::Text(ICON_FA_FOLDER);
-                    ImGui::PopStyleColor();
+            for (const DirectoryEntry *entry : foldersModel) {
+                const std::string &folder = entry->name;
+                // フォルダアイコンを表示
+                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.9f, 0.4f, 1.0f));
+                ImGui::Text(ICON_FA_FOLDER);
+                ImGui::PopStyleColor();
 
-                    ImGui::SameLine();
-                    if (ImGui::Selectable(folder.c_str(), selectedFolderModel == folder,
-                                          ImGuiSelectableFlags_AllowDoubleClick)) {
-                        if (ImGui::IsMouseDoubleClicked(0)) {
-                            selectedFolderModel = folder;
-                            currentDirModel = currentDirModel / folder;
-                            selectedFileModel = "";
-                        }
+                ImGui::SameLine();
+                if (ImGui::Selectable(folder.c_str(), selectedFolderModel == folder,
+                                      ImGuiSelectableFlags_AllowDoubleClick)) {
+                    if (ImGui::IsMouseDoubleClicked(0)) {
+                        selectedFolderModel = folder;
+                        currentDirModel = currentDirModel / folder;
+                        selectedFileModel = "";
                     }
+                }
 
-                    // コンテキストメニューの処理
-                    if (ImGui::BeginPopupContextItem(folder.c_str())) {
-                        if (ImGui::MenuItem("開く")) {
-                            selectedFolderModel = folder;
-                            currentDirModel = currentDirModel / folder;
-                            selectedFileModel = "";
-                        }
-                        ImGui::EndPopup();
+                // コンテキストメニューの処理
+                if (ImGui::BeginPopupContextItem(folder.c_str())) {
+                    if (ImGui::MenuItem("開く")) {
+                        selectedFolderModel = folder;
+                        currentDirModel = currentDirModel / folder;
+                        selectedFileModel = "";
                     }
+                    ImGui::EndPopup();
                 }
             }
 
@@ -415,42 +386,40 @@ void ShowModelFile(std::string &selectedModelPath) {
                 ImGui::NextColumn();
                 ImGui::Separator();
 
-                for (const auto &file : modelFiles) {
-                    if (filter.PassFilter(file.c_str())) {
-                        std::filesystem::path filePath(file);
-                        std::string extension = filePath.extension().string();
-
-                        // ファイルアイコンを表示（拡張子に応じて色を変更）
-                        ImVec4 iconColor;
-                        if (extension == ".obj" || extension == ".fbx") {
-                            iconColor = ImVec4(1.0f, 0.8f, 0.4f, 1.0f); // オレンジ
-                        } else if (extension == ".gltf" || extension == ".glb") {
-                            iconColor = ImVec4(0.4f, 1.0f, 0.8f, 1.0f); // 水色
-                        } else {
-                            iconColor = ImVec4(1.0f, 0.4f, 0.4f, 1.0f); // 赤
-                        }
-
-                        ImGui::PushStyleColor(ImGuiCol_Text, iconColor);
-                        ImGui::Text(ICON_FA_CUBE);
-                        ImGui::PopStyleColor();
-
-                        ImGui::SameLine();
-                        bool isSelected = (file == selectedFileModel);
-                        if (ImGui::Selectable(file.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
-                            selectedFileModel = file;
-                            // `baseDirModel` からの相対パスを取得
-                            std::filesystem::path relativePath = (currentDirModel / file).lexically_relative(baseDirModel);
-                            // Windowsのバックスラッシュをスラッシュに変換
-                            std::string pathStr = relativePath.string();
-                            std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
-                            // 選択されたモデルパスを設定
-                            selectedModelPath = pathStr;
-                        }
-
-                        ImGui::NextColumn();
-                        ImGui::Text("%s", extension.c_str());
-                        ImGui::NextColumn();
+                for (const DirectoryEntry *entry : modelFiles) {
+                    const std::string &file = entry->name;
+                    const std::string &extension = entry->extension;
+
+                    // ファイルアイコンを表示（拡張子に応じて色を変更）
+                    ImVec4 iconColor;
+                    if (extension == ".obj" || extension == ".fbx") {
+                        iconColor = ImVec4(1.0f, 0.8f, 0.4f, 1.0f); // オレンジ
+                    } else if (extension == ".gltf" || extension == ".glb") {
+                        iconColor = ImVec4(0.4f, 1.0f, 0.8f, 1.0f); // 水色
+                    } else {
+                        iconColor = ImVec4(1.0f, 0.4f, 0.4f, 1.0f); // 赤
                     }
+
+                    ImGui::PushStyleColor(ImGuiCol_Text, iconColor);
+                    ImGui::Text(ICON_FA_CUBE);
+                    ImGui::PopStyleColor();
+
+                    ImGui::SameLine();
+                    bool isSelected = (file == selectedFileModel);
+                    if (ImGui::Selectable(file.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
+                        selectedFileModel = file;
+                        // `baseDirModel` からの相対パスを取得
+                        std::filesystem::path relativePath = (currentDirModel / file).lexically_relative(baseDirModel);
+                        // Windowsのバックスラッシュをスラッシュに変換
+                        std::string pathStr = relativePath.string();
+                        std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
+                        // 選択されたモデルパスを設定
+                        selectedModelPath = pathStr;
+                    }
+
+                    ImGui::NextColumn();
+                    ImGui::Text("%s", extension.c_str());
+                    ImGui::NextColumn();
                 }
 
                 ImGui::Columns(1);
@@ -464,36 +433,35 @@ void ShowModelFile(std::string &selectedModelPath) {
 
                 ImGui::Columns(numColumns, "ファイルグリッド", false);
 
-                for (const auto &file : modelFiles) {
-                    if (filter.PassFilter(file.c_str())) {
-                        bool isSelected = (file == selectedFileModel);
-                        ImGui::PushStyleColor(ImGuiCol_Button, isSelected ? ImVec4(0.7f, 0.5f, 0.5f, 0.7f) : ImVec4(0.3f, 0.3f, 0.3f, 0.0f));
-
-                        ImGui::PushID(file.c_str());
-                        if (ImGui::Button("", ImVec2(cellSize - 10, cellSize - 10))) {
-                            selectedFileModel = file;
-                            // `baseDirModel` からの相対パスを取得
-                            std::filesystem::path relativePath = (currentDirModel / file).lexically_relative(baseDirModel);
-                            // Windowsのバックスラッシュをスラッシュに変換
-                            std::string pathStr = relativePath.string();
-                            std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
-                            // 選択されたモデルパスを設定
-                            selectedModelPath = pathStr;
-                        }
-                        ImGui::PopID();
-
-                        ImGui::PopStyleColor();
-
-                        // ファイル名を表示（短縮する必要がある場合）
-                        if (file.length() > 12) {
-                            std::string shortName = file.substr(0, 9) + "...";
-                            ImGui::TextWrapped("%s", shortName.c_str());
-                        } else {
-                            ImGui::TextWrapped("%s", file.c_str());
-                        }
-
-                        ImGui::NextColumn();
+                for (const DirectoryEntry *entry : modelFiles) {
+                    const std::string &file = entry->name;
+                    bool isSelected = (file == selectedFileModel);
+                    ImGui::PushStyleColor(ImGuiCol_Button, isSelected ? ImVec4(0.7f, 0.5f, 0.5f, 0.7f) : ImVec4(0.3f, 0.3f, 0.3f, 0.0f));
+
+                    ImGui::PushID(file.c_str());
+                    if (ImGui::Button("", ImVec2(cellSize - 10, cellSize - 10))) {
+                        selectedFileModel = file;
+                        // `baseDirModel` からの相対パスを取得
+                        std::filesystem::path relativePath = (currentDirModel / file).lexically_relative(baseDirModel);
+                        // Windowsのバックスラッシュをスラッシュに変換
+                        std::string pathStr = relativePath.string();
+                        std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
+                        // 選択されたモデルパスを設定
+                        selectedModelPath = pathStr;
+                    }
+                    ImGui::PopID();
+
+                    ImGui::PopStyleColor();
+
+                    // ファイル名を表示（短縮する必要がある場合）
+                    if (file.length() > 12) {
+                        std::string shortName = file.substr(0, 9) + "...";
+                        ImGui::TextWrapped("%s", shortName.c_str());
+                    } else {
+                        ImGui::TextWrapped("%s", file.c_str());
                     }
+
+                    ImGui::NextColumn();
                 }
 
                 ImGui::Columns(1);
@@ -510,7 +478,7 @@ void ShowModelFile(std::string &selectedModelPath) {
     // 下部ステータスバー
     ImGui::Separator();
     ImGui::Text("現在のパス: %s", currentDirModel.string().c_str());
-    ImGui::Text("ファイル数: %zu", modelFiles.size());
+    ImGui::Text("ファイル数: %zu", query.GetFileCount());
 
     // 選択したファイルの情報表示（プレビューなし）
     if (!selectedFileModel.empty()) {
@@ -587,33 +555,19 @@ void ShowJsonFile(std::string &selectedJsonPath, std::string &startPath) {
 
     ImGui::Spacing();
 
-    // ディレクトリの読み取り
-    std::vector<std::string> foldersJson;
-    std::vector<std::string> jsonFiles;
-
-    try {
-        for (const auto &entry : std::filesystem::directory_iterator(currentDirJson)) {
-            if (entry.is_directory()) {
-                foldersJson.push_back(entry.path().filename().string());
-            } else {
-                std::string ext = entry.path().extension().string();
-                // JSONファイル形式をサポート
-                if (ext == ".json" || ext == ".jsonl" || ext == ".geojson") {
-                    jsonFiles.push_back(entry.path().filename().string());
-                }
-            }
-        }
-
-        // アルファベット順にソート
-        std::sort(foldersJson.begin(), foldersJson.end());
-        std::sort(jsonFiles.begin(), jsonFiles.end());
-    } catch (std::exception &e) {
-        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "エラー: %s", e.what());
-    }
+    // ディレクトリ一覧はキャッシュから取得（条件が変わったときだけ絞り込みをやり直す）
+    static DirectoryQuery query({".json", ".jsonl", ".geojson"});
+    query.Update(currentDirJson, filter.InputBuf);
+    const std::vector<const DirectoryEntry *> &foldersJson = query.GetFolders();
+    const std::vector<const DirectoryEntry *> &jsonFiles = query.GetFiles();
 
     // フォルダとファイルのコンテナ
     ImGui::BeginChild("FileBrowser", ImVec2(0, ImGui::GetContentRegionAvail().y - ImGui::GetFrameHeightWithSpacing()), true, ImGuiWindowFlags_AlwaysVerticalScrollbar);
 
+    if (query.IsLoading()) {
+        ImGui::TextDisabled("読み込み中...");
+    }
+
     // フォルダ表示セクション
     if (!foldersJson.empty()) {
         ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.3f, 0.3f, 0.7f, 0.5f));
@@ -624,32 +578,31 @@ void ShowJsonFile(std::string &selectedJsonPath, std::string &startPath) {
             ImGui::Indent(10.0f);
             ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(style.ItemSpacing.x, 8.0f));
 
-            for (auto &folder : foldersJson) {
-                if (filter.PassFilter(folder.c_str())) {
-                    // フォルダアイコンを表示
-                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.9f, 0.4f, 1.0f));
-                    ImGui::Text(ICON_FA_FOLDER);
-                    ImGui::PopStyleColor();
+            for (const DirectoryEntry *entry : foldersJson) {
+                const std::string &folder = entry->name;
+                // フォルダアイコンを表示
+                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.9f, 0.4f, 1.0f));
+                ImGui::Text(ICON_FA_FOLDER);
+                ImGui::PopStyleColor();
 
-                    ImGui::SameLine();
-                    if (ImGui::Selectable(folder.c_str(), selectedFolderJson == folder,
-                                          ImGuiSelectableFlags_AllowDoubleClick)) {
-                        if (ImGui::IsMouseDoubleClicked(0)) {
-                            selectedFolderJson = folder;
-                            currentDirJson = currentDirJson / folder;
-                            selectedFileJson = "";
-                        }
+                ImGui::SameLine();
+                if (ImGui::Selectable(folder.c_str(), selectedFolderJson == folder,
+                                      ImGuiSelectableFlags_AllowDoubleClick)) {
+                    if (ImGui::IsMouseDoubleClicked(0)) {
+                        selectedFolderJson = folder;
+                        currentDirJson = currentDirJson / folder;
+                        selectedFileJson = "";
                     }
+                }
 
-                    // コンテキストメニューの処理
-                    if (ImGui::BeginPopupContextItem(folder.c_str())) {
-                        if (ImGui::MenuItem("開く")) {
-                            selectedFolderJson = folder;
-                            currentDirJson = currentDirJson / folder;
-                            selectedFileJson = "";
-                        }
-                        ImGui::EndPopup();
+                // コンテキストメニューの処理
+                if (ImGui::BeginPopupContextItem(folder.c_str())) {
+                    if (ImGui::MenuItem("開く")) {
+                        selectedFolderJson = folder;
+                        currentDirJson = currentDirJson / folder;
+                        selectedFileJson = "";
                     }
+                    ImGui::EndPopup();
                 }
             }
 
@@ -679,44 +632,42 @@ void ShowJsonFile(std::string &selectedJsonPath, std::string &startPath) {
                 ImGui::NextColumn();
                 ImGui::Separator();
 
-                for (const auto &file : jsonFiles) {
-                    if (filter.PassFilter(file.c_str())) {
-                        std::filesystem::path filePath(file);
-                        std::string extension = filePath.extension().string();
-
-                        // ファイルアイコンを表示（拡張子に応じて色を変更）
-                        ImVec4 iconColor;
-                        if (extension == ".json") {
-                            iconColor = ImVec4(1.0f, 0.9f, 0.4f, 1.0f); // 黄色
-                        } else if (extension == ".jsonl") {
-                            iconColor = ImVec4(0.4f, 0.8f, 1.0f, 1.0f); // 水色
-                        } else if (extension == ".geojson") {
-                            iconColor = ImVec4(0.4f, 1.0f, 0.6f, 1.0f); // 緑
-                        } else {
-                            iconColor = ImVec4(0.8f, 0.8f, 0.8f, 1.0f); // 灰色
-                        }
-
-                        ImGui::PushStyleColor(ImGuiCol_Text, iconColor);
-                        ImGui::Text(ICON_FA_FILE_CODE);
-                        ImGui::PopStyleColor();
-
-                        ImGui::SameLine();
-                        bool isSelected = (file == selectedFileJson);
-                        if (ImGui::Selectable(file.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
-                            selectedFileJson = file;
-                            // `baseDirJson` からの相対パスを取得
-                            std::filesystem::path relativePath = (currentDirJson / file).lexically_relative(baseDirJson);
-                            // Windowsのバックスラッシュをスラッシュに変換
-                            std::string pathStr = relativePath.string();
-                            std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
-                            // 選択されたJSONパスを設定
-                            selectedJsonPath = pathStr;
-                        }
-
-                        ImGui::NextColumn();
-                        ImGui::Text("%s", extension.c_str());
-                        ImGui::NextColumn();
+                for (const DirectoryEntry *entry : jsonFiles) {
+                    const std::string &file = entry->name;
+                    const std::string &extension = entry->extension;
+
+                    // ファイルアイコンを表示（拡張子に応じて色を変更）
+                    ImVec4 iconColor;
+                    if (extension == ".json") {
+                        iconColor = ImVec4(1.0f, 0.9f, 0.4f, 1.0f); // 黄色
+                    } else if (extension == ".jsonl") {
+                        iconColor = ImVec4(0.4f, 0.8f, 1.0f, 1.0f); // 水色
+                    } else if (extension == ".geojson") {
+                        iconColor = ImVec4(0.4f, 1.0f, 0.6f, 1.0f); // 緑
+                    } else {
+                        iconColor = ImVec4(0.8f, 0.8f, 0.8f, 1.0f); // 灰色
                     }
+
+                    ImGui::PushStyleColor(ImGuiCol_Text, iconColor);
+                    ImGui::Text(ICON_FA_FILE_CODE);
+                    ImGui::PopStyleColor();
+
+                    ImGui::SameLine();
+                    bool isSelected = (file == selectedFileJson);
+                    if (ImGui::Selectable(file.c_str(), isSelected, ImGuiSelectableFlags_SpanAllColumns)) {
+                        selectedFileJson = file;
+                        // `baseDirJson` からの相対パスを取得
+                        std::filesystem::path relativePath = (currentDirJson / file).lexically_relative(baseDirJson);
+                        // Windowsのバックスラッシュをスラッシュに変換
+                        std::string pathStr = relativePath.string();
+                        std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
+                        // 選択されたJSONパスを設定
+                        selectedJsonPath = pathStr;
+                    }
+
+                    ImGui::NextColumn();
+                    ImGui::Text("%s", extension.c_str());
+                    ImGui::NextColumn();
                 }
 
                 ImGui::Columns(1);
@@ -730,36 +681,35 @@ void ShowJsonFile(std::string &selectedJsonPath, std::string &startPath) {
 
                 ImGui::Columns(numColumns, "ファイルグリッド", false);
 
-                for (const auto &file : jsonFiles) {
-                    if (filter.PassFilter(file.c_str())) {
-                        bool isSelected = (file == selectedFileJson);
-                        ImGui::PushStyleColor(ImGuiCol_Button, isSelected ? ImVec4(0.5f, 0.7f, 0.7f, 0.7f) : ImVec4(0.3f, 0.3f, 0.3f, 0.0f));
-
-                        ImGui::PushID(file.c_str());
-                        if (ImGui::Button("", ImVec2(cellSize - 10, cellSize - 10))) {
-                            selectedFileJson = file;
-                            // `baseDirJson` からの相対パスを取得
-                            std::filesystem::path relativePath = (currentDirJson / file).lexically_relative(baseDirJson);
-                            // Windowsのバックスラッシュをスラッシュに変換
-                            std::string pathStr = relativePath.string();
-                            std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
-                            // 選択されたJSONパスを設定
-                            selectedJsonPath = pathStr;
-                        }
-                        ImGui::PopID();
-
-                        ImGui::PopStyleColor();
-
-                        // ファイル名を表示（短縮する必要がある場合）
-                        if (file.length() > 12) {
-                            std::string shortName = file.substr(0, 9) + "...";
-                            ImGui::TextWrapped("%s", shortName.c_str());
-                        } else {
-                            ImGui::TextWrapped("%s", file.c_str());
-                        }
-
-                        ImGui::NextColumn();
+                for (const DirectoryEntry *entry : jsonFiles) {
+                    const std::string &file = entry->name;
+                    bool isSelected = (file == selectedFileJson);
+                    ImGui::PushStyleColor(ImGuiCol_Button, isSelected ? ImVec4(0.5f, 0.7f, 0.7f, 0.7f) : ImVec4(0.3f, 0.3f, 0.3f, 0.0f));
+
+                    ImGui::PushID(file.c_str());
+                    if (ImGui::Button("", ImVec2(cellSize - 10, cellSize - 10))) {
+                        selectedFileJson = file;
+                        // `baseDirJson` からの相対パスを取得
+                        std::filesystem::path relativePath = (currentDirJson / file).lexically_relative(baseDirJson);
+                        // Windowsのバックスラッシュをスラッシュに変換
+                        std::string pathStr = relativePath.string();
+                        std::replace(pathStr.begin(), pathStr.end(), '\\', '/');
+                        // 選択されたJSONパスを設定
+                        selectedJsonPath = pathStr;
+                    }
+                    ImGui::PopID();
+
+                    ImGui::PopStyleColor();
+
+                    // ファイル名を表示（短縮する必要がある場合）
+                    if (file.length() > 12) {
+                        std::string shortName = file.substr(0, 9) + "...";
+                        ImGui::TextWrapped("%s", shortName.c_str());
+                    } else {
+                        ImGui::TextWrapped("%s", file.c_str());
                     }
+
+                    ImGui::NextColumn();
                 }
 
                 ImGui::Columns(1);
@@ -776,7 +726,7 @@ void ShowJsonFile(std::string &selectedJsonPath, std::string &startPath) {
     // 下部ステータスバー
     ImGui::Separator();
     ImGui::Text("現在のパス: %s", currentDirJson.string().c_str());
-    ImGui::Text("ファイル数: %zu", jsonFiles.size());
+    ImGui::Text("ファイル数: %zu", query.GetFileCount());
 
     // 選択したファイルの情報表示（プレビューなし）
     if (!selectedFileJson.empty()) {
@@ -0,0 +1,10 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのDirectXMath.hの代わり（エンジンが使う定数だけ）
+
+namespace DirectX {
+
+constexpr float XM_PI = 3.141592654f;
+constexpr float XM_2PI = 6.283185307f;
+constexpr float XM_PIDIV2 = 1.570796327f;
+
+} // namespace DirectX
@@ -0,0 +1,50 @@
+// 描画デバイスを作らずにエンジンのCPU側をリンクするための描画まわりのスタブ
+// テストと計測は描画リソースを作る初期化や描画を呼ばないので、ここに来たら何もせずに空を返す
+#include "DirectXCommon.h"
+#include "Graphics/PipeLine/PipeLineManager.h"
+#include "Graphics/Srv/SrvManager.h"
+#include "Particle/ParticleCommon.h"
+
+DirectXCommon *DirectXCommon::instance = nullptr;
+PipeLineManager *PipeLineManager::instance = nullptr;
+SrvManager *SrvManager::instance = nullptr;
+ParticleCommon *ParticleCommon::instance = nullptr;
+
+DirectXCommon *DirectXCommon::GetInstance() {
+    return instance;
+}
+
+Microsoft::WRL::ComPtr<ID3D12Resource> DirectXCommon::CreateBufferResource(size_t, bool) {
+    return nullptr;
+}
+
+PipeLineManager *PipeLineManager::GetInstance() {
+    return instance;
+}
+
+void PipeLineManager::DrawCommonSetting(PipelineType, BlendMode, ShaderMode) {
+}
+
+SrvManager *SrvManager::GetInstance() {
+    return instance;
+}
+
+uint32_t SrvManager::Allocate() {
+    return 0;
+}
+
+void SrvManager::CreateSRVforStructuredBuffer(uint32_t, ID3D12Resource *, UINT, UINT) {
+}
+
+void SrvManager::SetGraphicsRootDescriptorTable(UINT, uint32_t) {
+}
+
+ParticleCommon *ParticleCommon::GetInstance() {
+    return instance;
+}
+
+void ParticleCommon::DrawCommonSetting(BlendMode) {
+}
+
+void ParticleCommon::DrawTrailCommonSetting(BlendMode) {
+}
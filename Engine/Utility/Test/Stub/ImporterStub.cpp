@@ -0,0 +1,17 @@
+// assimpのライブラリを使わずにアニメーションの処理をリンクするためのスタブ
+// ファイルの読み込みは常に失敗する（テストではキーフレームをコードで組み立てる）
+#include <assimp/Importer.hpp>
+
+namespace Assimp {
+
+Importer::Importer() : pimpl(nullptr) {
+}
+
+Importer::~Importer() {
+}
+
+const aiScene *Importer::ReadFile(const char *, unsigned int) {
+    return nullptr;
+}
+
+} // namespace Assimp
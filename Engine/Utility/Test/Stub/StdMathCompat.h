@@ -0,0 +1,21 @@
+#pragma once
+// libstdc++（GCC 13まで）は<cmath>のfloat版（std::sqrtfなど）をstdに入れていないので補う（同じusingが重なっても問題ない）
+#include <cmath>
+
+#if defined(__GLIBCXX__)
+namespace std {
+using ::acosf;
+using ::asinf;
+using ::atan2f;
+using ::atanf;
+using ::cosf;
+using ::expf;
+using ::fabsf;
+using ::fmodf;
+using ::logf;
+using ::powf;
+using ::sinf;
+using ::sqrtf;
+using ::tanf;
+} // namespace std
+#endif
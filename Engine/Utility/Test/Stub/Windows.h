@@ -0,0 +1,49 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのWindows.hの代わり（型と定数と、ログの出力先だけ）
+#include <cstdint>
+#include <cstdio>
+
+using BYTE = uint8_t;
+using WORD = uint16_t;
+using DWORD = uint32_t;
+using UINT = unsigned int;
+using UINT8 = uint8_t;
+using UINT16 = uint16_t;
+using UINT64 = uint64_t;
+using INT = int;
+using LONG = int32_t;
+using BOOL = int;
+using FLOAT = float;
+using SIZE_T = size_t;
+using HRESULT = int32_t;
+using LPCSTR = const char *;
+using LPCWSTR = const wchar_t *;
+using WPARAM = uintptr_t;
+using LPARAM = intptr_t;
+using LRESULT = intptr_t;
+using HANDLE = void *;
+using HWND = struct HWND__ *;
+using HINSTANCE = struct HINSTANCE__ *;
+
+#define CALLBACK
+#define WINAPI
+#define S_OK ((HRESULT)0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+
+struct RECT {
+    LONG left;
+    LONG top;
+    LONG right;
+    LONG bottom;
+};
+
+struct WNDCLASS {
+    UINT style;
+    void *lpfnWndProc;
+    HINSTANCE hInstance;
+    LPCWSTR lpszClassName;
+};
+
+// デバッガーの代わりに標準エラーに出す
+inline void OutputDebugStringA(LPCSTR message) { std::fputs(message, stderr); }
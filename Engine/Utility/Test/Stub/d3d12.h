@@ -0,0 +1,113 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのd3d12.hの代わり
+// ヘッダーに出てくる型と、テスト対象の翻訳単位が呼ぶメソッドだけを持つ（呼んでも何もしない）
+#include "Windows.h"
+#include "dxgi1_6.h"
+
+using D3D12_GPU_VIRTUAL_ADDRESS = uint64_t;
+
+struct D3D12_CPU_DESCRIPTOR_HANDLE {
+    SIZE_T ptr;
+};
+
+struct D3D12_GPU_DESCRIPTOR_HANDLE {
+    UINT64 ptr;
+};
+
+struct D3D12_VERTEX_BUFFER_VIEW {
+    D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
+    UINT SizeInBytes;
+    UINT StrideInBytes;
+};
+
+struct D3D12_INDEX_BUFFER_VIEW {
+    D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
+    UINT SizeInBytes;
+    DXGI_FORMAT Format;
+};
+
+struct D3D12_RANGE {
+    SIZE_T Begin;
+    SIZE_T End;
+};
+
+struct D3D12_VIEWPORT {
+    FLOAT TopLeftX;
+    FLOAT TopLeftY;
+    FLOAT Width;
+    FLOAT Height;
+    FLOAT MinDepth;
+    FLOAT MaxDepth;
+};
+
+using D3D12_RECT = RECT;
+
+struct D3D12_DEPTH_STENCIL_VALUE {
+    FLOAT Depth;
+    UINT8 Stencil;
+};
+
+struct D3D12_CLEAR_VALUE {
+    DXGI_FORMAT Format;
+    union {
+        FLOAT Color[4];
+        D3D12_DEPTH_STENCIL_VALUE DepthStencil;
+    };
+};
+
+enum D3D12_RESOURCE_STATES {
+    D3D12_RESOURCE_STATE_COMMON = 0,
+    D3D12_RESOURCE_STATE_GENERIC_READ = 0xac3,
+};
+
+enum D3D12_DESCRIPTOR_HEAP_TYPE {
+    D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV = 0,
+    D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
+    D3D12_DESCRIPTOR_HEAP_TYPE_RTV,
+    D3D12_DESCRIPTOR_HEAP_TYPE_DSV,
+};
+
+enum D3D_PRIMITIVE_TOPOLOGY {
+    D3D_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+    D3D_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+    D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+};
+
+struct D3D12_STATIC_SAMPLER_DESC {};
+struct D3D12_DEPTH_STENCIL_DESC {};
+struct D3D12_RESOURCE_BARRIER {};
+struct D3D12_RENDER_TARGET_VIEW_DESC {};
+
+struct ID3D12Object {};
+struct ID3D12RootSignature : ID3D12Object {};
+struct ID3D12PipelineState : ID3D12Object {};
+struct ID3D12Fence : ID3D12Object {};
+struct ID3D12CommandQueue : ID3D12Object {};
+struct ID3D12CommandAllocator : ID3D12Object {};
+struct ID3D12Device : ID3D12Object {};
+
+struct ID3D12DescriptorHeap : ID3D12Object {
+    D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForHeapStart() { return {}; }
+    D3D12_GPU_DESCRIPTOR_HANDLE GetGPUDescriptorHandleForHeapStart() { return {}; }
+};
+
+struct ID3D12Resource : ID3D12Object {
+    HRESULT Map(UINT, const D3D12_RANGE *, void **data) {
+        *data = nullptr;
+        return S_OK;
+    }
+    void Unmap(UINT, const D3D12_RANGE *) {}
+    D3D12_GPU_VIRTUAL_ADDRESS GetGPUVirtualAddress() { return 0; }
+};
+
+struct ID3D12GraphicsCommandList : ID3D12Object {
+    void IASetVertexBuffers(UINT, UINT, const D3D12_VERTEX_BUFFER_VIEW *) {}
+    void IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW *) {}
+    void IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY) {}
+    void SetGraphicsRootSignature(ID3D12RootSignature *) {}
+    void SetPipelineState(ID3D12PipelineState *) {}
+    void SetGraphicsRootConstantBufferView(UINT, D3D12_GPU_VIRTUAL_ADDRESS) {}
+    void SetGraphicsRootDescriptorTable(UINT, D3D12_GPU_DESCRIPTOR_HANDLE) {}
+    void DrawInstanced(UINT, UINT, UINT, UINT) {}
+    void DrawIndexedInstanced(UINT, UINT, UINT, INT, UINT) {}
+};
@@ -0,0 +1,6 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのdxcapi.hの代わり（型だけ）
+struct IDxcBlob {};
+struct IDxcUtils {};
+struct IDxcCompiler3 {};
+struct IDxcIncludeHandler {};
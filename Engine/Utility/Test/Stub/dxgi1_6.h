@@ -0,0 +1,18 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのdxgi1_6.hの代わり（型だけ）
+#include "Windows.h"
+
+enum DXGI_FORMAT {
+    DXGI_FORMAT_UNKNOWN = 0,
+    DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+    DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+    DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29,
+    DXGI_FORMAT_D24_UNORM_S8_UINT = 45,
+    DXGI_FORMAT_R32_UINT = 42,
+    DXGI_FORMAT_R16_UINT = 57,
+};
+
+struct DXGI_SWAP_CHAIN_DESC1 {};
+struct IDXGIFactory7 {};
+struct IDXGIAdapter4 {};
+struct IDXGISwapChain4 {};
@@ -0,0 +1,26 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのDirectXTex.hの代わり（型だけ）
+#include "DirectXMath.h"
+#include "dxgi1_6.h"
+#include <cstddef>
+
+namespace DirectX {
+
+struct TexMetadata {
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t arraySize;
+    size_t mipLevels;
+    DXGI_FORMAT format;
+};
+
+class ScratchImage {
+  public:
+    const TexMetadata &GetMetadata() const { return metadata_; }
+
+  private:
+    TexMetadata metadata_{};
+};
+
+} // namespace DirectX
@@ -0,0 +1,3 @@
+#pragma once
+// Windows以外でエンジンのCPU側をテストするためのwrl.hの代わり（ComPtrの参照カウントは持たない）
+#include "wrl/client.h"
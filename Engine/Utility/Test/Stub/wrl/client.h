@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+
+namespace Microsoft::WRL {
+
+/// <summary>
+/// ComPtrの代わり（描画リソースは作らないので、ポインタを持つだけ）
+/// </summary>
+template <typename T>
+class ComPtr {
+  public:
+    ComPtr() = default;
+    ComPtr(std::nullptr_t) {}
+    ComPtr(T *pointer) : pointer_(pointer) {}
+
+    T *Get() const { return pointer_; }
+    T *operator->() const { return pointer_; }
+    T **operator&() { return &pointer_; }
+    T **GetAddressOf() { return &pointer_; }
+    T **ReleaseAndGetAddressOf() { return &pointer_; }
+    void Reset() { pointer_ = nullptr; }
+    explicit operator bool() const { return pointer_ != nullptr; }
+    bool operator==(std::nullptr_t) const { return pointer_ == nullptr; }
+    bool operator!=(std::nullptr_t) const { return pointer_ != nullptr; }
+
+  private:
+    T *pointer_ = nullptr;
+};
+
+} // namespace Microsoft::WRL
@@ -0,0 +1,40 @@
+#include "Test.h"
+#include <cstdio>
+#include <exception>
+
+uint32_t Test::failureCount_ = 0;
+
+std::vector<Test::Case> &Test::GetCases() {
+    // 登録は静的初期化の途中で行われるので、初めて使うときに作る
+    static std::vector<Case> cases;
+    return cases;
+}
+
+bool Test::Register(const char *name, Function function) {
+    GetCases().push_back({name, function});
+    return true;
+}
+
+void Test::Fail(const char *file, int line, const char *expression) {
+    ++failureCount_;
+    std::printf("  %s:%d: CHECK(%s)\n", file, line, expression);
+}
+
+int Test::RunAll() {
+    int failedCaseCount = 0;
+    for (const Case &testCase : GetCases()) {
+        failureCount_ = 0;
+        try {
+            testCase.function();
+        } catch (const std::exception &e) {
+            ++failureCount_;
+            std::printf("  exception: %s\n", e.what());
+        }
+        std::printf("[%s] %s\n", failureCount_ == 0 ? "  OK  " : "FAILED", testCase.name);
+        if (failureCount_ > 0) {
+            ++failedCaseCount;
+        }
+    }
+    std::printf("%zu tests, %d failed\n", GetCases().size(), failedCaseCount);
+    return failedCaseCount;
+}
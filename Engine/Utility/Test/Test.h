@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// モジュールの隣に置くテストの登録と実行
+/// テストは TEST(名前) { ... } で書き、CHECK(条件) が偽になったところを失敗として記録する
+/// </summary>
+class Test {
+  public:
+    using Function = void (*)();
+
+    /// <summary>
+    /// テストの登録（TESTマクロから呼ばれる）
+    /// </summary>
+    static bool Register(const char *name, Function function);
+
+    /// <summary>
+    /// 失敗の記録（CHECKマクロから呼ばれる）
+    /// </summary>
+    static void Fail(const char *file, int line, const char *expression);
+
+    /// <summary>
+    /// 登録されたテストをすべて実行する
+    /// </summary>
+    /// <returns>失敗したテストの数</returns>
+    static int RunAll();
+
+  private:
+    struct Case {
+        const char *name;
+        Function function;
+    };
+
+    static std::vector<Case> &GetCases();
+
+    // 実行中のテストの失敗数
+    static uint32_t failureCount_;
+};
+
+#define TEST(name)                                                      \
+    static void name();                                                 \
+    static const bool name##Registered = Test::Register(#name, &name); \
+    static void name()
+
+#define CHECK(expression)                                    \
+    do {                                                     \
+        if (!(expression)) {                                 \
+            Test::Fail(__FILE__, __LINE__, #expression);     \
+        }                                                    \
+    } while (0)
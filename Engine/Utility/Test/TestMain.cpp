@@ -0,0 +1,5 @@
+#include "Test.h"
+
+int main() {
+    return Test::RunAll() == 0 ? 0 : 1;
+}
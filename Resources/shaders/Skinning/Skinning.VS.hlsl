@@ -25,6 +25,7 @@ VertexShaderOutput main(VertexShaderInput input)
     output.worldPosition = mul(input.position, gTransformationMatrix.World).xyz;
     output.texcoord = input.texcoord;
     output.normal = normalize(mul(input.normal, (float3x3) gTransformationMatrix.WorldInverseTranspose));
+    output.color = float4(1.0f, 1.0f, 1.0f, 1.0f);
 
     return output;
 }
\ No newline at end of file
@@ -28,4 +28,5 @@ struct VertexShaderOutput
     float2 texcoord : TEXCOORD0;
     float3 normal : NORMAL0;
     float3 worldPosition : POSITION0;
+    float4 color : COLOR0;
 };
\ No newline at end of file
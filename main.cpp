@@ -1,7 +1,57 @@
 #include "MyGame.h"
 #include "d3dx12.h"
+#include <Decoder/AudioDecoder.h>
+#include <FramePacingBenchmark.h>
+#include <Job/JobSystemBenchmark.h>
+#include <Model/MeshOptimizer/MeshOptimizer.h>
+#include <Simd/MathBenchmark.h>
+#include <Transform/TransformBenchmark.h>
+#include <string>
+
+int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR lpCmdLine, int) {
+    std::string cmdLine = lpCmdLine ? lpCmdLine : "";
+
+    // ウィンドウを作らずにモデルディレクトリのメッシュ最適化レポートを出力
+    if (cmdLine.find("--mesh-report") != std::string::npos) {
+        MeshOptimizer::WriteReportCSV(MeshOptimizer::ReportDirectory("resources/models"), "mesh_optimize_report.csv");
+        return 0;
+    }
+
+    // オーディオデバイスを使わずに音声のデコード速度とメモリ使用量のレポートを出力
+    // （ストリーミング再生と同じ 64KB x 3 バッファで計測）
+    if (cmdLine.find("--audio-report") != std::string::npos) {
+        AudioDecoder::WriteReportCSV(AudioDecoder::ReportDirectory("resources/sounds", 64 * 1024, 3), "audio_decode_report.csv");
+        return 0;
+    }
+
+    // 行列・クォータニオン演算のSIMD版とスカラー版の速度比較（一致の確認はmyMathTest）
+    if (cmdLine.find("--math-bench") != std::string::npos) {
+        MathBenchmark::WriteReportCSV(MathBenchmark::Run(), "math_benchmark_report.csv");
+        return 0;
+    }
+
+    // 1万ノードのシーンで1% / 10% / 100% のノードを動かしたときのワールド変換の計算時間を比較（一致の確認はTransformHierarchyTest）
+    if (cmdLine.find("--transform-bench") != std::string::npos) {
+        JobSystem::GetInstance()->Initialize();
+        TransformBenchmark::WriteReportCSV(TransformBenchmark::Run(), "transform_benchmark_report.csv");
+        JobSystem::GetInstance()->Finalize();
+        return 0;
+    }
+
+    // ジョブ1つあたりのオーバーヘッド計測（同時登録・入れ子・依存関係・メインスレッド指定の動作確認はJobSystemTest）
+    if (cmdLine.find("--job-bench") != std::string::npos) {
+        JobSystem::GetInstance()->Initialize();
+        JobSystemBenchmark::WriteReportCSV(JobSystemBenchmark::Run(), "job_benchmark_report.csv");
+        JobSystem::GetInstance()->Finalize();
+        return 0;
+    }
+
+    // フレームレート固定の待ち方ごとの精度（目標との誤差 p50/p99）と待機中のCPU使用率を計測（目標どおりに待てるかはFramePacerTest）
+    if (cmdLine.find("--pacing-bench") != std::string::npos) {
+        FramePacingBenchmark::WriteReportCSV(FramePacingBenchmark::Run(), "pacing_benchmark_report.csv");
+        return 0;
+    }
 
-int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
     //_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF); 
     //_CrtSetBreakAlloc(152);
 
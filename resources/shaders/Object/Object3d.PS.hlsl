@@ -70,6 +70,7 @@ PixelShaderOutput main(VertexShaderOutput input)
 {
     float4 transformedUV = mul(float4(input.texcoord, 0.0f, 1.0f), gMaterial.uvTransform);
     float4 textureColor = gTexture.Sample(gSampler, transformedUV.xy);
+    float4 materialColor = gMaterial.color * input.color;
     PixelShaderOutput output;
     if (gMaterial.enableLighting != 0)
     {
@@ -80,7 +81,7 @@ PixelShaderOutput main(VertexShaderOutput input)
             {
                 float NdotL = dot(normalize(input.normal), normalize(-gDirectionalLight.direction));
                 float cos = pow(NdotL * 0.5f + 0.5f, 2.0f);
-                output.color = gMaterial.color * textureColor * gDirectionalLight.color * cos * gDirectionalLight.intensity;
+                output.color = materialColor * textureColor * gDirectionalLight.color * cos * gDirectionalLight.intensity;
             }
             else if (gDirectionalLight.BlinnPhong != 0)
             {
@@ -93,7 +94,7 @@ PixelShaderOutput main(VertexShaderOutput input)
                 float specularPowDirectional = pow(saturate(NDotHDirectional), gMaterial.shininess);
 
                 // 拡散反射
-                float3 diffuseDirectional = gMaterial.color.rgb * textureColor.rgb * gDirectionalLight.color.rgb * cosDirectional * gDirectionalLight.intensity;
+                float3 diffuseDirectional = materialColor.rgb * textureColor.rgb * gDirectionalLight.color.rgb * cosDirectional * gDirectionalLight.intensity;
                 // 鏡面反射
                 float3 specularDirectional = gDirectionalLight.color.rgb * gDirectionalLight.intensity * specularPowDirectional * float3(1.0f, 1.0f, 1.0f);
                 // 拡散反射 + 鏡面反射
@@ -120,7 +121,7 @@ PixelShaderOutput main(VertexShaderOutput input)
                 float factor = pow(saturate(-distance / gPointLight.radius + 1.0f), gPointLight.decay);
 
                 // 出力色を計算（拡散反射部分にライトの影響を加える）
-                output.color.rgb += gMaterial.color.rgb * textureColor.rgb * gPointLight.color.rgb * cos * gPointLight.intensity * factor;
+                output.color.rgb += materialColor.rgb * textureColor.rgb * gPointLight.color.rgb * cos * gPointLight.intensity * factor;
             }
             else if (gPointLight.BlinnPhong != 0)
             {
@@ -132,7 +133,7 @@ PixelShaderOutput main(VertexShaderOutput input)
                 // 拡散反射
                 float NdotLPoint = dot(normalize(input.normal), lightDir);
                 float cosPoint = max(NdotLPoint, 0.0f); // コサイン値
-                float3 diffusePoint = gMaterial.color.rgb * textureColor.rgb * gPointLight.color.rgb * cosPoint * gPointLight.intensity;
+                float3 diffusePoint = materialColor.rgb * textureColor.rgb * gPointLight.color.rgb * cosPoint * gPointLight.intensity;
 
                 // 鏡面反射
                 float3 toEyePoint = normalize(gCamera.worldPosition - input.worldPosition);
@@ -179,7 +180,7 @@ PixelShaderOutput main(VertexShaderOutput input)
 
         // 拡散反射計算
                 float NdotLSpot = max(dot(normalize(input.normal), -spotLightDirectionOnSurface), 0.0f);
-                float3 diffuseSpot = gMaterial.color.rgb * textureColor.rgb * gSpotLight.color.rgb * NdotLSpot * gSpotLight.intensity;
+                float3 diffuseSpot = materialColor.rgb * textureColor.rgb * gSpotLight.color.rgb * NdotLSpot * gSpotLight.intensity;
 
         // 鏡面反射計算
                 float3 toEyeSpot = normalize(gCamera.worldPosition - input.worldPosition);
@@ -204,11 +205,11 @@ PixelShaderOutput main(VertexShaderOutput input)
         // 環境マップの色を加算
         output.color.rgb += environmentColor.rgb * gMaterial.environmentCoefficient;
         
-        output.color.a = gMaterial.color.a * textureColor.a;
+        output.color.a = materialColor.a * textureColor.a;
     }
     else
     {
-        output.color = gMaterial.color * textureColor;
+        output.color = materialColor * textureColor;
     }
     if (textureColor.a == 0.0f)
     {
@@ -4,4 +4,5 @@ struct VertexShaderOutput
     float2 texcoord : TEXCOORD0;
     float3 normal : NORMAL0;
     float3 worldPosition : POSITION0;
+    float4 color : COLOR0; // インスタンスごとの色（マテリアルの色に掛ける）
 };
\ No newline at end of file
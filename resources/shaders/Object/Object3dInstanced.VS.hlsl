@@ -0,0 +1,36 @@
+#include"object3d.hlsli"
+
+struct InstanceForGPU
+{
+    float4x4 WVP;
+    float4x4 World;
+    float4x4 WorldInverseTranspose;
+    float4 color;
+};
+
+struct InstanceOffset
+{
+    uint firstInstance;
+};
+
+struct VertexShaderInput
+{
+    float4 position : POSITION0;
+    float2 texcoord : TEXCOORD0;
+    float3 normal : NORMAL0;
+};
+
+StructuredBuffer<InstanceForGPU> gInstances : register(t0);
+ConstantBuffer<InstanceOffset> gInstanceOffset : register(b0);
+
+VertexShaderOutput main(VertexShaderInput input, uint instanceId : SV_InstanceID)
+{
+    InstanceForGPU instance = gInstances[gInstanceOffset.firstInstance + instanceId];
+    VertexShaderOutput output;
+    output.position = mul(input.position, instance.WVP);
+    output.texcoord = input.texcoord;
+    output.normal = normalize(mul(input.normal, (float3x3) instance.WorldInverseTranspose));
+    output.worldPosition = mul(input.position, instance.World).xyz;
+    output.color = instance.color;
+    return output;
+}
@@ -0,0 +1,25 @@
+#include"Particle.hlsli"
+
+struct Camera
+{
+    float4x4 viewProjection;
+};
+
+struct VertexShaderInput
+{
+    float4 position : POSITION0;
+    float2 texcoord : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
+ConstantBuffer<Camera> gCamera : register(b0);
+
+// 軌跡の帯はCPUでワールド座標の頂点にしてあるので、カメラの変換だけ行う
+VertexShaderOutput main(VertexShaderInput input)
+{
+    VertexShaderOutput output;
+    output.position = mul(input.position, gCamera.viewProjection);
+    output.texcoord = input.texcoord;
+    output.color = input.color;
+    return output;
+}
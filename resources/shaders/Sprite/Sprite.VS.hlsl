@@ -1,23 +0,0 @@
-#include"Sprite.hlsli"
-
-struct TransformationMatrix
-{
-    float4x4 WVP;
-    float4x4 World;
-};
-
-struct VertexShaderInput
-{
-    float4 position : POSITION0;
-    float2 texcoord : TEXCOORD0;
-};
-
-ConstantBuffer<TransformationMatrix> gTransformationMatrix : register(b0);
-
-VertexShaderOutput main(VertexShaderInput input)
-{
-    VertexShaderOutput output;
-    output.position = mul(input.position, gTransformationMatrix.WVP);
-    output.texcoord = input.texcoord;
-    return output;
-}
\ No newline at end of file
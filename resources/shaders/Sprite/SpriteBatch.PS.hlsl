@@ -1,26 +1,18 @@
-#include"Sprite.hlsli"
-
-struct Material
-{
-    float4 color;
-    float4x4 uvTransform;
-};
+#include"SpriteBatch.hlsli"
 
 struct PixelShaderOutput
 {
     float4 color : SV_TARGET0;
 };
 
-ConstantBuffer<Material> gMaterial : register(b0);
 Texture2D<float4> gTexture : register(t0);
 SamplerState gSampler : register(s0);
 
 PixelShaderOutput main(VertexShaderOutput input)
 {
-    float4 transformedUV = mul(float4(input.texcoord, 0.0f, 1.0f), gMaterial.uvTransform);
-    float4 textureColor = gTexture.Sample(gSampler, transformedUV.xy);
+    float4 textureColor = gTexture.Sample(gSampler, input.texcoord);
     PixelShaderOutput output;
-    output.color = gMaterial.color * textureColor;
+    output.color = input.color * textureColor;
     if (textureColor.a == 0.0f)
     {
         discard;
@@ -0,0 +1,18 @@
+#include"SpriteBatch.hlsli"
+
+struct VertexShaderInput
+{
+    float4 position : POSITION0;
+    float2 texcoord : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
+// 座標変換とuvTransformはCPU側で済ませてある
+VertexShaderOutput main(VertexShaderInput input)
+{
+    VertexShaderOutput output;
+    output.position = input.position;
+    output.texcoord = input.texcoord;
+    output.color = input.color;
+    return output;
+}
@@ -2,4 +2,5 @@ struct VertexShaderOutput
 {
     float4 position : SV_POSITION;
     float2 texcoord : TEXCOORD0;
-};
\ No newline at end of file
+    float4 color : COLOR0;
+};